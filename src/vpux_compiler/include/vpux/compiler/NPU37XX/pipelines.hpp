@@ -57,6 +57,10 @@ struct ReferenceHWOptions37XX final : public ReferenceHWOptions<ReferenceHWOptio
     StrOption enableActivationSparsity{*this, "enable-activation-sparsity",
                                        llvm::cl::desc("Enable activation sparsity"), llvm::cl::init("false")};
 
+    StrOption actSparsityStatsFile{*this, "act-sparsity-stats-file",
+                                   llvm::cl::desc("JSON file with the activation zero ratios from calibration"),
+                                   llvm::cl::init("")};
+
     BoolOption enableWeightsSparsity{*this, "enable-weights-sparsity", llvm::cl::desc("Enable weights sparsity"),
                                      llvm::cl::init(false)};
 
@@ -20,6 +20,10 @@ struct DefaultHWOptionsDeviceBase : public virtual vpux::DefaultHWOptionsBase {
     StrOption enableActivationSparsity{*this, "enable-activation-sparsity",
                                        llvm::cl::desc("Enable activation sparsity"), llvm::cl::init("auto")};
 
+    StrOption actSparsityStatsFile{*this, "act-sparsity-stats-file",
+                                   llvm::cl::desc("JSON file with the activation zero ratios from calibration"),
+                                   llvm::cl::init("")};
+
     BoolOption enableWeightsSparsity{*this, "enable-weights-sparsity", llvm::cl::desc("Enable weights sparsity"),
                                      llvm::cl::init(true)};
 
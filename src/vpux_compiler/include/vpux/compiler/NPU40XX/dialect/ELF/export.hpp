@@ -25,5 +25,9 @@ namespace ELF {
 std::vector<uint8_t> exportToELF(mlir::ModuleOp module, Logger log = Logger::global());
 BlobView exportToELF(mlir::ModuleOp module, BlobAllocator& allocator, Logger log = Logger::global());
 
+// Serializes the constants of the VPU_SHT_SHARED_WEIGHTS sections into a content-addressed weights blob
+// (see SharedWeightsBlobHeader). Every distinct content is stored once.
+std::vector<uint8_t> exportSharedWeights(mlir::ModuleOp module, Logger log = Logger::global());
+
 }  // namespace ELF
 }  // namespace vpux
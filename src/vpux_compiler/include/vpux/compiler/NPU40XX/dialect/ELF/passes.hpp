@@ -27,6 +27,8 @@ namespace ELF {
 //
 
 std::unique_ptr<mlir::Pass> createMoveOpsIntoSectionsPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createDeduplicateConstBuffersPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createExternalizeConstBuffersPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createAddELFSymbolTablePass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createAddELFRelocationsPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createSetOpOffsetsPass(Logger log = Logger::global(),
@@ -26,7 +26,8 @@ std::unique_ptr<mlir::Pass> createComputeTaskStrippingPass(
 
 std::unique_ptr<mlir::Pass> createComputeHaloRegionForDPUTaskOpPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createDMATaskProfilingHwDdrPass(
-        DMAProfilingMode dmaProfilingMode = DMAProfilingMode::DISABLED, Logger log = Logger::global());
+        DMAProfilingMode dmaProfilingMode = DMAProfilingMode::DISABLED, int64_t samplingPeriod = 1,
+        Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createConstantDpuProfHwpBasePass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createCompressSpillDmaPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createDMAOutOfOrderOptimizationPass(Logger log = Logger::global());
@@ -35,10 +36,16 @@ std::unique_ptr<mlir::Pass> createUnrollClusterTilingPass(Logger log = Logger::g
 std::unique_ptr<mlir::Pass> createOptimizeConvertDMAOpPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createAddStartBarrierPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createDetectDMASplitCandidatePass(Logger log = Logger::global());
-std::unique_ptr<mlir::Pass> createSplitDMAToBalanceLoadPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createSplitDMAToBalanceLoadPass(bool enableDMACostModel = false,
+                                                            Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createLegalizeScheduleForWlmFetchDmasPass(
         const int virtualBarrierThreshold = VIRTUAL_BARRIER_THRESHOLD_WLM, Logger log = Logger::global());
 
+// ActShave L2 cache size which is available for the kernel code
+constexpr int64_t SHAVE_L2_CACHE_SIZE = 256 * 1024;
+
+std::unique_ptr<mlir::Pass> createAddSwKernelInstructionPrefetchPass(Logger log = Logger::global());
+
 //
 // Memory allocation pipeline
 //
@@ -48,11 +55,20 @@ struct MemoryAllocationOptions final : public VPUIP::MemoryAllocationOptionsBase
                                              ::llvm::cl::desc("Enable compress-activation-spill feature"),
                                              ::llvm::cl::init(false)};
 
+    BoolOption enableCompressDdrIntermediates{
+            *this, "compress-ddr-intermediates",
+            ::llvm::cl::desc("Extend compress-activation-spill to DDR-resident intermediate activations"),
+            ::llvm::cl::init(false)};
+
     MemoryAllocationOptions() = default;
 
+    // Only spill-cost-eviction is taken from the base options, the others keep their defaults as the ReferenceHW
+    // pipeline has different prefetching and pipelining defaults
     template <class OtherOptions>
-    MemoryAllocationOptions(const OtherOptions& options) {
+    explicit MemoryAllocationOptions(const OtherOptions& options) {
+        enableSpillCostEviction = options.enableSpillCostEviction;
         enableCompressActivationSpill = options.enableCompressActivationSpill;
+        enableCompressDdrIntermediates = options.enableCompressDdrIntermediates;
     }
 };
 
@@ -80,20 +96,50 @@ struct DefaultHWOptions :
     BoolOption enableActivationSwizzling{*this, "enable-activation-swizzling",
                                          ::llvm::cl::desc("Enable activation swizzling"), ::llvm::cl::init(true)};
 
+    BoolOption enableSwizzlingPlanner{*this, "enable-swizzling-planner",
+                                      ::llvm::cl::desc("Choose the swizzled buffers by the gain predicted by VPUNN"),
+                                      ::llvm::cl::init(false)};
+
     BoolOption enableCompressActivationSpill{*this, "compress-activation-spill",
                                              ::llvm::cl::desc("Enable compress-activation-spill feature"),
                                              ::llvm::cl::init(false)};
 
+    BoolOption enableCompressDdrIntermediates{
+            *this, "compress-ddr-intermediates",
+            ::llvm::cl::desc("Extend compress-activation-spill to DDR-resident intermediate activations"),
+            ::llvm::cl::init(false)};
+
     // TODO: E#118871 Switch this option to true by default
     BoolOption enableBarrierSchedWithFunctionOutlining{
             *this, "barrier-sched-with-function-outlining",
             llvm::cl::desc("Enable barrier scheduling passes with IR split into multiple functions"),
             llvm::cl::init(false)};
 
+    BoolOption enableCMXResidencyAcrossFunctionCalls{
+            *this, "cmx-residency-across-function-calls",
+            ::llvm::cl::desc("Keep the buffers passed between outlined function calls in reserved CMX"),
+            ::llvm::cl::init(false)};
+
     BoolOption enableSWKernelPrefetchingReserveMem{
             *this, "enable-sw-kernel-prefetching-reserve-mem",
             ::llvm::cl::desc("Reserve memory at the end of CMX for SW Kernel data prefetching"),
             ::llvm::cl::init(true)};
+
+    BoolOption enableSWKernelInstructionPrefetch{
+            *this, "enable-sw-kernel-instruction-prefetch",
+            ::llvm::cl::desc("Regroup SW tasks by kernel and prefetch SW kernel code ahead of predicted cache misses"),
+            ::llvm::cl::init(false)};
+
+    BoolOption enableWlmTimelinePlacement{
+            *this, "enable-wlm-timeline-placement",
+            ::llvm::cl::desc("Place workload management fetch tasks using the barrier release cycles predicted by "
+                             "the inference execution simulation"),
+            ::llvm::cl::init(false)};
+
+    BoolOption enableDMACostModel{
+            *this, "enable-dma-cost-model",
+            ::llvm::cl::desc("Split DMAs and assign their DMA ports by the cycles predicted by the DMA transfer model"),
+            ::llvm::cl::init(false)};
 };
 
 void buildDefaultHWPipeline(mlir::OpPassManager& pm, const DefaultHWOptions& options, Logger log = Logger::global());
@@ -60,6 +60,10 @@ struct ReferenceHWOptions40XX final : public ReferenceHWOptions<ReferenceHWOptio
     StrOption enableActivationSparsity{*this, "enable-activation-sparsity",
                                        llvm::cl::desc("Enable activation sparsity"), llvm::cl::init("false")};
 
+    StrOption actSparsityStatsFile{*this, "act-sparsity-stats-file",
+                                   llvm::cl::desc("JSON file with the activation zero ratios from calibration"),
+                                   llvm::cl::init("")};
+
     BoolOption enableWeightsSparsity{*this, "enable-weights-sparsity", llvm::cl::desc("Enable weights sparsity"),
                                      llvm::cl::init(false)};
 
@@ -75,6 +79,11 @@ struct ReferenceHWOptions40XX final : public ReferenceHWOptions<ReferenceHWOptio
                                              ::llvm::cl::desc("Enable compress-activation-spill feature"),
                                              ::llvm::cl::init(false)};
 
+    BoolOption enableCompressDdrIntermediates{
+            *this, "compress-ddr-intermediates",
+            ::llvm::cl::desc("Extend compress-activation-spill to DDR-resident intermediate activations"),
+            ::llvm::cl::init(false)};
+
     BoolOption enableFuseClampOperations{*this, "enable-fuse-clamp-op", llvm::cl::desc("Enable fuse clamp operations"),
                                          llvm::cl::init(false)};
 
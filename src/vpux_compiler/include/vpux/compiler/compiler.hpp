@@ -6,8 +6,12 @@
 #pragma once
 
 #include "intel_npu/al/icompiler.hpp"
+#include "vpux/compiler/utils/ELF/predicted_performance.hpp"
+#include "vpux/utils/core/array_ref.hpp"
 #include "vpux/utils/core/mem_size.hpp"
 
+#include <optional>
+
 namespace vpux {
 
 class BlobAllocator {
@@ -69,6 +73,9 @@ public:
 
     intel_npu::NetworkMetadata parse(const std::vector<uint8_t>& network, const intel_npu::Config&) const final;
 
+    // intel_npu::NetworkMetadata has no place for it, so the prediction is parsed separately
+    std::optional<PredictedPerformance> parsePredictedPerformance(ArrayRef<uint8_t> network) const;
+
     std::vector<ov::ProfilingInfo> process_profiling_output(const std::vector<uint8_t>& profData,
                                                             const std::vector<uint8_t>& network,
                                                             const intel_npu::Config& config) const final;
@@ -14,9 +14,15 @@ constexpr StringLiteral DPUCost = "minimumHardwareExecutionCost";
 constexpr StringLiteral cycleCostAttrName = "cycleCost";
 constexpr StringLiteral cycleBegin = "cycleBegin";
 constexpr StringLiteral cycleEnd = "cycleEnd";
+constexpr StringLiteral barrierReleaseCycle = "releaseCycle";
+constexpr StringLiteral profiledCycleCost = "profiledCycleCost";
+constexpr StringLiteral profiledCostScale = "profiledCostScale";
 
 size_t getDMACost(mlir::Value input, mlir::Value output, VPU::ArchKind archKind,
                   std::shared_ptr<VPUNN::VPUCostModel> costModel);
+// Transfer between buffers which are not segmented over several clusters
+size_t getDMACost(vpux::NDTypeInterface inputType, vpux::NDTypeInterface outputType, VPU::ArchKind archKind,
+                  const std::shared_ptr<VPUNN::VPUCostModel>& costModel);
 size_t getDMACost(vpux::NDTypeInterface tensorType, VPUNN::VPUDevice vpuDevice,
                   const std::shared_ptr<VPUNN::VPUCostModel>& costModel, int64_t numDMAPorts);
 size_t getDPUCost(mlir::Operation* op);
@@ -281,9 +281,10 @@ public:
     };
     // Struct storing eviction policy info for buffers
     struct EvictionCandidate {
-        EvictionCandidate(size_t priority, size_t earliestConsumerIdx, size_t size, operationIdxType bufferWriterIdx,
-                          size_t outputIdx, mlir::Value buffer)
+        EvictionCandidate(size_t priority, double spillCost, size_t earliestConsumerIdx, size_t size,
+                          operationIdxType bufferWriterIdx, size_t outputIdx, mlir::Value buffer)
                 : priority_(priority),
+                  spillCost_(spillCost),
                   earliestConsumerIdx_(earliestConsumerIdx),
                   size_(size),
                   bufferWriterIdx_(bufferWriterIdx),
@@ -291,6 +292,8 @@ public:
                   buffer_(buffer) {
         }
         size_t priority_;
+        // DMA cycles per freed byte weighted by distance to next use, 0 if spill cost eviction is disabled
+        double spillCost_;
         operationIdxType earliestConsumerIdx_;
         size_t size_;
         operationIdxType bufferWriterIdx_;
@@ -305,6 +308,11 @@ public:
                 return ec1.priority_ > ec2.priority_;
             }
 
+            // cheaper spill per freed byte
+            if (ec1.spillCost_ != ec2.spillCost_) {
+                return ec1.spillCost_ < ec2.spillCost_;
+            }
+
             // last first consumer
             if (ec1.earliestConsumerIdx_ != ec2.earliestConsumerIdx_) {
                 return ec1.earliestConsumerIdx_ > ec2.earliestConsumerIdx_;
@@ -329,7 +337,8 @@ public:
     FeasibleMemoryScheduler(VPU::MemoryKind memKind, VPU::MemoryKind secondLvlMemKind, MemLiveRangeInfo& liveRangeInfo,
                             AsyncDepsInfo& depsInfo, Logger log, LinearScan<mlir::Value, LinearScanHandler>& scan,
                             VPU::ArchKind arch, std::shared_ptr<VPUNN::VPUCostModel> costModel, int64_t nceClusterCount,
-                            int64_t dmaCount, bool enableScheduleStatistics, bool optimizeFragmentation);
+                            int64_t dmaCount, bool enableScheduleStatistics, bool optimizeFragmentation,
+                            bool enableSpillCostEviction = false);
 
 public:
     ScheduledOpInfoVec generateSchedule();
@@ -406,6 +415,7 @@ private:
     // eviction utility
     void evictActiveOp(EvictionCandidate evictionCandidate);
     size_t evictionPriority(operationIdxType writerOpIdx, mlir::Value buffer);
+    double evictionSpillCost(operationIdxType writerOpIdx, mlir::Value buffer, size_t earliestConsumerIdx);
     EvictionCandidate chooseCandidateForEviction(const mlir::DenseSet<mlir::Value>& aliveBuffers);
     void forceScheduleActiveOpEviction();
     size_t getOpBufferOutputIdx(operationIdxType opIdx, mlir::Value buffer);
@@ -435,6 +445,8 @@ private:
     bool _enableScheduleStatistics;
     // Flag for enabling fragmentation optimization
     bool _optimizeFragmentation;
+    // Flag for choosing eviction candidates based on spill DMA cost
+    bool _enableSpillCostEviction;
     // there are 8 barriers per cluster
     // TODO: E93149 update barrier usage
     const int64_t _barrierPerCluster = 8;
@@ -498,6 +510,8 @@ private:
     mlir::DenseMap<operationIdxType, size_t> _opIdxEndCycleMap;
 
     std::set<EvictionCandidate, EvictionPriority> _evictionCandidatesCache;
+    // buffers already spilled and not overwritten since, their DDR copy is still valid
+    mlir::DenseSet<std::pair<operationIdxType, mlir::Value>> _buffersWithDDRCopy;
 
     llvm::BitVector _isDataOp;
 };
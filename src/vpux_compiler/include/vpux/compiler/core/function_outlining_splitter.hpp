@@ -64,8 +64,10 @@ private:
 
 class FunctionOutlinerRepeatingBlocks final : public IFunctionOutliner {
 public:
+    // With hashMatching, repeating blocks are found as repeating sequences of structurally identical operations
+    // instead of iteratively merging adjacent blocks. maxNumIterations then limits the number of blocks
     FunctionOutlinerRepeatingBlocks(size_t minOpsInBlock, size_t maxNumIterations, bool separateFunctions,
-                                    bool weightsAsInputs, Logger log);
+                                    bool weightsAsInputs, Logger log, bool hashMatching = false);
 
     SmallVector<OutliningInstance> getOutliningTargets(mlir::func::FuncOp mainFunction) override;
 
@@ -75,6 +77,7 @@ private:
     bool _separateFunctions;
     bool _weightsAsInputs;
     Logger _log;
+    bool _hashMatching;
 };
 
 //
@@ -103,18 +106,22 @@ struct RepeatingBlocksOptions {
     static constexpr size_t MIN_OPS_IN_BLOCK_DEFAULT = 30;
     static constexpr size_t MAX_NUM_ITERATIONS_DEFAULT = 100;
     static constexpr bool WEIGHTS_AS_INPUTS_DEFAULT = false;
+    static constexpr bool HASH_MATCHING_DEFAULT = false;
 
     size_t minOpsInBlock;
     size_t maxNumIterations;
     bool weightsAsInputs;
+    bool hashMatching;
 };
 
 struct RepeatingBlocksSeparateFunctionsOptions {
     static constexpr size_t MIN_OPS_IN_BLOCK_DEFAULT = 30;
     static constexpr size_t MAX_NUM_ITERATIONS_DEFAULT = 100;
+    static constexpr bool HASH_MATCHING_DEFAULT = false;
 
     size_t minOpsInBlock;
     size_t maxNumIterations;
+    bool hashMatching;
 };
 
 struct BatchingOptions {};
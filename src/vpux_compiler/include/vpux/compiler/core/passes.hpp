@@ -27,6 +27,8 @@ std::unique_ptr<mlir::Pass> createSetupLocationVerifierPass(Logger log = Logger:
 std::unique_ptr<mlir::Pass> createStartLocationVerifierPass(
         vpux::Logger log, const mlir::detail::PassOptions::Option<std::string>& locationsVerificationMode);
 std::unique_ptr<mlir::Pass> createStopLocationVerifierPass(vpux::Logger log);
+std::unique_ptr<mlir::Pass> createApplyProfileGuidedCostsPass(StringRef profileFile = {},
+                                                              Logger log = Logger::global());
 
 //
 // Generated
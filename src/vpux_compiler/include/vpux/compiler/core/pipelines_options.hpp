@@ -186,6 +186,9 @@ struct ReferenceSWOptions : mlir::PassPipelineOptions<T> {
 
     StrOption modelHash{*this, "model-hash", llvm::cl::desc("Hash of model XML architecture"), llvm::cl::init("")};
 
+    StrOption modelIdentity{*this, "model-identity",
+                            llvm::cl::desc("Content hash of model XML architecture and weights"), llvm::cl::init("")};
+
     bool enableForceZMajorConcat = false;
     bool enableSwapTransposeWithFQ = false;
     bool enableAlignScales = false;
@@ -281,7 +284,7 @@ struct ReferenceHWOptions : mlir::PassPipelineOptions<T> {
                                          llvm::cl::desc("Enable optimize-slice-expand pass"), llvm::cl::init(true)};
 
     StrOption weightsSparsityHeuristic{*this, "weights-sparsity-heuristic",
-                                       llvm::cl::desc("Weights sparsity heuristic (RATIO or CMX)"),
+                                       llvm::cl::desc("Weights sparsity heuristic (RATIO, CMX or COST)"),
                                        llvm::cl::init("RATIO")};
     DoubleOption weightsSparsityThreshold{*this, "weights-sparsity-threshold",
                                           llvm::cl::desc("Threshold for ratio of sparse weights values"),
@@ -441,6 +444,9 @@ struct ReferenceHWOptions : mlir::PassPipelineOptions<T> {
 
     StrOption modelHash{*this, "model-hash", llvm::cl::desc("Hash of model XML architecture"), llvm::cl::init("")};
 
+    StrOption modelIdentity{*this, "model-identity",
+                            llvm::cl::desc("Content hash of model XML architecture and weights"), llvm::cl::init("")};
+
     BoolOption enableOpsAsDMA{*this, "enable-ops-as-dma",
                               llvm::cl::desc("Force using DMA transformations instead of SW ops"),
                               llvm::cl::init(false)};
@@ -500,6 +506,10 @@ struct ReferenceHWOptions : mlir::PassPipelineOptions<T> {
                                        ::llvm::cl::desc("Enables compiler to optimize dynamic spilling DMAs"),
                                        ::llvm::cl::init(true)};
 
+    BoolOption enableSpillCostEviction{*this, "spill-cost-eviction",
+                                       ::llvm::cl::desc("Choose spilled buffers by spill DMA cost"),
+                                       ::llvm::cl::init(false)};
+
     BoolOption linearizeSchedule{*this, "linearize-schedule", llvm::cl::desc("Linearize tasks on all engines"),
                                  llvm::cl::init(false)};
 
@@ -652,6 +662,13 @@ struct DefaultHWOptionsBase : mlir::PassPipelineOptions<DefaultHWOptionsBase> {
                                                      "Possible values: latency, efficiency (default)"),
                                       llvm::cl::init("efficiency")};
 
+    StrOption shapeBuckets{*this, "shape-buckets",
+                           llvm::cl::desc("Comma-separated buckets of the dynamic dimensions sizes, e.g. 128,256,512 "
+                                          "for the same size of every dimension or 128x64,256x64 for per-dimension "
+                                          "sizes. A static specialization of a dynamic-shape model is compiled for "
+                                          "each of them, the blob starts with the one serving all the sizes"),
+                           llvm::cl::init("")};
+
     BoolOption enableScheduleTrace{*this, "enable-schedule-trace",
                                    llvm::cl::desc("Enable compile time schedule analysis and trace"),
                                    llvm::cl::init(false)};
@@ -669,6 +686,11 @@ struct DefaultHWOptionsBase : mlir::PassPipelineOptions<DefaultHWOptionsBase> {
                                 llvm::cl::desc("Compile time schedule JSON trace file name"),
                                 llvm::cl::init("compileTimeScheduleTrace.json")};
 
+    StrOption pgoProfile{*this, "pgo-profile",
+                         llvm::cl::desc("Profiling report (JSON trace events) of a previous run of the model, used to "
+                                        "override the predicted costs of the profiled tasks"),
+                         llvm::cl::init("")};
+
     BoolOption enablePrefetching{*this, "prefetching",
                                  llvm::cl::desc("Enable prefetch tiling pass and prefetch scheduling"),
                                  llvm::cl::init(true)};
@@ -758,6 +780,9 @@ struct DefaultHWOptionsBase : mlir::PassPipelineOptions<DefaultHWOptionsBase> {
 
     StrOption modelHash{*this, "model-hash", llvm::cl::desc("Hash of model XML architecture"), llvm::cl::init("")};
 
+    StrOption modelIdentity{*this, "model-identity",
+                            llvm::cl::desc("Content hash of model XML architecture and weights"), llvm::cl::init("")};
+
     BoolOption enableMCSideLoadDump{*this, "enable-mc-side-loading-dump",
                                     llvm::cl::desc("Dump multi-cluster strategies in side-loading format"),
                                     llvm::cl::init(false)};
@@ -814,6 +839,9 @@ struct MCAndTilingOptionsBase : mlir::PassPipelineOptions<MCAndTilingOptionsBase
 
     StrOption modelHash{*this, "model-hash", llvm::cl::desc("Hash of model architecture XML"), llvm::cl::init("")};
 
+    StrOption modelIdentity{*this, "model-identity",
+                            llvm::cl::desc("Content hash of model XML architecture and weights"), llvm::cl::init("")};
+
     MCAndTilingOptionsBase() = default;
 
     template <class OtherOptions>
@@ -828,6 +856,7 @@ struct MCAndTilingOptionsBase : mlir::PassPipelineOptions<MCAndTilingOptionsBase
         writeStrategyToJson = options.writeStrategyToJson;
         enableExplicitDistributionInfoAttr = options.enableExplicitDistributionInfoAttr;
         modelHash = options.modelHash;
+        modelIdentity = options.modelIdentity;
         enableMCSideLoadDump = options.enableMCSideLoadDump;
     }
 };
@@ -850,6 +879,16 @@ struct BackendCompilationOptionsBase : mlir::PassPipelineOptions<T> {
     StrOption enableShaveDDRAccessOptimization{
             *this, "enable-shave-ddr-access-optimization",
             llvm::cl::desc("SHAVE DDR access optimization option (true, false or auto)"), llvm::cl::init("true")};
+
+    BoolOption enableConstBufferDeduplication{
+            *this, "enable-const-buffer-deduplication",
+            llvm::cl::desc("Merge byte-identical constant buffers in the ELF constant sections"), llvm::cl::init(true)};
+
+    BoolOption enableSharedWeights{*this, "enable-shared-weights",
+                                   llvm::cl::desc("Keep the constants out of the blob and reference them by content "
+                                                  "hash from a separate shared weights blob. Supported only by "
+                                                  "vpux-translate --export-ELF-shared-weights"),
+                                   llvm::cl::init(false)};
 };
 
 }  // namespace vpux
@@ -24,7 +24,7 @@ class PrefetchDataOps final {
     using scheduledOps = vpux::FeasibleMemoryScheduler::ScheduledOpInfoVec;
 
 public:
-    explicit PrefetchDataOps(scheduledOps& initialSchedule, AsyncDepsInfo& depsInfo);
+    explicit PrefetchDataOps(scheduledOps& initialSchedule, AsyncDepsInfo& depsInfo, size_t lookahead = 0);
 
 public:
     void enableDataOpPrefetching();
@@ -104,6 +104,8 @@ private:
     void sortOps(SmallVector<CycleInfo>& toBeSorted);
     // create a new order for IR
     SmallVector<CycleInfo> getNewOrder();
+    // create a new order for IR where prefetches are planned for next compute ops within lookahead window
+    SmallVector<CycleInfo> getLookaheadOrder();
     // reorder IR such that prefetch DMAs are before compute
     void reorderToPrefetch(ArrayRef<CycleInfo> sortedOpCycles);
 
@@ -118,11 +120,18 @@ private:
     mlir::DenseSet<size_t> _dataOpIdx;
     mlir::DenseSet<size_t> _computeExecutorKindOpIdx;
     mlir::DenseMap<size_t, size_t> _operationCycleCost;
+    // used by lookahead planning
+    mlir::DenseMap<size_t, size_t> _dataOpDMACost;
+    mlir::DenseMap<size_t, size_t> _dataOpSize;
+    mlir::DenseMap<size_t, uint8_t> _dataOpQueueId;
+    mlir::DenseMap<size_t, size_t> _freeCmx;
 
     // used for prefetching
     bool _prefetchOpsDefined = false;
     // for compute op prefetch DMAs until next X compute executor kind op cycle begin
     const size_t _advanceComputeExecutorKindOpsForPrefetch = 2;
+    // number of compute executor kind ops to plan prefetches for, 0 disables lookahead planning
+    size_t _lookahead;
     // used to represent a stall
     const size_t _cycleInfoStallDummyOp = std::numeric_limits<size_t>::max();
     // FIFO or pipeline storage
@@ -0,0 +1,45 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <llvm/ADT/StringMap.h>
+
+#include <optional>
+
+namespace vpux {
+
+/**
+ * @brief Measured task durations of a previous run of the same model.
+ *
+ * Built from the JSON trace events report produced by the profiling parser. Tasks are identified by their name
+ * without the cluster and variant suffixes, which matches the location of the task before it gets unrolled per
+ * cluster. Layers are identified by the original layer name, their duration is the sum of their DPU and SHAVE tasks.
+ */
+class ProfilingReport {
+public:
+    static ProfilingReport parse(StringRef fileName, Logger log = Logger::global());
+
+    std::optional<double> getTaskDurationNs(StringRef taskName) const;
+    std::optional<double> getLayerDurationNs(StringRef layerName) const;
+
+    size_t getNumTasks() const {
+        return _taskDurationsNs.size();
+    }
+
+private:
+    llvm::StringMap<double> _taskDurationsNs;
+    llvm::StringMap<double> _layerDurationsNs;
+};
+
+// Profiled durations are converted to the DPU clock cycles used by the cost model
+inline double convertNanoSecondsToCycles(double durationNs, double freqInMHz) {
+    return durationNs * freqInMHz / 1000.0;
+}
+
+}  // namespace vpux
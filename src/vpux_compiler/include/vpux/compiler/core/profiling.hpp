@@ -9,6 +9,7 @@
 #include "vpux/compiler/dialect/VPURT/IR/task.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 #include "vpux/compiler/utils/strings.hpp"
+#include "vpux/utils/core/numeric.hpp"
 #include "vpux/utils/profiling/common.hpp"
 
 namespace vpux {
@@ -124,4 +125,25 @@ bool isProfilingEnabled(IE::CNNNetworkOp netOp);
  *
  */
 std::optional<VPUIP::ProfilingSectionOp> getProfilingSection(mlir::ModuleOp module, profiling::ExecutorType secType);
+
+// Sampled DPU profiling instruments only every N-th NCE task. The period and the number of NCE tasks are kept on the
+// module, so the profiling metadata can check that the expected subset of tasks was instrumented
+struct DpuProfilingSampling {
+    int64_t samplingPeriod;
+    int64_t numTasks;
+
+    int64_t getNumSampledTasks() const {
+        return divUp(numTasks, samplingPeriod);
+    }
+};
+
+void setDpuProfilingSampling(mlir::ModuleOp module, const DpuProfilingSampling& sampling);
+
+/**
+ * @brief return DPU profiling sampling recorded by DPUProfilingPass
+ *
+ * @return sampling information, if DPU profiling was sampled, otherwise - empty value.
+ *
+ */
+std::optional<DpuProfilingSampling> getDpuProfilingSampling(mlir::ModuleOp module);
 }  // namespace vpux
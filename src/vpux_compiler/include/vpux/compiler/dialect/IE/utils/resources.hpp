@@ -140,6 +140,22 @@ memory_resource_if<Enum> getSWKernelPrefetchingReservedMemory(mlir::ModuleOp mai
 
 SmallVector<MemoryResourceOp> getSWKernelPrefetchingReservedMemory(mlir::ModuleOp mainModule);
 
+//
+// CMX residency reserved memory
+//
+static constexpr StringLiteral cmxResidencyResMemModuleName = "CMXResidencyReservedMemory";
+
+IE::MemoryResourceOp setCMXResidencyReservedMemory(mlir::ModuleOp mainModule, mlir::SymbolRefAttr memSpace,
+                                                   int64_t size);
+
+IE::MemoryResourceOp getCMXResidencyReservedMemory(mlir::ModuleOp mainModule, mlir::SymbolRefAttr memSpace);
+
+template <typename Enum>
+memory_resource_if<Enum> getCMXResidencyReservedMemory(mlir::ModuleOp mainModule, Enum kind) {
+    return getCMXResidencyReservedMemory(mainModule,
+                                         mlir::SymbolRefAttr::get(mainModule.getContext(), stringifyEnum(kind)));
+}
+
 //
 // ExecutorResourceOp
 //
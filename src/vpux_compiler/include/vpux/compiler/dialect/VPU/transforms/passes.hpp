@@ -37,6 +37,9 @@ struct ActivationSparsityOptions : mlir::PassPipelineOptions<ActivationSparsityO
                                        llvm::cl::desc("Enable activation sparsity"), llvm::cl::init("auto")};
     StrOption actSparsityProfile{*this, "act-sparsity-profile", llvm::cl::desc("Activation sparsity profile"),
                                  llvm::cl::init("NONE")};
+    StrOption actSparsityStatsFile{*this, "act-sparsity-stats-file",
+                                   llvm::cl::desc("JSON file with the activation zero ratios from calibration"),
+                                   llvm::cl::init("")};
 
     ActivationSparsityOptions() = default;
 
@@ -44,6 +47,7 @@ struct ActivationSparsityOptions : mlir::PassPipelineOptions<ActivationSparsityO
     explicit ActivationSparsityOptions(const OtherOptions& options) {
         enableActivationSparsity = options.enableActivationSparsity;
         actSparsityProfile = options.actSparsityProfile;
+        actSparsityStatsFile = options.actSparsityStatsFile;
     }
 };
 
@@ -53,7 +57,7 @@ struct ActivationSparsityOptions : mlir::PassPipelineOptions<ActivationSparsityO
 
 struct WeightsSparsityOptions : mlir::PassPipelineOptions<WeightsSparsityOptions> {
     StrOption weightsSparsityHeuristic{*this, "weights-sparsity-heuristic",
-                                       llvm::cl::desc("Weights sparsity heuristic (ratio or cmx)"),
+                                       llvm::cl::desc("Weights sparsity heuristic (ratio, cmx or cost)"),
                                        llvm::cl::init("ratio")};
     DoubleOption weightsSparsityThreshold{*this, "weights-sparsity-threshold",
                                           llvm::cl::desc("Weights sparsity threshold")};
@@ -104,6 +108,9 @@ struct TilingOptions : mlir::PassPipelineOptions<TilingOptions> {
 
     StrOption modelHash{*this, "model-hash", llvm::cl::desc("Hash of model XML architecture"), llvm::cl::init("")};
 
+    StrOption modelIdentity{*this, "model-identity",
+                            llvm::cl::desc("Content hash of model XML architecture and weights"), llvm::cl::init("")};
+
     TilingOptions() = default;
 
     template <class OtherOptions>
@@ -117,6 +124,7 @@ struct TilingOptions : mlir::PassPipelineOptions<TilingOptions> {
         readStrategyFromJson = options.readStrategyFromJson;
         writeStrategyToJson = options.writeStrategyToJson;
         modelHash = options.modelHash;
+        modelIdentity = options.modelIdentity;
     }
 };
 
@@ -263,6 +271,7 @@ std::unique_ptr<mlir::Pass> createAdjustMemorySpacePass(Logger log = Logger::glo
 std::unique_ptr<mlir::Pass> createMultiClusterStrategyAssignmentPass(bool enablePrefetchTiling = true,
                                                                      bool enableMcSideLoadingDump = false,
                                                                      StringRef modelHash = "",
+                                                                     StringRef modelIdentity = "",
                                                                      Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createManualStrategyUtilsPass();
 std::unique_ptr<mlir::Pass> createManualStrategyUtilsPass(bool writeStrategyToJSON,
@@ -270,14 +279,14 @@ std::unique_ptr<mlir::Pass> createManualStrategyUtilsPass(bool writeStrategyToJS
                                                           bool readStrategyFromJSON = false,
                                                           StringRef readStrategyFileLocation = "strategy_in.json",
                                                           bool enableSideLoadDump = false, StringRef modelHash = "",
-                                                          Logger log = Logger::global());
+                                                          StringRef modelIdentity = "", Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createManualStrategyUtilsPass(bool writeStrategyToJSON,
                                                           StringRef writeStrategyFileLocation = "strategy_out.json",
                                                           bool readStrategyFromJSON = false,
                                                           StringRef readStrategyFileLocation = "strategy_in.json",
                                                           bool updateStrategyForOutputPipelining = false,
                                                           bool enableSideLoadDump = false, StringRef modelHash = "",
-                                                          Logger log = Logger::global());
+                                                          StringRef modelIdentity = "", Logger log = Logger::global());
 
 std::unique_ptr<mlir::Pass> createDetectionOutputDecompositionPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createSplitGRUSequencePass(Logger log = Logger::global());
@@ -313,7 +322,8 @@ std::unique_ptr<mlir::Pass> createOptimizeSparsityOpsPass(SparsityProfileCreateF
 std::unique_ptr<mlir::Pass> createWrapOpsInSparsifyDesparsifyPairsPass();
 std::unique_ptr<mlir::Pass> createWrapOpsInSparsifyDesparsifyPairsPass(
         VPU::EnableActivationSparsityMode enableActivationSparsityMode,
-        VPU::ActivationSparsityProfile actSparsityProfile, Logger log = Logger::global());
+        VPU::ActivationSparsityProfile actSparsityProfile, StringRef sparsityStatsFile = "",
+        Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createAddSparsityMapToSparseActivationsPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createLowerSparsityOpsPass(std::optional<bool> fakeSparsify = std::nullopt,
                                                        Logger log = Logger::global());
@@ -348,6 +358,8 @@ std::unique_ptr<mlir::Pass> createEnsureNCEOpsSizeRequirementsPass(Logger log =
 std::unique_ptr<mlir::Pass> createFuseClampPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createOptimizeConcatPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createStrategyManagerImplPass(bool enablePrefetchTiling = true,
+                                                          bool enableVerticalFusion = false,
+                                                          bool enableVerticalFusionPipelining = false,
                                                           Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createEfficientIROrderPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createRemoveOutputSparseToAvoidSuboptimalDPUWorkloadsPass(Logger log = Logger::global());
@@ -427,7 +439,7 @@ struct DefaultHWOptionsDialectBase : public virtual vpux::DefaultHWOptionsBase {
 
     // WeightsSparsityOptions
     StrOption weightsSparsityHeuristic{*this, "weights-sparsity-heuristic",
-                                       llvm::cl::desc("Weights sparsity heuristic (RATIO or CMX)"),
+                                       llvm::cl::desc("Weights sparsity heuristic (RATIO, CMX or COST)"),
                                        llvm::cl::init("RATIO")};
 
     DoubleOption weightsSparsityThreshold{*this, "weights-sparsity-threshold",
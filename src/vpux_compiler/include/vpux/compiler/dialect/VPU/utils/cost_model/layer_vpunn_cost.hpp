@@ -70,6 +70,7 @@ public:
 
     /*
      *  Get the cost for operation for particular parameters
+     *  The cost is corrected by the profiled cost scale of the operation, if any
      */
     StrategyCost getStrategyCost(mlir::Operation* operation, const VPUNNCostParameters& parameters) const;
 
@@ -92,6 +93,11 @@ public:
                                      std::function<bool(mlir::Value value)> findOperand = nullptr) const;
 
 private:
+    /*
+     *  Get the cost model estimation for operation for particular parameters
+     */
+    StrategyCost getEstimatedStrategyCost(mlir::Operation* operation, const VPUNNCostParameters& parameters) const;
+
     /*
      *  Get the cost of NCE operation.
      *   In case tiling is passed, cost is taken with tiling parameters
@@ -26,7 +26,8 @@ void updateTilingStrategyInJSONForOperations(llvm::json::Value& json,
                                              llvm::MapVector<mlir::Location, mlir::Operation*>& operations);
 
 void saveMCSideLoadStrategyToFile(mlir::func::FuncOp func, StringRef strategyJsonPath,
-                                  const mlir::DenseMap<mlir::Operation*, size_t>& opToHash, StringRef modelHash);
+                                  const mlir::DenseMap<mlir::Operation*, size_t>& opToHash, StringRef modelHash,
+                                  StringRef modelIdentity);
 
 }  // namespace VPU
 }  // namespace vpux
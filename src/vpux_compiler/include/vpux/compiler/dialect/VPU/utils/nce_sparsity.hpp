@@ -103,18 +103,39 @@ int32_t toHex(double realVal);
 // RuntimeSparsityStatsProvider
 //
 
+// Zero ratios of the layer inputs, taken from the IE.SparsityStatistics of the module and optionally from a
+// calibration file. The file is a JSON object with the same layout as the activation sparsity runtime info:
+// {"<id>": {"node_name": "Conv_1", "port_id": 0, "statistic": 0.45}, ...}
+// Entries of the file take precedence over the statistics of the module
 class RuntimeSparsityStatsProvider {
     const double MINIMAL_SPARSITY_THRESHOLD = 0.2;
+    // The sparsity map is written by the producer and read by the consumer
+    const double SPARSITY_MAP_ACCESSES = 2.0;
+    // The non-zero values of a storage element are packed and accessed in chunks of this size
+    const double SPARSE_DATA_ALIGNMENT = 16.0;
+
+    struct SparsityInfo {
+        int64_t inputId;
+        double ratio;
+    };
 
 public:
-    RuntimeSparsityStatsProvider(mlir::func::FuncOp func, vpux::Logger log);
+    RuntimeSparsityStatsProvider(mlir::func::FuncOp func, vpux::Logger log, StringRef statsFileName = "");
 
     bool containsStatistics() const;
+    std::optional<double> getSparsityRatio(mlir::Operation* op, int64_t requestedInputId) const;
     bool likelySparsityConsumer(mlir::Operation* op, int64_t requestedInputId) const;
+    // Compares the data the consumer does not have to fetch because of the zero values, with the compressed storage
+    // elements rounded up to SPARSE_DATA_ALIGNMENT, against the traffic of the sparsity map, which has one bit per
+    // element. The input must be written sparse by the ODU of an NCE producer, any other Sparsify costs an extra task
+    bool profitableSparsityConsumer(mlir::Operation* op, int64_t requestedInputId) const;
+
+private:
+    void loadStatisticsFile(StringRef statsFileName);
 
 private:
     vpux::Logger _logger;
-    std::multimap<std::string, IE::SparsityInfoOp> _lookup;
+    std::multimap<std::string, SparsityInfo> _lookup;
 };
 
 }  // namespace NCESparsity
@@ -14,7 +14,9 @@
 namespace vpux {
 namespace VPU {
 
-enum class EnableActivationSparsityMode { AUTO, TRUE, FALSE };
+// AUTO enables sparse inputs which are likely to be sparse according to the statistics,
+// COST enables them only when the predicted savings exceed the overhead of the sparsity map
+enum class EnableActivationSparsityMode { AUTO, COST, TRUE, FALSE };
 
 EnableActivationSparsityMode getActSparsityMode(std::string enableActivationSparsityOption);
 EnableActivationSparsityMode getActSparsityMode(const StrOption& enableActivationSparsityOption);
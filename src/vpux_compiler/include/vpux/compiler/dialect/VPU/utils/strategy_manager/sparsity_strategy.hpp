@@ -9,6 +9,7 @@
 #include "vpux/compiler/dialect/IE/IR/attributes.hpp"
 #include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
 #include "vpux/compiler/dialect/VPU/IR/ops.hpp"
+#include "vpux/compiler/dialect/VPU/utils/cost_model/layer_vpunn_cost.hpp"
 #include "vpux/compiler/dialect/VPU/utils/nce_sparsity.hpp"
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
 
@@ -94,6 +95,29 @@ private:
     std::optional<double> _manualThreshold;
 };
 
+// Made decision on the predicted latency of the layer
+// shouldSparsifyWeights only filters out the weights which can't benefit from sparsity, the final decision is taken by
+// comparing getLayerCost of the operation with dense and with sparse weights. The cost is the cheapest combination of
+// multi-cluster strategy and tiling, so that the smaller CMX footprint of sparse weights is taken into account
+class CostBasedWeightsSparsityStrategy : public BaseWeightsSparsityStrategy {
+public:
+    CostBasedWeightsSparsityStrategy(mlir::func::FuncOp func, std::optional<double> manualThreshold = std::nullopt,
+                                     Logger log = Logger::global());
+
+    bool shouldSparsifyWeights(Logger& log, vpux::NDTypeInterface weightsType, ArrayRef<int64_t> numNonSparseElemsPerOC,
+                               bool hasFloatInput) override;
+
+    // Temporarily sets the multi-cluster strategies on the operation, so it must not be called concurrently
+    StrategyCost getLayerCost(VPU::NCEOpInterface nceOp) const;
+
+private:
+    VPU::LayerVPUNNCost _costModel;
+    SmallVector<VPU::MultiClusterStrategy> _strategies;
+    int64_t _numTiles;
+    std::optional<double> _manualThreshold;
+    Logger _log;
+};
+
 }  // namespace NCESparsity
 
 }  // namespace VPU
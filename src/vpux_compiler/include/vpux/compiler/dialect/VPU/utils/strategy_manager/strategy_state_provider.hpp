@@ -24,8 +24,13 @@ class LayerVPUNNCost;
 class DefaultStateProvider : public IStateProvider {
 public:
     DefaultStateProvider(const std::shared_ptr<OperationStrategies>& storage,
-                         const std::shared_ptr<LayerVPUNNCost>& costModel)
-            : _storage(storage), _costModel(costModel), _generator(0) {
+                         const std::shared_ptr<LayerVPUNNCost>& costModel, bool enableVerticalFusion = false,
+                         bool enableVFPipelining = false)
+            : _storage(storage),
+              _costModel(costModel),
+              _enableVerticalFusion(enableVerticalFusion),
+              _enableVFPipelining(enableVFPipelining),
+              _generator(0) {
     }
 
     /*
@@ -97,6 +102,13 @@ private:
 
     bool spillAroundConcat(mlir::Operation* operation) const;
 
+    /*
+      Get cost of keeping tensor between operations in CMX by fusing them vertically
+      with tiling derived from their strategies. Returns std::nullopt if they can't be fused
+    */
+    std::optional<StrategyCost> getVFTransitionCost(const OperationStrategy& parentState,
+                                                    const OperationStrategy& childState) const;
+
     /*
       Check if there is no spill between strategies
     */
@@ -139,6 +151,16 @@ private:
     */
     std::shared_ptr<LayerVPUNNCost> _costModel;
 
+    /*
+      Take vertical fusion into account for transitions which would otherwise spill
+    */
+    bool _enableVerticalFusion;
+
+    /*
+      Estimate fused operations as VF pipeline
+    */
+    bool _enableVFPipelining;
+
     /*
       Store neighbours for each operation
     */
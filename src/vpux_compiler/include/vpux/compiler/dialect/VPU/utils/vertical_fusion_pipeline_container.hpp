@@ -27,6 +27,7 @@ public:
 
     // get max cost of operations from the container
     StrategyCost maxCost(const std::unique_ptr<VPU::LayerVPUNNCost>& costFunction) const;
+    StrategyCost maxCost(const VPU::LayerVPUNNCost& costFunction) const;
 
     // compare two containers
     bool operator<(const VFPipelineContainer& o) const;
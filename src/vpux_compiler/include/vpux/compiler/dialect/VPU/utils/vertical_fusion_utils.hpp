@@ -94,6 +94,13 @@ VPU::VerticalFusionOp fuseOpsInBlock(mlir::PatternRewriter& rewriter, VPU::Verti
 StrategyCost getVFCost(const std::unique_ptr<VPU::LayerVPUNNCost>& costFunction, VPU::VerticalFusionOp op, Logger log,
                        bool prefetching = true, mlir::ArrayAttr tilingStrategy = nullptr);
 
+// calculate cost of operations executed tile by tile in VF pipeline: tile N of an operation
+// shares the container with tile N + 1 of its producer, each container costs as its busiest engine
+// tilesCostParams contains cost parameters for each tile of each operation
+StrategyCost getPipelinedCost(ArrayRef<mlir::Operation*> operations,
+                              ArrayRef<SmallVector<VPUNNCostParameters>> tilesCostParams,
+                              const VPU::LayerVPUNNCost& costFunction);
+
 // validate if subgraph doesn't have spills
 bool validateCMXSize(VFConfig& config, const TilingOperationStorage::UPtr& opStorage, Logger log,
                      Byte reservedMemory = Byte(0));
@@ -77,7 +77,8 @@ std::unique_ptr<mlir::Pass> createDMATaskProfilingReserveMemPass(
 std::unique_ptr<mlir::Pass> createDMATaskProfilingAfterBarrierSchedPass(
         DMAProfilingMode dmaProfilingMode = DMAProfilingMode::DISABLED, Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createCaptureWorkpointPass(Logger log = Logger::global());
-std::unique_ptr<mlir::Pass> createDPUProfilingPass(MemKindCreateFunc memKindCb, Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createDPUProfilingPass(MemKindCreateFunc memKindCb, int64_t samplingPeriod = 1,
+                                                   Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createGroupProfilingBuffersPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createActShaveProfilingPass(MemKindCreateFunc memKindCb, Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createWrapWithPermuteAsNNDMAPass(Logger log = Logger::global());
@@ -86,6 +87,7 @@ std::unique_ptr<mlir::Pass> createConvertExpandPass(Logger log = Logger::global(
 std::unique_ptr<mlir::Pass> createConvertToDMAPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createSwizzlingPass(const bool enableWeightSwizzling = true,
                                                 const bool enableActivationSwizzling = true,
+                                                const bool enableSwizzlingPlanner = false,
                                                 Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createOperationStubbingPass(ConditionFunc condition = makeStubCondition(),
                                                         Logger log = Logger::global());
@@ -100,12 +102,15 @@ std::unique_ptr<mlir::Pass> createConvertSETablesToConstantsPass(Logger log = Lo
 std::unique_ptr<mlir::Pass> createAdjustInputDataForExplicitSETablePass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createTileActShaveKernelTaskPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createSegmentHalosPass(Logger log = Logger::global());
-std::unique_ptr<mlir::Pass> createAdjustSpillSizePass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createAdjustSpillSizePass(const bool compressDdrIntermediates = false,
+                                                      Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createCompressDmaReserveMemPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createSWKernelPrefetchingReserveMemPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createFuseDDRCopiesIntoConcats(Logger log = Logger::global());
 
 std::unique_ptr<mlir::Pass> createLegalizeRepeatingFuncCallsPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createPlanCMXResidencyAcrossFunctionCallsPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createResolveCMXResidencyOffsetsPass(Logger log = Logger::global());
 
 std::unique_ptr<mlir::Pass> createAddCopyBetweenSWKernelsAndNetworkIOPass(Logger log = Logger::global());
 
@@ -146,7 +151,7 @@ std::unique_ptr<mlir::Pass> createFeasibleAllocationPass(
         MemKindCreateFunc memKindCb, MemKindCreateFunc secondLvlMemKindCb = nullptr,
         const bool linearizeSchedule = false, const bool enablePipelining = true, const bool enablePrefetching = true,
         const bool optimizeFragmentation = true, const bool optimizeDynamicSpilling = true,
-        Logger log = Logger::global());
+        const bool enableSpillCostEviction = false, Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createQueryArgsAllocationAnalysisPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createStaticAllocationPass(MemKindCreateFunc memKindCb, Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createCollectUsedMemoryPass(Logger log = Logger::global());
@@ -173,6 +178,9 @@ struct DefaultHWOptionsDialectBase : public virtual vpux::DefaultHWOptionsBase {
     BoolOption enableM2IProfiling{*this, "m2i-profiling", llvm::cl::desc("Enable M2I task profiling"),
                                   llvm::cl::init(true)};
 
+    IntOption profilingSamplingPeriod{*this, "profiling-sampling-period",
+                                      llvm::cl::desc("Profile every N-th DPU and DMA task only"), llvm::cl::init(1)};
+
     BoolOption enableOptimizeCopies{*this, "optimize-copies", llvm::cl::desc("Enable optimize-copies pass"),
                                     llvm::cl::init(true)};
 
@@ -197,6 +205,10 @@ struct DefaultHWOptionsDialectBase : public virtual vpux::DefaultHWOptionsBase {
                                        ::llvm::cl::desc("Enables compiler to optimize dynamic spilling DMAs"),
                                        ::llvm::cl::init(true)};
 
+    BoolOption enableSpillCostEviction{*this, "spill-cost-eviction",
+                                       ::llvm::cl::desc("Choose spilled buffers by spill DMA cost"),
+                                       ::llvm::cl::init(false)};
+
     BoolOption linearizeSchedule{*this, "linearize-schedule", llvm::cl::desc("Linearize tasks on all engines"),
                                  llvm::cl::init(false)};
 
@@ -49,6 +49,10 @@ struct MemoryAllocationOptionsBase : mlir::PassPipelineOptions<MemoryAllocationO
                                        ::llvm::cl::desc("Enables compiler to optimize dynamic spilling DMAs"),
                                        ::llvm::cl::init(true)};
 
+    BoolOption enableSpillCostEviction{*this, "spill-cost-eviction",
+                                       ::llvm::cl::desc("Choose spilled buffers by spill DMA cost"),
+                                       ::llvm::cl::init(false)};
+
     BoolOption enableGroupAsyncExecuteOps{*this, "group-async-execute-ops",
                                           llvm::cl::desc("Enable group-async-execute-ops pass"), llvm::cl::init(false)};
 
@@ -60,6 +64,7 @@ struct MemoryAllocationOptionsBase : mlir::PassPipelineOptions<MemoryAllocationO
         enablePrefetching = options.enablePrefetching;
         enablePipelining = options.enablePipelining;
         optimizeDynamicSpilling = options.optimizeDynamicSpilling;
+        enableSpillCostEviction = options.enableSpillCostEviction;
         enableGroupAsyncExecuteOps = options.enableGroupAsyncExecuteOps;
     }
 };
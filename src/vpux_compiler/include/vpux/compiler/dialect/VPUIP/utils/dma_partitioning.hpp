@@ -0,0 +1,73 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/core/type_interfaces.hpp"
+#include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
+#include "vpux/compiler/dialect/VPU/utils/cost_model/cost_model.hpp"
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <memory>
+
+namespace vpux::VPUIP {
+
+//
+// DMATransferModel
+//
+
+// DMA cycles predicted by VPUNN, the same estimation the inference execution simulation uses for DMA tasks
+struct DMATransferModel {
+    VPU::ArchKind arch;
+    std::shared_ptr<VPUNN::VPUCostModel> costModel;
+    // Cycles of the smallest DDR to CMX transfer, i.e. the fixed latency paid by every extra descriptor
+    int64_t descriptorCycles;
+};
+
+DMATransferModel getDMATransferModel(VPU::ArchKind arch, mlir::MLIRContext* ctx);
+
+int64_t getDMATransferCycles(const DMATransferModel& model, NDTypeInterface inputType, NDTypeInterface outputType);
+
+//
+// DMAPartition
+//
+
+// Maximal number of equal steps in which the split point of a transfer is searched
+constexpr int64_t DMA_SPLIT_GRANULARITY = 8;
+
+// Sizes of the first part along a dim of the given size, at a multiple of dimSize / DMA_SPLIT_GRANULARITY. The even
+// split comes first, so that it is kept when the other split points are not better
+SmallVector<int64_t> getDMASplitPoints(int64_t dimSize);
+
+struct DMASplitCandidate {
+    // Size of each part along the split dim
+    SmallVector<int64_t> partSizes;
+    SmallVector<int64_t> partCycles;
+};
+
+struct DMAPartition {
+    // Size along the split dim and DMA port of each part, a single entry means the transfer is kept whole
+    SmallVector<int64_t> partSizes;
+    SmallVector<int64_t> partPorts;
+    // Transfer cycles of each part, without the wait for its port
+    SmallVector<int64_t> partCycles;
+    // Predicted cycle at which the last part completes, relative to the moment the transfer becomes ready. A split
+    // is charged the descriptorCycles of each extra part on top of it
+    int64_t predictedCycles = 0;
+
+    bool isSplit() const {
+        return partPorts.size() > 1;
+    }
+};
+
+// Pick between keeping the transfer whole on its original port and spreading the parts of one of the candidates over
+// distinct ports. portLoads holds the cycles each port is still busy with other transfers of the same channel.
+// A split has to beat the whole transfer by more than the extra descriptors, as they also compete for the engine.
+DMAPartition getDMAPartition(int64_t descriptorCycles, int64_t wholeSize, int64_t wholeCycles,
+                             ArrayRef<DMASplitCandidate> candidates, int64_t origPort, ArrayRef<int64_t> portLoads);
+
+}  // namespace vpux::VPUIP
@@ -27,6 +27,14 @@ namespace VPUIP {
 
 constexpr StringLiteral numberOfVirtualBarriers = "numberOfVirtualBarriers";
 
+//
+// AttributeName for the buffers kept in CMX across function calls
+//
+
+// Marks the buffer declarations placed in the CMX residency reserved memory. Until the reserved memory gets its
+// final offset, the offset of such a declaration is relative to the beginning of the reserved memory.
+constexpr StringLiteral cmxResidencyBuffer = "cmxResidencyBuffer";
+
 //
 // Profiling
 //
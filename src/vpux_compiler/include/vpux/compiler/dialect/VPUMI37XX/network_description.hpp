@@ -7,10 +7,16 @@
 
 #include "intel_npu/al/icompiler.hpp"
 #include "vpux/compiler/dialect/ELFNPU37XX/metadata.hpp"
+#include "vpux/compiler/utils/ELF/predicted_performance.hpp"
+
+#include <optional>
 
 namespace vpux::VPUMI37XX {
 
 // E#-140887: replace mlir::ArrayRef<uint8_t> with BlobView
 intel_npu::NetworkMetadata getNetworkMetadata(mlir::ArrayRef<uint8_t> blob);
 
+// Returns std::nullopt for blobs compiled without the inference execution analysis
+std::optional<PredictedPerformance> getPredictedPerformance(mlir::ArrayRef<uint8_t> blob);
+
 }  // namespace vpux::VPUMI37XX
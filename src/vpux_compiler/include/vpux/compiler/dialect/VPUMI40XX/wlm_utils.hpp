@@ -48,5 +48,15 @@ llvm::SmallVector<mlir::Value> getPreviousUsages(mlir::ValueRange barrs,
 VPUMI40XX::ExecutableTaskOpInterface getBarrieredOp(VPURegMapped::TaskOpInterface primary,
                                                     VPURegMapped::TaskOpInterface secondary);
 
+//
+// Timeline Utils
+//
+
+// Release cycle predicted by AnnotateBarrierReleaseCycles, empty when the barrier was not annotated
+std::optional<int64_t> getBarrierReleaseCycle(mlir::Value barrier);
+
+// Cycle at which all the barriers are released, empty when any of them was not annotated
+std::optional<int64_t> getBarriersReleaseCycle(mlir::ValueRange barriers);
+
 }  // namespace VPUMI40XX
 }  // namespace vpux
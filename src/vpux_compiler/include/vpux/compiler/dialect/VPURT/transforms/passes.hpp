@@ -45,6 +45,7 @@ std::unique_ptr<mlir::Pass> createAssignPhysicalBarriersPass(
         const bool wlmFlag = false, const bool barrierColorBinFlag = false,
         std::optional<int> virtualBarrierThresholdforWlm = std::nullopt, Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createBarrierSimulationPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createAnnotateBarrierReleaseCyclesPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createIntermediateBufferOutputPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createInferenceExecutionAnalysisPass(
         std::string compileSchedTraceFileName = "compileTimeScheduleTrace.json", bool dumpToJson = false,
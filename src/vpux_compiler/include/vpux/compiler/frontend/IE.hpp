@@ -13,6 +13,8 @@
 #include <mlir/IR/MLIRContext.h>
 #include <mlir/Support/Timing.h>
 
+#include <llvm/Support/ThreadPool.h>
+
 // Opset versions supported
 #include <openvino/opsets/opset1.hpp>
 #include <openvino/opsets/opset12.hpp>
@@ -36,12 +38,16 @@ namespace vpux {
 namespace IE {
 
 // TODO Get rid of this function (importNetwork), move logic to compiler.cpp
+// runNGraphPasses can be disabled when the common nGraph passes were already applied to the model, e.g. once for all
+// the static specializations of a dynamic model
 mlir::OwningOpRef<mlir::ModuleOp> importNetwork(mlir::MLIRContext* ctx, const std::shared_ptr<ov::Model>& model,
                                                 const std::vector<std::shared_ptr<const ov::Node>>& originalParameters,
                                                 const std::vector<std::shared_ptr<const ov::Node>>& originalResults,
-                                                bool sharedConstants, mlir::TimingScope& rootTiming,
-                                                bool enableProfiling, DummyOpMode stubLayers, bool dynamicShapeToStatic,
-                                                vpux::VPU::ArchKind arch, Logger log = Logger::global());
+                                                bool sharedConstants, bool prefetchConstants,
+                                                mlir::TimingScope& rootTiming, bool enableProfiling,
+                                                DummyOpMode stubLayers, bool dynamicShapeToStatic,
+                                                vpux::VPU::ArchKind arch, Logger log = Logger::global(),
+                                                bool runNGraphPasses = true);
 
 std::vector<std::shared_ptr<const ov::Node>> buildOVParams(const std::shared_ptr<const ov::Model>& model);
 std::vector<std::shared_ptr<const ov::Node>> buildOVResults(const std::shared_ptr<const ov::Model>& model);
@@ -58,8 +64,13 @@ public:
     using OrigNode = ov::Node;
     using OrigNodePtr = std::shared_ptr<OrigNode>;
 
-    NGraphImporter(mlir::MLIRContext* ctx, std::shared_ptr<const ov::Model> netGraph, bool sharedConstants, Logger log)
-            : _ctx(ctx), _netGraph(std::move(netGraph)), _sharedConstants(sharedConstants), _log(log) {
+    NGraphImporter(mlir::MLIRContext* ctx, std::shared_ptr<const ov::Model> netGraph, bool sharedConstants, Logger log,
+                   bool prefetchConstants = false)
+            : _ctx(ctx),
+              _netGraph(std::move(netGraph)),
+              _sharedConstants(sharedConstants),
+              _prefetchConstants(prefetchConstants),
+              _log(log) {
     }
 
     mlir::func::FuncOp buildMainFunc(mlir::OpBuilder& moduleBuilder, StringRef funcName, mlir::TimingScope& rootTiming,
@@ -75,6 +86,7 @@ public:
 
 private:
     using NodeOutputMap = std::unordered_map<ov::Output<OrigNode>, mlir::Value>;
+    using PendingConstantsMap = std::unordered_map<const OrigNode*, std::shared_future<mlir::ElementsAttr>>;
     using Callback = void (NGraphImporter::*)(mlir::OpBuilder& builder, const OrigNodePtr& origNode);
 
     static Callback getParser(const std::shared_ptr<ov::Node>& op);
@@ -87,6 +99,8 @@ private:
 
     void parseNodeAsStub(mlir::OpBuilder& builder, const OrigNodePtr& origNode);
 
+    void prefetchConstants(const std::vector<OrigNodePtr>& orderedOps, llvm::ThreadPoolTaskGroup& taskGroup);
+
     void parseNode(mlir::OpBuilder& builder, const std::shared_ptr<ov::opset1::Constant>& origNode);
     void parseNode(mlir::OpBuilder& builder, const std::shared_ptr<ov::opset1::Convert>& origNode);
     void parseNode(mlir::OpBuilder& builder, const std::shared_ptr<ov::opset1::ConvertLike>& origNode);
@@ -306,9 +320,11 @@ private:
     mlir::MLIRContext* _ctx = nullptr;
     std::shared_ptr<const ov::Model> _netGraph;
     bool _sharedConstants = false;
+    bool _prefetchConstants = false;
     Logger _log;
 
     NodeOutputMap _importedVals;
+    PendingConstantsMap _pendingConstants;
 };
 
 template <class NodeType>
@@ -26,6 +26,7 @@ Byte getAvailableCmx(const intel_npu::Config& config);
 std::optional<bool> getEnableFP16CompressConv(const intel_npu::Config& config);
 std::optional<int> getWlmBarrierThreshold(const intel_npu::Config& config);
 std::optional<bool> getWlmEnabled(const intel_npu::Config& config);
+std::optional<bool> getSharedWeightsEnabled(const intel_npu::Config& config);
 std::optional<bool> getEnableAutoPaddingIDU(const intel_npu::Config& config);
 std::optional<bool> getEnableAutoPaddingODU(const intel_npu::Config& config);
 std::optional<bool> getEnableVerifiers(const intel_npu::Config& config);
@@ -44,5 +45,6 @@ std::optional<ConstantFoldingConfig> getConstantFoldingInBackground(const intel_
 #endif
 
 std::optional<std::string> getPerformanceHintOverride(const intel_npu::Config& config);
+std::optional<std::string> getShapeBuckets(const intel_npu::Config& config);
 
 }  // namespace vpux
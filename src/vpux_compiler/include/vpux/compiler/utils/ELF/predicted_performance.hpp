@@ -0,0 +1,40 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/array_ref.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace vpux {
+
+// Performance of the network predicted by the compile time inference simulation.
+// It is stored at the end of the performance metrics section, after the structure consumed by the firmware.
+// The record is emitted only when the simulation ran, otherwise the section keeps the size known to older readers.
+// All cycles are counted by the clock of frequencyMHz, the utilization of an engine is the ratio of its busy cycles
+// to the latency.
+struct PredictedPerformance {
+    static constexpr uint32_t MAGIC = 0x46524550;  // "PERF"
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic = MAGIC;
+    uint32_t version = VERSION;
+    uint64_t latencyCycles = 0;
+    // Cycles when at least one queue of the engine executes a task
+    uint64_t dmaBusyCycles = 0;
+    uint64_t dpuBusyCycles = 0;
+    uint64_t shaveBusyCycles = 0;
+    double frequencyMHz = 0;
+};
+
+static_assert(sizeof(PredictedPerformance) == 48, "PredictedPerformance size != 48");
+
+// Reads the record from the end of the performance metrics section.
+// Returns nullopt for sections without the record and for records of another version.
+std::optional<PredictedPerformance> readPredictedPerformance(ArrayRef<uint8_t> perfMetricsSection);
+
+}  // namespace vpux
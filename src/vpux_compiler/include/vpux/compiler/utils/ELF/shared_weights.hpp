@@ -0,0 +1,65 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/array_ref.hpp"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace vpux {
+
+// Constant identified by the hash of its content.
+// In a shared weights map the offset is relative to the start of the described VPU_SHT_SHARED_WEIGHTS section,
+// in a shared weights blob it is relative to the start of the blob.
+struct SharedWeightsEntry {
+    uint64_t hash = 0;
+    uint64_t offset = 0;
+    uint64_t size = 0;
+};
+
+static_assert(sizeof(SharedWeightsEntry) == 24, "SharedWeightsEntry size != 24");
+
+// Content of a VPU_SHT_SHARED_WEIGHTS_MAP section, followed by entryCount SharedWeightsEntry.
+// The map named "<section>.map" describes the VPU_SHT_SHARED_WEIGHTS section named "<section>".
+struct SharedWeightsMapHeader {
+    static constexpr uint32_t MAGIC = 0x50414D57;  // "WMAP"
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic = MAGIC;
+    uint32_t version = VERSION;
+    uint64_t entryCount = 0;
+};
+
+static_assert(sizeof(SharedWeightsMapHeader) == 16, "SharedWeightsMapHeader size != 16");
+
+// Header of the weights blob which is shared by all the executables compiled from the same model.
+// It is followed by entryCount SharedWeightsEntry sorted by hash and by the payloads of the constants.
+// Every distinct content is stored once, so the blobs of several executables can be merged by hash.
+struct SharedWeightsBlobHeader {
+    static constexpr uint32_t MAGIC = 0x54484757;  // "WGHT"
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic = MAGIC;
+    uint32_t version = VERSION;
+    uint64_t entryCount = 0;
+};
+
+static_assert(sizeof(SharedWeightsBlobHeader) == 16, "SharedWeightsBlobHeader size != 16");
+
+// Payloads in the weights blob are aligned to it
+constexpr uint64_t SHARED_WEIGHTS_ALIGNMENT = 64;
+
+uint64_t getSharedWeightsHash(ArrayRef<char> content);
+
+// Writes a weights blob with the given payloads, indexed by their content hash
+std::vector<uint8_t> packSharedWeights(const std::map<uint64_t, ArrayRef<char>>& payloads);
+
+// Merges the weights blobs of several executables, the content stored in several of them is kept once
+std::vector<uint8_t> mergeSharedWeights(ArrayRef<ArrayRef<uint8_t>> weightsBlobs);
+
+}  // namespace vpux
@@ -0,0 +1,18 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/logger.hpp"
+
+#include <mlir/Pass/PassManager.h>
+
+namespace vpux {
+
+// Accumulates the time spent by the function passes on every function and reports it when the PassManager is
+// destroyed. Useful to find the outlined functions which limit the parallel compilation.
+void addFunctionTiming(mlir::PassManager& pm, Logger log);
+
+}  // namespace vpux
@@ -0,0 +1,101 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace vpux {
+
+//
+// Shape buckets
+//
+// A dynamic-shape model can be compiled into several static specializations, one per bucket. A bucket holds the size
+// of every dynamic dimension of the inputs, in the order of the inputs and of their dimensions. A specialization is
+// compiled with the dynamic dimensions set to these sizes and serves the inputs whose dynamic dimensions are not
+// larger, the inputs are padded up to the bucket sizes.
+//
+// The last bucket is the primary specialization: it is large enough in every dimension to serve all the others and
+// it keeps its constants in its own ELF. The specializations are stored in a container:
+//   ELF of the primary specialization
+//   ShapeBucketsHeader, aligned to SHAPE_BUCKETS_BLOB_ALIGNMENT
+//   ShapeBucketEntry x numBuckets
+//   int64_t x numDynamicDims for every bucket, the sizes of the dynamic dimensions
+//   Shared weights blob (see SharedWeightsBlobHeader), aligned to SHAPE_BUCKETS_BLOB_ALIGNMENT
+//   ELF of every other specialization, aligned to SHAPE_BUCKETS_BLOB_ALIGNMENT
+//   ShapeBucketsFooter
+//
+// The container starts with a regular ELF, so a runtime unaware of the shape buckets loads the primary
+// specialization, which serves all the input sizes. A runtime aware of them finds the header through the footer.
+// The constants of the other specializations are stored once in the shared weights blob and their ELFs refer to
+// them by content hash.
+//
+
+constexpr uint64_t SHAPE_BUCKETS_BLOB_ALIGNMENT = 64;
+
+struct ShapeBucketsHeader {
+    static constexpr uint32_t MAGIC = 0x4B434253;  // "SBCK"
+    static constexpr uint32_t VERSION = 3;
+
+    uint32_t magic = MAGIC;
+    uint32_t version = VERSION;
+    uint64_t numBuckets = 0;
+    uint64_t numDynamicDims = 0;
+    // From the beginning of the container
+    uint64_t weightsOffset = 0;
+    uint64_t weightsSize = 0;
+};
+
+struct ShapeBucketEntry {
+    // From the beginning of the container, the entry of the primary specialization has offset 0
+    uint64_t offset = 0;
+    uint64_t size = 0;
+};
+
+struct ShapeBucketsFooter {
+    uint32_t magic = ShapeBucketsHeader::MAGIC;
+    uint32_t reserved = 0;
+    // From the beginning of the container
+    uint64_t headerOffset = 0;
+};
+
+static_assert(sizeof(ShapeBucketsHeader) == 40, "ShapeBucketsHeader size != 40");
+static_assert(sizeof(ShapeBucketEntry) == 16, "ShapeBucketEntry size != 16");
+static_assert(sizeof(ShapeBucketsFooter) == 16, "ShapeBucketsFooter size != 16");
+
+struct ShapeBucket {
+    SmallVector<int64_t> dimSizes;
+    ArrayRef<uint8_t> blob;
+};
+
+struct ShapeBuckets {
+    SmallVector<ShapeBucket> buckets;
+    ArrayRef<uint8_t> sharedWeights;
+};
+
+// Parses comma-separated buckets, e.g. "128,256,512" or "128x64,256x64". A bucket with a single size applies it to
+// all the dynamic dimensions, otherwise it lists the size of every dynamic dimension separated by 'x'.
+// The result is sorted and has no duplicates
+SmallVector<SmallVector<int64_t>> parseShapeBucketSizes(StringRef bucketSizes);
+
+// The last bucket is placed first as the primary specialization, it must be at least as large as every other bucket
+std::vector<uint8_t> packShapeBuckets(const ShapeBuckets& shapeBuckets);
+
+bool isShapeBucketsBlob(ArrayRef<uint8_t> blob);
+
+// The blobs of the returned buckets refer to the container memory, the primary specialization is the last one
+ShapeBuckets unpackShapeBuckets(ArrayRef<uint8_t> blob);
+
+// Index of the specialization which serves the given sizes of the dynamic dimensions. Among the buckets which are
+// large enough in every dimension it is the one with the least elements, so the least padding
+std::optional<size_t> findShapeBucket(ArrayRef<ShapeBucket> buckets, ArrayRef<int64_t> dimSizes);
+
+}  // namespace vpux
@@ -4,6 +4,7 @@
 //
 
 #include "vpux/compiler/NPU37XX/dialect/VPU/transforms/passes.hpp"
+#include "vpux/compiler/core/passes.hpp"
 
 #include "vpux/compiler/utils/rewriter.hpp"
 
@@ -17,11 +18,12 @@ void vpux::VPU::arch37xx::buildIncrementalPipeline(mlir::OpPassManager& pm, cons
     pm.addPass(VPU::arch37xx::createDecomposeMVNPass(log));
 
     pm.addPass(VPU::createMultiClusterStrategyAssignmentPass(options.enablePrefetching, options.enableMCSideLoadDump,
-                                                             options.modelHash, log));
+                                                             options.modelHash, options.modelIdentity, log));
 
     pm.addPass(VPU::createManualStrategyUtilsPass(options.writeStrategyToJson, writeStrategyFileLocation,
                                                   options.readStrategyFromJson, readStrategyFileLocation,
-                                                  options.enableMCSideLoadDump, options.modelHash, log));
+                                                  options.enableMCSideLoadDump, options.modelHash,
+                                                  options.modelIdentity, log));
 
     pm.addPass(VPU::createSplitGRUSequencePass(log));
     pm.addPass(VPU::arch37xx::createApplyTilingMVN1SumPass(log));
@@ -74,6 +76,10 @@ void vpux::VPU::arch37xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
         pm.addPass(VPU::createDetectInPlaceEltwisePass(log));
     }
 
+    if (!options.pgoProfile.empty()) {
+        pm.addPass(createApplyProfileGuidedCostsPass(options.pgoProfile, log));
+    }
+
     if (options.enableSMPipeline) {
         VPU::buildSMPipeline(pm, vpux::MCAndTilingOptionsBase(options), log);
     } else {
@@ -44,7 +44,7 @@ void vpux::VPUIP::arch37xx::buildMemoryAllocationPipeline(mlir::OpPassManager& p
     pm.addPass(VPUIP::createFeasibleAllocationPass(
             VPU::getMemKind<VPU::MemoryKind::CMX_NN>, VPU::getMemKind<VPU::MemoryKind::DDR>, options.linearizeSchedule,
             options.enablePipelining, options.enablePrefetching, options.optimizeFragmentation,
-            options.optimizeDynamicSpilling, log));
+            options.optimizeDynamicSpilling, options.enableSpillCostEviction, log));
 
     if (options.enableGroupAsyncExecuteOps) {
         pm.addPass(VPUIP::createGroupAsyncExecuteOpsPass(log));
@@ -112,7 +112,8 @@ void vpux::VPUIP::arch37xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
         pm.addPass(VPUIP::createFuseConstantsPass(log));
     }
 
-    pm.addPass(VPUIP::createSwizzlingPass(options.enableWeightsSwizzling, options.enableActivationSwizzling, log));
+    pm.addPass(VPUIP::createSwizzlingPass(options.enableWeightsSwizzling, options.enableActivationSwizzling,
+                                          /*enableSwizzlingPlanner=*/false, log));
 
     // Note: this pass introduces necessary VPUIP.Copy operations, thus, it must
     // be called *after* all copy optimizations are run (to ensure the
@@ -123,7 +124,8 @@ void vpux::VPUIP::arch37xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
     pm.addPass(VPUIP::createConvertTransferOpsToDMAsPass(log));
 
     if (options.enableProfiling && options.enableDPUProfiling) {
-        pm.addPass(VPUIP::createDPUProfilingPass(vpux::VPU::getMemKind<VPU::MemoryKind::CMX_NN>, log));
+        pm.addPass(VPUIP::createDPUProfilingPass(vpux::VPU::getMemKind<VPU::MemoryKind::CMX_NN>,
+                                                 options.profilingSamplingPeriod, log));
     }
 
     if (options.enableProfiling && options.enableSWProfiling) {
@@ -143,6 +145,9 @@ void vpux::VPUIP::arch37xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
 
     pm.addPass(VPUIP::createAddCopyBetweenSWKernelsAndNetworkIOPass(log));
 
+    if (!options.pgoProfile.empty()) {
+        pm.addPass(createApplyProfileGuidedCostsPass(options.pgoProfile, log));
+    }
     pm.addPass(VPUIP::createCalculateAsyncRegionCycleCostPass(log));
 
     VPUIP::arch37xx::buildMemoryAllocationPipeline(pm, VPUIP::arch37xx::MemoryAllocationOptions(options), log);
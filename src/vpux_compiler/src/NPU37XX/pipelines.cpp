@@ -452,12 +452,13 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
         pm.addPass(VPUIP::createFuseConstantsPass(log));
     }
 
-    pm.addPass(VPUIP::createSwizzlingPass(options.enableWeightsSwizzling, options.enableActivationSwizzling, log));
+    pm.addPass(VPUIP::createSwizzlingPass(options.enableWeightsSwizzling, options.enableActivationSwizzling,
+                                          /*enableSwizzlingPlanner=*/false, log));
 
     pm.addPass(VPUIP::createConvertTransferOpsToDMAsPass(log));
 
     if (options.enableProfiling && options.enableDPUProfiling) {
-        pm.addPass(VPUIP::createDPUProfilingPass(VPU::getMemKind<VPU::MemoryKind::CMX_NN>, log));
+        pm.addPass(VPUIP::createDPUProfilingPass(VPU::getMemKind<VPU::MemoryKind::CMX_NN>, /*samplingPeriod=*/1, log));
     }
 
     if (options.enableProfiling && options.enableSWProfiling) {
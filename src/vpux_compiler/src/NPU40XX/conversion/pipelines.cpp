@@ -34,10 +34,13 @@ void vpux::arch40xx::buildLowerVPUIP2ELFPipeline(mlir::OpPassManager& pm,
              "  wlmOptimizationThreshold = {1}\n"
              "  enableMemorySideCache = {2}\n"
              "  enableDMAProfiling = {3}\n"
-             "  enableShaveDDRAccessOptimization = {4}\n",
+             "  enableShaveDDRAccessOptimization = {4}\n"
+             "  enableConstBufferDeduplication = {5}\n"
+             "  enableSharedWeights = {6}\n",
              backendCompilationOptions.enablePartialWorkloadManagement,
              backendCompilationOptions.wlmOptimizationThreshold, backendCompilationOptions.enableMemorySideCache,
-             backendCompilationOptions.enableDMAProfiling, backendCompilationOptions.enableShaveDDRAccessOptimization);
+             backendCompilationOptions.enableDMAProfiling, backendCompilationOptions.enableShaveDDRAccessOptimization,
+             backendCompilationOptions.enableConstBufferDeduplication, backendCompilationOptions.enableSharedWeights);
 
     pm.addPass(createConvertVPUIP2VPUMI40XXPass(log, backendCompilationOptions.enableMemorySideCache));
     auto dmaProfilingMode =
@@ -50,6 +53,12 @@ void vpux::arch40xx::buildLowerVPUIP2ELFPipeline(mlir::OpPassManager& pm,
     pm.addPass(ELF::createAddABIVersionPass(log, NPUReg40XX::ABI_VERSION_MAJOR, NPUReg40XX::ABI_VERSION_MINOR,
                                             NPUReg40XX::ABI_VERSION_PATCH));
     pm.addPass(ELF::createMoveOpsIntoSectionsPass(log));
+    if (backendCompilationOptions.enableConstBufferDeduplication) {
+        pm.addPass(ELF::createDeduplicateConstBuffersPass(log));
+    }
+    if (backendCompilationOptions.enableSharedWeights) {
+        pm.addPass(ELF::createExternalizeConstBuffersPass(log));
+    }
     pm.addPass(ELF::createAddInnerSectionPaddingPass(log));
     pm.addPass(ELF::createAddELFSymbolTablePass(log));
     pm.addPass(ELF::createSetEntryPointPass(log));
@@ -5,10 +5,14 @@
 
 #include "vpux/compiler/NPU40XX/dialect/ELF/export.hpp"
 #include "vpux/compiler/dialect/ELFNPU37XX/metadata.hpp"
+#include "vpux/compiler/dialect/VPUASM/ops.hpp"
+#include "vpux/compiler/utils/ELF/shared_weights.hpp"
 #include "vpux/compiler/utils/ELF/utils.hpp"
 
 #include <vpux_elf/writer.hpp>
 
+#include <map>
+
 namespace vpux::ELF {
 
 namespace {
@@ -153,4 +157,40 @@ BlobView exportToELF(mlir::ModuleOp module, BlobAllocator& allocator, Logger log
     return {blob, static_cast<uint64_t>(size)};
 }
 
+std::vector<uint8_t> exportSharedWeights(mlir::ModuleOp module, Logger log) {
+    log.setName("ELF BackEnd");
+
+    auto elfMain = getElfMainOp(module);
+
+    std::map<uint64_t, std::vector<char>> payloads;
+    for (auto section : elfMain.getOps<LogicalSectionOp>()) {
+        if (section.getSecType() != SectionTypeAttr::VPU_SHT_SHARED_WEIGHTS) {
+            continue;
+        }
+
+        for (auto constOp : section.getBody()->getOps<VPUASM::ConstBufferOp>()) {
+            std::vector<char> payload(constOp.getBinarySize());
+            constOp.getProperties().getContent().fold().copyTo(MutableArrayRef<char>(payload.data(), payload.size()));
+
+            const auto hash = getSharedWeightsHash(payload);
+            auto stored = payloads.find(hash);
+            if (stored == payloads.end()) {
+                payloads.emplace(hash, std::move(payload));
+                continue;
+            }
+            VPUX_THROW_UNLESS(stored->second == payload, "Content hash collision for constant '{0}'",
+                              constOp.getSymName());
+        }
+    }
+
+    std::map<uint64_t, ArrayRef<char>> payloadRefs;
+    for (const auto& [hash, payload] : payloads) {
+        payloadRefs.emplace(hash, payload);
+    }
+    auto blob = packSharedWeights(payloadRefs);
+
+    log.info("Exported {0} shared constants, {1} bytes", payloads.size(), blob.size());
+    return blob;
+}
+
 }  // namespace vpux::ELF
@@ -5,9 +5,11 @@
 
 #include <vpux_elf/writer.hpp>
 #include "vpux/compiler/NPU40XX/dialect/VPU/utils/performance_metrics.hpp"
+#include "vpux/compiler/dialect/IE/IR/ops.hpp"
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
 #include "vpux/compiler/dialect/VPU/utils/performance_metrics.hpp"
 #include "vpux/compiler/dialect/VPUIP/utils/utils.hpp"
+#include "vpux/compiler/utils/ELF/predicted_performance.hpp"
 #include "vpux/compiler/utils/ELF/utils.hpp"
 
 #include <npu_40xx_nnrt.hpp>
@@ -15,6 +17,38 @@
 using namespace vpux;
 using namespace npu40xx;
 
+namespace {
+
+IE::CNNNetworkOp getNetworkOp(mlir::ModuleOp mainModule) {
+    IE::CNNNetworkOp netOp;
+    mlir::func::FuncOp netFunc;
+    IE::CNNNetworkOp::getFromModule(mainModule, netOp, netFunc);
+    return netOp;
+}
+
+// The record is emitted only when InferenceExecutionAnalysisPass stored its results, so that blobs compiled without
+// the analysis keep the section layout known to older readers
+bool hasPredictedPerformance(mlir::ModuleOp mainModule) {
+    return getNetworkOp(mainModule).getInferenceTiming().has_value();
+}
+
+PredictedPerformance getPredictedPerformance(mlir::ModuleOp mainModule) {
+    PredictedPerformance predicted{};
+
+    auto netOp = getNetworkOp(mainModule);
+    predicted.latencyCycles = checked_cast<uint64_t>(netOp.getInferenceTiming().value_or(0));
+    predicted.dmaBusyCycles = checked_cast<uint64_t>(netOp.getDmaBusyTiming().value_or(0));
+    predicted.dpuBusyCycles = checked_cast<uint64_t>(netOp.getDpuBusyTiming().value_or(0));
+    predicted.shaveBusyCycles = checked_cast<uint64_t>(netOp.getShaveBusyTiming().value_or(0));
+
+    if (auto tileOp = IE::getTileExecutor(mainModule)) {
+        predicted.frequencyMHz = tileOp.getProcessorFrequency().getValueAsDouble();
+    }
+    return predicted;
+}
+
+}  // namespace
+
 void vpux::ELF::PerformanceMetricsOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDataSection) {
     VpuPerformanceMetrics perf{};
 
@@ -47,15 +81,28 @@ void vpux::ELF::PerformanceMetricsOp::serialize(elf::writer::BinaryDataSection<u
     }
 
     const auto ptrCharTmp = reinterpret_cast<uint8_t*>(&perf);
-    binDataSection.appendData(ptrCharTmp, getBinarySize());
+    binDataSection.appendData(ptrCharTmp, sizeof(VpuPerformanceMetrics));
+
+    // The firmware reads only VpuPerformanceMetrics, the prediction is appended for the host side tools
+    if (!hasPredictedPerformance(mainModule)) {
+        return;
+    }
+    auto predicted = getPredictedPerformance(mainModule);
+    binDataSection.appendData(reinterpret_cast<uint8_t*>(&predicted), sizeof(PredictedPerformance));
 }
 
 size_t vpux::ELF::PerformanceMetricsOp::getBinarySize() {
-    return sizeof(VpuPerformanceMetrics);
+    static_assert(sizeof(VpuPerformanceMetrics) % alignof(PredictedPerformance) == 0,
+                  "PredictedPerformance is misaligned");
+    auto mainModule = getOperation()->getParentOfType<mlir::ModuleOp>();
+    if (!hasPredictedPerformance(mainModule)) {
+        return sizeof(VpuPerformanceMetrics);
+    }
+    return sizeof(VpuPerformanceMetrics) + sizeof(PredictedPerformance);
 }
 
 size_t vpux::ELF::PerformanceMetricsOp::getAlignmentRequirements() {
-    return alignof(VpuPerformanceMetrics);
+    return std::max(alignof(VpuPerformanceMetrics), alignof(PredictedPerformance));
 }
 
 std::optional<ELF::SectionSignature> vpux::ELF::PerformanceMetricsOp::getSectionSignature() {
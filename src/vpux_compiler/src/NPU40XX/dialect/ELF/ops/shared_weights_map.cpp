@@ -0,0 +1,69 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <vpux_elf/writer.hpp>
+#include "vpux/compiler/NPU40XX/dialect/ELF/ops.hpp"
+#include "vpux/compiler/dialect/VPUASM/ops.hpp"
+#include "vpux/compiler/utils/ELF/shared_weights.hpp"
+#include "vpux/compiler/utils/ELF/utils.hpp"
+#include "vpux/compiler/utils/loop.hpp"
+
+#include <mlir/IR/SymbolTable.h>
+
+using namespace vpux;
+
+namespace {
+
+SmallVector<VPUASM::ConstBufferOp> getSharedConstants(ELF::SharedWeightsMapOp mapOp) {
+    auto elfMain = mapOp->getParentOfType<ELF::MainOp>();
+    VPUX_THROW_WHEN(elfMain == nullptr, "SharedWeightsMap '{0}' is not placed inside ELF.Main", mapOp.getSymName());
+
+    auto section = mlir::SymbolTable::lookupSymbolIn(elfMain, mapOp.getSectionAttr());
+    auto logicalSection = mlir::dyn_cast_or_null<ELF::LogicalSectionOp>(section);
+    VPUX_THROW_WHEN(logicalSection == nullptr, "SharedWeightsMap '{0}' refers to unknown section '{1}'",
+                    mapOp.getSymName(), mapOp.getSection());
+
+    return to_small_vector(logicalSection.getBody()->getOps<VPUASM::ConstBufferOp>());
+}
+
+}  // namespace
+
+void vpux::ELF::SharedWeightsMapOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDataSection) {
+    const auto constOps = getSharedConstants(*this);
+
+    SmallVector<SharedWeightsEntry> entries(constOps.size());
+    loop_1d(LoopExecPolicy::Parallel, getContext(), static_cast<int64_t>(constOps.size()), [&](int64_t opIdx) {
+        auto constOp = constOps[opIdx];
+        std::vector<char> payload(constOp.getBinarySize());
+        constOp.getProperties().getContent().fold().copyTo(MutableArrayRef<char>(payload.data(), payload.size()));
+
+        auto& entry = entries[opIdx];
+        entry.hash = getSharedWeightsHash(payload);
+        entry.offset = constOp.getMemoryOffset();
+        entry.size = payload.size();
+    });
+
+    SharedWeightsMapHeader header{};
+    header.entryCount = entries.size();
+    binDataSection.appendData(reinterpret_cast<uint8_t*>(&header), sizeof(SharedWeightsMapHeader));
+    binDataSection.appendData(reinterpret_cast<uint8_t*>(entries.data()), entries.size() * sizeof(SharedWeightsEntry));
+}
+
+size_t vpux::ELF::SharedWeightsMapOp::getBinarySize() {
+    return sizeof(SharedWeightsMapHeader) + getSharedConstants(*this).size() * sizeof(SharedWeightsEntry);
+}
+
+size_t vpux::ELF::SharedWeightsMapOp::getAlignmentRequirements() {
+    return alignof(SharedWeightsEntry);
+}
+
+std::optional<ELF::SectionSignature> vpux::ELF::SharedWeightsMapOp::getSectionSignature() {
+    return ELF::SectionSignature(vpux::ELF::generateSignature(getSection().str(), "map"),
+                                 ELF::SectionFlagsAttr::SHF_NONE, ELF::SectionTypeAttr::VPU_SHT_SHARED_WEIGHTS_MAP);
+}
+
+bool vpux::ELF::SharedWeightsMapOp::hasMemoryFootprint() {
+    return true;
+}
@@ -0,0 +1,123 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/NPU40XX/dialect/ELF/ops.hpp"
+#include "vpux/compiler/NPU40XX/dialect/ELF/passes.hpp"
+#include "vpux/compiler/dialect/VPUASM/ops.hpp"
+
+#include <mlir/IR/SymbolTable.h>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/Support/xxhash.h>
+
+#include <cstring>
+
+using namespace vpux;
+
+namespace {
+
+std::vector<char> foldPayload(VPUASM::ConstBufferOp op) {
+    std::vector<char> payload(op.getBinarySize());
+    op.getProperties().getContent().fold().copyTo(MutableArrayRef<char>(payload.data(), payload.size()));
+    return payload;
+}
+
+uint64_t hashPayload(ArrayRef<char> payload) {
+    return llvm::xxh3_64bits(ArrayRef<uint8_t>(reinterpret_cast<const uint8_t*>(payload.data()), payload.size()));
+}
+
+bool isSamePayload(VPUASM::ConstBufferOp candidate, ArrayRef<char> candidatePayload, VPUASM::ConstBufferOp kept) {
+    // identical content attributes are guaranteed to fold to the same data
+    if (candidate.getProperties().getContent() == kept.getProperties().getContent()) {
+        return true;
+    }
+
+    // hashes matched, make sure it is not a collision
+    const auto keptPayload = foldPayload(kept);
+    return keptPayload.size() == candidatePayload.size() &&
+           std::memcmp(keptPayload.data(), candidatePayload.data(), keptPayload.size()) == 0;
+}
+
+//
+// DeduplicateConstBuffersPass
+//
+
+class DeduplicateConstBuffersPass final : public ELF::DeduplicateConstBuffersBase<DeduplicateConstBuffersPass> {
+public:
+    explicit DeduplicateConstBuffersPass(Logger log): _log(log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnFunc() final;
+    Logger _log;
+};
+
+void DeduplicateConstBuffersPass::safeRunOnFunc() {
+    auto netFunc = getOperation();
+    auto mainOps = to_small_vector(netFunc.getOps<ELF::MainOp>());
+    VPUX_THROW_UNLESS(mainOps.size() == 1, "Expected exactly one ELF mainOp. Got {0}", mainOps.size());
+    auto elfMain = mainOps[0];
+
+    mlir::SymbolTableCollection collection;
+    auto symbolUserMap = mlir::SymbolUserMap(collection, elfMain);
+
+    size_t removedBuffers = 0;
+    size_t savedBytes = 0;
+
+    for (auto section : elfMain.getOps<ELF::DataSectionOp>()) {
+        auto constOps = to_small_vector(section.getBlock()->getOps<VPUASM::ConstBufferOp>());
+        if (constOps.size() < 2) {
+            continue;
+        }
+
+        // Only buffers of the same type can be merged, as users interpret the referenced data through the buffer
+        // type of the symbol. Folding the payload is expensive, so skip the buffers which have no merge candidate.
+        llvm::DenseMap<mlir::Type, size_t> typeCount;
+        for (auto constOp : constOps) {
+            ++typeCount[constOp.getBufferType()];
+        }
+
+        llvm::DenseMap<std::pair<mlir::Type, uint64_t>, SmallVector<VPUASM::ConstBufferOp>> keptBuffers;
+        for (auto constOp : constOps) {
+            const auto bufferType = constOp.getBufferType();
+            if (typeCount[bufferType] < 2) {
+                continue;
+            }
+
+            const auto payload = foldPayload(constOp);
+            auto& candidates = keptBuffers[std::make_pair(bufferType, hashPayload(payload))];
+
+            auto keptIt = llvm::find_if(candidates, [&](VPUASM::ConstBufferOp kept) {
+                return isSamePayload(constOp, payload, kept);
+            });
+            if (keptIt == candidates.end()) {
+                candidates.push_back(constOp);
+                continue;
+            }
+
+            auto kept = *keptIt;
+            _log.trace("Merge '{0}' into '{1}' ({2} bytes)", constOp.getSymName(), kept.getSymName(), payload.size());
+
+            symbolUserMap.replaceAllUsesWith(constOp, kept.getSymNameAttr());
+            constOp.erase();
+
+            ++removedBuffers;
+            savedBytes += payload.size();
+        }
+    }
+
+    _log.info("Removed {0} duplicated constant buffers, saved {1} bytes", removedBuffers, savedBytes);
+}
+
+}  // namespace
+
+//
+// createDeduplicateConstBuffersPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::ELF::createDeduplicateConstBuffersPass(Logger log) {
+    return std::make_unique<DeduplicateConstBuffersPass>(log);
+}
@@ -0,0 +1,79 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/NPU40XX/dialect/ELF/ops.hpp"
+#include "vpux/compiler/NPU40XX/dialect/ELF/passes.hpp"
+#include "vpux/compiler/dialect/VPUASM/ops.hpp"
+
+using namespace vpux;
+
+namespace {
+
+bool holdsOnlyConstants(ELF::DataSectionOp section) {
+    auto& ops = section.getBody()->getOperations();
+    return !ops.empty() && llvm::all_of(ops, [](mlir::Operation& op) {
+        return mlir::isa<VPUASM::ConstBufferOp>(op);
+    });
+}
+
+//
+// ExternalizeConstBuffersPass
+//
+
+class ExternalizeConstBuffersPass final : public ELF::ExternalizeConstBuffersBase<ExternalizeConstBuffersPass> {
+public:
+    explicit ExternalizeConstBuffersPass(Logger log): _log(log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnFunc() final;
+    Logger _log;
+};
+
+void ExternalizeConstBuffersPass::safeRunOnFunc() {
+    auto netFunc = getOperation();
+    auto mainOps = to_small_vector(netFunc.getOps<ELF::MainOp>());
+    VPUX_THROW_UNLESS(mainOps.size() == 1, "Expected exactly one ELF mainOp. Got {0}", mainOps.size());
+    auto elfMain = mainOps[0];
+
+    for (auto dataSection : llvm::make_early_inc_range(elfMain.getOps<ELF::DataSectionOp>())) {
+        if (!holdsOnlyConstants(dataSection)) {
+            continue;
+        }
+
+        // The section keeps its name, so the symbolic references of the constants stay valid
+        mlir::OpBuilder builder(dataSection);
+        auto sharedSection = builder.create<ELF::LogicalSectionOp>(
+                dataSection.getLoc(), dataSection.getSymName(), dataSection.getSecAddrAlign(),
+                ELF::SectionTypeAttr::VPU_SHT_SHARED_WEIGHTS, dataSection.getSecFlags());
+        auto sharedBlock = sharedSection.getBlock();
+        sharedBlock->getOperations().splice(sharedBlock->end(), dataSection.getBody()->getOperations());
+        builder.setInsertionPointAfter(sharedSection);
+        dataSection.erase();
+
+        auto mapOp = builder.create<ELF::SharedWeightsMapOp>(
+                sharedSection.getLoc(), mlir::StringAttr::get(&getContext(), "SharedWeightsMap"),
+                mlir::FlatSymbolRefAttr::get(sharedSection.getSymNameAttr()));
+        auto signature = mapOp.getSectionSignature().value();
+        auto mapSection = builder.create<ELF::DataSectionOp>(sharedSection.getLoc(), signature.getName(),
+                                                             mapOp.getAlignmentRequirements(), signature.getType(),
+                                                             signature.getFlags());
+        mapOp->moveBefore(mapSection.getBlock(), mapSection.getBlock()->end());
+
+        _log.trace("Moved {0} constants of section '{1}' to the shared weights",
+                   llvm::range_size(sharedBlock->getOps<VPUASM::ConstBufferOp>()), sharedSection.getSymName());
+    }
+}
+
+}  // namespace
+
+//
+// createExternalizeConstBuffersPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::ELF::createExternalizeConstBuffersPass(Logger log) {
+    return std::make_unique<ExternalizeConstBuffersPass>(log);
+}
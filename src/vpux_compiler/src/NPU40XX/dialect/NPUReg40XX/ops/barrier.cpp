@@ -17,14 +17,14 @@ using namespace npu40xx;
 //
 
 void vpux::NPUReg40XX::ConfigureBarrierOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDataSection) {
-    nn_public::VpuBarrierCountConfig barrier;
-
     auto barrierDescriptor = getBarrierDescriptorAttr().getRegMapped();
-    auto serializedBarrierDesc = barrierDescriptor.serialize();
-    memcpy(reinterpret_cast<uint8_t*>(&barrier), serializedBarrierDesc.data(), serializedBarrierDesc.size());
 
-    auto ptrCharTmp = reinterpret_cast<uint8_t*>(&barrier);
-    binDataSection.appendData(ptrCharTmp, getBinarySize());
+    VPUX_THROW_UNLESS(sizeof(nn_public::VpuBarrierCountConfig) == barrierDescriptor.size(),
+                      "HW VpuBarrierCountConfig size {0} != regMapped representation size {1}.",
+                      sizeof(nn_public::VpuBarrierCountConfig), barrierDescriptor.size());
+    auto serializedBarrierDesc = barrierDescriptor.getStorage();
+
+    binDataSection.appendData(serializedBarrierDesc.data(), serializedBarrierDesc.size());
 }
 
 size_t vpux::NPUReg40XX::ConfigureBarrierOp::getBinarySize() {
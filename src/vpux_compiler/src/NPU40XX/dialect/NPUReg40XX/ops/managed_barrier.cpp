@@ -17,14 +17,14 @@ using namespace npu40xx;
 //
 
 void NPUReg40XX::ManagedBarrierOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDataSection) {
-    nn_public::VpuTaskBarrierMap barrier = {};
-
     auto barrierDescriptor = getBarrierDescriptorAttr().getRegMapped();
-    auto serializedBarrierDesc = barrierDescriptor.serialize();
-    memcpy(reinterpret_cast<uint8_t*>(&barrier), serializedBarrierDesc.data(), serializedBarrierDesc.size());
 
-    auto ptrCharTmp = reinterpret_cast<uint8_t*>(&barrier);
-    binDataSection.appendData(ptrCharTmp, getBinarySize());
+    VPUX_THROW_UNLESS(sizeof(nn_public::VpuTaskBarrierMap) == barrierDescriptor.size(),
+                      "HW VpuTaskBarrierMap size {0} != regMapped representation size {1}.",
+                      sizeof(nn_public::VpuTaskBarrierMap), barrierDescriptor.size());
+    auto serializedBarrierDesc = barrierDescriptor.getStorage();
+
+    binDataSection.appendData(serializedBarrierDesc.data(), serializedBarrierDesc.size());
 }
 
 size_t NPUReg40XX::ManagedBarrierOp::getBinarySize() {
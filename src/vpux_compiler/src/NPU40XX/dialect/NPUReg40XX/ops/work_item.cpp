@@ -8,15 +8,14 @@ using namespace npu40xx;
 using namespace vpux;
 
 void vpux::NPUReg40XX::WorkItemOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDataSection) {
-    nn_public::VpuWorkItem workItem = {};
     auto workItemDesc = getWorkItemDescriptor().getRegMapped();
-    auto serializedworkItemDesc = workItemDesc.serialize();
 
-    memcpy(reinterpret_cast<uint8_t*>(&workItem), serializedworkItemDesc.data(), serializedworkItemDesc.size());
+    VPUX_THROW_UNLESS(sizeof(nn_public::VpuWorkItem) == workItemDesc.size(),
+                      "HW VpuWorkItem size {0} != regMapped representation size {1}.", sizeof(nn_public::VpuWorkItem),
+                      workItemDesc.size());
+    auto serializedWorkItemDesc = workItemDesc.getStorage();
 
-    auto ptrCharTmp = reinterpret_cast<uint8_t*>(&workItem);
-
-    binDataSection.appendData(ptrCharTmp, getBinarySize());
+    binDataSection.appendData(serializedWorkItemDesc.data(), serializedWorkItemDesc.size());
 }
 
 size_t vpux::NPUReg40XX::WorkItemOp::getBinarySize() {
@@ -19,11 +19,12 @@ void vpux::VPU::arch40xx::buildIncrementalPipeline(mlir::OpPassManager& pm, cons
     pm.addPass(VPU::arch37xx::createDecomposeMVNPass(log));
 
     pm.addPass(VPU::createMultiClusterStrategyAssignmentPass(options.enablePrefetching, options.enableMCSideLoadDump,
-                                                             options.modelHash, log));
+                                                             options.modelHash, options.modelIdentity, log));
 
     pm.addPass(VPU::createManualStrategyUtilsPass(options.writeStrategyToJson, writeStrategyFileLocation,
                                                   options.readStrategyFromJson, readStrategyFileLocation,
-                                                  options.enableMCSideLoadDump, options.modelHash, log));
+                                                  options.enableMCSideLoadDump, options.modelHash,
+                                                  options.modelIdentity, log));
     pm.addPass(VPU::createSplitGRUSequencePass(log));
     pm.addPass(VPU::arch37xx::createApplyTilingMVN1SumPass(log));
     pm.addPass(VPU::createTileLSTMSequencePass(log));
@@ -89,6 +90,10 @@ void vpux::VPU::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
         pm.addPass(VPU::arch40xx::createConvertM2IOpsPass(log));
     }
 
+    if (!options.pgoProfile.empty()) {
+        pm.addPass(createApplyProfileGuidedCostsPass(options.pgoProfile, log));
+    }
+
     if (options.enableSMPipeline) {
         VPU::buildSMPipeline(pm, vpux::MCAndTilingOptionsBase(options), log);
     } else {
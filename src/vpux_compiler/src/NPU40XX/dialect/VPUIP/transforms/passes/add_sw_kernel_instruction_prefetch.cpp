@@ -0,0 +1,324 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/NPU40XX/dialect/VPUIP/transforms/passes.hpp"
+#include "vpux/compiler/act_kernels/shave_binary_resources.h"
+#include "vpux/compiler/dialect/VPUIP/IR/ops.hpp"
+#include "vpux/compiler/dialect/VPUIP/utils/cache_utils.hpp"
+#include "vpux/compiler/dialect/VPUIP/utils/sw_utils.hpp"
+#include "vpux/compiler/dialect/VPURT/IR/task.hpp"
+#include "vpux/compiler/utils/logging.hpp"
+#include "vpux/compiler/utils/rewriter.hpp"
+
+#include <llvm/ADT/MapVector.h>
+#include <llvm/ADT/StringMap.h>
+
+using namespace vpux;
+
+namespace {
+
+constexpr StringLiteral vpuTaskTypeAttrName{"VPU.task_type"};
+constexpr StringLiteral kernelElfNameAttrName{"kernelElfName"};
+constexpr StringLiteral cachePrefetchFuncName{"cache_prefetch"};
+constexpr StringLiteral swKernelCpuName{"4000xx"};
+
+//
+// SwTask
+//
+
+struct SwTask {
+    VPURT::TaskOp taskOp;
+    VPUIP::SwKernelOp swKernelOp;
+    std::optional<VPU::ActShaveTaskType> cacheOpType;
+    // kernel entry for compute tasks, prefetched kernel for CACHE_PREFETCH tasks
+    std::string kernelName;
+};
+
+std::optional<SwTask> getSwTask(VPURT::TaskOp taskOp, mlir::ModuleOp moduleOp) {
+    auto swKernelOp = mlir::dyn_cast_or_null<VPUIP::SwKernelOp>(taskOp.getInnerTaskOp());
+    if (swKernelOp == nullptr) {
+        return std::nullopt;
+    }
+
+    auto kernelFunc = moduleOp.lookupSymbol<mlir::func::FuncOp>(swKernelOp.getKernelFunctionAttr());
+    VPUX_THROW_WHEN(kernelFunc == nullptr, "Cannot find kernel function symbol at '{0}'", swKernelOp->getLoc());
+
+    SwTask task{taskOp, swKernelOp, std::nullopt, {}};
+
+    const auto kernelTaskType = kernelFunc->getAttrOfType<mlir::SymbolRefAttr>(vpuTaskTypeAttrName);
+    if (VPUIP::isCacheOpTaskType(kernelTaskType)) {
+        task.cacheOpType = VPU::symbolizeActShaveTaskType(kernelTaskType.getLeafReference().strref());
+        if (task.cacheOpType == VPU::ActShaveTaskType::CACHE_PREFETCH) {
+            if (const auto kernelElfName = swKernelOp->getAttrOfType<mlir::StringAttr>(kernelElfNameAttrName)) {
+                task.kernelName = kernelElfName.str();
+            }
+        }
+        return task;
+    }
+
+    task.kernelName = VPUIP::getSwKernelEntryName(swKernelOp).str().str();
+    return task;
+}
+
+bool isComputeTask(const SwTask& task) {
+    return !task.cacheOpType.has_value();
+}
+
+bool isInvalidatingCacheOp(const SwTask& task) {
+    return task.cacheOpType == VPU::ActShaveTaskType::CACHE_INVALIDATE ||
+           task.cacheOpType == VPU::ActShaveTaskType::CACHE_FLUSH_INVALIDATE;
+}
+
+int64_t getTileIndex(const SwTask& task) {
+    return task.swKernelOp.getTileIndex().value_or(0);
+}
+
+// Two compute tasks can be freely swapped in the task list when they run on the same tile, are synchronized by
+// the same barriers and carry no profiling buffers, whose slots follow the task order
+bool isInterchangeable(const SwTask& lhs, const SwTask& rhs) {
+    if (!isComputeTask(lhs) || !isComputeTask(rhs)) {
+        return false;
+    }
+    if (lhs.swKernelOp.getProfilingData() != nullptr || rhs.swKernelOp.getProfilingData() != nullptr) {
+        return false;
+    }
+    if (lhs.taskOp.getEnqueueBarrier() != nullptr || rhs.taskOp.getEnqueueBarrier() != nullptr) {
+        return false;
+    }
+    return getTileIndex(lhs) == getTileIndex(rhs) &&
+           llvm::equal(lhs.taskOp.getWaitBarriers(), rhs.taskOp.getWaitBarriers()) &&
+           llvm::equal(lhs.taskOp.getUpdateBarriers(), rhs.taskOp.getUpdateBarriers());
+}
+
+//
+// AddSwKernelInstructionPrefetchPass
+//
+
+class AddSwKernelInstructionPrefetchPass final :
+        public VPUIP::arch40xx::AddSwKernelInstructionPrefetchBase<AddSwKernelInstructionPrefetchPass> {
+public:
+    explicit AddSwKernelInstructionPrefetchPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnFunc() final;
+
+    size_t getKernelTextSize(StringRef kernelName);
+    void accessKernel(VPUIP::ShaveL2CacheSimulator& cache, const SwTask& task);
+
+    SmallVector<SwTask> collectSwTasks(mlir::func::FuncOp func, mlir::ModuleOp moduleOp);
+    size_t regroupSwTasks(mlir::func::FuncOp func, mlir::ModuleOp moduleOp);
+    size_t insertPrefetches(mlir::func::FuncOp func, mlir::ModuleOp moduleOp);
+    mlir::SymbolRefAttr getCachePrefetchFunction(mlir::ModuleOp moduleOp);
+
+private:
+    llvm::StringMap<size_t> _kernelTextSizes;
+};
+
+size_t AddSwKernelInstructionPrefetchPass::getKernelTextSize(StringRef kernelName) {
+    auto it = _kernelTextSizes.find(kernelName);
+    if (it == _kernelTextSizes.end()) {
+        const auto text = ShaveBinaryResources::getInstance().getText(kernelName, swKernelCpuName);
+        it = _kernelTextSizes.try_emplace(kernelName, text.size()).first;
+    }
+    return it->second;
+}
+
+void AddSwKernelInstructionPrefetchPass::accessKernel(VPUIP::ShaveL2CacheSimulator& cache, const SwTask& task) {
+    if (isInvalidatingCacheOp(task)) {
+        cache.invalidate();
+        return;
+    }
+    if (task.kernelName.empty()) {
+        return;
+    }
+
+    const auto kernelSize = getKernelTextSize(task.kernelName);
+    if (kernelSize > cache.getCapacity()) {
+        // such kernel streams through the cache and leaves nothing useful behind
+        cache.invalidate();
+        return;
+    }
+    cache.loadKernel(task.kernelName, kernelSize);
+}
+
+SmallVector<SwTask> AddSwKernelInstructionPrefetchPass::collectSwTasks(mlir::func::FuncOp func,
+                                                                       mlir::ModuleOp moduleOp) {
+    SmallVector<SwTask> swTasks;
+    for (auto taskOp : func.getOps<VPURT::TaskOp>()) {
+        if (auto task = getSwTask(taskOp, moduleOp)) {
+            swTasks.push_back(std::move(task.value()));
+        }
+    }
+    return swTasks;
+}
+
+size_t AddSwKernelInstructionPrefetchPass::regroupSwTasks(mlir::func::FuncOp func, mlir::ModuleOp moduleOp) {
+    VPUIP::ShaveL2CacheSimulator cache(checked_cast<size_t>(cacheSize.getValue()));
+    const auto swTasks = collectSwTasks(func, moduleOp);
+
+    size_t movedTasks = 0;
+    size_t runBegin = 0;
+    while (runBegin < swTasks.size()) {
+        // Only the tasks which are adjacent in the IR form a run, so that no other op has to be moved around them
+        auto runEnd = runBegin + 1;
+        while (runEnd < swTasks.size() && swTasks[runEnd - 1].taskOp->getNextNode() == swTasks[runEnd].taskOp &&
+               isInterchangeable(swTasks[runBegin], swTasks[runEnd])) {
+            ++runEnd;
+        }
+
+        const auto run = ArrayRef<SwTask>(swTasks).slice(runBegin, runEnd - runBegin);
+        runBegin = runEnd;
+
+        if (run.size() < 2) {
+            accessKernel(cache, run.front());
+            continue;
+        }
+
+        llvm::MapVector<StringRef, SmallVector<const SwTask*>> kernelGroups;
+        for (const auto& task : run) {
+            kernelGroups[task.kernelName].push_back(&task);
+        }
+
+        SmallVector<const SwTask*> newOrder;
+        newOrder.reserve(run.size());
+
+        // kernels which are still in the cache go first, the most recently used one continues the previous run
+        for (const auto& kernelName : cache.getUsageHistory()) {
+            auto groupIt = kernelGroups.find(kernelName);
+            if (groupIt != kernelGroups.end()) {
+                newOrder.append(groupIt->second.begin(), groupIt->second.end());
+                groupIt->second.clear();
+            }
+        }
+        for (const auto& group : kernelGroups) {
+            newOrder.append(group.second.begin(), group.second.end());
+        }
+
+        const auto runMovedTasks = llvm::count_if(llvm::enumerate(newOrder), [&](const auto& item) {
+            return item.value() != &run[item.index()];
+        });
+        if (runMovedTasks != 0) {
+            auto insertionPoint = run.back().taskOp->getNextNode();
+            for (const auto* task : newOrder) {
+                task->taskOp->moveBefore(insertionPoint);
+            }
+            movedTasks += checked_cast<size_t>(runMovedTasks);
+            _log.trace("Regrouped {0} SW tasks on tile {1} into {2} kernel groups", run.size(),
+                       getTileIndex(run.front()), kernelGroups.size());
+        }
+
+        for (const auto* task : newOrder) {
+            accessKernel(cache, *task);
+        }
+    }
+
+    return movedTasks;
+}
+
+mlir::SymbolRefAttr AddSwKernelInstructionPrefetchPass::getCachePrefetchFunction(mlir::ModuleOp moduleOp) {
+    auto ctx = moduleOp.getContext();
+    auto vpuswModule = VPUIP::getVPUSWModule(moduleOp, _log);
+    auto functionSymbol = mlir::SymbolRefAttr::get(ctx, vpuswModule.getName().value(),
+                                                   {mlir::SymbolRefAttr::get(ctx, cachePrefetchFuncName)});
+
+    if (vpuswModule.lookupSymbol<mlir::func::FuncOp>(cachePrefetchFuncName) != nullptr) {
+        return functionSymbol;
+    }
+
+    OpBuilderLogger builderLog(_log.nest());
+    auto innerModuleBuilder = mlir::OpBuilder::atBlockBegin(vpuswModule.getBody(), &builderLog);
+    const auto funcType = mlir::FunctionType::get(ctx, {}, {});
+    auto funcOp =
+            innerModuleBuilder.create<mlir::func::FuncOp>(mlir::UnknownLoc::get(ctx), cachePrefetchFuncName, funcType);
+    funcOp.setSymVisibilityAttr(mlir::StringAttr::get(ctx, "private"));
+    funcOp->setAttr(vpuTaskTypeAttrName, mlir::SymbolRefAttr::get(ctx, VPU::stringifyActShaveTaskType(
+                                                                               VPU::ActShaveTaskType::CACHE_PREFETCH)));
+
+    return functionSymbol;
+}
+
+size_t AddSwKernelInstructionPrefetchPass::insertPrefetches(mlir::func::FuncOp func, mlir::ModuleOp moduleOp) {
+    VPUIP::ShaveL2CacheSimulator cache(checked_cast<size_t>(cacheSize.getValue()));
+    const auto swTasks = collectSwTasks(func, moduleOp);
+
+    mlir::SymbolRefAttr prefetchFunction;
+    OpBuilderLogger builderLog(_log.nest());
+    mlir::OpBuilder builder(func.getContext(), &builderLog);
+
+    // Per tile, the first compute task of the latest stretch of tasks which wait for the same barriers.
+    // All tasks of such stretch become ready at once, so the prefetch is placed in front of the whole stretch.
+    llvm::DenseMap<int64_t, const SwTask*> stretchBegins;
+
+    size_t insertedPrefetches = 0;
+    for (const auto& task : swTasks) {
+        if (!isComputeTask(task)) {
+            if (isInvalidatingCacheOp(task)) {
+                // prefetched code must not be placed before the invalidation
+                stretchBegins.clear();
+            }
+            accessKernel(cache, task);
+            continue;
+        }
+
+        auto& stretchBegin = stretchBegins[getTileIndex(task)];
+        if (stretchBegin == nullptr ||
+            !llvm::equal(stretchBegin->taskOp.getWaitBarriers(), task.taskOp.getWaitBarriers())) {
+            stretchBegin = &task;
+        }
+
+        // A task without wait barriers starts as soon as the previous task on the tile is done,
+        // there is no idle time to hide the kernel code fetch in
+        const auto isPrefetchUseful = !task.taskOp.getWaitBarriers().empty() &&
+                                      getKernelTextSize(task.kernelName) <= cache.getCapacity();
+
+        if (isPrefetchUseful && !cache.isLoaded(task.kernelName)) {
+            if (prefetchFunction == nullptr) {
+                prefetchFunction = getCachePrefetchFunction(moduleOp);
+            }
+
+            _log.trace("Prefetch kernel '{0}' for task at '{1}'", task.kernelName, task.taskOp->getLoc());
+
+            builder.setInsertionPoint(stretchBegin->taskOp);
+            const auto loc = appendLoc(task.taskOp->getLoc(), "_cache_prefetch");
+            const auto buffers = mlir::ValueRange();
+            auto prefetchOp = VPURT::wrapIntoTaskOp<VPUIP::SwKernelOp>(
+                    builder, mlir::ValueRange(), mlir::ValueRange(), loc, buffers, buffers, nullptr, prefetchFunction,
+                    getIntAttr(builder, getTileIndex(task)));
+            prefetchOp->setAttr(kernelElfNameAttrName, builder.getStringAttr(task.kernelName));
+            VPUIP::initSwKernel(prefetchOp, buffers, buffers, {}, _log.nest());
+
+            ++insertedPrefetches;
+        }
+
+        accessKernel(cache, task);
+    }
+
+    return insertedPrefetches;
+}
+
+void AddSwKernelInstructionPrefetchPass::safeRunOnFunc() {
+    auto func = getOperation();
+    auto moduleOp = func->getParentOfType<mlir::ModuleOp>();
+
+    VPUX_THROW_UNLESS(cacheSize.getValue() > 0, "Invalid ActShave L2 cache size {0}", cacheSize.getValue());
+
+    const auto movedTasks = regroupSwTasks(func, moduleOp);
+    const auto insertedPrefetches = insertPrefetches(func, moduleOp);
+
+    _log.info("Moved {0} SW tasks to reuse cached kernel code, inserted {1} kernel code prefetches", movedTasks,
+              insertedPrefetches);
+}
+
+}  // namespace
+
+//
+// createAddSwKernelInstructionPrefetchPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::VPUIP::arch40xx::createAddSwKernelInstructionPrefetchPass(Logger log) {
+    return std::make_unique<AddSwKernelInstructionPrefetchPass>(log);
+}
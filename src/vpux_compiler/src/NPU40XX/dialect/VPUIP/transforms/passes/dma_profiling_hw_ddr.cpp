@@ -69,16 +69,18 @@ private:
 
 class DMATaskProfilingHwDdrPass final : public VPUIP::arch40xx::DMATaskProfilingHwDdrBase<DMATaskProfilingHwDdrPass> {
 public:
-    explicit DMATaskProfilingHwDdrPass(DMAProfilingMode dmaProfilingMode, Logger log)
-            : _dmaProfilingMode(dmaProfilingMode) {
+    explicit DMATaskProfilingHwDdrPass(DMAProfilingMode dmaProfilingMode, int64_t samplingPeriod, Logger log)
+            : _dmaProfilingMode(dmaProfilingMode), _samplingPeriod(samplingPeriod) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
 private:
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
     void safeRunOnModule() final;
 
 private:
     DMAProfilingMode _dmaProfilingMode;
+    int64_t _samplingPeriod;
     FirstDMAQueueTracker firstDMATracker;
     LastDMAQueueTracker lastDMATracker;
 
@@ -90,6 +92,19 @@ private:
                                           VPURT::TaskOp previousBufferCopyTask);
 };
 
+mlir::LogicalResult DMATaskProfilingHwDdrPass::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+
+    if (samplingPeriod.hasValue()) {
+        _samplingPeriod = samplingPeriod.getValue();
+    }
+    VPUX_THROW_UNLESS(_samplingPeriod > 0, "Profiling sampling period must be positive, got {0}", _samplingPeriod);
+
+    return mlir::success();
+}
+
 void DMATaskProfilingHwDdrPass::safeRunOnModule() {
     auto moduleOp = getOperation();
     auto* ctx = moduleOp->getContext();
@@ -98,7 +113,6 @@ void DMATaskProfilingHwDdrPass::safeRunOnModule() {
     if (enableDMAProfiling.hasValue()) {
         _dmaProfilingMode = getDMAProfilingMode(arch, enableDMAProfiling.getValue());
     }
-
     IE::CNNNetworkOp netOp;
     mlir::func::FuncOp funcOp;
     IE::CNNNetworkOp::getFromModule(moduleOp, netOp, funcOp);
@@ -125,6 +139,7 @@ void DMATaskProfilingHwDdrPass::safeRunOnModule() {
 void DMATaskProfilingHwDdrPass::setupStaticProfiling(mlir::MLIRContext* ctx, IE::CNNNetworkOp netOp,
                                                      mlir::func::FuncOp funcOp) {
     uint32_t dmaHwpId = 0;
+    int64_t dmaTaskIdx = 0;
     funcOp->walk([&](VPURT::TaskOp taskOp) {
         if (!vpux::isProfiledDmaTask(taskOp)) {
             return mlir::WalkResult::skip();
@@ -137,6 +152,11 @@ void DMATaskProfilingHwDdrPass::setupStaticProfiling(mlir::MLIRContext* ctx, IE:
             }
         }
 
+        // DMAs left out by sampling keep HWP ID 0, so their records land in the dummy entry
+        if (dmaTaskIdx++ % _samplingPeriod != 0) {
+            return mlir::WalkResult::skip();
+        }
+
         if (dmaHwpId >= VPUIP::HW_DMA_PROFILING_STATIC_ID_LIMIT - 1) {
             _log.warning("Some DMA task cannot be profiled.");
             _log.info("First task not profiled: '{0}'", taskOp->getLoc());
@@ -187,6 +207,7 @@ void DMATaskProfilingHwDdrPass::setupProfiling(mlir::MLIRContext* ctx, mlir::Mod
     mlir::OpBuilder builder(&(funcOp.getFunctionBody()), &builderLog);
 
     SmallVector<VPURT::TaskOp> tasks;
+    int64_t dmaTaskIdx = 0;
     funcOp->walk([&](VPURT::TaskOp taskOp) {
         if (!vpux::isProfiledDmaTask(taskOp)) {
             return mlir::WalkResult::skip();
@@ -199,6 +220,11 @@ void DMATaskProfilingHwDdrPass::setupProfiling(mlir::MLIRContext* ctx, mlir::Mod
             }
         }
 
+        // DMAs left out by sampling keep HWP ID 0, so their records land in the dummy entry which is never copied
+        if (dmaTaskIdx++ % _samplingPeriod != 0) {
+            return mlir::WalkResult::skip();
+        }
+
         tasks.push_back(taskOp);
         return mlir::WalkResult::advance();
     });
@@ -339,6 +365,6 @@ VPURT::TaskOp DMATaskProfilingHwDdrPass::generateBufferCopyAfter(mlir::OpBuilder
 //
 
 std::unique_ptr<mlir::Pass> vpux::VPUIP::arch40xx::createDMATaskProfilingHwDdrPass(DMAProfilingMode dmaProfilingMode,
-                                                                                   Logger log) {
-    return std::make_unique<DMATaskProfilingHwDdrPass>(dmaProfilingMode, log);
+                                                                                   int64_t samplingPeriod, Logger log) {
+    return std::make_unique<DMATaskProfilingHwDdrPass>(dmaProfilingMode, samplingPeriod, log);
 }
@@ -6,9 +6,13 @@
 #include "vpux/compiler/NPU40XX/dialect/VPUIP/transforms/passes.hpp"
 #include "vpux/compiler/dialect/VPUIP/transforms/passes/unroll_cluster_tiling.hpp"
 
+#include "vpux/compiler/core/cost_model_utils.hpp"
 #include "vpux/compiler/dialect/VPU/utils/distributed_tensor_utils.hpp"
+#include "vpux/compiler/dialect/VPUIP/utils/dma_partitioning.hpp"
 #include "vpux/compiler/dialect/VPUIP/utils/utils.hpp"
 #include "vpux/compiler/dialect/VPURT/IR/task.hpp"
+#include "vpux/compiler/dialect/VPURT/interfaces/inference_execution_simulator.hpp"
+#include "vpux/compiler/utils/dma.hpp"
 #include "vpux/utils/core/error.hpp"
 
 #include <mlir/Transforms/GreedyPatternRewriteDriver.h>
@@ -18,6 +22,9 @@ using namespace vpux;
 namespace {
 
 using BuffersPair = std::pair<mlir::Value, mlir::Value>;
+using PortsPair = std::pair<int64_t, int64_t>;
+// Sizes of the two parts along the split dim
+using PartSizes = std::pair<int64_t, int64_t>;
 
 Shape getSplitShape(NDTypeInterface bufferType, vpux::Dim tileDim, int64_t newDimSize) {
     Shape subShape = bufferType.getShape().toValues();
@@ -70,7 +77,8 @@ NDTypeInterface getNewBufferType(NDTypeInterface bufferType, vpux::Dim tileDim,
 
 // Replace single allocation with 2 separate allocations. These allocations cover same memory range, but first points to
 // the beginning of buffer, second points to the middle or place with offset
-BuffersPair getReplacementBuffers(mlir::Value originalBuffer, vpux::Dim tileDim, mlir::OpBuilder builder) {
+BuffersPair getReplacementBuffers(mlir::Value originalBuffer, vpux::Dim tileDim, PartSizes partSizes,
+                                  mlir::OpBuilder builder) {
     const auto bufferType = originalBuffer.getType().cast<NDTypeInterface>();
     auto bufferOp = originalBuffer.getDefiningOp<VPURT::DeclareBufferOp>();
 
@@ -91,7 +99,7 @@ BuffersPair getReplacementBuffers(mlir::Value originalBuffer, vpux::Dim tileDim,
                 ->getResult(0);
     };
 
-    const auto [firstPartSize, secondPartSize] = VPUIP::getSplitPartSizes(bufferType, tileDim);
+    const auto [firstPartSize, secondPartSize] = partSizes;
     const auto extraOffset = Byte(firstPartSize * origStrides[tileDim]).count();
 
     auto firstBuff = getTiledBuf(/*dimOffset=*/0, firstPartSize, /*byteOffset=*/0, "_first_part");
@@ -100,7 +108,8 @@ BuffersPair getReplacementBuffers(mlir::Value originalBuffer, vpux::Dim tileDim,
     return {firstBuff, secondBuff};
 }
 
-BuffersPair getConstantParts(mlir::Value originalConstant, vpux::Dim tileDim, mlir::OpBuilder builder) {
+BuffersPair getConstantParts(mlir::Value originalConstant, vpux::Dim tileDim, PartSizes partSizes,
+                             mlir::OpBuilder builder) {
     auto cstOp = originalConstant.getDefiningOp<Const::DeclareOp>();
 
     const auto cstType = cstOp.getOutput().getType().cast<vpux::NDTypeInterface>();
@@ -115,7 +124,7 @@ BuffersPair getConstantParts(mlir::Value originalConstant, vpux::Dim tileDim, ml
         return builder.createOrFold<VPUIP::SubViewOp>(newLoc, cstOp, offset.raw(), newShape.raw());
     };
 
-    const auto [firstPartSize, secondPartSize] = VPUIP::getSplitPartSizes(cstType, tileDim);
+    const auto [firstPartSize, secondPartSize] = partSizes;
     auto firstCst = createCstPart(0, firstPartSize, "_first_part");
     auto secondCst = createCstPart(firstPartSize, secondPartSize, "_second_part");
 
@@ -123,7 +132,7 @@ BuffersPair getConstantParts(mlir::Value originalConstant, vpux::Dim tileDim, ml
 }
 
 void replaceDmaWithTwoParts(VPURT::TaskOp taskOp, VPUIP::NNDMAOp dmaOp, BuffersPair inputs, BuffersPair outputs,
-                            int64_t numDmaPorts, mlir::OpBuilder builder, vpux::Logger log) {
+                            PortsPair partPorts, mlir::OpBuilder builder, vpux::Logger log) {
     builder.setInsertionPoint(taskOp);
     const auto insertNewDma = [&](mlir::Value input, mlir::Value output, int64_t newDmaPort, StringRef locSuffix) {
         const auto newLoc = takeOpLoc(taskOp, locSuffix);
@@ -133,11 +142,8 @@ void replaceDmaWithTwoParts(VPURT::TaskOp taskOp, VPUIP::NNDMAOp dmaOp, BuffersP
                 /*compress_candidate=*/nullptr);  // split gives more improvement than compression
     };
 
-    int64_t firstPartPort = dmaOp.getPort().value();
-    int64_t secondPartPort = (firstPartPort + 1) % numDmaPorts;
-
-    insertNewDma(inputs.first, outputs.first, firstPartPort, "_first_part");
-    insertNewDma(inputs.second, outputs.second, secondPartPort, "_second_part");
+    insertNewDma(inputs.first, outputs.first, partPorts.first, "_first_part");
+    insertNewDma(inputs.second, outputs.second, partPorts.second, "_second_part");
 
     SmallVector<mlir::Value> oldArgs{dmaOp.getInput(), dmaOp.getOutputBuff()};
     taskOp->erase();
@@ -159,22 +165,18 @@ bool isTrivialConst(Const::DeclareOp cstOp) {
            transformations.back().getPositionRequirement() == vpux::Const::details::PositionRequirement::NONE;
 }
 
-// Non trivial transforms requires folding and flattening to keep content correct
-void splitFoldedConstToBufferDma(VPURT::TaskOp taskOp, VPUIP::NNDMAOp dmaOp, Const::DeclareOp cstOp, vpux::Dim tileDim,
-                                 int64_t numDmaPorts, mlir::OpBuilder builder, vpux::Logger log) {
+// Non trivial transforms requires folding and flattening to keep content correct. Returns false when the DMA is kept
+bool splitFoldedConstToBufferDma(VPURT::TaskOp taskOp, VPUIP::NNDMAOp dmaOp, Const::DeclareOp cstOp, vpux::Dim tileDim,
+                                 PartSizes partSizes, PortsPair partPorts, mlir::OpBuilder builder, vpux::Logger log) {
     const auto cstType = cstOp.getOutput().getType().cast<vpux::NDTypeInterface>();
     const auto strides = cstType.getStrides();
     // In case of subbyte type, which has non-byte stride along tiling dim - don't attempt to split this constant
     const auto tileDimStride = strides[tileDim];
     if (tileDimStride.count() % CHAR_BIT != 0) {
         log.trace("Can't split constant with non-byte stride");
-        return;
-    }
-    auto [firstPartSize, secondPartSize] = VPUIP::getSplitPartSizes(cstType, tileDim);
-    if (firstPartSize != secondPartSize) {
-        log.trace("Can't split constant with odd tiling dim");
-        return;
+        return false;
     }
+    const auto [firstPartSize, secondPartSize] = partSizes;
 
     const auto content = cstOp.getContent();
     const auto contentType = content.getType();
@@ -183,7 +185,7 @@ void splitFoldedConstToBufferDma(VPURT::TaskOp taskOp, VPUIP::NNDMAOp dmaOp, Con
     const auto isUnsupportedSubByteStorageType = elemTypeBitSize < CHAR_BIT && elemTypeBitSize > 1;
     if (isUnsupportedSubByteStorageType) {
         log.trace("Can't split constant with unsupported element type");
-        return;
+        return false;
     }
     log.trace("Splitting FoldedConst->Buffer DMA");
     const auto bufSize = checked_cast<size_t>(contentType.getTotalAllocSize().count());
@@ -205,7 +207,7 @@ void splitFoldedConstToBufferDma(VPURT::TaskOp taskOp, VPUIP::NNDMAOp dmaOp, Con
 
         const auto fullShape = rankedTensorType.getShape();
         SmallVector<int64_t> newShapeVec(fullShape.begin(), fullShape.end());
-        newShapeVec[tileDim.ind()] /= 2;
+        newShapeVec[tileDim.ind()] = newDimSize;
         const auto partRankedTensorType = rankedTensorType.clone(newShapeVec, rankedElemType);
         const auto denseAttr = mlir::DenseElementsAttr::getFromRawBuffer(partRankedTensorType, partContent);
         const auto newLoc = takeOpLoc(cstOp, locSuffix);
@@ -218,35 +220,90 @@ void splitFoldedConstToBufferDma(VPURT::TaskOp taskOp, VPUIP::NNDMAOp dmaOp, Con
     auto secondCst = createCstPart(firstPartSize, secondPartSize, "_second_part");
 
     BuffersPair inputBuffers = {firstCst, secondCst};
-    auto outputBuffers = getReplacementBuffers(dmaOp.getOutputBuff(), tileDim, builder);
-    replaceDmaWithTwoParts(taskOp, dmaOp, inputBuffers, outputBuffers, numDmaPorts, builder, log);
+    auto outputBuffers = getReplacementBuffers(dmaOp.getOutputBuff(), tileDim, partSizes, builder);
+    replaceDmaWithTwoParts(taskOp, dmaOp, inputBuffers, outputBuffers, partPorts, builder, log);
+    return true;
 }
 
-void splitDmaIntoParts(VPURT::TaskOp taskOp, int64_t numDmaPorts, mlir::OpBuilder builder, vpux::Logger log) {
+// Returns false when the DMA is kept
+bool splitDmaIntoParts(VPURT::TaskOp taskOp, vpux::Dim tileDim, PartSizes partSizes, PortsPair partPorts,
+                       mlir::OpBuilder builder, vpux::Logger log) {
     auto dmaOp = mlir::dyn_cast<VPUIP::NNDMAOp>(taskOp.getInnerTaskOp());
-    const auto inputBuffType = dmaOp.getInput().getType().cast<vpux::NDTypeInterface>();
-    const auto maybeTileDim = VPUIP::getCopyDMATilingDim(dmaOp);
-    if (!maybeTileDim.has_value()) {
-        log.trace("Can't find split dim for shape {0}, skip", inputBuffType.getShape());
-        return;
-    }
-    const auto tileDim = maybeTileDim.value();
 
     BuffersPair inputBuffers;
     if (auto inputCst = dmaOp.getInput().getDefiningOp<Const::DeclareOp>()) {
         if (!isTrivialConst(inputCst)) {
-            splitFoldedConstToBufferDma(taskOp, dmaOp, inputCst, tileDim, numDmaPorts, builder, log);
-            return;
+            return splitFoldedConstToBufferDma(taskOp, dmaOp, inputCst, tileDim, partSizes, partPorts, builder, log);
         }
-        inputBuffers = getConstantParts(dmaOp.getInput(), tileDim, builder);
+        inputBuffers = getConstantParts(dmaOp.getInput(), tileDim, partSizes, builder);
         log.trace("Splitting Const->Buffer DMA");
     } else {
-        inputBuffers = getReplacementBuffers(dmaOp.getInput(), tileDim, builder);
+        inputBuffers = getReplacementBuffers(dmaOp.getInput(), tileDim, partSizes, builder);
         log.trace("Splitting Buffer->Buffer DMA");
     }
 
-    auto outputBuffers = getReplacementBuffers(dmaOp.getOutputBuff(), tileDim, builder);
-    replaceDmaWithTwoParts(taskOp, dmaOp, inputBuffers, outputBuffers, numDmaPorts, builder, log);
+    auto outputBuffers = getReplacementBuffers(dmaOp.getOutputBuff(), tileDim, partSizes, builder);
+    replaceDmaWithTwoParts(taskOp, dmaOp, inputBuffers, outputBuffers, partPorts, builder, log);
+    return true;
+}
+
+//
+// DMA transfer model
+//
+
+SmallVector<VPUIP::DMASplitCandidate> getSplitCandidates(const VPUIP::DMATransferModel& model, VPUIP::NNDMAOp dmaOp,
+                                                         vpux::Dim tileDim) {
+    const auto inputType = dmaOp.getInput().getType().cast<NDTypeInterface>();
+    const auto outputType = dmaOp.getOutputBuff().getType().cast<NDTypeInterface>();
+    const auto getPartCycles = [&](int64_t dimOffset, int64_t dimSize) {
+        const auto inputPartType = getNewBufferType(inputType, tileDim, dimOffset, dimSize);
+        const auto outputPartType = getNewBufferType(outputType, tileDim, dimOffset, dimSize);
+        return VPUIP::getDMATransferCycles(model, inputPartType.changeStrides(inputType.getStrides()),
+                                           outputPartType.changeStrides(outputType.getStrides()));
+    };
+
+    const auto dimSize = inputType.getShape()[tileDim];
+    SmallVector<VPUIP::DMASplitCandidate> candidates;
+    for (auto firstPartSize : VPUIP::getDMASplitPoints(dimSize)) {
+        const auto secondPartSize = dimSize - firstPartSize;
+        candidates.push_back({{firstPartSize, secondPartSize},
+                              {getPartCycles(0, firstPartSize), getPartCycles(firstPartSize, secondPartSize)}});
+    }
+    return candidates;
+}
+
+struct QueueTask {
+    VPURT::TaskOp taskOp;
+    int64_t cycleStart;
+    int64_t cycleEnd;
+};
+
+using QueueTasks = SmallVector<QueueTask>;
+
+// Simulated cycles a DMA queue still has to spend on other tasks within the simulated window of the current task.
+// Tasks which are only partially inside the window contribute the part which is left after the window start.
+int64_t getQueueLoad(ArrayRef<QueueTask> queueTasks, VPURT::TaskOp currentTask, int64_t windowStart,
+                     int64_t windowEnd) {
+    int64_t load = 0;
+    // Tasks are sorted by start cycle. Parts of split DMAs may overlap other tasks of their queue, so the end cycles
+    // are not sorted and every task started before the window end has to be checked
+    const auto windowTasksEnd = llvm::partition_point(queueTasks, [&](const QueueTask& task) {
+        return task.cycleStart < windowEnd;
+    });
+    for (auto it = queueTasks.begin(); it != windowTasksEnd; ++it) {
+        if (it->taskOp == currentTask || it->cycleEnd <= windowStart) {
+            continue;
+        }
+        load += it->cycleEnd - std::max(it->cycleStart, windowStart);
+    }
+    return load;
+}
+
+void insertQueueTask(QueueTasks& queueTasks, const QueueTask& task) {
+    const auto it = llvm::partition_point(queueTasks, [&](const QueueTask& other) {
+        return other.cycleStart <= task.cycleStart;
+    });
+    queueTasks.insert(it, task);
 }
 
 //
@@ -255,14 +312,129 @@ void splitDmaIntoParts(VPURT::TaskOp taskOp, int64_t numDmaPorts, mlir::OpBuilde
 
 class SplitDMAToBalanceLoad final : public VPUIP::arch40xx::SplitDMAToBalanceLoadBase<SplitDMAToBalanceLoad> {
 public:
-    explicit SplitDMAToBalanceLoad(Logger log) {
+    explicit SplitDMAToBalanceLoad(bool enableDMACostModel, Logger log): _enableDMACostModel(enableDMACostModel) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
 private:
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
     void safeRunOnFunc() final;
+
+    void collectQueueTasks();
+    std::optional<VPUIP::DMAPartition> getPartitionByCostModel(VPURT::TaskOp taskOp, VPUIP::NNDMAOp dmaOp,
+                                                               vpux::Dim tileDim, int64_t dmaPortCount);
+    void updateQueueTasks(VPURT::TaskOp taskOp, int64_t origQueueId,
+                          std::optional<VPUIP::DmaChannelType> channelType, const VPUIP::DMAPartition& partition);
+
+private:
+    bool _enableDMACostModel;
+    std::optional<VPUIP::DMATransferModel> _model;
+    DenseMap<int64_t, QueueTasks> _queueTasks;
+    DenseMap<VPURT::TaskOp, QueueTask> _taskCycles;
 };
 
+mlir::LogicalResult SplitDMAToBalanceLoad::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+
+    if (enableDMACostModel.hasValue()) {
+        _enableDMACostModel = enableDMACostModel.getValue();
+    }
+
+    return mlir::success();
+}
+
+void SplitDMAToBalanceLoad::collectQueueTasks() {
+    _queueTasks.clear();
+    _taskCycles.clear();
+
+    auto func = getOperation();
+    CycleCostInfo cycleCostInfo(func);
+    VPURT::InferenceExecutionSimulator infSim(_log, func, cycleCostInfo);
+    infSim.runSim();
+
+    auto dmaTasks = infSim.getTaskCycleConfig(VPU::ExecutorKind::DMA_NN);
+    llvm::sort(dmaTasks, [](const VPURT::TaskConfig& lhs, const VPURT::TaskConfig& rhs) {
+        return lhs.cycleStart < rhs.cycleStart;
+    });
+
+    for (const auto& taskConfig : dmaTasks) {
+        auto dmaOp = mlir::dyn_cast<VPUIP::DMATypeOpInterface>(taskConfig.taskOp.getInnerTaskOp());
+        if (dmaOp == nullptr || !dmaOp.getPortVal().has_value()) {
+            continue;
+        }
+
+        const auto queueId = getDMAQueueIdEncoding(dmaOp.getPortVal().value(), dmaOp.getChannelType());
+        const auto cycleStart = checked_cast<int64_t>(taskConfig.cycleStart);
+        const QueueTask queueTask{taskConfig.taskOp, cycleStart,
+                                  cycleStart + checked_cast<int64_t>(taskConfig.cycleCost)};
+        _queueTasks[queueId].push_back(queueTask);
+        _taskCycles.insert({taskConfig.taskOp, queueTask});
+    }
+}
+
+std::optional<VPUIP::DMAPartition> SplitDMAToBalanceLoad::getPartitionByCostModel(VPURT::TaskOp taskOp,
+                                                                                   VPUIP::NNDMAOp dmaOp,
+                                                                                   vpux::Dim tileDim,
+                                                                                   int64_t dmaPortCount) {
+    const auto taskIt = _taskCycles.find(taskOp);
+    if (taskIt == _taskCycles.end()) {
+        _log.trace("No simulated cycles for DMA at '{0}'", dmaOp->getLoc());
+        return std::nullopt;
+    }
+    const auto& current = taskIt->second;
+
+    SmallVector<int64_t> portLoads(dmaPortCount, 0);
+    for (auto port : irange(dmaPortCount)) {
+        const auto queueId = getDMAQueueIdEncoding(port, dmaOp.getChannelType());
+        const auto queueIt = _queueTasks.find(queueId);
+        if (queueIt != _queueTasks.end()) {
+            portLoads[port] = getQueueLoad(queueIt->second, taskOp, current.cycleStart, current.cycleEnd);
+        }
+    }
+
+    const auto wholeSize = getShape(dmaOp.getInput())[tileDim];
+    const auto wholeCycles =
+            VPUIP::getDMATransferCycles(_model.value(), dmaOp.getInput().getType().cast<NDTypeInterface>(),
+                                        dmaOp.getOutputBuff().getType().cast<NDTypeInterface>());
+    const auto candidates = getSplitCandidates(_model.value(), dmaOp, tileDim);
+    const auto partition = VPUIP::getDMAPartition(_model->descriptorCycles, wholeSize, wholeCycles, candidates,
+                                                  dmaOp.getPort().value(), portLoads);
+    _log.trace("DMA at '{0}': whole {1} cycles, port loads {2}, predicted {3} cycles with parts {4} on ports {5}",
+               dmaOp->getLoc(), wholeCycles, portLoads, partition.predictedCycles, partition.partSizes,
+               partition.partPorts);
+    return partition;
+}
+
+// The split DMA is replaced by its parts in the queues, so that the next candidates see the load the parts put on
+// the ports. Each part is placed after the load its port already had within the window of the original DMA.
+// The task is already erased here, it is only used as a key
+void SplitDMAToBalanceLoad::updateQueueTasks(VPURT::TaskOp taskOp, int64_t origQueueId,
+                                             std::optional<VPUIP::DmaChannelType> channelType,
+                                             const VPUIP::DMAPartition& partition) {
+    const auto taskIt = _taskCycles.find(taskOp);
+    if (taskIt == _taskCycles.end()) {
+        return;
+    }
+    const auto current = taskIt->second;
+    _taskCycles.erase(taskIt);
+
+    // The address of the erased task may be reused by the new ops, so it must not stay in the queue
+    auto& origQueue = _queueTasks[origQueueId];
+    origQueue.erase(llvm::remove_if(origQueue,
+                                    [&](const QueueTask& task) {
+                                        return task.taskOp == taskOp;
+                                    }),
+                    origQueue.end());
+
+    for (auto partIdx : irange(partition.partPorts.size())) {
+        auto& queue = _queueTasks[getDMAQueueIdEncoding(partition.partPorts[partIdx], channelType)];
+        const auto partStart = current.cycleStart + getQueueLoad(queue, taskOp, current.cycleStart, current.cycleEnd);
+        insertQueueTask(queue, QueueTask{/*taskOp=*/nullptr, partStart, partStart + partition.partCycles[partIdx]});
+    }
+}
+
 void SplitDMAToBalanceLoad::safeRunOnFunc() {
     auto func = getOperation();
 
@@ -274,6 +446,11 @@ void SplitDMAToBalanceLoad::safeRunOnFunc() {
         return;
     }
 
+    if (_enableDMACostModel) {
+        _model = VPUIP::getDMATransferModel(VPU::getArch(module), &getContext());
+        collectQueueTasks();
+    }
+
     func->walk([&](VPURT::TaskOp taskOp) {
         if (taskOp.getExecutorKind() != VPU::ExecutorKind::DMA_NN) {
             return;
@@ -294,8 +471,37 @@ void SplitDMAToBalanceLoad::safeRunOnFunc() {
             _log.warning("Can't split op because of unsupported source");
             return;
         }
+
+        const auto maybeTileDim = VPUIP::getCopyDMATilingDim(dmaOp);
+        if (!maybeTileDim.has_value()) {
+            _log.trace("Can't find split dim for shape {0}, skip", getShape(dmaOp.getInput()));
+            return;
+        }
+        const auto tileDim = maybeTileDim.value();
+
+        const auto origPort = dmaOp.getPort().value();
+        PartSizes partSizes = VPUIP::getSplitPartSizes(dmaOp.getInput().getType().cast<NDTypeInterface>(), tileDim);
+        PortsPair partPorts{origPort, (origPort + 1) % dmaPortCount};
+        std::optional<VPUIP::DMAPartition> partition;
+        if (_enableDMACostModel) {
+            partition = getPartitionByCostModel(taskOp, dmaOp, tileDim, dmaPortCount);
+            if (!partition.has_value() || !partition->isSplit()) {
+                _log.trace("Keep DMA at '{0}' whole", dmaOp->getLoc());
+                dmaOp.setSplitCandidate(false);
+                return;
+            }
+            partSizes = PartSizes{partition->partSizes[0], partition->partSizes[1]};
+            partPorts = PortsPair{partition->partPorts[0], partition->partPorts[1]};
+        }
+
+        // The DMA is erased by the split
+        const auto channelType = dmaOp.getChannelType();
+        const auto origQueueId = getDMAQueueIdEncoding(origPort, channelType);
         mlir::OpBuilder builder(taskOp.getOperation());
-        splitDmaIntoParts(taskOp, dmaPortCount, builder, _log.nest());
+        const auto isSplit = splitDmaIntoParts(taskOp, tileDim, partSizes, partPorts, builder, _log.nest());
+        if (isSplit && partition.has_value()) {
+            updateQueueTasks(taskOp, origQueueId, channelType, partition.value());
+        }
     });
     _log.trace("Done");
 }
@@ -306,6 +512,7 @@ void SplitDMAToBalanceLoad::safeRunOnFunc() {
 // createSplitDMAToBalanceLoadPass
 //
 
-std::unique_ptr<mlir::Pass> vpux::VPUIP::arch40xx::createSplitDMAToBalanceLoadPass(Logger log) {
-    return std::make_unique<SplitDMAToBalanceLoad>(log);
+std::unique_ptr<mlir::Pass> vpux::VPUIP::arch40xx::createSplitDMAToBalanceLoadPass(bool enableDMACostModel,
+                                                                                   Logger log) {
+    return std::make_unique<SplitDMAToBalanceLoad>(enableDMACostModel, log);
 }
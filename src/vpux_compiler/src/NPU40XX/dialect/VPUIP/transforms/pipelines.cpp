@@ -30,10 +30,10 @@ void vpux::VPUIP::arch40xx::buildMemoryAllocationPipeline(mlir::OpPassManager& p
     pm.addPass(VPUIP::createFeasibleAllocationPass(
             VPU::getMemKind<VPU::MemoryKind::CMX_NN>, VPU::getMemKind<VPU::MemoryKind::DDR>, options.linearizeSchedule,
             options.enablePipelining, options.enablePrefetching, options.optimizeFragmentation,
-            options.optimizeDynamicSpilling, log));
+            options.optimizeDynamicSpilling, options.enableSpillCostEviction, log));
 
     if (options.enableCompressActivationSpill) {
-        pm.addPass(VPUIP::createAdjustSpillSizePass(log));
+        pm.addPass(VPUIP::createAdjustSpillSizePass(options.enableCompressDdrIntermediates, log));
     }
 
     if (options.enableGroupAsyncExecuteOps) {
@@ -104,7 +104,8 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
         pm.addPass(VPUIP::createFuseConstantsPass(log));
     }
 
-    pm.addPass(VPUIP::createSwizzlingPass(options.enableWeightsSwizzling, options.enableActivationSwizzling, log));
+    pm.addPass(VPUIP::createSwizzlingPass(options.enableWeightsSwizzling, options.enableActivationSwizzling,
+                                          options.enableSwizzlingPlanner, log));
 
     // Note: this pass introduces necessary VPUIP.Copy operations, thus, it must
     // be called *after* all copy optimizations are run (to ensure the
@@ -112,10 +113,16 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
     pm.addPass(VPUIP::createLegalizeRepeatingFuncCallsPass(log));
     pm.addPass(mlir::createCanonicalizerPass(grc));
 
+    const bool isOutliningEnabled = options.functionOutlining.hasValue();
+    if (isOutliningEnabled && options.enableCMXResidencyAcrossFunctionCalls) {
+        pm.addPass(VPUIP::createPlanCMXResidencyAcrossFunctionCallsPass(log));
+    }
+
     pm.addPass(VPUIP::createConvertTransferOpsToDMAsPass(log));
 
     if (options.enableProfiling && options.enableDPUProfiling) {
-        pm.addPass(VPUIP::createDPUProfilingPass(VPU::getMemKind<VPU::MemoryKind::CMX_NN>, log));
+        pm.addPass(VPUIP::createDPUProfilingPass(VPU::getMemKind<VPU::MemoryKind::CMX_NN>,
+                                                 options.profilingSamplingPeriod, log));
     }
 
     if (options.enableProfiling && options.enableSWProfiling) {
@@ -137,8 +144,15 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
 
     pm.addPass(VPUIP::createAddCopyBetweenSWKernelsAndNetworkIOPass(log));
 
+    if (!options.pgoProfile.empty()) {
+        pm.addPass(createApplyProfileGuidedCostsPass(options.pgoProfile, log));
+    }
     pm.addPass(VPUIP::createCalculateAsyncRegionCycleCostPass(log));
 
+    if (isOutliningEnabled && options.enableCMXResidencyAcrossFunctionCalls) {
+        pm.addPass(VPUIP::createResolveCMXResidencyOffsetsPass(log));
+    }
+
     VPUIP::arch40xx::buildMemoryAllocationPipeline(pm, VPUIP::arch40xx::MemoryAllocationOptions(options), log);
 
     pm.addPass(VPUIP::createOptimizeAsyncDepsPass(log));
@@ -190,14 +204,12 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
         pm.addPass(VPUIP::createCompressWeightsBTCPass(log));
     }
 
-    pm.addPass(VPUIP::arch40xx::createSplitDMAToBalanceLoadPass(log));
+    pm.addPass(VPUIP::arch40xx::createSplitDMAToBalanceLoadPass(options.enableDMACostModel, log));
 
     if (options.enableCompressActivationSpill) {
         pm.addPass(VPUIP::arch40xx::createCompressSpillDmaPass(log));
     }
 
-    bool isOutliningEnabled = options.functionOutlining.hasValue();
-
     if (isOutliningEnabled) {
         if (options.enableBarrierSchedWithFunctionOutlining) {
             pm.addPass(VPURT::arch40xx::createInsertSyncTasksPass(log));
@@ -211,7 +223,8 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
 
     if (options.enableProfiling) {
         auto dmaProfilingMode = getDMAProfilingMode(VPU::ArchKind::NPU40XX, options.enableDMAProfiling.getValue());
-        pm.addPass(VPUIP::arch40xx::createDMATaskProfilingHwDdrPass(dmaProfilingMode, log));
+        pm.addPass(VPUIP::arch40xx::createDMATaskProfilingHwDdrPass(dmaProfilingMode, options.profilingSamplingPeriod,
+                                                                    log));
     }
 
     if (options.enableControlGraphSplit) {
@@ -251,6 +264,10 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
     pm.addPass(VPUIP::arch40xx::createAddStartBarrierPass(log));
     pm.addPass(VPURT::arch37xx::createAddFinalBarrierPass(log));
 
+    if (options.enableSWKernelInstructionPrefetch) {
+        pm.addPass(VPUIP::arch40xx::createAddSwKernelInstructionPrefetchPass(log));
+    }
+
     pm.addPass(VPURT::arch37xx::createAddUpdateBarrierForSwKernelsPass(log));
 
     if (options.enableDmaOutOfOrder) {
@@ -272,6 +289,10 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
     pm.addPass(VPURT::createBarrierSimulationPass(log));
     pm.addPass(mlir::createCanonicalizerPass(grc));
 
+    if (options.enablePartialWorkloadManagement && options.enableWlmTimelinePlacement) {
+        pm.addPass(VPURT::createAnnotateBarrierReleaseCyclesPass(log));
+    }
+
     if (options.enableIntermediateBufferOutput) {
         pm.addPass(VPURT::createIntermediateBufferOutputPass(log));
     }
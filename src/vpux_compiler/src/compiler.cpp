@@ -24,15 +24,20 @@
 #include "vpux/compiler/init.hpp"
 #include "vpux/compiler/interfaces_registry.hpp"
 #include "vpux/compiler/options_mapper.hpp"
+#include "vpux/compiler/utils/ELF/shared_weights.hpp"
 #include "vpux/compiler/utils/dot_printer.hpp"
+#include "vpux/compiler/utils/function_timing.hpp"
 #include "vpux/compiler/utils/locations_verifier.hpp"
 #include "vpux/compiler/utils/logging.hpp"
 #include "vpux/compiler/utils/memory_usage_collector.hpp"
+#include "vpux/compiler/utils/shape_buckets.hpp"
 
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/format.hpp"
 #include "vpux/utils/core/memory_usage.hpp"
 #include "vpux/utils/core/optional.hpp"
+#include "vpux/utils/core/range.hpp"
 #include "vpux/utils/profiling/reports/api.hpp"
 
 #include <mlir/IR/Dialect.h>
@@ -46,6 +51,7 @@
 
 #include <openvino/core/dimension.hpp>
 #include <openvino/core/preprocess/pre_post_process.hpp>
+#include <openvino/pass/constant_folding.hpp>
 #include <openvino/pass/manager.hpp>
 #include <openvino/runtime/intel_npu/properties.hpp>
 #include <openvino/runtime/iplugin.hpp>
@@ -82,6 +88,15 @@ void checkPlatformSupportedForCompilation(const std::string_view platform) {
         VPUX_THROW(UNSUPPORTED_PLATFORM_ERROR_MESSAGE.data(), platform, intel_npu::PLATFORM::key());
     }
 }
+
+// The blob compiled with shared weights can't run without the weights blob, which is written only by
+// vpux-translate --export-ELF-shared-weights. The compiler API has no way to return it and the loader doesn't know
+// the shared weights sections, so the option is rejected here
+void checkSharedWeightsNotRequested(const intel_npu::Config& config) {
+    VPUX_THROW_WHEN(getSharedWeightsEnabled(config).value_or(false),
+                    "enable-shared-weights is supported only by vpux-translate --export-ELF-shared-weights");
+}
+
 constexpr uint32_t SUPPORTED_OPSET = 11;
 
 //
@@ -123,11 +138,18 @@ public:
         return _crashReproducerFile.empty() && _irPrintingFilter.empty();
     }
 
+    // Specifies whether to convert the duplicated IE constants on the context thread pool during the import.
+    // Only applies when the constants are not shared, shared ones only reference the model memory.
+    bool prefetchConstants() const {
+        return _importPrefetchConstants && !useSharedConstants();
+    }
+
 private:
     Logger _log;
 
     std::string _crashReproducerFile;
     bool _localReproducer = true;
+    bool _importPrefetchConstants = false;
 
     std::string _irPrintingFilter;
     std::string _irPrintingFile;
@@ -151,6 +173,7 @@ DeveloperConfig::DeveloperConfig(Logger log): _log(log) {
 #if defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
     parseEnv("IE_NPU_CRASH_REPRODUCER_FILE", _crashReproducerFile);
     parseEnv("IE_NPU_GEN_LOCAL_REPRODUCER", _localReproducer);
+    parseEnv("IE_NPU_IMPORT_PREFETCH_CONSTANTS", _importPrefetchConstants);
 
     parseEnv("IE_NPU_IR_PRINTING_FILTER", _irPrintingFilter);
     parseEnv("IE_NPU_IR_PRINTING_FILE", _irPrintingFile);
@@ -289,6 +312,11 @@ void DeveloperConfig::setup(mlir::PassManager& pm, const intel_npu::Config& conf
         addMemoryUsageCollector(pm, _log);
     }
 
+    // Per-function timing of the function passes, shows the imbalance between the outlined functions
+    if (_timingStream != nullptr) {
+        addFunctionTiming(pm, _log);
+    }
+
     // Enable pass verifiers
     const auto shouldEnableVerifiers = getEnableVerifiers(config).value_or(false);
     _log.info("Verifiers are {0}", shouldEnableVerifiers ? "enabled" : "disabled");
@@ -355,10 +383,11 @@ auto importNetwork(mlir::MLIRContext* ctx, const std::shared_ptr<ov::Model>& mod
                    const std::vector<std::shared_ptr<const ov::Node>>& originalParameters,
                    const std::vector<std::shared_ptr<const ov::Node>>& originalResults, const DeveloperConfig& devConf,
                    mlir::TimingScope& rootTiming, bool enableProfiling, vpux::DummyOpMode stubLayers,
-                   bool dynamicShapeToStatic, vpux::VPU::ArchKind arch, Logger log) {
+                   bool dynamicShapeToStatic, vpux::VPU::ArchKind arch, Logger log, bool runNGraphPasses) {
     auto importTiming = rootTiming.nest("Import network");
     return IE::importNetwork(ctx, model, originalParameters, originalResults, devConf.useSharedConstants(),
-                             importTiming, enableProfiling, stubLayers, dynamicShapeToStatic, arch, log.nest());
+                             devConf.prefetchConstants(), importTiming, enableProfiling, stubLayers,
+                             dynamicShapeToStatic, arch, log.nest(), runNGraphPasses);
 }
 
 void compileNetwork(mlir::ModuleOp module, mlir::PassManager& pm, mlir::TimingScope& rootTiming) {
@@ -509,7 +538,8 @@ mlir::OwningOpRef<mlir::ModuleOp> compileModel(mlir::MLIRContext& ctx, const std
                                                const std::vector<std::shared_ptr<const ov::Node>>& originalParameters,
                                                const std::vector<std::shared_ptr<const ov::Node>>& originalResults,
                                                DeveloperConfig& devConf, mlir::TimingScope& rootTiming,
-                                               const intel_npu::Config& config, vpux::Logger& log) {
+                                               const intel_npu::Config& config, vpux::Logger& log,
+                                               bool runNGraphPasses = true) {
     OV_ITT_TASK_CHAIN(COMPILER_IMPLEMENTATION, itt::domains::VPUXPlugin, "CompilerImpl::compile", "compileModel");
     const auto arch = getArchKind(config);
 
@@ -519,7 +549,8 @@ mlir::OwningOpRef<mlir::ModuleOp> compileModel(mlir::MLIRContext& ctx, const std
     const auto dummyOpReplacement = getDummyOpReplacement(config).value_or(DummyOpMode::DISABLED);
     mlir::OwningOpRef<mlir::ModuleOp> module =
             importNetwork(&ctx, model, originalParameters, originalResults, devConf, rootTiming,
-                          config.get<intel_npu::PERF_COUNT>(), dummyOpReplacement, dynamicShapeToStatic, arch, log);
+                          config.get<intel_npu::PERF_COUNT>(), dummyOpReplacement, dynamicShapeToStatic, arch, log,
+                          runNGraphPasses);
 
     OV_ITT_TASK_NEXT(COMPILER_IMPLEMENTATION, "PassManager");
 
@@ -652,6 +683,161 @@ CompilationResult compileImpl(mlir::MLIRContext& ctx, const std::shared_ptr<ov::
     return CompilationResult{std::move(moduleOp), model};
 }
 
+//
+// Shape buckets
+//
+
+// Sizes of the dynamic dimensions for every configured bucket which fits the bounds of the model. The last one is the
+// primary specialization, it is large enough for all the others. Empty when shape buckets are not configured or the
+// model is static
+SmallVector<SmallVector<int64_t>> getShapeBucketSizes(const std::shared_ptr<ov::Model>& model,
+                                                      const intel_npu::Config& config, Logger log) {
+    const auto bucketSizesStr = getShapeBuckets(config).value_or("");
+    if (bucketSizesStr.empty()) {
+        return {};
+    }
+
+    VPUX_THROW_UNLESS(getArchKind(config) == VPU::ArchKind::NPU40XX,
+                      "Shape buckets require shared weights, which are supported only by NPU40XX");
+
+    SmallVector<ov::Dimension> dynamicDims;
+    for (const auto& param : model->get_parameters()) {
+        const auto& shape = param->get_partial_shape();
+        VPUX_THROW_WHEN(shape.rank().is_dynamic(), "Shape buckets do not support dynamic rank of input '{0}'",
+                        param->get_friendly_name());
+        llvm::copy_if(shape, std::back_inserter(dynamicDims), [](const ov::Dimension& dim) {
+            return dim.is_dynamic();
+        });
+    }
+    if (dynamicDims.empty()) {
+        log.info("Model has static shapes, shape buckets '{0}' are ignored", bucketSizesStr);
+        return {};
+    }
+
+    SmallVector<SmallVector<int64_t>> buckets;
+    SmallVector<int64_t> primarySizes(dynamicDims.size(), 0);
+    for (auto bucketSizes : parseShapeBucketSizes(bucketSizesStr)) {
+        if (bucketSizes.size() == 1) {
+            bucketSizes.resize(dynamicDims.size(), bucketSizes.front());
+        }
+        VPUX_THROW_UNLESS(bucketSizes.size() == dynamicDims.size(),
+                          "Shape bucket {0} does not match the {1} dynamic dimensions of the model", bucketSizes,
+                          dynamicDims.size());
+
+        const auto isBucketInBounds = llvm::all_of(zip(dynamicDims, bucketSizes), [](const auto& dims) {
+            return std::get<0>(dims).compatible(ov::Dimension(std::get<1>(dims)));
+        });
+        if (!isBucketInBounds) {
+            log.warning("Shape bucket {0} is out of the bounds of the dynamic dimensions, skip it", bucketSizes);
+            continue;
+        }
+
+        for (auto dimIdx : irange(bucketSizes.size())) {
+            primarySizes[dimIdx] = std::max(primarySizes[dimIdx], bucketSizes[dimIdx]);
+        }
+        buckets.push_back(std::move(bucketSizes));
+    }
+
+    VPUX_THROW_WHEN(buckets.empty(), "None of the shape buckets '{0}' fits the dynamic dimensions", bucketSizesStr);
+
+    // The primary specialization is what a runtime unaware of the buckets loads, so it must serve every size
+    buckets.erase(std::remove(buckets.begin(), buckets.end(), primarySizes), buckets.end());
+    log.info("Shape bucket {0} is the primary specialization", primarySizes);
+    buckets.push_back(std::move(primarySizes));
+    return buckets;
+}
+
+// Static specialization of the model: the dynamic dimensions of the inputs are set to the sizes of the bucket.
+// The constants of the clone share the data with the original model
+std::shared_ptr<ov::Model> specializeModel(const std::shared_ptr<ov::Model>& model, ArrayRef<int64_t> bucketSizes) {
+    const auto& params = model->get_parameters();
+    std::map<size_t, ov::PartialShape> newShapes;
+    size_t dynamicDimIdx = 0;
+    for (auto paramIdx : irange(params.size())) {
+        auto shape = params[paramIdx]->get_partial_shape();
+        if (shape.is_static()) {
+            continue;
+        }
+        for (auto& dim : shape) {
+            if (dim.is_dynamic()) {
+                dim = ov::Dimension(bucketSizes[dynamicDimIdx++]);
+            }
+        }
+        newShapes.emplace(paramIdx, shape);
+    }
+
+    auto specializedModel = model->clone();
+    specializedModel->reshape(newShapes);
+
+    // The common nGraph passes ran on the dynamic model, fold the shape computations which became static
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::ConstantFolding>();
+    manager.run_passes(specializedModel);
+    return specializedModel;
+}
+
+// The model is transformed by the common nGraph passes once, then every bucket reshapes a clone of it and is compiled
+// by the MLIR pipeline, which depends on the static shapes. The primary specialization keeps its constants, the other
+// ones store them once in the shared weights of the container
+std::vector<uint8_t> compileShapeBuckets(mlir::MLIRContext& ctx, const std::shared_ptr<ov::Model>& model,
+                                         ArrayRef<SmallVector<int64_t>> bucketSizes, const intel_npu::Config& config,
+                                         Logger& log) {
+    DeveloperConfig devConf(log);
+
+    mlir::DefaultTimingManager tm;
+    devConf.setup(tm);
+
+    addLogging(ctx, log);
+    auto rootTiming = tm.getRootScope();
+
+    // All specializations describe the I/O of the original dynamic model in their metadata
+    const auto originalParameters = IE::buildOVParams(model);
+    const auto originalResults = IE::buildOVResults(model);
+
+    IE::NGraphPasses::runNGraphPasses(model, rootTiming, getArchKind(config));
+
+    auto sharedWeightsConfig = config;
+    auto backendConfig = sharedWeightsConfig.get<intel_npu::BACKEND_COMPILATION_PARAMS>();
+    backendConfig.append(" ").append("enable-shared-weights=true");
+    sharedWeightsConfig.update({{intel_npu::BACKEND_COMPILATION_PARAMS::key().data(), backendConfig}});
+
+    std::vector<std::vector<uint8_t>> blobs;
+    std::vector<std::vector<uint8_t>> weightsBlobs;
+    blobs.reserve(bucketSizes.size());
+    weightsBlobs.reserve(bucketSizes.size());
+    for (const auto& [bucketIdx, sizes] : bucketSizes | indexed) {
+        const auto isPrimary = bucketIdx + 1 == bucketSizes.size();
+        log.info("Compile shape bucket {0}", sizes);
+        auto bucketTiming = rootTiming.nest(printToString("Shape bucket {0}", sizes));
+
+        const auto specializedModel = specializeModel(model, sizes);
+        auto moduleOp = compileModel(ctx, specializedModel, originalParameters, originalResults, devConf, bucketTiming,
+                                     isPrimary ? config : sharedWeightsConfig, log, /*runNGraphPasses=*/false);
+        blobs.push_back(exportToELF(moduleOp.get(), log));
+        if (!isPrimary) {
+            weightsBlobs.push_back(ELF::exportSharedWeights(moduleOp.get(), log));
+        }
+    }
+
+    ShapeBuckets shapeBuckets;
+    for (const auto& [sizes, blob] : zip(bucketSizes, blobs)) {
+        shapeBuckets.buckets.push_back(ShapeBucket{sizes, blob});
+    }
+    const SmallVector<ArrayRef<uint8_t>> weightsBlobRefs(weightsBlobs.begin(), weightsBlobs.end());
+    const auto sharedWeights = weightsBlobRefs.empty() ? std::vector<uint8_t>{} : mergeSharedWeights(weightsBlobRefs);
+    shapeBuckets.sharedWeights = sharedWeights;
+    return packShapeBuckets(shapeBuckets);
+}
+
+// Shape buckets container is described by its primary specialization, which starts the container.
+// All the specializations carry the I/O of the original model
+ArrayRef<uint8_t> getMetadataBlob(ArrayRef<uint8_t> blob) {
+    if (isShapeBucketsBlob(blob)) {
+        return unpackShapeBuckets(blob).buckets.back().blob;
+    }
+    return blob;
+}
+
 auto createContext(mlir::DialectRegistry& registry, const intel_npu::Config& config) {
     auto interfacesRegistry = createInterfacesRegistry(getArchKind(config));
     interfacesRegistry->registerInterfaces(registry);
@@ -691,6 +877,7 @@ NetworkDescription CompilerImpl::compile(const std::shared_ptr<ov::Model>& model
                                          const intel_npu::Config& config) const {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "CompilerImpl::compile");
     checkPlatformSupportedForCompilation(config.get<intel_npu::PLATFORM>());
+    checkSharedWeightsNotRequested(config);
 
     Logger log("vpux-compiler", getLogLevel(config));
 
@@ -699,6 +886,15 @@ NetworkDescription CompilerImpl::compile(const std::shared_ptr<ov::Model>& model
     auto threadPool = enableMultithreading(ctx, config);
 
     auto peakMemStart = getPeakMemoryUsage();
+    const auto shapeBucketSizes = getShapeBucketSizes(model, config, log);
+    if (!shapeBucketSizes.empty()) {
+        auto container = compileShapeBuckets(ctx, model, shapeBucketSizes, config, log);
+        auto meta = VPUMI37XX::getNetworkMetadata(getMetadataBlob(container));
+
+        log.info("End of compilation memory usage: Peak {0} KB", getPeakMemoryUsage().count());
+        return NetworkDescription(std::move(container), std::move(meta));
+    }
+
     auto compilationResult = compileImpl(ctx, model, config, log);
 
     OV_ITT_TASK_CHAIN(COMPILER_IMPLEMENTATION, itt::domains::VPUXPlugin, "CompilerImpl::compile", "exportNetwork");
@@ -717,6 +913,7 @@ NetworkDescriptionView CompilerImpl::compile(const std::shared_ptr<ov::Model>& m
                                              BlobAllocator& allocator) const {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "CompilerImpl::compile");
     checkPlatformSupportedForCompilation(config.get<intel_npu::PLATFORM>());
+    checkSharedWeightsNotRequested(config);
 
     Logger log("vpux-compiler", getLogLevel(config));
 
@@ -725,6 +922,18 @@ NetworkDescriptionView CompilerImpl::compile(const std::shared_ptr<ov::Model>& m
     auto threadPool = enableMultithreading(ctx, config);
 
     auto peakMemStart = getPeakMemoryUsage();
+    const auto shapeBucketSizes = getShapeBucketSizes(model, config, log);
+    if (!shapeBucketSizes.empty()) {
+        // The container is assembled after all specializations are exported, so it is copied to the storage once
+        const auto container = compileShapeBuckets(ctx, model, shapeBucketSizes, config, log);
+        auto blobPtr = allocator.allocate(Byte(checked_cast<int64_t>(container.size())));
+        std::copy(container.begin(), container.end(), blobPtr);
+        BlobView blobView(blobPtr, container.size());
+
+        log.info("End of compilation memory usage: Peak {0} KB", getPeakMemoryUsage().count());
+        return NetworkDescriptionView(blobView, VPUMI37XX::getNetworkMetadata(getMetadataBlob(container)));
+    }
+
     auto compilationResult = compileImpl(ctx, model, config, log);
 
     OV_ITT_TASK_CHAIN(COMPILER_IMPLEMENTATION, itt::domains::VPUXPlugin, "CompilerImpl::compile", "exportNetwork");
@@ -771,7 +980,11 @@ NetworkDescription CompilerImpl::compile(const std::shared_ptr<const ov::Model>&
 //
 
 NetworkMetadata CompilerImpl::parse(const std::vector<uint8_t>& compiledNetwork, const intel_npu::Config&) const {
-    return VPUMI37XX::getNetworkMetadata(mlir::ArrayRef(compiledNetwork));
+    return VPUMI37XX::getNetworkMetadata(getMetadataBlob(compiledNetwork));
+}
+
+std::optional<PredictedPerformance> CompilerImpl::parsePredictedPerformance(ArrayRef<uint8_t> network) const {
+    return VPUMI37XX::getPredictedPerformance(getMetadataBlob(network));
 }
 
 //
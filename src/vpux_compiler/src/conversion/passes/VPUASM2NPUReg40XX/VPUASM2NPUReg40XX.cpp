@@ -44,16 +44,14 @@ mlir::LogicalResult BarrierRewriter::matchAndRewrite(VPUASM::ConfigureBarrierOp
     // value of numeric_limits<uint32_t>::max() - 1
     // At this point it is cast to uint32 as required by the NNRuntime with invalid barrier
     // represented by numeric_limits<uint32_t>::max()
-    auto regBarrierDescriptorAttr =
-            vpux::VPURegMapped::getRegMappedAttributeWithValues<vpux::NPUReg40XX::RegMapped_VpuBarrierCountConfigType>(
-                    rewriter, {
-                                      {"next_same_id_",
-                                       {{"next_same_id_", checked_cast_reg<NPUReg40XX::RegField_next_same_id_Type>(
-                                                                  static_cast<uint32_t>(origOp.getNextSameId()))}}},
-                                      {"producer_count_", {{"producer_count_", origOp.getProducerCount()}}},
-                                      {"consumer_count_", {{"consumer_count_", origOp.getConsumerCount()}}},
-                                      {"real_id_", {{"real_id_", origOp.getId()}}},
-                              });
+    NPUReg40XX::Descriptors::VpuBarrierCountConfig descriptor;
+    descriptor.write<NPUReg40XX::Fields::next_same_id_>(
+            checked_cast_reg<NPUReg40XX::RegField_next_same_id_Type>(static_cast<uint32_t>(origOp.getNextSameId())));
+    descriptor.write<NPUReg40XX::Fields::producer_count_>(origOp.getProducerCount());
+    descriptor.write<NPUReg40XX::Fields::consumer_count_>(origOp.getConsumerCount());
+    descriptor.write<NPUReg40XX::Fields::real_id_>(origOp.getId());
+
+    auto regBarrierDescriptorAttr = NPUReg40XX::VpuBarrierCountConfigAttr::get(rewriter.getContext(), descriptor);
     rewriter.create<NPUReg40XX::ConfigureBarrierOp>(origOp->getLoc(), regBarrierDescriptorAttr);
 
     rewriter.eraseOp(origOp);
@@ -172,21 +170,18 @@ mlir::LogicalResult ManagedBarrierRewriter::matchAndRewrite(VPUASM::ManagedBarri
         workItemRegVal = workItemIdx.value().getValue();
     }
 
-    auto regBarrierDescriptorAttr =
-            vpux::VPURegMapped::getRegMappedAttributeWithValues<vpux::NPUReg40XX::RegMapped_vpuTaskBarrierMapType>(
-                    rewriter, {{"tb_next_same_id",
-                                {{"tb_next_same_id", checked_cast_reg<NPUReg40XX::RegField_next_same_id_Type>(
-                                                             static_cast<uint32_t>(origOp.getNextSameId()))}}},
-                               {"tb_producer_count", {{"tb_producer_count", origOp.getProducerCount()}}},
-                               {"tb_consumer_count", {{"tb_consumer_count", origOp.getConsumerCount()}}},
-                               {"tb_real_id", {{"tb_real_id", origOp.getId()}}},
-                               {"tb_work_item_idx",
-                                {{"tb_work_item_idx",
-                                  checked_cast_reg<NPUReg40XX::RegField_tb_work_item_idxType>(workItemRegVal)}}},
-                               {"tb_enqueue_count",
-                                {{"tb_enqueue_count",
-                                  checked_cast_reg<NPUReg40XX::RegField_tb_enqueue_countType>(enqueueCount)}}}});
-
+    NPUReg40XX::Descriptors::vpuTaskBarrierMap descriptor;
+    descriptor.write<NPUReg40XX::Fields::tb_next_same_id>(
+            checked_cast_reg<NPUReg40XX::RegField_next_same_id_Type>(static_cast<uint32_t>(origOp.getNextSameId())));
+    descriptor.write<NPUReg40XX::Fields::tb_producer_count>(origOp.getProducerCount());
+    descriptor.write<NPUReg40XX::Fields::tb_consumer_count>(origOp.getConsumerCount());
+    descriptor.write<NPUReg40XX::Fields::tb_real_id>(origOp.getId());
+    descriptor.write<NPUReg40XX::Fields::tb_work_item_idx>(
+            checked_cast_reg<NPUReg40XX::RegField_tb_work_item_idxType>(workItemRegVal));
+    descriptor.write<NPUReg40XX::Fields::tb_enqueue_count>(
+            checked_cast_reg<NPUReg40XX::RegField_tb_enqueue_countType>(enqueueCount));
+
+    auto regBarrierDescriptorAttr = NPUReg40XX::vpuTaskBarrierMapAttr::get(rewriter.getContext(), descriptor);
     rewriter.create<NPUReg40XX::ManagedBarrierOp>(origOp.getLoc(), regBarrierDescriptorAttr);
     rewriter.eraseOp(origOp);
 
@@ -289,16 +284,13 @@ mlir::LogicalResult WorkItemRewriter::matchAndRewrite(VPUASM::WorkItemOp origOp,
         ;
     }
 
-    auto regWorkItemDescriptorAttr =
-            vpux::VPURegMapped::getRegMappedAttributeWithValues<vpux::NPUReg40XX::RegMapped_WorkItemType>(
-                    rewriter, {
-                                      {"desc_ptr", {{"desc_ptr", descPtrOffset}}},
-                                      {"wi_type", {{"wi_type", workItemType}}},
-                                      {"wi_unit", {{"wi_unit", realTaskIndex.getTileIdx()}}},
-                                      {"wi_sub_unit", {{"wi_sub_unit", realTaskIndex.getListIdx()}}},
-
-                              });
+    NPUReg40XX::Descriptors::WorkItem descriptor;
+    descriptor.write<NPUReg40XX::Fields::desc_ptr>(descPtrOffset);
+    descriptor.write<NPUReg40XX::Fields::wi_type>(workItemType);
+    descriptor.write<NPUReg40XX::Fields::wi_unit>(realTaskIndex.getTileIdx());
+    descriptor.write<NPUReg40XX::Fields::wi_sub_unit>(realTaskIndex.getListIdx());
 
+    auto regWorkItemDescriptorAttr = NPUReg40XX::WorkItemAttr::get(rewriter.getContext(), descriptor);
     rewriter.create<NPUReg40XX::WorkItemOp>(origOp.getLoc(), regWorkItemDescriptorAttr);
     rewriter.eraseOp(origOp);
     _log.trace("[{0}] Got '{1}' at '{2}'", getDebugName(), origOp->getName(), origOp->getLoc());
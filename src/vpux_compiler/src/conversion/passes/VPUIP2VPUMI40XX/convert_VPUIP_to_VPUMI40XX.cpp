@@ -18,6 +18,7 @@
 #include "vpux/compiler/utils/ELF/utils.hpp"
 
 #include "vpux/compiler/core/bounded_buffer.hpp"
+#include "vpux/compiler/core/cost_model_utils.hpp"
 #include "vpux/utils/core/disable_warning.hpp"
 #include "vpux/utils/profiling/metadata.hpp"
 
@@ -1401,7 +1402,8 @@ public:
 
         mlir::IntegerType uint8Type = mlir::IntegerType::get(ctx, 8, mlir::IntegerType::Unsigned);
 
-        rewriter.replaceOpWithNewOp<VPUMI40XX::ConfigureBarrierOp>(
+        auto releaseCycle = origOp->getAttr(barrierReleaseCycle);
+        auto newOp = rewriter.replaceOpWithNewOp<VPUMI40XX::ConfigureBarrierOp>(
                 origOp,
                 trivialIndexType,                                   // setup all barriers with the trivial index (0)
                 checked_cast<uint8_t>(origOp.getId()),              // real_id
@@ -1409,6 +1411,10 @@ public:
                 mlir::IntegerAttr::get(uint8Type, producer_count),  // origOp.producer_countAttr(),
                 mlir::IntegerAttr::get(uint8Type, consumer_count),  // origOp.consumer_countAttr(),
                 origOp.getIsFinalBarrier());
+        // keep the predicted timeline for the workload management
+        if (releaseCycle != nullptr) {
+            newOp->setAttr(barrierReleaseCycle, releaseCycle);
+        }
         barrierCount++;
         return mlir::success();
     }
@@ -314,12 +314,18 @@ size_t vpux::getDMACost(mlir::Value input, mlir::Value output, VPU::ArchKind arc
         return calculateMultiClusterDMACost(output, inElemType, outElemType, archKind, costModel);
     }
 
-    auto inputShape = getShape(input);
-    auto outputShape = getShape(output);
+    return getDMACost(inputType.cast<vpux::NDTypeInterface>(), outputType.cast<vpux::NDTypeInterface>(), archKind,
+                      costModel);
+}
+
+size_t vpux::getDMACost(vpux::NDTypeInterface inputType, vpux::NDTypeInterface outputType, VPU::ArchKind archKind,
+                        const std::shared_ptr<VPUNN::VPUCostModel>& costModel) {
+    auto inElemType = getElementType(inputType.getElementType());
+    auto outElemType = getElementType(outputType.getElementType());
 
     // TODO: add layout info to VPUNN tensors
-    auto cost = costModel->DMA(getVPUDeviceType(archKind), {getVPUNNTensor(inputShape, inElemType)},
-                               {getVPUNNTensor(outputShape, outElemType)}, getMemoryLocation(inputType),
+    auto cost = costModel->DMA(getVPUDeviceType(archKind), {getVPUNNTensor(inputType.getShape(), inElemType)},
+                               {getVPUNNTensor(outputType.getShape(), outElemType)}, getMemoryLocation(inputType),
                                getMemoryLocation(outputType));
 
     return static_cast<size_t>(cost);
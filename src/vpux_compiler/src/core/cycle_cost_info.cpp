@@ -66,6 +66,13 @@ size_t CycleCostInfo::getCycleCost(mlir::Operation* op) {
         return _cycleCosts[op];
     }
 
+    // Cost measured in a previous run, see ApplyProfileGuidedCostsPass
+    if (auto profiledCost = op->getAttrOfType<mlir::IntegerAttr>(profiledCycleCost)) {
+        size_t cycleCost = checked_cast<size_t>(profiledCost.getInt());
+        storeCycleCost(cycleCost, op);
+        return cycleCost;
+    }
+
     _log.trace("Cost for mlir::Operation not found in cache, querying costModel");
     size_t cycleCost = costInterface.getOperationCycleCost(_costModel);
     storeCycleCost(cycleCost, op);
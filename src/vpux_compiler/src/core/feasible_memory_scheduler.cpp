@@ -38,7 +38,8 @@ FeasibleMemoryScheduler::FeasibleMemoryScheduler(VPU::MemoryKind memKind, VPU::M
                                                  LinearScan<mlir::Value, LinearScanHandler>& scan, VPU::ArchKind arch,
                                                  std::shared_ptr<VPUNN::VPUCostModel> costModel,
                                                  int64_t nceClusterCount, int64_t dmaCount,
-                                                 bool enableScheduleStatistics, bool optimizeFragmentation)
+                                                 bool enableScheduleStatistics, bool optimizeFragmentation,
+                                                 bool enableSpillCostEviction)
         : _log(log),
           _memKind(memKind),
           _secondLvlMemKind(secondLvlMemKind),
@@ -49,7 +50,8 @@ FeasibleMemoryScheduler::FeasibleMemoryScheduler(VPU::MemoryKind memKind, VPU::M
           _costModel(std::move(costModel)),
           _nceClusterCount(nceClusterCount),
           _enableScheduleStatistics(enableScheduleStatistics),
-          _optimizeFragmentation(optimizeFragmentation) {
+          _optimizeFragmentation(optimizeFragmentation),
+          _enableSpillCostEviction(enableSpillCostEviction) {
     _log.setName("feasible-memory-scheduler-allocator");
 
     auto dmaChannels = getDMAChannelsWithIndependentLinkAgents(arch);
@@ -1067,6 +1069,7 @@ void FeasibleMemoryScheduler::evictActiveOp(EvictionCandidate evictionCandidate)
 
     _readySpilledOps[evictionCandidate.buffer_] = evictionCandidate.bufferWriterIdx_;
     _spillBufferMap[evictionCandidate.bufferWriterIdx_].insert(evictionCandidate.buffer_);
+    _buffersWithDDRCopy.insert({evictionCandidate.bufferWriterIdx_, evictionCandidate.buffer_});
 
     _log.nest().trace("Mark dynamically spilled buffer as dead, '{0}'", evictionCandidate.buffer_);
     _scan.handler().markAsDead(evictionCandidate.buffer_);
@@ -1100,6 +1103,40 @@ size_t FeasibleMemoryScheduler::evictionPriority(operationIdxType writerOpIdx, m
     return 3;
 }
 
+double FeasibleMemoryScheduler::evictionSpillCost(operationIdxType writerOpIdx, mlir::Value buffer,
+                                                  size_t earliestConsumerIdx) {
+    if (!_enableSpillCostEviction) {
+        return 0.0;
+    }
+
+    // Spill read is always needed, spill write only if there is no valid copy of the buffer in DDR.
+    // Copy is valid if the same buffer was already spilled and no other operation has written to it since,
+    // in such case subsequent spill write is removed by spilling optimizations
+    const auto dmaCost = static_cast<double>(spilledOperationCycleCost(buffer));
+    const auto hasDDRCopy = _buffersWithDDRCopy.contains({writerOpIdx, buffer});
+    const auto spillCost = hasDDRCopy ? dmaCost : 2.0 * dmaCost;
+    const auto costPerByte = spillCost / static_cast<double>(std::max<AddressType>(_scan.handler().getSize(buffer), 1));
+
+    // Distance in IR order between next compute operation to be scheduled and the nearest compute consumer of
+    // the buffer. Buffers needed furthest in the future are cheapest to evict (Belady's policy)
+    auto nextComputeOpIdx = std::numeric_limits<size_t>::max();
+    for (auto& computeOpOrder : _computeOpOrder) {
+        if (!computeOpOrder.second.empty()) {
+            nextComputeOpIdx = std::min(nextComputeOpIdx, *computeOpOrder.second.begin());
+        }
+    }
+
+    size_t nextUseDistance = 0;
+    if (earliestConsumerIdx == std::numeric_limits<unsigned int>::max()) {
+        // no compute consumer left, buffer is only needed by DMAs or as network output
+        nextUseDistance = _opLevelVec.size();
+    } else if (nextComputeOpIdx != std::numeric_limits<size_t>::max() && earliestConsumerIdx > nextComputeOpIdx) {
+        nextUseDistance = earliestConsumerIdx - nextComputeOpIdx;
+    }
+
+    return costPerByte / static_cast<double>(1 + nextUseDistance);
+}
+
 size_t FeasibleMemoryScheduler::getOpBufferOutputIdx(operationIdxType opIdx, mlir::Value buffer) {
     size_t outputIdx = 0;
 
@@ -1122,6 +1159,16 @@ FeasibleMemoryScheduler::EvictionCandidate FeasibleMemoryScheduler::chooseCandid
     // and eviction candidates can be picked up from cache which was prepared during previous search
     // for spill write buffer
     if (!_evictionCandidatesCache.empty() && _scheduledOps.back().isSpillWrite()) {
+        if (_enableSpillCostEviction) {
+            // Spill costs depend on the DDR copies left by previous spills, re-rank the remaining candidates
+            std::set<EvictionCandidate, EvictionPriority> rerankedCandidates;
+            for (auto candidate : _evictionCandidatesCache) {
+                candidate.spillCost_ = evictionSpillCost(candidate.bufferWriterIdx_, candidate.buffer_,
+                                                         candidate.earliestConsumerIdx_);
+                rerankedCandidates.insert(candidate);
+            }
+            _evictionCandidatesCache = std::move(rerankedCandidates);
+        }
         auto evictionCandidate = *_evictionCandidatesCache.begin();
         _evictionCandidatesCache.erase(_evictionCandidatesCache.begin());
         return evictionCandidate;
@@ -1153,8 +1200,9 @@ FeasibleMemoryScheduler::EvictionCandidate FeasibleMemoryScheduler::chooseCandid
         auto size = _scan.handler().getSize(buffer);
         // in special case of multiple output buffers store output idx
         auto outputIdx = getOpBufferOutputIdx(executeOpIdx, buffer);
+        auto spillCost = evictionSpillCost(executeOpIdx, buffer, earliestConsumerIdx);
         _evictionCandidatesCache.insert(
-                EvictionCandidate(priority, earliestConsumerIdx, size, executeOpIdx, outputIdx, buffer));
+                EvictionCandidate(priority, spillCost, earliestConsumerIdx, size, executeOpIdx, outputIdx, buffer));
     }
 
     // Get eviction candidate with highest priority (beginning of set)
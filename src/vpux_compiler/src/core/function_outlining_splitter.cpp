@@ -26,6 +26,10 @@ struct RepeatingBlocksOptions : mlir::PassPipelineOptions<RepeatingBlocksOptions
             *this, "weights-as-inputs",
             llvm::cl::desc("Add const.DeclareOp's to the function argument list of each block"),
             llvm::cl::init(vpux::RepeatingBlocksOptions::WEIGHTS_AS_INPUTS_DEFAULT)};
+    vpux::BoolOption hashMatching{
+            *this, "hash-matching",
+            llvm::cl::desc("Find repeating blocks by matching sequences of structurally identical operations"),
+            llvm::cl::init(vpux::RepeatingBlocksOptions::HASH_MATCHING_DEFAULT)};
 };
 
 struct RepeatingBlocksSeparateFunctionsOptions : mlir::PassPipelineOptions<RepeatingBlocksOptions> {
@@ -35,6 +39,10 @@ struct RepeatingBlocksSeparateFunctionsOptions : mlir::PassPipelineOptions<Repea
     vpux::IntOption maxNumIterations{*this, "max-num-iterations",
                                      llvm::cl::desc("Maximum number of iterations to find a solution"),
                                      llvm::cl::init(vpux::RepeatingBlocksOptions::MAX_NUM_ITERATIONS_DEFAULT)};
+    vpux::BoolOption hashMatching{
+            *this, "hash-matching",
+            llvm::cl::desc("Find repeating blocks by matching sequences of structurally identical operations"),
+            llvm::cl::init(vpux::RepeatingBlocksSeparateFunctionsOptions::HASH_MATCHING_DEFAULT)};
 };
 
 struct BatchingOptions : mlir::PassPipelineOptions<BatchingOptions> {};
@@ -99,8 +107,10 @@ OutlinerPassOptions OutlinerPassOptions::createFromString(StringRef param) {
             size_t minOpsInBlock = opt->minOpsInBlock;
             size_t maxNumIterations = opt->maxNumIterations;
             bool weightsAsInputs = opt->weightsAsInputs;
+            bool hashMatching = opt->hashMatching;
 
-            options._options.emplace_back(RepeatingBlocksOptions{minOpsInBlock, maxNumIterations, weightsAsInputs});
+            options._options.emplace_back(
+                    RepeatingBlocksOptions{minOpsInBlock, maxNumIterations, weightsAsInputs, hashMatching});
         } else if (modeStringTrimmed == "repeating-blocks-separate-functions") {
             auto opt = ::RepeatingBlocksSeparateFunctionsOptions::createFromString(argumentStringTrimmed);
             VPUX_THROW_WHEN(opt.get() == nullptr,
@@ -111,8 +121,10 @@ OutlinerPassOptions OutlinerPassOptions::createFromString(StringRef param) {
 
             size_t minOpsInBlock = opt->minOpsInBlock;
             size_t maxNumIterations = opt->maxNumIterations;
+            bool hashMatching = opt->hashMatching;
 
-            options._options.emplace_back(RepeatingBlocksSeparateFunctionsOptions{minOpsInBlock, maxNumIterations});
+            options._options.emplace_back(
+                    RepeatingBlocksSeparateFunctionsOptions{minOpsInBlock, maxNumIterations, hashMatching});
         } else if (modeStringTrimmed == "batching") {
             auto opt = ::BatchingOptions::createFromString(argumentStringTrimmed);
             VPUX_THROW_WHEN(opt.get() == nullptr, "Cannot create batching options from string: {0}",
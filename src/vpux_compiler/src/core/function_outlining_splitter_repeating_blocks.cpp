@@ -11,6 +11,8 @@
 #include "vpux/utils/core/array_ref.hpp"
 #include "vpux/utils/core/dense_map.hpp"
 
+#include <numeric>
+
 using namespace vpux;
 
 namespace {
@@ -22,11 +24,12 @@ namespace {
 class RepeatingBlocksIdentifier {
 public:
     RepeatingBlocksIdentifier(size_t minOpsInBlock, size_t maxNumIterations, bool separateFunctions,
-                              bool weightsAsInputs, const Logger& log)
+                              bool weightsAsInputs, bool hashMatching, const Logger& log)
             : _minOpsInBlock(minOpsInBlock),
               _maxNumIterations(maxNumIterations),
               _separateFunctions(separateFunctions),
               _weightsAsInputs(weightsAsInputs),
+              _hashMatching(hashMatching),
               _log(log) {
         // The CLI argument parser already ensures that these are mutually exclusive. Just to be safe, we prohibit the
         // construction of an invalid instance.
@@ -79,8 +82,22 @@ private:
 
     using OpValuePair = std::pair<llvm::hash_code, size_t>;
 
+    // Instances of a sequence of operations which repeats in the IR order
+    struct RepeatingSequence {
+        size_t length = 0;
+        SmallVector<size_t> starts;
+
+        size_t coverage() const {
+            return length * starts.size();
+        }
+    };
+
 private:
     void identifyUniqueOperations(mlir::func::FuncOp mainFunction);
+    void identifyRepeatingSequences(mlir::func::FuncOp mainFunction);
+    SmallVector<RepeatingSequence> findRepeatingSequences(ArrayRef<size_t> tokens);
+    SmallVector<size_t> getIdenticallyConnectedInstances(ArrayRef<mlir::Operation*> ops,
+                                                         const RepeatingSequence& sequence);
     bool tryMergeAdjacentBlocks();
     SmallVector<size_t> findMergeCandidateIdx(ArrayRef<MergeCandidateInfo> mergeCandidates,
                                               const InstancePair& currentInstancePair);
@@ -97,12 +114,14 @@ private:
     SmallVector<OutliningInstance> prepareOutliningInstances(mlir::func::FuncOp mainFunction);
 
     void printBlocks(StringLiteral note);
+    void printCoverage(mlir::func::FuncOp mainFunction);
 
 private:
     size_t _minOpsInBlock;
     size_t _maxNumIterations;
     bool _separateFunctions;
     bool _weightsAsInputs;
+    bool _hashMatching;
     Logger _log;
 
     std::unordered_map<mlir::Operation*, llvm::hash_code> _opHash{};
@@ -171,6 +190,275 @@ void RepeatingBlocksIdentifier::identifyUniqueOperations(mlir::func::FuncOp main
     printBlocks("after identifyUniqueOperations");
 }
 
+/**
+ * @brief Build the suffix array of the sequence of tokens by prefix doubling, in O(n log^2 n)
+ */
+SmallVector<size_t> buildSuffixArray(ArrayRef<size_t> tokens) {
+    const auto size = tokens.size();
+    SmallVector<size_t> suffixArray(size);
+    SmallVector<size_t> rank(tokens.begin(), tokens.end());
+    SmallVector<size_t> newRank(size);
+    std::iota(suffixArray.begin(), suffixArray.end(), 0);
+
+    for (size_t prefixLength = 1;; prefixLength *= 2) {
+        // Suffixes are sorted by the rank of their first prefixLength tokens and then by the rank of the following
+        // prefixLength tokens. Suffixes which are shorter come first
+        const auto key = [&](size_t suffix) {
+            const auto second = suffix + prefixLength < size ? rank[suffix + prefixLength] + 1 : 0;
+            return std::make_pair(rank[suffix], second);
+        };
+        llvm::sort(suffixArray, [&](size_t lhs, size_t rhs) {
+            return key(lhs) < key(rhs);
+        });
+
+        newRank[suffixArray.front()] = 0;
+        for (size_t i = 1; i < size; ++i) {
+            newRank[suffixArray[i]] = newRank[suffixArray[i - 1]] + (key(suffixArray[i - 1]) < key(suffixArray[i]));
+        }
+        rank.swap(newRank);
+
+        if (rank[suffixArray.back()] == size - 1 || prefixLength >= size) {
+            break;
+        }
+    }
+    return suffixArray;
+}
+
+/**
+ * @brief Build the array of the longest common prefixes of adjacent suffixes with Kasai's algorithm, in O(n).
+ * Element i contains the length of the common prefix of suffixes suffixArray[i - 1] and suffixArray[i]
+ */
+SmallVector<size_t> buildLCPArray(ArrayRef<size_t> tokens, ArrayRef<size_t> suffixArray) {
+    const auto size = tokens.size();
+    SmallVector<size_t> suffixRank(size);
+    for (size_t i = 0; i < size; ++i) {
+        suffixRank[suffixArray[i]] = i;
+    }
+
+    SmallVector<size_t> lcp(size, 0);
+    size_t commonLength = 0;
+    for (size_t suffix = 0; suffix < size; ++suffix) {
+        if (suffixRank[suffix] == 0) {
+            commonLength = 0;
+            continue;
+        }
+        const auto prevSuffix = suffixArray[suffixRank[suffix] - 1];
+        while (suffix + commonLength < size && prevSuffix + commonLength < size &&
+               tokens[suffix + commonLength] == tokens[prevSuffix + commonLength]) {
+            ++commonLength;
+        }
+        lcp[suffixRank[suffix]] = commonLength;
+        if (commonLength > 0) {
+            --commonLength;
+        }
+    }
+    return lcp;
+}
+
+/**
+ * @brief Find the sequences of tokens which repeat without overlapping, sorted by the number of tokens they cover
+ * @details Every group of suffixes sharing a common prefix forms an interval in the suffix array, which are all
+ * enumerated with a stack over the LCP array. For an interval with common prefix length L, the sequence can have any
+ * length up to L; it is either shortened to the smallest distance between the instances, so that all of them can be
+ * used, or kept at length L with only the instances which do not overlap
+ */
+SmallVector<RepeatingBlocksIdentifier::RepeatingSequence> RepeatingBlocksIdentifier::findRepeatingSequences(
+        ArrayRef<size_t> tokens) {
+    if (tokens.size() < 2) {
+        return {};
+    }
+
+    const auto suffixArray = buildSuffixArray(tokens);
+    const auto lcp = buildLCPArray(tokens, suffixArray);
+
+    SmallVector<RepeatingSequence> sequences;
+    const auto addInterval = [&](size_t commonLength, size_t first, size_t last) {
+        if (commonLength < _minOpsInBlock) {
+            return;
+        }
+
+        SmallVector<size_t> starts(suffixArray.begin() + first, suffixArray.begin() + last + 1);
+        llvm::sort(starts);
+
+        auto minDistance = std::numeric_limits<size_t>::max();
+        for (size_t i = 1; i < starts.size(); ++i) {
+            minDistance = std::min(minDistance, starts[i] - starts[i - 1]);
+        }
+
+        RepeatingSequence sequence;
+        if (minDistance >= _minOpsInBlock) {
+            sequence.length = std::min(commonLength, minDistance);
+            sequence.starts = starts;
+        }
+
+        RepeatingSequence nonOverlapping;
+        nonOverlapping.length = commonLength;
+        for (auto start : starts) {
+            if (nonOverlapping.starts.empty() || start >= nonOverlapping.starts.back() + commonLength) {
+                nonOverlapping.starts.push_back(start);
+            }
+        }
+        if (nonOverlapping.starts.size() >= 2 && nonOverlapping.coverage() > sequence.coverage()) {
+            sequence = std::move(nonOverlapping);
+        }
+
+        if (sequence.starts.size() >= 2) {
+            sequences.push_back(std::move(sequence));
+        }
+    };
+
+    // Pairs of common prefix length and the first suffix array index of the interval
+    SmallVector<std::pair<size_t, size_t>> intervals = {{0, 0}};
+    for (size_t i = 1; i <= tokens.size(); ++i) {
+        const auto commonLength = i < tokens.size() ? lcp[i] : 0;
+        auto first = i - 1;
+        while (intervals.back().first > commonLength) {
+            first = intervals.back().second;
+            addInterval(intervals.back().first, first, i - 1);
+            intervals.pop_back();
+        }
+        if (intervals.back().first < commonLength) {
+            intervals.emplace_back(commonLength, first);
+        }
+    }
+
+    // Prefer the sequences covering more operations, then the ones with more instances as their function is reused
+    // more often and then the ones appearing earlier in the IR
+    llvm::stable_sort(sequences, [](const RepeatingSequence& lhs, const RepeatingSequence& rhs) {
+        if (lhs.coverage() != rhs.coverage()) {
+            return lhs.coverage() > rhs.coverage();
+        }
+        if (lhs.starts.size() != rhs.starts.size()) {
+            return lhs.starts.size() > rhs.starts.size();
+        }
+        return lhs.starts.front() < rhs.starts.front();
+    });
+    return sequences;
+}
+
+/**
+ * @brief Identical operation sequences can still be connected differently. Group the instances of the sequence by the
+ * way their operations are connected to each other and return the starts of the largest group
+ */
+SmallVector<size_t> RepeatingBlocksIdentifier::getIdenticallyConnectedInstances(ArrayRef<mlir::Operation*> ops,
+                                                                                const RepeatingSequence& sequence) {
+    const auto getConnectionsHash = [&](size_t start) {
+        DenseMap<mlir::Operation*, size_t> opOffset;
+        for (size_t offset = 0; offset < sequence.length; ++offset) {
+            opOffset[ops[start + offset]] = offset;
+        }
+
+        llvm::hash_code hash = 0;
+        for (size_t offset = 0; offset < sequence.length; ++offset) {
+            for (auto operand : ops[start + offset]->getOperands()) {
+                // Operands produced outside of the instance are the inputs of the instance, only the constants have
+                // to be distinguished since they are handled differently when the instance is outlined
+                auto parentOp = operand.getDefiningOp();
+                const auto parentOffsetIt = opOffset.find(parentOp);
+                if (parentOffsetIt != opOffset.end()) {
+                    const auto resultIdx = mlir::cast<mlir::OpResult>(operand).getResultNumber();
+                    hash = llvm::hash_combine(hash, parentOffsetIt->second, resultIdx);
+                } else {
+                    hash = llvm::hash_combine(hash, mlir::isa_and_nonnull<Const::DeclareOp>(parentOp));
+                }
+            }
+        }
+        return hash;
+    };
+
+    DenseMap<llvm::hash_code, SmallVector<size_t>> instancesByConnections;
+    SmallVector<llvm::hash_code> connectionsOrder;
+    for (auto start : sequence.starts) {
+        const auto hash = getConnectionsHash(start);
+        auto& instances = instancesByConnections[hash];
+        if (instances.empty()) {
+            connectionsOrder.push_back(hash);
+        }
+        instances.push_back(start);
+    }
+
+    SmallVector<size_t> largestGroup;
+    for (const auto& hash : connectionsOrder) {
+        if (instancesByConnections[hash].size() > largestGroup.size()) {
+            largestGroup = instancesByConnections[hash];
+        }
+    }
+    return largestGroup;
+}
+
+/**
+ * @brief Identify repeating blocks as repeating sequences of operations in the IR order. This is an alternative to
+ * identifyUniqueOperations and tryMergeAdjacentBlocks which finds the largest blocks directly.
+ * @details Every operation is mapped to a token, identical for all structurally identical operations (see
+ * hashOperation). The sequence of tokens covering the largest number of operations is found using a suffix array and
+ * the instances of this sequence which are connected identically become a new block. The operations of the block are
+ * then replaced by unique tokens and the search is repeated until no sequence is found or the maximum number of
+ * iterations is reached. Since the instances are contiguous in the IR order, which is topological, no operation outside
+ * of an instance can be both a user and a producer of operations in the instance.
+ */
+void RepeatingBlocksIdentifier::identifyRepeatingSequences(mlir::func::FuncOp mainFunction) {
+    _log.trace("Identifying repeating sequences of operations");
+
+    // Constants are skipped as they should not represent operations which could differentiate between repeating
+    // blocks
+    SmallVector<mlir::Operation*> ops;
+    for (auto& op : mainFunction.getOps()) {
+        if (mlir::isa<Const::DeclareOp>(op) || op.hasTrait<mlir::OpTrait::IsTerminator>()) {
+            continue;
+        }
+        ops.push_back(&op);
+    }
+
+    DenseMap<llvm::hash_code, size_t> tokenIds;
+    SmallVector<size_t> tokens;
+    tokens.reserve(ops.size());
+    for (auto op : ops) {
+        const auto hash = hashOperation(op);
+        _opHash[op] = hash;
+        tokens.push_back(tokenIds.try_emplace(hash, tokenIds.size()).first->second);
+    }
+
+    // Operations already placed in a block get tokens which cannot match any other token
+    auto nextUniqueToken = tokenIds.size();
+
+    for (size_t i = 0; i < _maxNumIterations; ++i) {
+        _log.trace("Iteration {0}", i);
+
+        std::optional<RepeatingSequence> blockSequence;
+        for (const auto& sequence : findRepeatingSequences(tokens)) {
+            auto starts = getIdenticallyConnectedInstances(ops, sequence);
+            if (starts.size() >= 2) {
+                blockSequence = RepeatingSequence{sequence.length, std::move(starts)};
+                break;
+            }
+        }
+        if (!blockSequence.has_value()) {
+            _log.trace("No repeating sequence found. Stopping attempts");
+            break;
+        }
+
+        const auto blockId = _lastBlockId++;
+        _log.nest().trace("Block {0} with {1} instances of {2} operations", blockId, blockSequence->starts.size(),
+                          blockSequence->length);
+        for (auto start : blockSequence->starts) {
+            const auto instanceId = _lastInstanceId++;
+            std::set<mlir::Operation*> instanceOps;
+            for (size_t offset = 0; offset < blockSequence->length; ++offset) {
+                auto op = ops[start + offset];
+                // The hash has to be unique inside the instance and identical for the same operation in all instances
+                _opHash[op] = llvm::hash_combine(_opHash[op], blockId, offset);
+                _opInstance[op] = instanceId;
+                instanceOps.insert(op);
+                tokens[start + offset] = nextUniqueToken++;
+            }
+            _instanceBlock[instanceId] = blockId;
+            _blocks[blockId].emplace_back(instanceId, instanceOps);
+        }
+    }
+
+    printBlocks("after identifyRepeatingSequences");
+}
+
 /**
  * @brief Try to merge adjacent blocks of operations
  * @details Implementation overview:
@@ -725,6 +1013,27 @@ SmallVector<OutliningInstance> RepeatingBlocksIdentifier::prepareOutliningInstan
     return outliningInstances;
 }
 
+void RepeatingBlocksIdentifier::printCoverage(mlir::func::FuncOp mainFunction) {
+    if (!_log.isActive(LogLevel::Debug)) {
+        return;
+    }
+
+    size_t numOps = 0;
+    for (auto& op : mainFunction.getOps()) {
+        if (!mlir::isa<Const::DeclareOp>(op) && !op.hasTrait<mlir::OpTrait::IsTerminator>()) {
+            ++numOps;
+        }
+    }
+    const auto numCoveredOps = _opInstance.size();
+    const auto coverage = numOps > 0 ? 100.0 * static_cast<double>(numCoveredOps) / static_cast<double>(numOps) : 0.0;
+    _log.debug("Repeating blocks cover {0} of {1} operations ({2:F2}%)", numCoveredOps, numOps, coverage);
+    for (auto& block : _blocks) {
+        const auto& instances = block.second;
+        _log.nest().debug("Block {0}: {1} instances of {2} operations", block.first, instances.size(),
+                          instances.front().operations.size());
+    }
+}
+
 void RepeatingBlocksIdentifier::printBlocks(StringLiteral note) {
     if (!_log.isActive(LogLevel::Trace)) {
         return;
@@ -758,22 +1067,28 @@ void RepeatingBlocksIdentifier::printBlocks(StringLiteral note) {
  * operation.
  */
 SmallVector<OutliningInstance> RepeatingBlocksIdentifier::getOutliningInstances(mlir::func::FuncOp mainFunction) {
-    // Step 1. Identify operations that repeat in the IR and place them in a unique block.
-    identifyUniqueOperations(mainFunction);
-
-    // Step 2. Try to merge adjacent blocks of operations. This is repeated until no more merges are done or until the
-    // maximum number of iterations is reached
-    _log.trace("Trying to merge adjacent blocks");
-    for (size_t i = 0; i < _maxNumIterations; ++i) {
-        _log.trace("Iteration {0}", i);
-        if (!tryMergeAdjacentBlocks()) {
-            _log.trace("No merge could be performed. Stopping attempts");
-            break;
+    if (_hashMatching) {
+        // Steps 1-2. Identify repeating sequences of operations directly
+        identifyRepeatingSequences(mainFunction);
+    } else {
+        // Step 1. Identify operations that repeat in the IR and place them in a unique block.
+        identifyUniqueOperations(mainFunction);
+
+        // Step 2. Try to merge adjacent blocks of operations. This is repeated until no more merges are done or until
+        // the maximum number of iterations is reached
+        _log.trace("Trying to merge adjacent blocks");
+        for (size_t i = 0; i < _maxNumIterations; ++i) {
+            _log.trace("Iteration {0}", i);
+            if (!tryMergeAdjacentBlocks()) {
+                _log.trace("No merge could be performed. Stopping attempts");
+                break;
+            }
         }
     }
 
     // Step 3. Remove blocks which have only one instance or fewer operations than the configured minimum
     removeLeftoverBlocks();
+    printCoverage(mainFunction);
 
     // Step 4. Sort the instances in each repeating block topologically and include all dependencies
     return prepareOutliningInstances(mainFunction);
@@ -783,12 +1098,13 @@ SmallVector<OutliningInstance> RepeatingBlocksIdentifier::getOutliningInstances(
 
 FunctionOutlinerRepeatingBlocks::FunctionOutlinerRepeatingBlocks(size_t minOpsInBlock, size_t maxNumIterations,
                                                                  bool separateFunctions, bool weightsAsInputs,
-                                                                 Logger log)
+                                                                 Logger log, bool hashMatching)
         : _minOpsInBlock(minOpsInBlock),
           _maxNumIterations(maxNumIterations),
           _separateFunctions(separateFunctions),
           _weightsAsInputs(weightsAsInputs),
-          _log(log) {
+          _log(log),
+          _hashMatching(hashMatching) {
     _log.setName("function-outliner-repeating-blocks");
 }
 
@@ -801,7 +1117,7 @@ SmallVector<OutliningInstance> FunctionOutlinerRepeatingBlocks::getOutliningTarg
     }
 
     RepeatingBlocksIdentifier repeatingBlocksIdentifier(_minOpsInBlock, _maxNumIterations, _separateFunctions,
-                                                        _weightsAsInputs, _log);
+                                                        _weightsAsInputs, _hashMatching, _log);
     const auto outliningInstances = repeatingBlocksIdentifier.getOutliningInstances(mainFunction);
 
     if (_log.isActive(LogLevel::Debug)) {
@@ -0,0 +1,181 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/core/passes.hpp"
+
+#include "vpux/compiler/core/cost_model_utils.hpp"
+#include "vpux/compiler/core/profile_guided_costs.hpp"
+#include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPU/IR/ops.hpp"
+#include "vpux/compiler/dialect/VPU/utils/cost_model/layer_vpunn_cost.hpp"
+#include "vpux/compiler/dialect/VPUIP/IR/ops.hpp"
+#include "vpux/compiler/utils/attributes.hpp"
+#include "vpux/compiler/utils/strings.hpp"
+
+#include "vpux/utils/profiling/tasknames.hpp"
+
+#include <llvm/ADT/MapVector.h>
+
+using namespace vpux;
+
+namespace {
+
+// The best estimation among the strategies supported by the operation, assuming the previous compilation picked it
+std::optional<double> getBestEstimatedCost(mlir::Operation* op, const VPU::LayerVPUNNCost& costModel,
+                                           int64_t numTiles) {
+    std::optional<double> bestCost;
+    auto updateBestCost = [&](VPU::MultiClusterStrategy strategy) {
+        const auto cost = costModel.getStrategyCost(op, VPU::VPUNNCostParameters(strategy));
+        if (cost == 0 || cost >= VPU::INVALID_COST_BASE) {
+            return;
+        }
+        bestCost = std::min(bestCost.value_or(cost), static_cast<double>(cost));
+    };
+
+    if (auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(op)) {
+        for (uint64_t i = 0; i <= VPU::getMaxEnumValForMultiClusterStrategy(); ++i) {
+            const auto strategy = VPU::symbolizeMultiClusterStrategy(i);
+            if (strategy.has_value() && clusteredOp.checkStrategyCompatibility(strategy.value(), numTiles)) {
+                updateBestCost(strategy.value());
+            }
+        }
+    }
+    if (!bestCost.has_value()) {
+        updateBestCost(VPU::MultiClusterStrategy::Clustering);
+    }
+    return bestCost;
+}
+
+//
+// ApplyProfileGuidedCostsPass
+//
+
+class ApplyProfileGuidedCostsPass final : public ApplyProfileGuidedCostsBase<ApplyProfileGuidedCostsPass> {
+public:
+    ApplyProfileGuidedCostsPass(StringRef profileFile, Logger log): _profileFile(profileFile.str()) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    mlir::LogicalResult initializeOptions(StringRef options) final;
+    void safeRunOnModule() final;
+
+    void applyTaskCosts(mlir::func::FuncOp func, const ProfilingReport& report, double freqInMHz);
+    void applyLayerCostScales(mlir::func::FuncOp func, const ProfilingReport& report, double freqInMHz,
+                              int64_t numTiles);
+
+private:
+    std::string _profileFile;
+};
+
+mlir::LogicalResult ApplyProfileGuidedCostsPass::initializeOptions(StringRef options) {
+    if (mlir::failed(Base::initializeOptions(options))) {
+        return mlir::failure();
+    }
+    if (profileFileOpt.hasValue()) {
+        _profileFile = profileFileOpt.getValue();
+    }
+    return mlir::success();
+}
+
+void ApplyProfileGuidedCostsPass::applyTaskCosts(mlir::func::FuncOp func, const ProfilingReport& report,
+                                                 double freqInMHz) {
+    size_t numMatched = 0;
+    func->walk([&](VPUIP::CycleCostInterface costOp) {
+        auto op = costOp.getOperation();
+        const auto durationNs = report.getTaskDurationNs(stringifyPrimaryLocation(op->getLoc()));
+        if (!durationNs.has_value()) {
+            return;
+        }
+
+        const auto cycles = std::max<int64_t>(1, std::llround(convertNanoSecondsToCycles(*durationNs, freqInMHz)));
+        op->setAttr(profiledCycleCost, getIntAttr(op->getContext(), cycles));
+        ++numMatched;
+    });
+
+    _log.trace("Function '@{0}': {1} tasks matched the profiling report", func.getName(), numMatched);
+}
+
+void ApplyProfileGuidedCostsPass::applyLayerCostScales(mlir::func::FuncOp func, const ProfilingReport& report,
+                                                       double freqInMHz, int64_t numTiles) {
+    // A layer may be represented by several operations after the decompositions done so far
+    llvm::MapVector<std::string, SmallVector<mlir::Operation*>> layerOps;
+    func->walk([&](mlir::Operation* op) {
+        if (!mlir::isa<VPU::NCEOpInterface, VPU::SWOpInterface>(op)) {
+            return;
+        }
+        op->removeAttr(profiledCostScale);
+        layerOps[profiling::getLayerName(stringifyPrimaryLocation(op->getLoc()))].push_back(op);
+    });
+
+    VPU::LayerVPUNNCost costModel(func, _log);
+    size_t numMatched = 0;
+    for (const auto& [layerName, ops] : layerOps) {
+        const auto durationNs = report.getLayerDurationNs(layerName);
+        if (!durationNs.has_value()) {
+            continue;
+        }
+
+        double estimatedCost = 0.0;
+        for (auto op : ops) {
+            const auto opCost = getBestEstimatedCost(op, costModel, numTiles);
+            if (!opCost.has_value()) {
+                estimatedCost = 0.0;
+                break;
+            }
+            estimatedCost += opCost.value();
+        }
+        if (estimatedCost == 0.0) {
+            _log.trace("No valid estimation for layer '{0}'", layerName);
+            continue;
+        }
+
+        const auto scale = convertNanoSecondsToCycles(*durationNs, freqInMHz) / estimatedCost;
+        _log.trace("Layer '{0}': measured {1}ns, estimated {2} cycles, scale {3}", layerName, *durationNs,
+                   estimatedCost, scale);
+        for (auto op : ops) {
+            op->setAttr(profiledCostScale, getFPAttr(op->getContext(), scale));
+        }
+        ++numMatched;
+    }
+
+    _log.trace("Function '@{0}': {1} layers matched the profiling report", func.getName(), numMatched);
+}
+
+void ApplyProfileGuidedCostsPass::safeRunOnModule() {
+    if (_profileFile.empty()) {
+        return;
+    }
+
+    auto module = getOperation();
+    auto tileOp = IE::getTileExecutor(module);
+    VPUX_THROW_WHEN(tileOp == nullptr, "Tile executor is required to convert profiled durations to cycles");
+    const auto freqInMHz = tileOp.getProcessorFrequency().getValueAsDouble();
+    VPUX_THROW_WHEN(freqInMHz == 0, "Frequency was not configured");
+
+    const auto report = ProfilingReport::parse(_profileFile, _log.nest());
+    if (report.getNumTasks() == 0) {
+        _log.warning("Profiling report '{0}' does not contain any task", _profileFile);
+        return;
+    }
+
+    for (auto func : module.getOps<mlir::func::FuncOp>()) {
+        if (func.isExternal()) {
+            continue;
+        }
+        applyTaskCosts(func, report, freqInMHz);
+        applyLayerCostScales(func, report, freqInMHz, tileOp.getCount());
+    }
+}
+
+}  // namespace
+
+//
+// createApplyProfileGuidedCostsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::createApplyProfileGuidedCostsPass(StringRef profileFile, Logger log) {
+    return std::make_unique<ApplyProfileGuidedCostsPass>(profileFile, log);
+}
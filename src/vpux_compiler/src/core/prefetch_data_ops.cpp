@@ -5,6 +5,7 @@
 
 #include "vpux/compiler/core/prefetch_data_ops.hpp"
 
+#include "vpux/compiler/core/cycle_cost_info.hpp"
 #include "vpux/compiler/dialect/VPUIP/IR/ops.hpp"
 #include "vpux/compiler/utils/attributes.hpp"
 
@@ -16,8 +17,11 @@ using namespace vpux;
 // Constructor
 //
 
-PrefetchDataOps::PrefetchDataOps(scheduledOps& initialSchedule, AsyncDepsInfo& depsInfo)
-        : _log(Logger::global().nest("prefetch-data-ops", 0)), _scheduledOps(initialSchedule), _depsInfo(depsInfo) {
+PrefetchDataOps::PrefetchDataOps(scheduledOps& initialSchedule, AsyncDepsInfo& depsInfo, size_t lookahead)
+        : _log(Logger::global().nest("prefetch-data-ops", 0)),
+          _scheduledOps(initialSchedule),
+          _depsInfo(depsInfo),
+          _lookahead(lookahead) {
 }
 
 void PrefetchDataOps::init() {
@@ -33,6 +37,28 @@ void PrefetchDataOps::init() {
             _computeExecutorKindOpIdx.insert(op.op_);
         }
     }
+
+    if (_lookahead == 0 || _scheduledOps.empty()) {
+        return;
+    }
+
+    // information needed to plan prefetches: DMA cost from cost model, size of data op output, DMA channel
+    // and free CMX left by the initial schedule when the op was scheduled
+    auto func = _depsInfo.getExecuteOpAtIndex(_scheduledOps.front().op_)->getParentOfType<mlir::func::FuncOp>();
+    CycleCostInfo cycleCostInfo(func);
+    for (const auto& op : _scheduledOps) {
+        if (!op.isOriginalOp()) {
+            continue;
+        }
+
+        _freeCmx.try_emplace(op.op_, op.freeCmx_);
+        if (op.isDataOp()) {
+            auto execOp = _depsInfo.getExecuteOpAtIndex(op.op_);
+            _dataOpDMACost[op.op_] = cycleCostInfo.getCycleCost(execOp);
+            _dataOpSize[op.op_] = op.resourceSize();
+            _dataOpQueueId[op.op_] = op.queueType.id;
+        }
+    }
 }
 
 bool PrefetchDataOps::isScheduled(size_t opIdx) {
@@ -472,6 +498,175 @@ SmallVector<PrefetchDataOps::CycleInfo> PrefetchDataOps::getNewOrder() {
     return sortedOpCycles;
 }
 
+// Plan prefetches for the next '_lookahead' compute executor kind ops. Before each op in compute order
+// all candidate data ops whose first consumer lies in the window are costed: DMA occupancy is tracked
+// per DMA channel and a candidate hides the part of its DMA which completes before its consumer begins.
+// Candidates with the most hidden cycles per byte are picked first as long as the bytes prefetched ahead
+// of their consumers fit in CMX left free by the initial schedule. Remaining data ops are issued right
+// before their first consumer, only data ops without compute consumers are left for the end.
+SmallVector<PrefetchDataOps::CycleInfo> PrefetchDataOps::getLookaheadOrder() {
+    SmallVector<CycleInfo> sortedComputeAndDMAOps;
+    SmallVector<CycleInfo> sortedDataOps;
+
+    for (const auto& op : _operationCycles) {
+        if (_dataOpIdx.find(op.first) != _dataOpIdx.end()) {
+            sortedDataOps.push_back(op.second);
+        } else {
+            sortedComputeAndDMAOps.push_back(op.second);
+        }
+    }
+
+    sortOps(sortedDataOps);
+    sortOps(sortedComputeAndDMAOps);
+
+    // position of first consumer in compute order for every data op
+    mlir::DenseMap<size_t, size_t> firstConsumerPos;
+    for (const auto& computeOp : sortedComputeAndDMAOps | indexed) {
+        for (const auto depIdx : _depsInfo.getOpDeps(computeOp.value().getOpIdx())) {
+            if (_dataOpIdx.find(depIdx) != _dataOpIdx.end()) {
+                firstConsumerPos.try_emplace(depIdx, computeOp.index());
+            }
+        }
+    }
+
+    mlir::DenseSet<size_t> scheduledOps;
+    const auto dependenciesScheduled = [&](size_t opIdx) {
+        return llvm::all_of(_depsInfo.getOpDeps(opIdx), [&](size_t depIdx) {
+            return scheduledOps.contains(depIdx);
+        });
+    };
+
+    SmallVector<CycleInfo> sortedOpCycles;
+    const auto scheduleOp = [&](const CycleInfo& opCycles) {
+        sortedOpCycles.push_back(opCycles);
+        scheduledOps.insert(opCycles.getOpIdx());
+        _log.nest().trace("opIdx = '{0}', cycles = '{1}' -> '{2}', executor = '{3}'", opCycles.getOpIdx(),
+                          opCycles.getCycleBegin(), opCycles.getCycleEnd(), opCycles.getExecutorKind());
+    };
+
+    // DMA engine occupancy per channel
+    mlir::DenseMap<uint8_t, size_t> dmaChannelFreeCycle;
+    const auto getDMACycleBegin = [&](size_t opIdx, size_t issueCycle) {
+        return std::max(dmaChannelFreeCycle[_dataOpQueueId[opIdx]], issueCycle);
+    };
+    const auto scheduleDataOp = [&](const CycleInfo& opCycles, size_t issueCycle) {
+        const auto opIdx = opCycles.getOpIdx();
+        dmaChannelFreeCycle[_dataOpQueueId[opIdx]] = getDMACycleBegin(opIdx, issueCycle) + _dataOpDMACost[opIdx];
+        scheduleOp(opCycles);
+    };
+
+    // bytes of data ops issued ahead of their first consumer
+    size_t prefetchedBytes = 0;
+    mlir::DenseMap<size_t, size_t> prefetchedBytesReleasePos;
+    size_t numPrefetched = 0;
+    size_t hiddenCycles = 0;
+
+    _log.trace("Defining new order with lookahead '{0}':", _lookahead);
+    for (size_t pos = 0; pos < sortedComputeAndDMAOps.size(); ++pos) {
+        const auto& computeOp = sortedComputeAndDMAOps[pos];
+        const auto issueCycle = computeOp.getCycleBegin();
+
+        // data ops needed by this op, or not needed by any compute, are issued now. A data op may depend on
+        // another one which comes later in cycle order, so repeat until nothing more can be issued
+        for (bool issued = true; issued;) {
+            issued = false;
+            for (auto dataItr = sortedDataOps.begin(); dataItr != sortedDataOps.end();) {
+                const auto opIdx = dataItr->getOpIdx();
+                const auto consumerPos = firstConsumerPos.find(opIdx);
+                const auto isNeeded = consumerPos != firstConsumerPos.end() ? consumerPos->second <= pos
+                                                                            : dataItr->getCycleBegin() <= issueCycle;
+                if (!isNeeded || !dependenciesScheduled(opIdx)) {
+                    ++dataItr;
+                    continue;
+                }
+                scheduleDataOp(*dataItr, issueCycle);
+                dataItr = sortedDataOps.erase(dataItr);
+                issued = true;
+            }
+        }
+
+        // find end of lookahead window
+        size_t windowEnd = pos;
+        for (size_t computeCount = 0; windowEnd + 1 < sortedComputeAndDMAOps.size() && computeCount < _lookahead;) {
+            ++windowEnd;
+            if (_computeExecutorKindOpIdx.contains(sortedComputeAndDMAOps[windowEnd].getOpIdx())) {
+                ++computeCount;
+            }
+        }
+
+        // free CMX is taken from the initial schedule where no data op was prefetched
+        const auto freeCmxItr = _freeCmx.find(computeOp.getOpIdx());
+        const auto cmxBudget = freeCmxItr != _freeCmx.end() ? freeCmxItr->second : 0;
+
+        // greedily pick prefetch with most hidden DMA cycles per byte
+        while (true) {
+            auto bestDataItr = sortedDataOps.end();
+            double bestGain = 0.0;
+            size_t bestHiddenCycles = 0;
+            for (auto dataItr = sortedDataOps.begin(); dataItr != sortedDataOps.end(); ++dataItr) {
+                const auto opIdx = dataItr->getOpIdx();
+                const auto consumerPos = firstConsumerPos.find(opIdx);
+                if (consumerPos == firstConsumerPos.end() || consumerPos->second <= pos ||
+                    consumerPos->second > windowEnd) {
+                    continue;
+                }
+                const auto size = _dataOpSize[opIdx];
+                if (prefetchedBytes + size > cmxBudget || !dependenciesScheduled(opIdx)) {
+                    continue;
+                }
+
+                const auto consumerCycleBegin = sortedComputeAndDMAOps[consumerPos->second].getCycleBegin();
+                const auto dmaCycleBegin = getDMACycleBegin(opIdx, issueCycle);
+                if (consumerCycleBegin <= dmaCycleBegin) {
+                    continue;
+                }
+
+                const auto opHiddenCycles = std::min(_dataOpDMACost[opIdx], consumerCycleBegin - dmaCycleBegin);
+                const auto gain = static_cast<double>(opHiddenCycles) / static_cast<double>(std::max<size_t>(size, 1));
+                if (gain > bestGain) {
+                    bestGain = gain;
+                    bestHiddenCycles = opHiddenCycles;
+                    bestDataItr = dataItr;
+                }
+            }
+
+            if (bestDataItr == sortedDataOps.end()) {
+                break;
+            }
+
+            const auto opIdx = bestDataItr->getOpIdx();
+            _log.nest().trace("Prefetch '{0}' for op at position '{1}', hidden cycles '{2}', size '{3}'", opIdx,
+                              firstConsumerPos[opIdx], bestHiddenCycles, _dataOpSize[opIdx]);
+            prefetchedBytes += _dataOpSize[opIdx];
+            prefetchedBytesReleasePos[firstConsumerPos[opIdx]] += _dataOpSize[opIdx];
+            hiddenCycles += bestHiddenCycles;
+            ++numPrefetched;
+            scheduleDataOp(*bestDataItr, issueCycle);
+            sortedDataOps.erase(bestDataItr);
+        }
+
+        // schedule compute op or compute DMA
+        scheduleOp(computeOp);
+
+        // prefetched data ops consumed, CMX is accounted by the consumer from now on
+        const auto releaseItr = prefetchedBytesReleasePos.find(pos);
+        if (releaseItr != prefetchedBytesReleasePos.end()) {
+            prefetchedBytes -= releaseItr->second;
+            prefetchedBytesReleasePos.erase(releaseItr);
+        }
+    }
+
+    // data ops without compute consumers
+    for (const auto& dataOp : sortedDataOps) {
+        VPUX_THROW_WHEN(firstConsumerPos.contains(dataOp.getOpIdx()),
+                        "Data op '{0}' is not scheduled before its consumer", dataOp.getOpIdx());
+        scheduleOp(dataOp);
+    }
+
+    _log.trace("Planned '{0}' prefetches hiding '{1}' DMA cycles", numPrefetched, hiddenCycles);
+    return sortedOpCycles;
+}
+
 void PrefetchDataOps::reorderToPrefetch(ArrayRef<CycleInfo> sortedOpCycles) {
     // reorder IR such that DMAs to prefetch are earlier
     mlir::Operation* prevAsyncOp = nullptr;
@@ -510,7 +705,7 @@ void PrefetchDataOps::enableDataOpPrefetching() {
     performCycleScheduling();
 
     // based on new schedule generate a new order for operations
-    auto newOpOrder = getNewOrder();
+    auto newOpOrder = _lookahead > 0 ? getLookaheadOrder() : getNewOrder();
     // reorder IR to new order
     reorderToPrefetch(newOpOrder);
 }
@@ -0,0 +1,145 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/core/profile_guided_costs.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/profiling/location.hpp"
+#include "vpux/utils/profiling/tasknames.hpp"
+
+#include <llvm/ADT/StringSet.h>
+#include <llvm/Support/JSON.h>
+
+#include <fstream>
+#include <sstream>
+
+using namespace vpux;
+
+namespace {
+
+constexpr StringLiteral DPU_TASK_CATEGORY = "DPU";
+constexpr StringLiteral SW_TASK_CATEGORY = "SW";
+constexpr StringLiteral DMA_TASK_CATEGORY = "DMA";
+constexpr StringLiteral M2I_TASK_CATEGORY = "M2I";
+
+bool isComputeCategory(StringRef category) {
+    return category == DPU_TASK_CATEGORY || category == SW_TASK_CATEGORY || category == M2I_TASK_CATEGORY;
+}
+
+bool isIndexToken(StringRef token, StringRef key) {
+    size_t index = 0;
+    return token.consume_front(key) && token.consume_front("_") && !token.getAsInteger(10, index);
+}
+
+// Drop the per-cluster and per-variant suffixes, so the name matches the location of the task before unrolling
+std::string getTaskKey(const std::string& taskName) {
+    auto tokenized = profiling::tokenizeTaskName(taskName);
+    std::string key = tokenized.layerName + LOCATION_ORIGIN_SEPARATOR;
+    bool isFirst = true;
+    for (const auto& token : tokenized.tokens) {
+        if (isIndexToken(token, profiling::CLUSTER_LEVEL_PROFILING_SUFFIX) ||
+            isIndexToken(token, profiling::VARIANT_LEVEL_PROFILING_SUFFIX)) {
+            continue;
+        }
+        if (!isFirst) {
+            key += LOCATION_SEPARATOR;
+        }
+        key += token;
+        isFirst = false;
+    }
+    return key;
+}
+
+}  // namespace
+
+ProfilingReport ProfilingReport::parse(StringRef fileName, Logger log) {
+    std::ifstream stream(fileName.str());
+    VPUX_THROW_UNLESS(stream.good(), "Failed to open profiling report '{0}'", fileName);
+    std::stringstream content;
+    content << stream.rdbuf();
+
+    auto json = llvm::json::parse(content.str());
+    VPUX_THROW_UNLESS(static_cast<bool>(json), "Failed to parse profiling report '{0}': {1}", fileName,
+                      llvm::toString(json.takeError()));
+
+    // Trace events may be stored either as a plain array or inside the "traceEvents" field
+    const llvm::json::Array* events = nullptr;
+    if (auto root = json->getAsObject()) {
+        events = root->getArray("traceEvents");
+    } else {
+        events = json->getAsArray();
+    }
+    VPUX_THROW_WHEN(events == nullptr, "Profiling report '{0}' does not contain trace events", fileName);
+
+    ProfilingReport report;
+    llvm::StringMap<double> variantDurationsNs;
+    llvm::StringSet<> computeTasks;
+    for (const auto& event : *events) {
+        auto object = event.getAsObject();
+        if (object == nullptr || object->getString("ph") != StringRef("X")) {
+            continue;
+        }
+
+        const auto category = object->getString("cat");
+        const auto name = object->getString("name");
+        const auto duration = object->getNumber("dur");
+        if (!category.has_value() || !name.has_value() || !duration.has_value()) {
+            continue;
+        }
+        if (!isComputeCategory(category.value()) && category.value() != DMA_TASK_CATEGORY) {
+            continue;
+        }
+
+        const auto taskName = name.value().str();
+        if (taskName.find(LOCATION_ORIGIN_SEPARATOR) == std::string::npos) {
+            log.trace("Skip task '{0}' without compiler metadata", taskName);
+            continue;
+        }
+
+        const auto key = getTaskKey(taskName);
+        // Trace events store durations in microseconds
+        const auto durationNs = duration.value() * 1000.0;
+        // Cluster-level entries cover the whole task, variants are used only when nothing else was profiled.
+        // Clusters execute in parallel, so the slowest one defines the duration of the task
+        const auto isVariant = !profiling::getVariantFromName(taskName).empty();
+        auto& durations = isVariant ? variantDurationsNs : report._taskDurationsNs;
+        auto& storedDurationNs = durations[key];
+        storedDurationNs = std::max(storedDurationNs, durationNs);
+
+        if (isComputeCategory(category.value())) {
+            computeTasks.insert(key);
+        }
+    }
+
+    for (const auto& variantTask : variantDurationsNs) {
+        report._taskDurationsNs.try_emplace(variantTask.getKey(), variantTask.getValue());
+    }
+
+    for (const auto& task : report._taskDurationsNs) {
+        if (computeTasks.contains(task.getKey())) {
+            report._layerDurationsNs[profiling::getLayerName(task.getKey().str())] += task.getValue();
+        }
+    }
+
+    log.trace("Loaded {0} tasks and {1} layers from profiling report '{2}'", report._taskDurationsNs.size(),
+              report._layerDurationsNs.size(), fileName);
+    return report;
+}
+
+std::optional<double> ProfilingReport::getTaskDurationNs(StringRef taskName) const {
+    auto it = _taskDurationsNs.find(taskName);
+    if (it == _taskDurationsNs.end()) {
+        return std::nullopt;
+    }
+    return it->getValue();
+}
+
+std::optional<double> ProfilingReport::getLayerDurationNs(StringRef layerName) const {
+    auto it = _layerDurationsNs.find(layerName);
+    if (it == _layerDurationsNs.end()) {
+        return std::nullopt;
+    }
+    return it->getValue();
+}
@@ -183,3 +183,32 @@ std::optional<VPUIP::ProfilingSectionOp> vpux::getProfilingSection(mlir::ModuleO
     }
     return {};
 }
+
+namespace {
+
+constexpr StringLiteral dpuProfilingSamplingAttrName = "VPUIP.dpuProfilingSampling";
+constexpr StringLiteral samplingPeriodAttrName = "samplingPeriod";
+constexpr StringLiteral numTasksAttrName = "numTasks";
+
+}  // namespace
+
+void vpux::setDpuProfilingSampling(mlir::ModuleOp module, const DpuProfilingSampling& sampling) {
+    auto* ctx = module->getContext();
+    const SmallVector<mlir::NamedAttribute> fields = {
+            mlir::NamedAttribute(mlir::StringAttr::get(ctx, samplingPeriodAttrName),
+                                 getIntAttr(ctx, sampling.samplingPeriod)),
+            mlir::NamedAttribute(mlir::StringAttr::get(ctx, numTasksAttrName), getIntAttr(ctx, sampling.numTasks))};
+    module->setAttr(dpuProfilingSamplingAttrName, mlir::DictionaryAttr::get(ctx, fields));
+}
+
+std::optional<DpuProfilingSampling> vpux::getDpuProfilingSampling(mlir::ModuleOp module) {
+    auto samplingAttr = module->getAttrOfType<mlir::DictionaryAttr>(dpuProfilingSamplingAttrName);
+    if (samplingAttr == nullptr) {
+        return {};
+    }
+    auto samplingPeriod = samplingAttr.getAs<mlir::IntegerAttr>(samplingPeriodAttrName);
+    auto numTasks = samplingAttr.getAs<mlir::IntegerAttr>(numTasksAttrName);
+    VPUX_THROW_WHEN(samplingPeriod == nullptr || numTasks == nullptr, "Malformed '{0}' attribute: {1}",
+                    dpuProfilingSamplingAttrName, samplingAttr);
+    return DpuProfilingSampling{samplingPeriod.getInt(), numTasks.getInt()};
+}
@@ -21,6 +21,8 @@
 
 #include <mlir/IR/Visitors.h>
 
+#include <set>
+
 using namespace vpux;
 
 namespace {
@@ -74,6 +76,8 @@ struct ProfilingConfiguration {
         isDpuProfEnabled = hasSectionOfType<ExecutorType::DPU>();
         isSwProfEnabled = hasSectionOfType<ExecutorType::ACTSHAVE>();
         isM2iProfEnabled = hasSectionOfType<ExecutorType::M2I>();
+
+        dpuSampling = getDpuProfilingSampling(netOp->getParentOfType<mlir::ModuleOp>());
     }
 
     SmallVector<VPUIP::ProfilingSectionOp> sections;
@@ -84,6 +88,8 @@ struct ProfilingConfiguration {
     bool isSwProfEnabled;
     bool isM2iProfEnabled;
 
+    std::optional<DpuProfilingSampling> dpuSampling;
+
 private:
     template <profiling::ExecutorType... execTypes>
     bool hasSectionOfType() {
@@ -109,6 +115,12 @@ private:
     }
 };
 
+struct TaskCoverage {
+    profiling::ExecutorType type;
+    uint32_t totalTasks = 0;
+    uint32_t profiledTasks = 0;
+};
+
 using BarrierMap = DenseMap<mlir::Value, uint32_t>;
 using TaskBarriers = std::pair<std::vector<uint32_t>, std::vector<uint32_t>>;
 
@@ -223,6 +235,17 @@ struct RtDialectProvider {
     static std::optional<VPUIP::SwProfilingMetadataAttr> getSwProfilingMetadata(VPUIP::SwKernelOp op) {
         return op.getProfilingMetadata();
     }
+
+    // DMAs which move profiling data are never instrumented, so they don't count towards the coverage
+    static bool isInstrumentableDma(VPUIP::DMATypeOpInterface dmaOp) {
+        if (mlir::isa<VPUIP::SyncDMAOp>(dmaOp.getOperation())) {
+            return false;
+        }
+        if (auto nndmaOp = mlir::dyn_cast<VPUIP::NNDMAOp>(dmaOp.getOperation())) {
+            return !nndmaOp.getProfilingBufferMgmt();
+        }
+        return true;
+    }
 };
 
 using RtDialectProvider37XX = RtDialectProvider;
@@ -248,10 +271,11 @@ std::string cleanSwTaskType(std::string origType) {
 template <class DialectProvider, class DmaType, class Iterable>
 FbVector<ProfilingFB::DMATask> getDmaTasksOffset(const ProfilingConfiguration& profilingCfg,
                                                  flatbuffers::FlatBufferBuilder& builder, const Iterable& dmaTasks,
-                                                 const BarrierMap& barriers) {
+                                                 const BarrierMap& barriers, SmallVector<TaskCoverage>& coverage) {
     if (!profilingCfg.isDmaProfEnabled) {
         return {};
     }
+    TaskCoverage dmaCoverage{profiling::ExecutorType::DMA_HW};
     std::vector<flatbuffers::Offset<ProfilingFB::DMATask>> dmaOffsets;
     for (const auto& dmaTask : dmaTasks) {
         // TableGen generate interface methods without const specifier, so can't be called from const DmaType&.
@@ -259,6 +283,9 @@ FbVector<ProfilingFB::DMATask> getDmaTasksOffset(const ProfilingConfiguration& p
         DmaType& mutDmaTask = const_cast<DmaType&>(dmaTask);
 
         const auto maybeMetadata = mutDmaTask.getProfilingMetadata();
+        if (DialectProvider::isInstrumentableDma(mutDmaTask)) {
+            ++dmaCoverage.totalTasks;
+        }
         if (!maybeMetadata.has_value()) {
             continue;
         }
@@ -290,6 +317,11 @@ FbVector<ProfilingFB::DMATask> getDmaTasksOffset(const ProfilingConfiguration& p
         const auto taskOffset = ProfilingFB::CreateDMATask(builder, nameOffset, waitBarriersOffset,
                                                            updateBarriersOffset, hwpId, dataIndex, isProfBegin);
         dmaOffsets.push_back(taskOffset);
+        ++dmaCoverage.profiledTasks;
+    }
+    // SW DMA profiling wraps every DMA with timestamp DMAs, only HWP can leave DMAs out
+    if (DialectProvider::IS_DMA_HWP_SUPPORTED) {
+        coverage.push_back(dmaCoverage);
     }
     return builder.CreateVector(dmaOffsets);
 }
@@ -322,31 +354,46 @@ FbVector<ProfilingFB::M2ITask> getM2iTasksOffset(const ProfilingConfiguration& p
 template <class DialectProvider, class DPUInvariantType, class DPUVariantType, class Iterable>
 FbVector<ProfilingFB::DPUTask> getDpuTasksOffset(const ProfilingConfiguration& profilingCfg,
                                                  flatbuffers::FlatBufferBuilder& builder, const Iterable& dpuTasks,
-                                                 const BarrierMap& barriers) {
+                                                 const BarrierMap& barriers, SmallVector<TaskCoverage>& coverage) {
     if (!profilingCfg.isDpuProfEnabled) {
         return {};
     }
+    const auto& sampling = profilingCfg.dpuSampling;
     std::vector<flatbuffers::Offset<ProfilingFB::DPUTask>> dpuOffsets;
+    // Invariants of the same multi-cluster task share the buffer and task IDs
+    std::set<std::pair<int64_t, int64_t>> sampledTasks;
     for (const auto& dpuInvariant : dpuTasks) {
+        // TableGen generate interface methods without const specifier, so can't be called from const DpuType&.
+        // In the same moment, coverity force to use const auto&
+        auto profMeta = const_cast<DPUInvariantType&>(dpuInvariant).getProfilingMetadata();
+        // Tasks skipped by sampled profiling have no profiling slot
+        if (!profMeta.has_value()) {
+            continue;
+        }
+        sampledTasks.emplace(profMeta->getBufferId().getInt(), profMeta->getTaskId().getInt());
+
         auto name = stringifyPrimaryLocationChecked(dpuInvariant->getLoc());
 
         const auto opBarriers = DialectProvider::getOpBarriers(barriers, dpuInvariant);
         std::vector<uint32_t> workloadIds =
                 DialectProvider::template getWorkloadIds<DPUInvariantType, DPUVariantType>(dpuInvariant);
 
-        // TableGen generate interface methods without const specifier, so can't be called from const DpuType&.
-        // In the same moment, coverity force to use const auto&
-        auto profMeta = const_cast<DPUInvariantType&>(dpuInvariant).getProfilingMetadata();
-        VPUX_THROW_UNLESS(profMeta.has_value(), "Empty profiling metadata at '{0}'", dpuInvariant);
-
         const auto taskOffset =
                 createDPUTaskMeta(builder, profMeta.value(), name, opBarriers.first, opBarriers.second, workloadIds);
         dpuOffsets.push_back(taskOffset);
     }
-    size_t dpuTaskCount = std::distance(dpuTasks.begin(), dpuTasks.end());
-    VPUX_THROW_WHEN(dpuOffsets.size() != dpuTaskCount,
-                    "Number of DPU tasks in profiling metadata ({0}) doesn't match the number of DPU invariants ({1})",
-                    dpuOffsets.size(), dpuTaskCount);
+    const size_t dpuTaskCount = std::distance(dpuTasks.begin(), dpuTasks.end());
+    if (sampling.has_value()) {
+        const auto expectedTasks = sampling->getNumSampledTasks();
+        VPUX_THROW_UNLESS(sampledTasks.size() == checked_cast<size_t>(expectedTasks),
+                          "Sampling every {0}-th of {1} NCE tasks must profile {2} tasks, got {3}",
+                          sampling->samplingPeriod, sampling->numTasks, expectedTasks, sampledTasks.size());
+    } else {
+        VPUX_THROW_UNLESS(dpuOffsets.size() == dpuTaskCount, "Expected profiling metadata for {0} DPU tasks, got {1}",
+                          dpuTaskCount, dpuOffsets.size());
+    }
+    coverage.push_back(TaskCoverage{profiling::ExecutorType::DPU, checked_cast<uint32_t>(dpuTaskCount),
+                                    checked_cast<uint32_t>(dpuOffsets.size())});
     return builder.CreateVector(dpuOffsets);
 }
 
@@ -419,6 +466,17 @@ flatbuffers::Offset<ProfilingFB::ProfilingBuffer> createProfilingBufferOffset(Pr
     return ProfilingFB::CreateProfilingBuffer(builder, sectionsOffset, sectionTotalSizeBytes);
 }
 
+FbVector<ProfilingFB::TaskCoverage> createCoverageOffset(ArrayRef<TaskCoverage> coverage,
+                                                        flatbuffers::FlatBufferBuilder& builder) {
+    std::vector<flatbuffers::Offset<ProfilingFB::TaskCoverage>> coverageOffsets;
+    for (const auto& engineCoverage : coverage) {
+        coverageOffsets.push_back(ProfilingFB::CreateTaskCoverage(builder, static_cast<uint32_t>(engineCoverage.type),
+                                                                  engineCoverage.totalTasks,
+                                                                  engineCoverage.profiledTasks));
+    }
+    return builder.CreateVector(coverageOffsets);
+}
+
 flatbuffers::Offset<ProfilingFB::Platform> createPlatformOffset(VPU::ArchKind arch,
                                                                 flatbuffers::FlatBufferBuilder& builder) {
     auto targetDevice = mapTargetDevice(arch);
@@ -436,21 +494,23 @@ flatbuffers::DetachedBuffer buildProfilingMetaGeneric(IE::CNNNetworkOp netOp, ml
     ProfilingConfiguration profilingCfg(netOp);
     const auto arch = VPU::getArch(funcOp);
 
+    SmallVector<TaskCoverage> coverage;
     auto dmaOffset = getDmaTasksOffset<DialectProvider, DmaType>(
-            profilingCfg, builder, DialectProvider::template extractOp<DmaType>(funcOp), barriers);
+            profilingCfg, builder, DialectProvider::template extractOp<DmaType>(funcOp), barriers, coverage);
     auto dpuOffset = getDpuTasksOffset<DialectProvider, DpuInvariantType, DpuVariantType>(
-            profilingCfg, builder, DialectProvider::template extractOp<DpuInvariantType>(funcOp), barriers);
+            profilingCfg, builder, DialectProvider::template extractOp<DpuInvariantType>(funcOp), barriers, coverage);
     auto swTaskOffset = getSwTasksOffset<DialectProvider, SwType>(
             profilingCfg, builder, DialectProvider::template extractComputeSwOp<SwType>(funcOp), barriers);
     auto m2iOffset = getM2iTasksOffset<DialectProvider, M2iType>(
             profilingCfg, builder, DialectProvider::template extractOp<M2iType>(funcOp), barriers);
     auto profilingBufferOffset = createProfilingBufferOffset(profilingCfg, builder);
     auto platformOffset = createPlatformOffset(arch, builder);
+    auto coverageOffset = createCoverageOffset(coverage, builder);
 
-    auto metadataOffset =
-            ProfilingFB::CreateProfilingMeta(builder, vpux::profiling::PROFILING_METADATA_VERSION_MAJOR,
-                                             vpux::profiling::PROFILING_METADATA_VERSION_MINOR, platformOffset,
-                                             profilingBufferOffset, dmaOffset, dpuOffset, swTaskOffset, m2iOffset);
+    auto metadataOffset = ProfilingFB::CreateProfilingMeta(
+            builder, vpux::profiling::PROFILING_METADATA_VERSION_MAJOR,
+            vpux::profiling::PROFILING_METADATA_VERSION_MINOR, platformOffset, profilingBufferOffset, dmaOffset,
+            dpuOffset, swTaskOffset, m2iOffset, coverageOffset);
     builder.Finish(metadataOffset);
 
     return builder.Release();
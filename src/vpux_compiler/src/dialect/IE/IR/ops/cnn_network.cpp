@@ -92,7 +92,8 @@ static mlir::LogicalResult checkFunctionPrototype(vpux::IE::CNNNetworkOp cnnOp,
 
 void vpux::IE::CNNNetworkOp::build(mlir::OpBuilder& builder, mlir::OperationState& state,
                                    mlir::FlatSymbolRefAttr entryPoint, bool withProfiling) {
-    build(builder, state, entryPoint, nullptr, static_cast<unsigned>(withProfiling ? 1 : 0));
+    build(builder, state, entryPoint, /*inferenceTiming=*/nullptr, /*dmaBusyTiming=*/nullptr,
+          /*dpuBusyTiming=*/nullptr, /*shaveBusyTiming=*/nullptr, static_cast<unsigned>(withProfiling ? 1 : 0));
 }
 
 mlir::LogicalResult vpux::IE::CNNNetworkOp::verifySymbolUses(mlir::SymbolTableCollection& symbolTable) {
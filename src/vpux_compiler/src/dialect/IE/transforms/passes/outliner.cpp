@@ -221,10 +221,11 @@ private:
 
 class RepeatingBlocks final : public OutlinerBase {
 public:
-    RepeatingBlocks(size_t minOpsInBlock, size_t maxNumIterations, bool weightsAsInputs, const Logger& log)
+    RepeatingBlocks(size_t minOpsInBlock, size_t maxNumIterations, bool weightsAsInputs, bool hashMatching,
+                    const Logger& log)
             : OutlinerBase(std::make_unique<FunctionOutlinerRepeatingBlocks>(minOpsInBlock, maxNumIterations,
                                                                              /*separateFunctions=*/false,
-                                                                             weightsAsInputs, log),
+                                                                             weightsAsInputs, log, hashMatching),
                            log) {
     }
 
@@ -372,10 +373,12 @@ private:
 
 class RepeatingBlocksSeparateFunctions final : public OutlinerBase {
 public:
-    RepeatingBlocksSeparateFunctions(size_t minOpsInBlock, size_t maxNumIterations, const Logger& log)
+    RepeatingBlocksSeparateFunctions(size_t minOpsInBlock, size_t maxNumIterations, bool hashMatching,
+                                     const Logger& log)
             : OutlinerBase(std::make_unique<FunctionOutlinerRepeatingBlocks>(minOpsInBlock, maxNumIterations,
                                                                              /*separateFunctions=*/true,
-                                                                             /*weightsAsInputs=*/false, log),
+                                                                             /*weightsAsInputs=*/false, log,
+                                                                             hashMatching),
                            log) {
     }
 
@@ -698,10 +701,12 @@ void OutlinerPass::safeRunOnModule() {
             outliner::Naive outliner(opt->numParts, _log);
             outliner.outline(moduleOp, "part");
         } else if (const auto* opt = _options.getIf<vpux::RepeatingBlocksOptions>(i)) {
-            outliner::RepeatingBlocks outliner(opt->minOpsInBlock, opt->maxNumIterations, opt->weightsAsInputs, _log);
+            outliner::RepeatingBlocks outliner(opt->minOpsInBlock, opt->maxNumIterations, opt->weightsAsInputs,
+                                               opt->hashMatching, _log);
             outliner.outline(moduleOp, "fn");
         } else if (const auto* opt = _options.getIf<vpux::RepeatingBlocksSeparateFunctionsOptions>(i)) {
-            outliner::RepeatingBlocksSeparateFunctions outliner(opt->minOpsInBlock, opt->maxNumIterations, _log);
+            outliner::RepeatingBlocksSeparateFunctions outliner(opt->minOpsInBlock, opt->maxNumIterations,
+                                                                opt->hashMatching, _log);
             outliner.outline(moduleOp, "fn");
         } else if (const auto* opt = _options.getIf<vpux::BatchingOptions>(i)) {
             std::ignore = opt;
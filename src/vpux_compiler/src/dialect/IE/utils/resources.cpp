@@ -455,6 +455,19 @@ SmallVector<IE::MemoryResourceOp> vpux::IE::getSWKernelPrefetchingReservedMemory
     return details::getReservedMemoryResource(mainModule, swKernelPrefetchingResMemModuleName);
 }
 
+//
+// CMX residency reserved memory
+//
+
+IE::MemoryResourceOp vpux::IE::setCMXResidencyReservedMemory(mlir::ModuleOp mainModule, mlir::SymbolRefAttr memSpace,
+                                                             int64_t size) {
+    return details::addReservedMemoryResource(mainModule, cmxResidencyResMemModuleName, memSpace, size);
+}
+
+IE::MemoryResourceOp vpux::IE::getCMXResidencyReservedMemory(mlir::ModuleOp mainModule, mlir::SymbolRefAttr memSpace) {
+    return details::getReservedMemoryResource(mainModule, cmxResidencyResMemModuleName, memSpace);
+}
+
 //
 // ExecutorResourceOp
 //
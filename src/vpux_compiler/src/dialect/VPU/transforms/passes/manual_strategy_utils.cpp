@@ -33,13 +33,14 @@ public:
               _readStrategyFileLocation(),
               _updateStrategyForOutputPipelining(false),
               _enableSideLoadDump(false),
-              _modelHash(){};
+              _modelHash(),
+              _modelIdentity(){};
     ManualStrategyUtilsPass(bool writeStrategyToJSON, StringRef writeStrategyFileLocation, bool readStrategyFromJSON,
                             StringRef readStrategyFileLocation, bool enableSideLoadDump, StringRef modelHash,
-                            Logger log);
+                            StringRef modelIdentity, Logger log);
     ManualStrategyUtilsPass(bool writeStrategyToJSON, StringRef writeStrategyFileLocation, bool readStrategyFromJSON,
                             StringRef readStrategyFileLocation, bool updateStrategyForOutputPipelining,
-                            bool enableSideLoadDump, StringRef modelHash, Logger log);
+                            bool enableSideLoadDump, StringRef modelHash, StringRef modelIdentity, Logger log);
 
 private:
     mlir::LogicalResult initializeOptions(StringRef options) final;
@@ -53,11 +54,13 @@ private:
     bool _updateStrategyForOutputPipelining;
     bool _enableSideLoadDump;
     std::string _modelHash;
+    std::string _modelIdentity;
 };
 
 ManualStrategyUtilsPass::ManualStrategyUtilsPass(bool writeStrategyToJSON, StringRef writeStrategyFileLocation,
                                                  bool readStrategyFromJSON, StringRef readStrategyFileLocation,
-                                                 bool enableSideLoadDump, StringRef modelHash, Logger log)
+                                                 bool enableSideLoadDump, StringRef modelHash, StringRef modelIdentity,
+                                                 Logger log)
         // NOTE: currently called after two/three strategy passes, flags in all must match.
         : _writeStrategyToJSON(writeStrategyToJSON),
           _writeStrategyFileLocation(writeStrategyFileLocation.str()),
@@ -65,14 +68,15 @@ ManualStrategyUtilsPass::ManualStrategyUtilsPass(bool writeStrategyToJSON, Strin
           _readStrategyFileLocation(readStrategyFileLocation.str()),
           _updateStrategyForOutputPipelining(false),
           _enableSideLoadDump(enableSideLoadDump),
-          _modelHash(modelHash) {
+          _modelHash(modelHash),
+          _modelIdentity(modelIdentity) {
     Base::initLogger(log, Base::getArgumentName());
 }
 
 ManualStrategyUtilsPass::ManualStrategyUtilsPass(bool writeStrategyToJSON, StringRef writeStrategyFileLocation,
                                                  bool readStrategyFromJSON, StringRef readStrategyFileLocation,
                                                  bool updateStrategyForOutputPipelining, bool enableSideLoadDump,
-                                                 StringRef modelHash, Logger log)
+                                                 StringRef modelHash, StringRef modelIdentity, Logger log)
         // NOTE: currently called after two/three strategy passes, flags in all must match.
         : _writeStrategyToJSON(writeStrategyToJSON),
           _writeStrategyFileLocation(writeStrategyFileLocation.str()),
@@ -80,7 +84,8 @@ ManualStrategyUtilsPass::ManualStrategyUtilsPass(bool writeStrategyToJSON, Strin
           _readStrategyFileLocation(readStrategyFileLocation.str()),
           _updateStrategyForOutputPipelining(updateStrategyForOutputPipelining),
           _enableSideLoadDump(enableSideLoadDump),
-          _modelHash(modelHash) {
+          _modelHash(modelHash),
+          _modelIdentity(modelIdentity) {
     Base::initLogger(log, Base::getArgumentName());
 }
 
@@ -124,7 +129,8 @@ void ManualStrategyUtilsPass::safeRunOnFunc() {
     if (_enableSideLoadDump) {
         const auto layerHashes = hashFunctionLayers(func);
         VPUX_THROW_UNLESS(layerHashes.succeed, "Can't generate unique hashes for side-load dump");
-        saveMCSideLoadStrategyToFile(func, "mc_side_load_dump.json", layerHashes.localizedHashes, _modelHash);
+        saveMCSideLoadStrategyToFile(func, "mc_side_load_dump.json", layerHashes.localizedHashes, _modelHash,
+                                     _modelIdentity);
     }
 
     if (!_writeStrategyToJSON && !_readStrategyFromJSON) {
@@ -263,17 +269,18 @@ std::unique_ptr<mlir::Pass> vpux::VPU::createManualStrategyUtilsPass() {
 
 std::unique_ptr<mlir::Pass> VPU::createManualStrategyUtilsPass(
         bool writeStrategyToJSON, StringRef writeStrategyFileLocation, bool readStrategyFromJSON,
-        StringRef readStrategyFileLocation, bool enableSideLoadDump, StringRef modelHash, Logger log) {
+        StringRef readStrategyFileLocation, bool enableSideLoadDump, StringRef modelHash, StringRef modelIdentity,
+        Logger log) {
     return std::make_unique<ManualStrategyUtilsPass>(writeStrategyToJSON, writeStrategyFileLocation,
                                                      readStrategyFromJSON, readStrategyFileLocation, enableSideLoadDump,
-                                                     modelHash, log);
+                                                     modelHash, modelIdentity, log);
 }
 
 std::unique_ptr<mlir::Pass> VPU::createManualStrategyUtilsPass(
         bool writeStrategyToJSON, StringRef writeStrategyFileLocation, bool readStrategyFromJSON,
         StringRef readStrategyFileLocation, bool updateStrategyForOutputPipelining, bool enableSideLoadDump,
-        StringRef modelHash, Logger log) {
+        StringRef modelHash, StringRef modelIdentity, Logger log) {
     return std::make_unique<ManualStrategyUtilsPass>(
             writeStrategyToJSON, writeStrategyFileLocation, readStrategyFromJSON, readStrategyFileLocation,
-            updateStrategyForOutputPipelining, enableSideLoadDump, modelHash, log);
+            updateStrategyForOutputPipelining, enableSideLoadDump, modelHash, modelIdentity, log);
 }
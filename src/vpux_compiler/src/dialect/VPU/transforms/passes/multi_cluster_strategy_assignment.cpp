@@ -20,11 +20,12 @@ class MultiClusterStrategyAssignmentPass final :
         public MultiClusterStrategyAssignmentBase<MultiClusterStrategyAssignmentPass> {
 public:
     explicit MultiClusterStrategyAssignmentPass(bool enablePrefetchTiling, bool enableMcSideLoadingDump,
-                                                StringRef modelHash, Logger log)
+                                                StringRef modelHash, StringRef modelIdentity, Logger log)
             : _enablePrefetchTiling(enablePrefetchTiling),
 
               _enableMcSideLoadingDump(enableMcSideLoadingDump),
-              _modelHash(modelHash) {
+              _modelHash(modelHash),
+              _modelIdentity(modelIdentity) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
@@ -36,6 +37,7 @@ private:
     bool _enablePrefetchTiling = true;
     bool _enableMcSideLoadingDump;
     std::string _modelHash;
+    std::string _modelIdentity;
 };
 
 mlir::LogicalResult MultiClusterStrategyAssignmentPass::initializeOptions(StringRef options) {
@@ -65,9 +67,16 @@ void MultiClusterStrategyAssignmentPass::safeRunOnFunc() {
     }
 
     bool mcSideLoadSucceeded = false;
-    if (!_enableMcSideLoadingDump && isStrategyPreConfigured(_modelHash)) {
-        _log.trace("Found pre-defined strategy for model hash '{0}'", _modelHash);
-        mcSideLoadSucceeded = loadPreConfiguredStrategy(_log, func, _modelHash);
+    // The identity covers both topology and weights, so it is preferred over the topology-only hash
+    for (StringRef modelKey : {StringRef(_modelIdentity), StringRef(_modelHash)}) {
+        if (_enableMcSideLoadingDump || modelKey.empty() || !isStrategyPreConfigured(modelKey)) {
+            continue;
+        }
+        _log.trace("Found pre-defined strategy for model '{0}'", modelKey);
+        mcSideLoadSucceeded = loadPreConfiguredStrategy(_log, func, modelKey);
+        if (mcSideLoadSucceeded) {
+            break;
+        }
     }
     _log.warning("Compiler strategy match: {0}", mcSideLoadSucceeded);
     if (mcSideLoadSucceeded) {
@@ -94,7 +103,8 @@ void MultiClusterStrategyAssignmentPass::safeRunOnFunc() {
 
 std::unique_ptr<mlir::Pass> VPU::createMultiClusterStrategyAssignmentPass(bool enablePrefetchTiling,
                                                                           bool enableMcSideLoadingDump,
-                                                                          StringRef modelHash, Logger log) {
+                                                                          StringRef modelHash, StringRef modelIdentity,
+                                                                          Logger log) {
     return std::make_unique<MultiClusterStrategyAssignmentPass>(enablePrefetchTiling, enableMcSideLoadingDump,
-                                                                modelHash, log);
+                                                                modelHash, modelIdentity, log);
 }
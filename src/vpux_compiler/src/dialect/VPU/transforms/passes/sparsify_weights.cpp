@@ -49,6 +49,7 @@ void SparsifyWeightsPass::safeRunOnFunc() {
     auto& ctx = getContext();
 
     std::unique_ptr<BaseWeightsSparsityStrategy> enablementStrategy;
+    CostBasedWeightsSparsityStrategy* costBasedStrategy = nullptr;
     if (_heuristic == VPU::WeightsSparsityHeuristic::CMX) {
         _log.trace("Using CMX-based heuristic");
         const Byte availableCMX = VPU::getTotalCMXSize(module);
@@ -58,6 +59,11 @@ void SparsifyWeightsPass::safeRunOnFunc() {
         _log.trace("Using ratio-based heuristic");
         enablementStrategy = std::make_unique<RatioBasedWeightsSparsityStrategy>(
                 WEIGHTS_SPARSITY_FLOAT_RATIO_THRESHOLD, WEIGHTS_SPARSITY_INT_RATIO_THRESHOLD, _manualThreshold);
+    } else if (_heuristic == VPU::WeightsSparsityHeuristic::COST) {
+        _log.trace("Using cost-based heuristic");
+        auto costStrategy = std::make_unique<CostBasedWeightsSparsityStrategy>(func, _manualThreshold, _log.nest(2));
+        costBasedStrategy = costStrategy.get();
+        enablementStrategy = std::move(costStrategy);
     } else {
         VPUX_THROW("Unsupported heuristic: {0}", _heuristic);
     }
@@ -113,6 +119,17 @@ void SparsifyWeightsPass::safeRunOnFunc() {
     });
 
     DenseMap<Const::DeclareOp, VPU::GroupSparseTensorOp> localReplacementCache;
+    const auto eraseUnusedSparseTensorOp = [&](Const::DeclareOp weightsOp, VPU::GroupSparseTensorOp groupedView) {
+        if (!groupedView->use_empty()) {
+            return;
+        }
+        auto sparsifiedWeights = groupedView.getData().getDefiningOp();
+        auto sparsityMap = groupedView.getSparsityMap().getDefiningOp();
+        groupedView->erase();
+        sparsifiedWeights->erase();
+        sparsityMap->erase();
+        localReplacementCache.erase(weightsOp);
+    };
     // poor man's way to only create a GroupSparseTensor once. done this way to
     // limit the amount of changes around multi-threaded code.
     const auto getCachedSparseTensorOp = [&](Const::DeclareOp weightsOp, const Const::ContentSetup& newContentAttrSetup,
@@ -189,12 +206,32 @@ void SparsifyWeightsPass::safeRunOnFunc() {
         // IR modification is not thread safe according to MLIR documentation.
         std::lock_guard<std::mutex> guard(irModificationMutex);
 
+        // The cost model temporarily sets attributes on the operation, so it is evaluated under the same lock
+        VPU::StrategyCost denseCost = 0;
+        if (costBasedStrategy != nullptr) {
+            denseCost = costBasedStrategy->getLayerCost(nceOp);
+        }
+
         VPU::GroupSparseTensorOp groupedView =
                 getCachedSparseTensorOp(weightsOp, newContentAttrSetup, sparsityCompressionAttr);
 
-        weightsOp->replaceUsesWithIf(groupedView, [useToReplace = sparsifiableOp.getOperation()](mlir::OpOperand& use) {
+        const auto isUseToReplace = [useToReplace = sparsifiableOp.getOperation()](mlir::OpOperand& use) {
             return use.getOwner() == useToReplace;
-        });
+        };
+        weightsOp->replaceUsesWithIf(groupedView, isUseToReplace);
+
+        if (costBasedStrategy != nullptr) {
+            const auto sparseCost = costBasedStrategy->getLayerCost(nceOp);
+            innerLog.trace("Layer cost with dense weights {0}, with sparse weights {1}", denseCost, sparseCost);
+            if (sparseCost >= denseCost) {
+                innerLog.trace("Sparse weights do not lower the latency of op '{0}' at '{1}'",
+                               sparsifiableOp->getName(), sparsifiableOp->getLoc());
+                groupedView->replaceUsesWithIf(weightsOp, isUseToReplace);
+                eraseUnusedSparseTensorOp(weightsOp, groupedView);
+                return;
+            }
+        }
+
         if (weightsOp->getUses().empty()) {
             weightsOp->erase();
         }
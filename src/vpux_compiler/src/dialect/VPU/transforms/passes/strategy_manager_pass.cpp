@@ -28,8 +28,11 @@ namespace {
 
 class StrategyManagerImplPass final : public StrategyManagerImplBase<StrategyManagerImplPass> {
 public:
-    explicit StrategyManagerImplPass(bool enablePrefetchTiling, Logger log)
-            : _enablePrefetchTiling(enablePrefetchTiling) {
+    explicit StrategyManagerImplPass(bool enablePrefetchTiling, bool enableVerticalFusion,
+                                     bool enableVerticalFusionPipelining, Logger log)
+            : _enablePrefetchTiling(enablePrefetchTiling),
+              _enableVerticalFusion(enableVerticalFusion),
+              _enableVerticalFusionPipelining(enableVerticalFusionPipelining) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
@@ -51,6 +54,8 @@ private:
     std::shared_ptr<LayerVPUNNCost> _costModel;
     SmallVector<VPU::MultiClusterStrategy> _archStrategies;
     bool _enablePrefetchTiling = true;
+    bool _enableVerticalFusion = false;
+    bool _enableVerticalFusionPipelining = false;
     int64_t _numTiles;
 };
 
@@ -102,6 +107,12 @@ mlir::LogicalResult StrategyManagerImplPass::initialize(mlir::MLIRContext* ctx)
         _log.trace("Overloading enablePrefetchTiling with an MLIR variable");
         _enablePrefetchTiling = tilingMode.getValue() == "PREFETCH";
     }
+    if (enableVerticalFusion.hasValue()) {
+        _enableVerticalFusion = enableVerticalFusion.getValue();
+    }
+    if (enableVerticalFusionPipelining.hasValue()) {
+        _enableVerticalFusionPipelining = enableVerticalFusionPipelining.getValue();
+    }
     return mlir::success();
 }
 
@@ -253,7 +264,8 @@ void StrategyManagerImplPass::safeRunOnFunc() {
     }
 
     // optimization
-    auto stateProvider = std::make_shared<DefaultStateProvider>(operationStrategies, _costModel);
+    auto stateProvider = std::make_shared<DefaultStateProvider>(operationStrategies, _costModel, _enableVerticalFusion,
+                                                                _enableVerticalFusionPipelining);
 
     if (operations.size() > 1) {
         TilingOptions options;
@@ -306,8 +318,10 @@ void StrategyManagerImplPass::safeRunOnFunc() {
 // createStrategyManagerImplPass
 //
 
-std::unique_ptr<mlir::Pass> createStrategyManagerImplPass(bool enablePrefetchTiling, Logger log) {
-    return std::make_unique<StrategyManagerImplPass>(enablePrefetchTiling, log);
+std::unique_ptr<mlir::Pass> createStrategyManagerImplPass(bool enablePrefetchTiling, bool enableVerticalFusion,
+                                                          bool enableVerticalFusionPipelining, Logger log) {
+    return std::make_unique<StrategyManagerImplPass>(enablePrefetchTiling, enableVerticalFusion,
+                                                     enableVerticalFusionPipelining, log);
 }
 
 }  // namespace vpux::VPU
@@ -28,8 +28,11 @@ class WrapOpsInSparsifyDesparsifyPairsPass final :
 public:
     WrapOpsInSparsifyDesparsifyPairsPass() = default;
     explicit WrapOpsInSparsifyDesparsifyPairsPass(VPU::EnableActivationSparsityMode enableActivationSparsityMode,
-                                                  VPU::ActivationSparsityProfile actSparsityProfile, Logger log)
-            : _enableActivationSparsityMode(enableActivationSparsityMode), _sparsityProfile(actSparsityProfile) {
+                                                  VPU::ActivationSparsityProfile actSparsityProfile,
+                                                  StringRef sparsityStatsFile, Logger log)
+            : _enableActivationSparsityMode(enableActivationSparsityMode),
+              _sparsityProfile(actSparsityProfile),
+              _sparsityStatsFile(sparsityStatsFile.str()) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
@@ -41,6 +44,7 @@ private:
 private:
     VPU::EnableActivationSparsityMode _enableActivationSparsityMode = VPU::EnableActivationSparsityMode::FALSE;
     VPU::ActivationSparsityProfile _sparsityProfile{VPU::ActivationSparsityProfile::S0};
+    std::string _sparsityStatsFile;
     VPU::SparsityProfileCreateFunc _sparsityProfileCreateCb;
 };
 
@@ -57,6 +61,10 @@ mlir::LogicalResult WrapOpsInSparsifyDesparsifyPairsPass::initialize(mlir::MLIRC
         _sparsityProfile = getSparsityProfile(sparsityProfile.getValue());
     }
 
+    if (sparsityStatsFile.hasValue()) {
+        _sparsityStatsFile = sparsityStatsFile.getValue();
+    }
+
     return mlir::success();
 }
 
@@ -69,15 +77,16 @@ void WrapOpsInSparsifyDesparsifyPairsPass::safeRunOnFunc() {
     using namespace VPU::NCESparsity;
 
     auto func = getOperation();
-    auto rtStatsHelper = RuntimeSparsityStatsProvider(func, _log);
 
     // Enable activation sparsity if the option is passed
-    // For the AUTO option, only enable if statistics are present inside the module
+    // For the AUTO and COST options, only enable if statistics are present inside the module or the file
     if (_enableActivationSparsityMode == VPU::EnableActivationSparsityMode::FALSE) {
         return;
     }
-    if (_enableActivationSparsityMode == VPU::EnableActivationSparsityMode::AUTO &&
-        !rtStatsHelper.containsStatistics()) {
+    const auto statsBasedMode = _enableActivationSparsityMode == VPU::EnableActivationSparsityMode::AUTO ||
+                                _enableActivationSparsityMode == VPU::EnableActivationSparsityMode::COST;
+    auto rtStatsHelper = RuntimeSparsityStatsProvider(func, _log, statsBasedMode ? _sparsityStatsFile : "");
+    if (statsBasedMode && !rtStatsHelper.containsStatistics()) {
         return;
     }
 
@@ -106,6 +115,10 @@ void WrapOpsInSparsifyDesparsifyPairsPass::safeRunOnFunc() {
             !rtStatsHelper.likelySparsityConsumer(consumerOp, operandId)) {
             return;
         }
+        if (_enableActivationSparsityMode == VPU::EnableActivationSparsityMode::COST &&
+            !rtStatsHelper.profitableSparsityConsumer(consumerOp, operandId)) {
+            return;
+        }
 
         const auto producer = consumerOp->getOperand(operandId);
         const auto shape = producer.getType().cast<vpux::NDTypeInterface>().getShape();
@@ -154,7 +167,7 @@ std::unique_ptr<mlir::Pass> vpux::VPU::createWrapOpsInSparsifyDesparsifyPairsPas
 
 std::unique_ptr<mlir::Pass> vpux::VPU::createWrapOpsInSparsifyDesparsifyPairsPass(
         VPU::EnableActivationSparsityMode enableActivationSparsityMode,
-        VPU::ActivationSparsityProfile actSparsityProfile, Logger log) {
+        VPU::ActivationSparsityProfile actSparsityProfile, StringRef sparsityStatsFile, Logger log) {
     return std::make_unique<WrapOpsInSparsifyDesparsifyPairsPass>(enableActivationSparsityMode, actSparsityProfile,
-                                                                  log);
+                                                                  sparsityStatsFile, log);
 }
@@ -90,7 +90,8 @@ void vpux::VPU::buildActivationSparsityPipeline(mlir::OpPassManager& pm, const V
     const auto profileCallback = getSparsityProfileCallback(actSparsityProfile);
 
     pm.addPass(VPU::createWrapOpsInSparsifyDesparsifyPairsPass(
-            VPU::getActSparsityMode(options.enableActivationSparsity), actSparsityProfile, log));
+            VPU::getActSparsityMode(options.enableActivationSparsity), actSparsityProfile,
+            options.actSparsityStatsFile.getValue(), log));
 
     if (actSparsityProfile == VPU::ActivationSparsityProfile::S1) {
         pm.addPass(VPU::createFuseSparsityOpsPass(/*fuseSparsify=*/false, log));
@@ -147,7 +148,8 @@ void vpux::VPU::buildTilingPipeline(mlir::OpPassManager& pm, const VPU::TilingOp
     if (!options.enableVerticalFusion) {
         pm.addPass(VPU::createManualStrategyUtilsPass(options.writeStrategyToJson, writeStrategyFileLocation,
                                                       options.readStrategyFromJson, readStrategyFileLocation,
-                                                      /*enableMCSideLoadDump*/ false, options.modelHash, log));
+                                                      /*enableMCSideLoadDump*/ false, options.modelHash,
+                                                      options.modelIdentity, log));
     }
     pm.addPass(VPU::createEfficientIROrderPass(log));
     if (options.enableVerticalFusion) {
@@ -159,7 +161,8 @@ void vpux::VPU::buildTilingPipeline(mlir::OpPassManager& pm, const VPU::TilingOp
         pm.addPass(VPU::createManualStrategyUtilsPass(options.writeStrategyToJson, writeStrategyFileLocation,
                                                       options.readStrategyFromJson, readStrategyFileLocation,
                                                       /*updateStrategyForOutputPipelining*/ true,
-                                                      /*enableMCSideLoadDump*/ false, options.modelHash, log));
+                                                      /*enableMCSideLoadDump*/ false, options.modelHash,
+                                                      options.modelIdentity, log));
     }
     // manual strategy debug configuration
 
@@ -180,7 +183,8 @@ void vpux::VPU::buildVFPipeline(mlir::OpPassManager& pm, const VPU::TilingOption
     pm.addPass(VPU::createUnrollUnusedVerticalFusionRegionPass(log));
     pm.addPass(VPU::createManualStrategyUtilsPass(options.writeStrategyToJson, writeStrategyFileLocation,
                                                   options.readStrategyFromJson, readStrategyFileLocation,
-                                                  /*enableMCSideLoadDump*/ false, options.modelHash, log));
+                                                  /*enableMCSideLoadDump*/ false, options.modelHash,
+                                                  options.modelIdentity, log));
     pm.addPass(VPU::createVfTilingPass(options.enableVerticalFusionPipelining, log));
 }
 
@@ -188,7 +192,8 @@ void vpux::VPU::buildSMPipeline(mlir::OpPassManager& pm, const vpux::MCAndTiling
     // TO DO - SM Assignment Optimization Pass
     // Keep enableSMpipleline Option - false till SM pipeline is built
 
-    pm.addPass(VPU::createStrategyManagerImplPass(options.enablePrefetching, log));
+    pm.addPass(VPU::createStrategyManagerImplPass(options.enablePrefetching, options.enableVerticalFusion,
+                                                 options.enablePipelining, log));
     pm.addPass(VPU::createEfficientIROrderPass(log));
     if (options.enableVerticalFusion) {
         VPU::buildVFPipeline(pm, VPU::TilingOptions(options), log);
@@ -198,7 +203,8 @@ void vpux::VPU::buildSMPipeline(mlir::OpPassManager& pm, const vpux::MCAndTiling
     if (!options.enableVerticalFusion) {
         pm.addPass(VPU::createManualStrategyUtilsPass(options.writeStrategyToJson, writeStrategyFileLocation,
                                                       options.readStrategyFromJson, readStrategyFileLocation,
-                                                      /*enableMCSideLoadDump*/ false, options.modelHash, log));
+                                                      /*enableMCSideLoadDump*/ false, options.modelHash,
+                                                      options.modelIdentity, log));
     }
     pm.addPass(VPU::createApplyTilingPass(log));
     pm.addPass(VPU::createMakeOpsWithDistributedTensorPass(options.enableExplicitDistributionInfoAttr, log));
@@ -53,6 +53,19 @@ void MultiClusterStrategySetter::setTemporaryStrategy(VPU::MultiClusterStrategy
 }
 
 StrategyCost LayerVPUNNCost::getStrategyCost(mlir::Operation* operation, const VPUNNCostParameters& parameters) const {
+    const auto cost = getEstimatedStrategyCost(operation, parameters);
+
+    // Scale set from the profiling report of a previous run, see ApplyProfileGuidedCostsPass
+    auto scaleAttr = operation->getAttrOfType<mlir::FloatAttr>(profiledCostScale);
+    if (scaleAttr == nullptr || cost >= VPU::INVALID_COST_BASE) {
+        return cost;
+    }
+    const auto scaledCost = std::llround(cost * scaleAttr.getValueAsDouble());
+    return static_cast<StrategyCost>(std::clamp<int64_t>(scaledCost, 1, VPU::INVALID_COST_BASE - 1));
+}
+
+StrategyCost LayerVPUNNCost::getEstimatedStrategyCost(mlir::Operation* operation,
+                                                      const VPUNNCostParameters& parameters) const {
     if (mlir::isa<VPU::NCEPermuteOp>(operation)) {
         return getSimpleLayerCost(operation->getResult(0).getType().cast<vpux::NDTypeInterface>(), parameters);
     } else if (auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(operation)) {
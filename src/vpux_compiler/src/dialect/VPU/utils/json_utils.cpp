@@ -286,12 +286,15 @@ void updateTilingStrategyInJSONForOperations(llvm::json::Value& json,
 }
 
 void saveMCSideLoadStrategyToFile(mlir::func::FuncOp func, StringRef strategyJsonPath,
-                                  const mlir::DenseMap<mlir::Operation*, size_t>& opToHash, StringRef modelHash) {
+                                  const mlir::DenseMap<mlir::Operation*, size_t>& opToHash, StringRef modelHash,
+                                  StringRef modelIdentity) {
     constexpr StringLiteral MODEL_HASH_KEY = "ModelHash";
+    constexpr StringLiteral MODEL_IDENTITY_KEY = "ModelIdentity";
     constexpr StringLiteral OP_HASH_KEY = "Op";
 
     llvm::json::Object model{};
     model[MODEL_HASH_KEY.str()] = modelHash.str();
+    model[MODEL_IDENTITY_KEY.str()] = modelIdentity.str();
     llvm::json::Object opsToStrategies{};
     func->walk([&](VPU::LayerOpInterface op) {
         auto isNCEOp = mlir::isa<VPU::NCEOpInterface>(op.getOperation());
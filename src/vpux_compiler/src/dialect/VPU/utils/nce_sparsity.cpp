@@ -19,10 +19,14 @@
 #include "vpux/utils/core/enums.hpp"
 #include "vpux/utils/core/numeric.hpp"
 
+#include <cmath>
+#include <fstream>
 #include <limits>
 #include <numeric>
+#include <sstream>
 
 #include <llvm/ADT/bit.h>
+#include <llvm/Support/JSON.h>
 
 using namespace vpux;
 
@@ -443,8 +447,13 @@ bool vpux::VPU::NCESparsity::isSuperdenseRequired(const VPU::ArchKind arch, cons
 }
 
 vpux::VPU::NCESparsity::RuntimeSparsityStatsProvider::RuntimeSparsityStatsProvider(mlir::func::FuncOp func,
-                                                                                   vpux::Logger log)
+                                                                                   vpux::Logger log,
+                                                                                   StringRef statsFileName)
         : _logger(log), _lookup({}) {
+    if (!statsFileName.empty()) {
+        loadStatisticsFile(statsFileName);
+    }
+
     auto module = func->getParentOfType<mlir::ModuleOp>();
     auto statOps = to_small_vector(module.getOps<IE::SparsityStatisticsOp>());
     VPUX_THROW_UNLESS(statOps.size() <= 1, "Module must contains 0 or 1 sparsity statistics, but got {0}",
@@ -458,41 +467,118 @@ vpux::VPU::NCESparsity::RuntimeSparsityStatsProvider::RuntimeSparsityStatsProvid
     for (auto& info : infos) {
         auto asOp = mlir::cast<IE::SparsityInfoOp>(info);
         const auto key = asOp.getName().str();
-        _lookup.emplace(key, asOp);
+        _lookup.emplace(key, SparsityInfo{asOp.getInputId(), asOp.getRatioAttr().getValueAsDouble()});
     }
 }
 
+void vpux::VPU::NCESparsity::RuntimeSparsityStatsProvider::loadStatisticsFile(StringRef statsFileName) {
+    std::ifstream stream(statsFileName.str());
+    VPUX_THROW_UNLESS(stream.good(), "Failed to open sparsity statistics file '{0}'", statsFileName);
+    std::stringstream content;
+    content << stream.rdbuf();
+
+    auto json = llvm::json::parse(content.str());
+    VPUX_THROW_UNLESS(static_cast<bool>(json), "Failed to parse sparsity statistics file '{0}': {1}", statsFileName,
+                      llvm::toString(json.takeError()));
+    auto root = json->getAsObject();
+    VPUX_THROW_WHEN(root == nullptr, "Sparsity statistics file '{0}' must contain a JSON object", statsFileName);
+
+    for (const auto& entry : *root) {
+        const StringRef entryId = entry.getFirst();
+        auto object = entry.getSecond().getAsObject();
+        VPUX_THROW_WHEN(object == nullptr, "Entry '{0}' of sparsity statistics file '{1}' is not an object",
+                        entryId, statsFileName);
+        const auto nodeName = object->getString("node_name");
+        const auto portId = object->getInteger("port_id");
+        const auto ratio = object->getNumber("statistic");
+        VPUX_THROW_UNLESS(nodeName.has_value() && portId.has_value() && ratio.has_value(),
+                          "Entry '{0}' of sparsity statistics file '{1}' must have 'node_name', 'port_id' and "
+                          "'statistic' fields",
+                          entryId, statsFileName);
+        VPUX_THROW_UNLESS(ratio.value() >= 0.0 && ratio.value() <= 1.0,
+                          "Sparsity ratio of entry '{0}' must be in [0, 1] range, got {1}", entryId,
+                          ratio.value());
+        _lookup.emplace(nodeName.value().str(), SparsityInfo{portId.value(), ratio.value()});
+    }
+
+    _logger.trace("Loaded {0} entries from sparsity statistics file '{1}'", root->size(), statsFileName);
+}
+
 bool vpux::VPU::NCESparsity::RuntimeSparsityStatsProvider::containsStatistics() const {
     return _lookup.size() > 0;
 }
 
-bool vpux::VPU::NCESparsity::RuntimeSparsityStatsProvider::likelySparsityConsumer(mlir::Operation* op,
-                                                                                  int64_t requestedInputId) const {
+std::optional<double> vpux::VPU::NCESparsity::RuntimeSparsityStatsProvider::getSparsityRatio(
+        mlir::Operation* op, int64_t requestedInputId) const {
     auto loc = op->getLoc().dyn_cast<mlir::FusedLoc>();
     if (loc == nullptr) {
-        return false;
+        return std::nullopt;
     }
     auto locParts = loc.getLocations();
     if (locParts.empty()) {
-        return false;
+        return std::nullopt;
     }
     auto keyNameLoc = locParts.front().dyn_cast<mlir::NameLoc>();
     if (keyNameLoc == nullptr) {
-        return false;
+        return std::nullopt;
     }
     const auto key = keyNameLoc.getName().strref().data();
     for (auto it = _lookup.find(key); it != _lookup.end() && it->first == key; ++it) {
-        auto opStats = it->second;
-        auto inputId = opStats.getInputId();
-        if (inputId != requestedInputId) {
+        if (it->second.inputId != requestedInputId) {
             continue;
         }
-        const auto ratio = opStats.getRatioAttr().getValueAsDouble();
+        const auto ratio = it->second.ratio;
         _logger.trace("Found RT stats for input {0} of '{1}'.  Sparsity ratio is {2}", requestedInputId, op->getLoc(),
                       ratio);
-        return ratio >= MINIMAL_SPARSITY_THRESHOLD;
+        return ratio;
+    }
+    return std::nullopt;
+}
+
+bool vpux::VPU::NCESparsity::RuntimeSparsityStatsProvider::likelySparsityConsumer(mlir::Operation* op,
+                                                                                  int64_t requestedInputId) const {
+    const auto ratio = getSparsityRatio(op, requestedInputId);
+    return ratio.has_value() && ratio.value() >= MINIMAL_SPARSITY_THRESHOLD;
+}
+
+bool vpux::VPU::NCESparsity::RuntimeSparsityStatsProvider::profitableSparsityConsumer(
+        mlir::Operation* op, int64_t requestedInputId) const {
+    const auto ratio = getSparsityRatio(op, requestedInputId);
+    if (!ratio.has_value()) {
+        return false;
+    }
+
+    // Only a Sparsify fused into the producer is free, the others are lowered to an extra NCE task or to a
+    // sparsity map without zeros. The output of a sparse producer is already wrapped in Sparsify -> Desparsify
+    const auto input = op->getOperand(requestedInputId);
+    auto producerOp = input.getDefiningOp();
+    if (auto desparsifyOp = mlir::dyn_cast_or_null<VPU::DesparsifyOp>(producerOp)) {
+        producerOp = desparsifyOp.getInput().getDefiningOp();
     }
-    return false;
+    if (auto sparsifyOp = mlir::dyn_cast_or_null<VPU::SparsifyOp>(producerOp)) {
+        producerOp = sparsifyOp.getInput().getDefiningOp();
+    }
+    if (producerOp == nullptr || !VPU::supportsSparseOutputs(producerOp)) {
+        _logger.trace("Input {0} of '{1}' cannot be written sparse by its producer", requestedInputId, op->getLoc());
+        return false;
+    }
+
+    const auto inputType = input.getType().cast<vpux::NDTypeInterface>();
+    if (inputType.getRank() != 4) {
+        return false;
+    }
+
+    // A storage element holds all the channels of a pixel, the costs are compared per storage element
+    const auto channels = static_cast<double>(inputType.getShape()[Dims4D::Act::C]);
+    const auto elemBytes = static_cast<double>(inputType.getElemTypeSize().count()) / 8.0;
+    const auto denseBytes = channels * elemBytes;
+    const auto compressedBytes =
+            std::ceil((1.0 - ratio.value()) * denseBytes / SPARSE_DATA_ALIGNMENT) * SPARSE_DATA_ALIGNMENT;
+    const auto mapBytes = SPARSITY_MAP_ACCESSES * channels / 8.0;
+    _logger.trace("Input {0} of '{1}': {2} of {3} bytes per storage element saved by zero skipping, {4} bytes of "
+                  "sparsity map traffic",
+                  requestedInputId, op->getLoc(), denseBytes - compressedBytes, denseBytes, mapBytes);
+    return denseBytes - compressedBytes > mapBytes;
 }
 
 //
@@ -13,6 +13,7 @@
 using namespace vpux;
 
 static constexpr auto MODE_AUTO = "auto";
+static constexpr auto MODE_COST = "cost";
 static constexpr auto MODE_TRUE = "true";
 static constexpr auto MODE_FALSE = "false";
 
@@ -21,6 +22,8 @@ VPU::EnableActivationSparsityMode VPU::getActSparsityMode(std::string strMode) {
 
     if (strMode == MODE_AUTO) {
         return VPU::EnableActivationSparsityMode::AUTO;
+    } else if (strMode == MODE_COST) {
+        return VPU::EnableActivationSparsityMode::COST;
     } else if (strMode == MODE_TRUE) {
         return VPU::EnableActivationSparsityMode::TRUE;
     } else if (strMode == MODE_FALSE) {
@@ -41,7 +44,8 @@ VPU::EnableActivationSparsityMode VPU::getActSparsityMode(const StrOption& enabl
 bool VPU::isActSparsityEnabled(const StrOption& enableActivationSparsityOption) {
     const auto actSparsityMode = getActSparsityMode(enableActivationSparsityOption);
     return actSparsityMode == VPU::EnableActivationSparsityMode::TRUE ||
-           actSparsityMode == VPU::EnableActivationSparsityMode::AUTO;
+           actSparsityMode == VPU::EnableActivationSparsityMode::AUTO ||
+           actSparsityMode == VPU::EnableActivationSparsityMode::COST;
 }
 
 // Get the largest storage element size that is compatible with the given number of channels
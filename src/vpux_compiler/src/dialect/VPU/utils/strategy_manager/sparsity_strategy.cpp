@@ -6,6 +6,10 @@
 #include "vpux/compiler/dialect/VPU/utils/strategy_manager/sparsity_strategy.hpp"
 
 #include "vpux/compiler/dialect/IE/IR/ops.hpp"
+#include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPU/transforms/factories/mc_strategy_getter.hpp"
+#include "vpux/compiler/dialect/VPU/utils/generate_tiling.hpp"
+#include "vpux/compiler/dialect/VPU/utils/multi_cluster_strategy_utils.hpp"
 #include "vpux/compiler/dialect/VPU/utils/nce_sparsity.hpp"
 
 #include "vpux/compiler/core/layers.hpp"
@@ -123,6 +127,96 @@ bool CMXConsumptionBasedWeightsSparsityStrategy::shouldSparsifyWeights(Logger& l
     return std::isgreaterequal(actualSparsityRatio, sparsityRatioThreshold);
 }
 
+CostBasedWeightsSparsityStrategy::CostBasedWeightsSparsityStrategy(mlir::func::FuncOp func,
+                                                                   std::optional<double> manualThreshold, Logger log)
+        : _costModel(func, log), _manualThreshold(manualThreshold), _log(log) {
+    auto module = func->getParentOfType<mlir::ModuleOp>();
+    _numTiles = IE::getTileExecutor(module).getCount();
+    auto mcStrategyGetter = createMCStrategyGetter(VPU::getArch(module), _numTiles);
+    mcStrategyGetter->getMCStrategies(_strategies);
+}
+
+bool CostBasedWeightsSparsityStrategy::shouldSparsifyWeights(Logger& log, vpux::NDTypeInterface weightsType,
+                                                             ArrayRef<int64_t> numNonSparseElemsPerOC, bool) {
+    // This case requires tiling over input channels, which is not supported with the current representation of the
+    // compression scheme
+    if (weightsType.getShape()[Dims4D::Filter::IC] > VPU::NCEInvariant::VPU_DIMENSION_LIMIT) {
+        log.trace("Input channels are larger than 8K. Skipping");
+        return false;
+    }
+    const auto actualSparsityRatio = getSparsityRatio(weightsType, numNonSparseElemsPerOC);
+    if (isDoubleEqual(actualSparsityRatio, 1.0)) {
+        log.trace("All weights are zero, so sparsity ratio is 1. Skipping");
+        return false;
+    }
+    if (isDoubleEqual(actualSparsityRatio, 0.0)) {
+        log.trace("Weights have no sparse values. Skipping");
+        return false;
+    }
+
+    // The manual threshold is a lower bound, the cost model still has the final word
+    if (_manualThreshold.has_value() && std::isless(actualSparsityRatio, _manualThreshold.value())) {
+        log.trace("Sparsity ratio {0} is below the manual threshold {1}", actualSparsityRatio,
+                  _manualThreshold.value());
+        return false;
+    }
+
+    log.trace("Sparsity ratio {0}, layer cost has to be evaluated", actualSparsityRatio);
+    return true;
+}
+
+StrategyCost CostBasedWeightsSparsityStrategy::getLayerCost(VPU::NCEOpInterface nceOp) const {
+    auto operation = nceOp.getOperation();
+    auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(operation);
+    auto tilingBuilderOp = mlir::dyn_cast<VPU::TilingBuilderOpInterface>(operation);
+    auto siblingsAnalysis = SiblingOpsAnalysis(operation);
+
+    const auto getStrategyCost = [&](VPU::MultiClusterStrategy strategy) -> std::optional<StrategyCost> {
+        MultiClusterStrategySetter mcSetter(operation, strategy);
+
+        auto mode = TilingMode::ISOLATED;
+        OutputTiling tiling;
+        if (tilingBuilderOp != nullptr && opNeedsTiling(operation, /*enablePrefetchTiling=*/false, _log)) {
+            const auto tilingResult =
+                    getLayerTilingStrategy(tilingBuilderOp, /*enablePrefetchTiling=*/false, mode, _log);
+            if (mlir::failed(tilingResult)) {
+                return std::nullopt;
+            }
+            tiling = tilingResult.value();
+        } else if (clusteredOp != nullptr && !clusteredOp.doesLayerFitIntoCMX(strategy, siblingsAnalysis, Byte(0))) {
+            return std::nullopt;
+        }
+
+        const auto cost = _costModel.getStrategyCost(operation, VPUNNCostParameters(strategy, tiling, mode));
+        _log.trace("Strategy {0} with {1} tiles costs {2}", strategy, std::max<size_t>(tiling.size(), 1), cost);
+        return cost;
+    };
+
+    std::optional<StrategyCost> bestCost;
+    for (auto strategy : _strategies) {
+        // HKSwitch cost depends on the strategy of the consumers, which is not decided yet
+        if (strategy == VPU::MultiClusterStrategy::HKSwitch) {
+            continue;
+        }
+        if (clusteredOp == nullptr ||
+            !isStrategyCompatibleShape(clusteredOp, TileInfo(getShape(operation->getResult(0))), strategy, _log) ||
+            !clusteredOp.checkStrategyCompatibility(strategy, _numTiles)) {
+            continue;
+        }
+        const auto cost = getStrategyCost(strategy);
+        if (cost.has_value() && (!bestCost.has_value() || cost.value() < bestCost.value())) {
+            bestCost = cost;
+        }
+    }
+
+    // Single cluster devices or operations without compatible multi-cluster strategies
+    if (!bestCost.has_value()) {
+        bestCost = getStrategyCost(VPU::MultiClusterStrategy::Clustering);
+    }
+
+    return bestCost.value_or(std::numeric_limits<StrategyCost>::max());
+}
+
 }  // namespace NCESparsity
 
 }  // namespace VPU
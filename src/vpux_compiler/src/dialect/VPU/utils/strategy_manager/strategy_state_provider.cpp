@@ -7,6 +7,7 @@
 #include "vpux/compiler/dialect/VPU/utils/cost_model/cost_model.hpp"
 #include "vpux/compiler/dialect/VPU/utils/cost_model/layer_vpunn_cost.hpp"
 #include "vpux/compiler/dialect/VPU/utils/multi_cluster_strategy_utils.hpp"
+#include "vpux/compiler/dialect/VPU/utils/vertical_fusion_utils.hpp"
 #include "vpux/compiler/utils/VPU/tile_utils.hpp"
 
 #include <numeric>
@@ -241,6 +242,15 @@ StrategyCost DefaultStateProvider::getTransitionCost(const OperationStrategy& fi
 
         transitionCost = _costModel->getSpillingCost(firstState.first, getCostModelParameters(firstState),
                                                      secondState.first, getCostModelParameters(secondState));
+
+        // vertical fusion avoids the spill as well, so the cheaper option is taken
+        // and strategies of both operations are chosen together with the fusion decision
+        if (_enableVerticalFusion) {
+            const auto vfTransitionCost = getVFTransitionCost(firstState, secondState);
+            if (vfTransitionCost.has_value()) {
+                transitionCost = std::min(transitionCost, vfTransitionCost.value());
+            }
+        }
     }
 
     _storage->setTransitionCost(firstState, secondState, transitionCost);
@@ -248,6 +258,89 @@ StrategyCost DefaultStateProvider::getTransitionCost(const OperationStrategy& fi
     return transitionCost;
 }
 
+std::optional<StrategyCost> DefaultStateProvider::getVFTransitionCost(const OperationStrategy& parentState,
+                                                                      const OperationStrategy& childState) const {
+    auto* parentOp = parentState.first;
+    auto* childOp = childState.first;
+
+    auto parentVFOp = mlir::dyn_cast<VPU::VerticalFusionOpInterface>(parentOp);
+    auto childVFOp = mlir::dyn_cast<VPU::VerticalFusionOpInterface>(childOp);
+    if (parentVFOp == nullptr || childVFOp == nullptr || !parentVFOp.isVFSupported() || !childVFOp.isVFSupported()) {
+        return std::nullopt;
+    }
+
+    // the intermediate tensor must be consumed only inside the fused region
+    // and both operations need the same distribution of tiles
+    if (!parentOp->getResult(0).hasOneUse() || *parentOp->getUsers().begin() != childOp) {
+        return std::nullopt;
+    }
+    if (parentState.second.getMCStrategy() != childState.second.getMCStrategy()) {
+        return std::nullopt;
+    }
+
+    const auto getTiling = [](const OperationStrategy& state) {
+        const auto tilingStrategy = state.second.getTilingStrategy();
+        if (tilingStrategy != nullptr) {
+            return parseIntArrayAttr<int64_t>(tilingStrategy);
+        }
+        const auto rank = state.first->getResult(0).getType().cast<vpux::NDTypeInterface>().getRank();
+        return SmallVector<int64_t>(rank, 1);
+    };
+
+    const auto parentTiling = getTiling(parentState);
+    const auto childTiling = getTiling(childState);
+    if (parentTiling.size() != childTiling.size() || parentTiling.size() != Dims4D::Act::numSpatialDims + 2) {
+        return std::nullopt;
+    }
+
+    // VF region is tiled over single spatial axis, both operations take the larger number of tiles
+    const auto parentDims = getNonOneDim(Shape(parentTiling));
+    const auto childDims = getNonOneDim(Shape(childTiling));
+    if (parentDims.size() > 1 || childDims.size() > 1 || (parentDims.empty() && childDims.empty())) {
+        return std::nullopt;
+    }
+    const auto axis = !parentDims.empty() ? parentDims.front() : childDims.front();
+    if (!childDims.empty() && childDims.front() != axis) {
+        return std::nullopt;
+    }
+    if (axis != Dims4D::Act::H && axis != Dims4D::Act::W) {
+        return std::nullopt;
+    }
+    if (llvm::is_contained(parentVFOp.restrictedFusionAxes(), axis) ||
+        llvm::is_contained(childVFOp.restrictedFusionAxes(), axis)) {
+        return std::nullopt;
+    }
+
+    auto vfTiling = SmallVector<int64_t>(parentTiling.size(), 1);
+    vfTiling[axis.ind()] = std::max(parentTiling[axis.ind()], childTiling[axis.ind()]);
+
+    const auto operations = SmallVector<mlir::Operation*>{parentOp, childOp};
+    SmallVector<SmallVector<VPUNNCostParameters>> tilesCostParams;
+    StrategyCost sequentialCost = 0;
+    for (const auto& state : {parentState, childState}) {
+        const auto mcStrategy = state.second.getMCStrategy();
+        const auto mode = state.second.getTilingMode();
+
+        auto tiles = fillDividedTiles(state.first, Shape(vfTiling), getShape(state.first->getResult(0)));
+        if (mlir::failed(tiles) || !isCMXConcatentationAvaliable(state.first, mode, tiles.value(), mcStrategy)) {
+            return std::nullopt;
+        }
+
+        auto& opTilesCostParams = tilesCostParams.emplace_back();
+        for (const auto& tile : tiles.value()) {
+            opTilesCostParams.push_back(VPUNNCostParameters(mcStrategy, OutputTiling{tile}, mode));
+            sequentialCost += _costModel->getStrategyCost(state.first, opTilesCostParams.back());
+        }
+    }
+
+    const auto fusedCost =
+            _enableVFPipelining ? getPipelinedCost(operations, tilesCostParams, *_costModel) : sequentialCost;
+
+    // isolated costs of both operations are already part of the state cost
+    const auto isolatedCost = _storage->getStrategyCost(parentState) + _storage->getStrategyCost(childState);
+    return fusedCost > isolatedCost ? fusedCost - isolatedCost : 0;
+}
+
 bool DefaultStateProvider::spillAroundConcat(mlir::Operation* operation) const {
     if (!mlir::isa<VPU::ConcatOp>(operation)) {
         return false;
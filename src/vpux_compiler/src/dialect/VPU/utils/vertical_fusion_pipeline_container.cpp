@@ -18,11 +18,15 @@ void VFPipelineContainer::addOperation(mlir::Operation* operation, const VPUNNCo
 }
 
 StrategyCost VFPipelineContainer::maxCost(const std::unique_ptr<VPU::LayerVPUNNCost>& costFunction) const {
+    return maxCost(*costFunction);
+}
+
+StrategyCost VFPipelineContainer::maxCost(const VPU::LayerVPUNNCost& costFunction) const {
     StrategyCost swCost = 0;
     StrategyCost dpuCost = 0;
 
     for (auto item : _containerMapper) {
-        auto operCost = costFunction->getStrategyCost(item.first, item.second);
+        auto operCost = costFunction.getStrategyCost(item.first, item.second);
         if (mlir::isa<VPU::SWOpInterface>(item.first)) {
             swCost += operCost;
         } else {
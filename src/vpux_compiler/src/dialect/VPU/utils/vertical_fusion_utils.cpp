@@ -570,52 +570,56 @@ void existedVFSpilling(mlir::Operation* operation, const std::unique_ptr<TilingO
 StrategyCost getVFCostPipelined(const int tilesNumber, VFConfig& config,
                                 const std::unique_ptr<TilingOperationStorage>& opStorage,
                                 const std::unique_ptr<VPU::LayerVPUNNCost>& costFunction) {
-    StrategyCost pipelinedCost = 0;
-    // create a structure which reflects the execution order of the IR
-    // same way as scheduler does
+    auto& operations = config.getVFOperations();
 
-    auto pipelinedStructure = SmallVector<VFPipelineContainer>();
+    SmallVector<SmallVector<VPUNNCostParameters>> tilesCostParams(operations.size());
+    for (auto opIndex : irange(operations.size())) {
+        for (auto index : irange(tilesNumber)) {
+            tilesCostParams[opIndex].push_back(
+                    fillInCostParam(operations[opIndex], opStorage, index, config.isPipelined()));
+        }
+    }
+
+    return VPU::getPipelinedCost(operations, tilesCostParams, *costFunction);
+}
+
+StrategyCost vpux::VPU::getPipelinedCost(ArrayRef<mlir::Operation*> operations,
+                                         ArrayRef<SmallVector<VPUNNCostParameters>> tilesCostParams,
+                                         const VPU::LayerVPUNNCost& costFunction) {
+    VPUX_THROW_UNLESS(operations.size() == tilesCostParams.size(),
+                      "Cost parameters are provided for {0} operations, but there are {1} operations",
+                      tilesCostParams.size(), operations.size());
 
+    // create a structure which reflects the execution order of the IR
+    // same way as scheduler does
     // first "tile" is fully filled as it is,
     // next tile might be pipelined
-    auto& operations = config.getVFOperations();
 
-    for (auto index : irange(tilesNumber)) {
-        // first row should be presented in the container
-        // DPU -> SW -> DPU
-        // next line has to be pipelined
-        // 1. SW Engine compute bottleneck
-
-        // DPU ENGINE  | DPU0 | DPU1 |          | DPU0 | DPU 2 |  | DPU 1 |         | DPU 2 |
-        // SW ENGINE         |       SW0       |       SW1       |       SW2       |
-
-        // 2. DPU Engine compute bottleneck
-
-        // DPU ENGINE  |  DPU0  |  DPU 1  |  DPU 0  |  DPU 2  |  DPU 1  |  DPU2  |
-        // SW ENGINE           |  SW0  | |  SW1 |            | SW2  |
-        // E#95184 for extending the case
-        if (index == 0) {
-            for (auto opIndex : irange(operations.size())) {
-                pipelinedStructure.emplace_back(VFPipelineContainer(
-                        operations[opIndex],
-                        fillInCostParam(operations[opIndex], opStorage, index, config.isPipelined())));
-            }
-            continue;
-        }
+    // DPU -> SW -> DPU
+    // 1. SW Engine compute bottleneck
 
-        for (auto opIndex : irange(operations.size())) {
-            auto tilingInfo = fillInCostParam(operations[opIndex], opStorage, index, config.isPipelined());
-            auto containerNumber = pipelinedStructure.size() - VF_PIPELINE_LENGTH + 1 + opIndex;
+    // DPU ENGINE  | DPU0 | DPU1 |          | DPU0 | DPU 2 |  | DPU 1 |         | DPU 2 |
+    // SW ENGINE         |       SW0       |       SW1       |       SW2       |
 
+    // 2. DPU Engine compute bottleneck
+
+    // DPU ENGINE  |  DPU0  |  DPU 1  |  DPU 0  |  DPU 2  |  DPU 1  |  DPU2  |
+    // SW ENGINE           |  SW0  | |  SW1 |            | SW2  |
+    // E#95184 for extending the case
+    auto pipelinedStructure = SmallVector<VFPipelineContainer>();
+
+    for (auto opIndex : irange(operations.size())) {
+        for (auto index : irange(tilesCostParams[opIndex].size())) {
+            const auto containerNumber = index + opIndex;
             if (containerNumber >= pipelinedStructure.size()) {
-                pipelinedStructure.emplace_back(VFPipelineContainer(operations[opIndex], tilingInfo));
-            } else {
-                pipelinedStructure[containerNumber].addOperation(operations[opIndex], tilingInfo);
+                pipelinedStructure.resize(containerNumber + 1);
             }
+            pipelinedStructure[containerNumber].addOperation(operations[opIndex], tilesCostParams[opIndex][index]);
         }
     }
 
     // iterate through the structure, accumulate the cost for each "container", taking maximum from it.
+    StrategyCost pipelinedCost = 0;
     for (auto& container : pipelinedStructure) {
         pipelinedCost += container.maxCost(costFunction);
     }
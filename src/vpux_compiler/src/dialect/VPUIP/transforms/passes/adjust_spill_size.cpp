@@ -3,29 +3,119 @@
 // SPDX-License-Identifier: Apache 2.0
 //
 
+#include "vpux/compiler/core/cost_model_utils.hpp"
+#include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
+#include "vpux/compiler/dialect/VPU/utils/cost_model/cost_model.hpp"
 #include "vpux/compiler/dialect/VPUIP/transforms/passes.hpp"
 #include "vpux/compiler/utils/compression_utils.hpp"
 #include "vpux/compiler/utils/memref_attr_utils.hpp"
+#include "vpux/compiler/utils/types.hpp"
+
+#include <mlir/Dialect/Async/IR/Async.h>
+#include <mlir/Dialect/MemRef/IR/MemRef.h>
+
+#include <cmath>
 
 using namespace vpux;
 
 namespace {
 
+// DMAs moving single DDR-resident intermediate activation
+struct IntermediateTransfers {
+    VPUIP::NNDMAOp writeOp;
+    SmallVector<VPUIP::NNDMAOp> readOps;
+};
+
+bool isCompactType(vpux::NDTypeInterface origType) {
+    const auto strideReqs = StrideReqs::compact(origType.getShape().size());
+    return strideReqs.checkStrides(origType);
+}
+
+// Get NNDMA which uses given operand either directly or through NCEClusterTiling body argument
+VPUIP::NNDMAOp getDmaUser(mlir::OpOperand& use) {
+    auto* user = use.getOwner();
+    if (auto dmaOp = mlir::dyn_cast<VPUIP::NNDMAOp>(user)) {
+        return dmaOp;
+    }
+
+    auto clusterOp = mlir::dyn_cast<VPUIP::NCEClusterTilingOp>(user);
+    if (clusterOp == nullptr) {
+        return nullptr;
+    }
+    auto innerArg = clusterOp.getBody().getArgument(use.getOperandNumber());
+    if (!innerArg.hasOneUse()) {
+        return nullptr;
+    }
+    return mlir::dyn_cast<VPUIP::NNDMAOp>(*innerArg.getUsers().begin());
+}
+
+bool isWholeBufferDma(VPUIP::NNDMAOp dmaOp, VPU::MemoryKind srcKind, VPU::MemoryKind dstKind) {
+    if (dmaOp.getSpillId().has_value() || dmaOp.getCompressCandidateAttr() != nullptr) {
+        return false;
+    }
+
+    const auto inType = dmaOp.getInput().getType().cast<vpux::NDTypeInterface>();
+    const auto outType = dmaOp.getOutput().getType().cast<vpux::NDTypeInterface>();
+    if (inType.getMemoryKind() != srcKind || outType.getMemoryKind() != dstKind) {
+        return false;
+    }
+    if (!isCompactType(inType) || !isCompactType(outType)) {
+        return false;
+    }
+
+    const auto cmxType = srcKind == VPU::MemoryKind::CMX_NN ? inType : outType;
+    return isSupportedBufferSizeForCompression(cmxType);
+}
+
+// Every transfer of the buffer moves about expectedCompressionRatio of its data, but the compressed DMA also
+// transfers the act_comp_size entry which holds the compressed size. The same holds for the write and each
+// read, so the number of transfers does not change the decision
+bool isCompressionBeneficial(int64_t bufferSize, double expectedCompressionRatio, VPUNN::VPUDevice vpuDevice,
+                             const std::shared_ptr<VPUNN::VPUCostModel>& costModel, mlir::MLIRContext* ctx) {
+    const auto getTransferCost = [&](int64_t numBytes) {
+        const auto type = mlir::RankedTensorType::get({numBytes}, getUInt8Type(ctx));
+        return getDMACost(type.cast<vpux::NDTypeInterface>(), vpuDevice, costModel, 1);
+    };
+
+    const auto compressedSize = static_cast<int64_t>(std::ceil(bufferSize * expectedCompressionRatio));
+    const auto sizeEntryCost = getTransferCost(ACT_COMPRESSION_SIZE_ENTRY_SIZE);
+    return getTransferCost(bufferSize) > getTransferCost(compressedSize) + sizeEntryCost;
+}
+
 class AdjustSpillSizePass final : public VPUIP::AdjustSpillSizeBase<AdjustSpillSizePass> {
 public:
-    explicit AdjustSpillSizePass(Logger log) {
+    explicit AdjustSpillSizePass(const bool compressDdrIntermediates, Logger log)
+            : _compressDdrIntermediates(compressDdrIntermediates) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
+
 private:
     void safeRunOnFunc() final;
     int64_t getAdjustedSpillBufferSize(vpux::NDTypeInterface origTypeThatGotSpilled);
     void updateSpillWrite(VPUIP::NNDMAOp dmaOp);
     void updateSpillRead(VPUIP::NNDMAOp dmaOp);
 
+    std::optional<IntermediateTransfers> getIntermediateTransfers(mlir::memref::AllocOp allocOp);
+    void prepareDdrIntermediates(mlir::func::FuncOp func, int64_t nextSpillId);
+
+    bool _compressDdrIntermediates;
     mlir::DenseMap<int64_t, mlir::Type> _spillIdAndTypeMap;
 };
 
+mlir::LogicalResult AdjustSpillSizePass::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+
+    if (compressDdrIntermediates.hasValue()) {
+        _compressDdrIntermediates = compressDdrIntermediates.getValue();
+    }
+
+    return mlir::success();
+}
+
 int64_t AdjustSpillSizePass::getAdjustedSpillBufferSize(vpux::NDTypeInterface origTypeThatGotSpilled) {
     int64_t numberOfDmas = 1;
     // In case of segmented buffer each chunk needs to satisfy
@@ -136,13 +226,126 @@ void AdjustSpillSizePass::updateSpillRead(VPUIP::NNDMAOp dmaOp) {
     dmaOp.setCompressCandidate(true);
 }
 
+// Check if DDR buffer is an intermediate activation which is written once by a CMX->DDR DMA
+// and afterwards only read back in whole by DDR->CMX DMAs. Any other user, like a view op
+// or a DDR kernel, needs the data uncompressed
+std::optional<IntermediateTransfers> AdjustSpillSizePass::getIntermediateTransfers(mlir::memref::AllocOp allocOp) {
+    const auto bufferType = allocOp.getType().cast<vpux::NDTypeInterface>();
+    if (bufferType.getMemoryKind() != VPU::MemoryKind::DDR || getCompressionStateAttr(bufferType) != nullptr) {
+        return std::nullopt;
+    }
+
+    IntermediateTransfers transfers;
+    mlir::Value writeResult;
+    for (auto& use : allocOp->getUses()) {
+        auto dmaOp = getDmaUser(use);
+        if (dmaOp == nullptr) {
+            return std::nullopt;
+        }
+
+        auto clusterOp = mlir::dyn_cast<VPUIP::NCEClusterTilingOp>(use.getOwner());
+        const auto bufferInDma =
+                clusterOp != nullptr ? clusterOp.getBody().getArgument(use.getOperandNumber()) : allocOp.getResult();
+        if (dmaOp.getOutputBuff() == bufferInDma) {
+            if (transfers.writeOp != nullptr ||
+                !isWholeBufferDma(dmaOp, VPU::MemoryKind::CMX_NN, VPU::MemoryKind::DDR)) {
+                return std::nullopt;
+            }
+            transfers.writeOp = dmaOp;
+            writeResult = clusterOp != nullptr ? clusterOp->getResult(0) : dmaOp.getOutput();
+        } else {
+            if (!isWholeBufferDma(dmaOp, VPU::MemoryKind::DDR, VPU::MemoryKind::CMX_NN)) {
+                return std::nullopt;
+            }
+            transfers.readOps.push_back(dmaOp);
+        }
+    }
+
+    if (transfers.writeOp == nullptr) {
+        return std::nullopt;
+    }
+
+    // Written data is passed to readers through async value of the write region
+    auto writeExecOp = writeResult.getDefiningOp()->getParentOfType<mlir::async::ExecuteOp>();
+    if (writeExecOp == nullptr || writeExecOp.getBodyResults().size() != 1) {
+        return std::nullopt;
+    }
+    auto yieldOp = mlir::cast<mlir::async::YieldOp>(writeExecOp.getBody()->getTerminator());
+    if (yieldOp.getOperands().front() != writeResult) {
+        return std::nullopt;
+    }
+    for (auto* user : writeExecOp.getBodyResults()[0].getUsers()) {
+        auto readExecOp = mlir::dyn_cast<mlir::async::ExecuteOp>(user);
+        if (readExecOp == nullptr) {
+            return std::nullopt;
+        }
+
+        for (const auto& bodyOperand : readExecOp.getBodyOperands() | indexed) {
+            if (bodyOperand.value() != writeExecOp.getBodyResults()[0]) {
+                continue;
+            }
+            for (auto& use : readExecOp.getBody()->getArgument(bodyOperand.index()).getUses()) {
+                auto dmaOp = getDmaUser(use);
+                if (dmaOp == nullptr || !isWholeBufferDma(dmaOp, VPU::MemoryKind::DDR, VPU::MemoryKind::CMX_NN)) {
+                    return std::nullopt;
+                }
+                transfers.readOps.push_back(dmaOp);
+            }
+        }
+    }
+
+    if (transfers.readOps.empty()) {
+        return std::nullopt;
+    }
+
+    return transfers;
+}
+
+// Mark transfers of DDR intermediate activations as compression candidates when cost model
+// expects DDR bandwidth savings. Each selected buffer gets a spill id not used by the scheduler,
+// so that later stages handle its write and reads exactly like a spill
+void AdjustSpillSizePass::prepareDdrIntermediates(mlir::func::FuncOp func, int64_t nextSpillId) {
+    const auto arch = VPU::getArch(func);
+    const auto vpuDevice = VPU::getVPUDeviceType(arch);
+    const auto costModel = VPU::createCostModel(arch);
+    const auto compressionRatio = expectedCompressionRatio.getValue();
+
+    func->walk([&](mlir::memref::AllocOp allocOp) {
+        auto transfers = getIntermediateTransfers(allocOp);
+        if (!transfers.has_value()) {
+            return;
+        }
+
+        const auto writeOp = transfers.value().writeOp;
+        const auto bufferSize =
+                writeOp.getInput().getType().cast<vpux::NDTypeInterface>().getTotalAllocSize().count();
+        if (!isCompressionBeneficial(bufferSize, compressionRatio, vpuDevice, costModel, func.getContext())) {
+            _log.trace("Compression of DDR intermediate '{0}' is not beneficial", allocOp->getLoc());
+            return;
+        }
+
+        _log.trace("DDR intermediate '{0}' selected for compression with spillId '{1}'", allocOp->getLoc(),
+                   nextSpillId);
+
+        writeOp.setSpillId(nextSpillId);
+        updateSpillWrite(writeOp);
+        for (auto readOp : transfers.value().readOps) {
+            readOp.setSpillId(nextSpillId);
+            updateSpillRead(readOp);
+        }
+        ++nextSpillId;
+    });
+}
+
 void AdjustSpillSizePass::safeRunOnFunc() {
     auto func = getOperation();
 
+    int64_t nextSpillId = 0;
     func->walk([&](VPUIP::NNDMAOp dmaOp) {
         if (!dmaOp.getSpillId().has_value()) {
             return;
         }
+        nextSpillId = std::max(nextSpillId, dmaOp.getSpillId().value() + 1);
 
         const auto inType = dmaOp.getInput().getType().cast<vpux::NDTypeInterface>();
         const auto outType = dmaOp.getOutput().getType().cast<vpux::NDTypeInterface>();
@@ -158,6 +361,10 @@ void AdjustSpillSizePass::safeRunOnFunc() {
             }
         }
     });
+
+    if (_compressDdrIntermediates) {
+        prepareDdrIntermediates(func, nextSpillId);
+    }
 }
 
 }  // namespace
@@ -166,6 +373,6 @@ void AdjustSpillSizePass::safeRunOnFunc() {
 // createAdjustSpillSizePass
 //
 
-std::unique_ptr<mlir::Pass> vpux::VPUIP::createAdjustSpillSizePass(Logger log) {
-    return std::make_unique<AdjustSpillSizePass>(log);
+std::unique_ptr<mlir::Pass> vpux::VPUIP::createAdjustSpillSizePass(const bool compressDdrIntermediates, Logger log) {
+    return std::make_unique<AdjustSpillSizePass>(compressDdrIntermediates, log);
 }
@@ -33,7 +33,8 @@ namespace {
 
 class DPUProfilingPass final : public VPUIP::DPUProfilingBase<DPUProfilingPass> {
 public:
-    explicit DPUProfilingPass(VPUIP::MemKindCreateFunc memKindCb, Logger log): _memKindCb(std::move(memKindCb)) {
+    explicit DPUProfilingPass(VPUIP::MemKindCreateFunc memKindCb, int64_t samplingPeriod, Logger log)
+            : _memKindCb(std::move(memKindCb)), _samplingPeriod(samplingPeriod) {
         VPUX_THROW_UNLESS(_memKindCb != nullptr, "Missing memKindCb");
         Base::initLogger(log, Base::getArgumentName());
     }
@@ -43,17 +44,32 @@ public:
     }
 
 private:
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
     void safeRunOnModule() final;
 
 private:
     VPUIP::MemKindCreateFunc _memKindCb;
+    int64_t _samplingPeriod;
 };
 
+mlir::LogicalResult DPUProfilingPass::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+
+    if (samplingPeriod.hasValue()) {
+        _samplingPeriod = samplingPeriod.getValue();
+    }
+    VPUX_THROW_UNLESS(_samplingPeriod > 0, "Profiling sampling period must be positive, got {0}", _samplingPeriod);
+
+    return mlir::success();
+}
+
 // DPU profiling pass
 // Add profiling buffer for the all DPU Clusters in the network
 // Steps:
 //   1. For each cluster amount create ClusterBufferScheduler instance
-//   2. Find all NCEClusterTaskOp and group them by cluster amount
+//   2. Find all NCEClusterTaskOp and group them by cluster amount, with sampling only every N-th task is taken
 //   3. Using this information calculate needed DDR amount
 //   4. ClusterBufferScheduler will handle grouped tasks and connect results to DDR
 //   5. Concat results from different schedulers
@@ -87,7 +103,13 @@ void DPUProfilingPass::safeRunOnModule() {
     clusterSchedulers[1] = std::unique_ptr<BaseClusterBufferScheduler>(
             new SingleClusterScheduler(profilingWorkloadSize, builder, ctx, memKind, netFunc, nameUniqifier));
 
+    int64_t nceTaskIdx = 0;
     netFunc.walk([&](VPUIP::NCEClusterTaskOp nceClusterTaskOp) {
+        if (nceTaskIdx++ % _samplingPeriod != 0) {
+            _log.trace("Skip Operation '{0}' due to sampling", nceClusterTaskOp->getLoc());
+            return;
+        }
+
         _log.trace("Process Operation '{0}'", nceClusterTaskOp->getLoc());
         const auto numClusters = getClustersNumber(nceClusterTaskOp);
         if (clusterSchedulers.count(numClusters) == 0) {
@@ -107,6 +129,10 @@ void DPUProfilingPass::safeRunOnModule() {
         return;
     }
 
+    if (_samplingPeriod > 1) {
+        setDpuProfilingSampling(module, DpuProfilingSampling{_samplingPeriod, nceTaskIdx});
+    }
+
     const auto outputResult = mlir::MemRefType::get({totalDpuDdrProfilingOutputSize}, getUInt64Type(ctx));
     auto profilingResult = addNewProfilingOutput(ctx, netFunc, netOp, outputResult, profiling::ExecutorType::DPU);
 
@@ -134,6 +160,7 @@ void DPUProfilingPass::safeRunOnModule() {
 // createDPUProfilingPass
 //
 
-std::unique_ptr<mlir::Pass> vpux::VPUIP::createDPUProfilingPass(VPUIP::MemKindCreateFunc memKindCb, Logger log) {
-    return std::make_unique<DPUProfilingPass>(std::move(memKindCb), log);
+std::unique_ptr<mlir::Pass> vpux::VPUIP::createDPUProfilingPass(VPUIP::MemKindCreateFunc memKindCb,
+                                                                int64_t samplingPeriod, Logger log) {
+    return std::make_unique<DPUProfilingPass>(std::move(memKindCb), samplingPeriod, log);
 }
@@ -187,7 +187,8 @@ class FeasibleAllocationPass final : public VPUIP::FeasibleAllocationBase<Feasib
 public:
     FeasibleAllocationPass(VPUIP::MemKindCreateFunc memKindCb, VPUIP::MemKindCreateFunc secondLevelmemKindCb,
                            bool linearizeSchedule, bool enablePipelining, bool enablePrefetching,
-                           bool optimizeFragmentation, bool optimizeDynamicSpilling, Logger log);
+                           bool optimizeFragmentation, bool optimizeDynamicSpilling, bool enableSpillCostEviction,
+                           Logger log);
 
 public:
     mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
@@ -216,19 +217,23 @@ private:
     bool _enableScheduleStatistics{false};
     bool _optimizeFragmentation{true};
     bool _optimizeDynamicSpilling{true};
+    bool _enableSpillCostEviction{false};
+    size_t _prefetchLookahead{0};
 };
 
 FeasibleAllocationPass::FeasibleAllocationPass(VPUIP::MemKindCreateFunc memKindCb,
                                                VPUIP::MemKindCreateFunc secondLvlmemKindCb, bool linearizeSchedule,
                                                bool enablePipelining, bool enablePrefetching,
-                                               bool optimizeFragmentation, bool optimizeDynamicSpilling, Logger log)
+                                               bool optimizeFragmentation, bool optimizeDynamicSpilling,
+                                               bool enableSpillCostEviction, Logger log)
         : _memKindCb(std::move(memKindCb)),
           _secondLvlMemKindCb(std::move(secondLvlmemKindCb)),
           _linearizeSchedule(linearizeSchedule),
           _enablePipelining(enablePipelining),
           _enablePrefetching(enablePrefetching),
           _optimizeFragmentation(optimizeFragmentation),
-          _optimizeDynamicSpilling(optimizeDynamicSpilling) {
+          _optimizeDynamicSpilling(optimizeDynamicSpilling),
+          _enableSpillCostEviction(enableSpillCostEviction) {
     Base::initLogger(log, Base::getArgumentName());
 }
 
@@ -268,6 +273,16 @@ mlir::LogicalResult FeasibleAllocationPass::initialize(mlir::MLIRContext* ctx) {
         _linearizeSchedule = linearizeSchedule.getValue();
     }
 
+    if (enableSpillCostEviction.hasValue()) {
+        _enableSpillCostEviction = enableSpillCostEviction.getValue();
+    }
+
+    if (prefetchLookahead.hasValue()) {
+        VPUX_THROW_WHEN(prefetchLookahead.getValue() < 0, "Negative prefetch lookahead '{0}'",
+                        prefetchLookahead.getValue());
+        _prefetchLookahead = checked_cast<size_t>(prefetchLookahead.getValue());
+    }
+
     return mlir::success();
 }
 
@@ -653,7 +668,8 @@ void FeasibleAllocationPass::safeRunOnFunc() {
 
     // feasible memory scheduler - list scheduler
     FeasibleMemoryScheduler scheduler(_memKind, _secondLvlMemKind, liveRangeInfo, depsInfo, _log, scan, arch, costModel,
-                                      tileCount, dmaCount, _enableScheduleStatistics, _optimizeFragmentation);
+                                      tileCount, dmaCount, _enableScheduleStatistics, _optimizeFragmentation,
+                                      _enableSpillCostEviction);
 
     // 1. initial schedule
     auto scheduledOps = scheduler.generateSchedule();
@@ -664,7 +680,7 @@ void FeasibleAllocationPass::safeRunOnFunc() {
 
     // 2. prefetching
     if (_enablePrefetching && !_linearizeSchedule) {
-        PrefetchDataOps prefetching(scheduledOps, depsInfo);
+        PrefetchDataOps prefetching(scheduledOps, depsInfo, _prefetchLookahead);
         prefetching.enableDataOpPrefetching();
 
         LinearScan<mlir::Value, LinearScanHandler> prefetchScan(maxSize.count(), reservedMemVec, alignment);
@@ -678,7 +694,8 @@ void FeasibleAllocationPass::safeRunOnFunc() {
 
         FeasibleMemoryScheduler schedulerWithPrefetch(_memKind, _secondLvlMemKind, prefetchLiveRangeInfo, depsInfo,
                                                       _log, prefetchScan, arch, costModel, tileCount, dmaCount,
-                                                      _enableScheduleStatistics, _optimizeFragmentation);
+                                                      _enableScheduleStatistics, _optimizeFragmentation,
+                                                      _enableSpillCostEviction);
         scheduledOps = schedulerWithPrefetch.generateSchedule();
         scan = std::move(prefetchScan);
     }
@@ -793,8 +810,9 @@ void FeasibleAllocationPass::safeRunOnFunc() {
 std::unique_ptr<mlir::Pass> vpux::VPUIP::createFeasibleAllocationPass(
         MemKindCreateFunc memKindCb, MemKindCreateFunc secondLvlmemKindCb, const bool linearizeSchedule,
         const bool enablePrefetching, const bool enablePipelining, const bool optimizeFragmentation,
-        const bool optimizeDynamicSpilling, Logger log) {
+        const bool optimizeDynamicSpilling, const bool enableSpillCostEviction, Logger log) {
     return std::make_unique<FeasibleAllocationPass>(std::move(memKindCb), std::move(secondLvlmemKindCb),
                                                     linearizeSchedule, enablePipelining, enablePrefetching,
-                                                    optimizeFragmentation, optimizeDynamicSpilling, log);
+                                                    optimizeFragmentation, optimizeDynamicSpilling,
+                                                    enableSpillCostEviction, log);
 }
@@ -42,8 +42,7 @@ public:
 private:
     mlir::FailureOr<Const::DataOp> insertInitResSection(mlir::ModuleOp moduleOp);
     mlir::func::FuncOp insertInitFunction(mlir::ModuleOp moduleOp, mlir::func::FuncOp mainFunc);
-    mlir::LogicalResult populateInitFunction(mlir::func::FuncOp mainFunc, mlir::func::FuncOp initFunc,
-                                             Const::DataOp initRes);
+    void populateInitFunction(mlir::func::FuncOp mainFunc, mlir::func::FuncOp initFunc, Const::DataOp initRes);
     mlir::Operation* createMatchingOperation(mlir::OpBuilder& builder, mlir::Value input, mlir::Location constLoc,
                                              Const::TransformAttrInterface transformation, size_t transformationIndex);
 
@@ -77,11 +76,11 @@ mlir::func::FuncOp IntroduceInitFunctionPass::insertInitFunction(mlir::ModuleOp
     return initFunc;
 }
 
-mlir::LogicalResult IntroduceInitFunctionPass::populateInitFunction(mlir::func::FuncOp mainFunc,
-                                                                    mlir::func::FuncOp initFunc,
-                                                                    Const::DataOp initRes) {
+void IntroduceInitFunctionPass::populateInitFunction(mlir::func::FuncOp mainFunc, mlir::func::FuncOp initFunc,
+                                                     Const::DataOp initRes) {
     OpBuilderLogger builderLog(_log.nest());
     auto initBuilder = mlir::OpBuilder::atBlockEnd(initFunc.addEntryBlock(), &builderLog);
+    auto initBlock = initBuilder.getInsertionBlock();
 
     OpBuilderLogger initResBuilderLog(_log.nest());
     auto& initResBlock = initRes.getBody().emplaceBlock();
@@ -90,21 +89,26 @@ mlir::LogicalResult IntroduceInitFunctionPass::populateInitFunction(mlir::func::
 
     mlir::OpBuilder mainBuilder(mainFunc);
 
-    auto mainWalk = mainFunc.walk([&](Const::DeclareOp constOp) {
-        const auto baseContent = constOp.getContentAttr().getBaseContent();
-        const auto symRefAttr = mlir::dyn_cast<Const::SymElementsAttr>(baseContent);
-        if (symRefAttr == nullptr) {
-            return mlir::WalkResult::skip();
+    SmallVector<Const::DeclareOp> constOps;
+    mainFunc.walk([&](Const::DeclareOp constOp) {
+        const auto symRefAttr = mlir::dyn_cast<Const::SymElementsAttr>(constOp.getContentAttr().getBaseContent());
+        if (symRefAttr != nullptr && symRefAttr.getSymName().getRootReference() == vpux::ovBinSection) {
+            constOps.push_back(constOp);
         }
+    });
 
-        const auto symRef = symRefAttr.getSymName();
-        const auto section = symRef.getRootReference();
-        if (section != vpux::ovBinSection) {
-            return mlir::WalkResult::skip();
-        }
+    // Sizes of the constants which are computed by `init` and of the ones which are still folded on the host
+    Byte deviceBytes(0);
+    Byte hostBytes(0);
 
+    for (auto constOp : constOps) {
         _log.trace("Got '{0}' at '{1}'", constOp->getName(), constOp->getLoc());
 
+        const auto constSize = constOp.getType().cast<NDTypeInterface>().getTotalAllocSize();
+        const auto lastKeptOp = initBlock->empty() ? nullptr : &initBlock->back();
+
+        const auto baseContent = constOp.getContentAttr().getBaseContent();
+        const auto symRef = baseContent.cast<Const::SymElementsAttr>().getSymName();
         const auto constLoc = constOp.getLoc();
         const auto loadLoc = appendLoc(constOp.getLoc(), "_load");
         auto loadOp = initBuilder.create<Const::LoadOp>(loadLoc, baseContent.getType(), symRef);
@@ -114,9 +118,20 @@ mlir::LogicalResult IntroduceInitFunctionPass::populateInitFunction(mlir::func::
         for (const auto& [trIndex, tr] : transformations | indexed) {
             lastOp = createMatchingOperation(initBuilder, lastOp->getResult(0), constLoc, tr, trIndex);
             if (lastOp == nullptr) {
-                _log.debug("Unable to create matching operation for transformation '{0}'", tr);
-                return mlir::WalkResult::interrupt();
+                _log.debug("Unable to create matching operation for transformation '{0}', '{1}' stays folded on "
+                           "the host",
+                           tr, constLoc);
+                break;
+            }
+        }
+
+        if (lastOp == nullptr) {
+            // Drop the partial chain in reverse order, so that users are erased before their operands
+            while (!initBlock->empty() && &initBlock->back() != lastKeptOp) {
+                initBlock->back().erase();
             }
+            hostBytes += constSize;
+            continue;
         }
 
         const auto foldedLoc = appendLoc(constOp.getLoc(), "_folded");
@@ -134,17 +149,16 @@ mlir::LogicalResult IntroduceInitFunctionPass::populateInitFunction(mlir::func::
         constOp->replaceAllUsesWith(mainLoadOp->getResults());
         constOp->erase();
 
-        return mlir::WalkResult::advance();
-    });
-
-    if (mainWalk.wasInterrupted()) {
-        return mlir::failure();
+        deviceBytes += constSize;
     }
 
     const auto returnLoc = appendLoc(initFunc.getLoc(), "_return");
     initBuilder.create<mlir::func::ReturnOp>(returnLoc);
 
-    return mlir::success();
+    _log.info("Moved {0} of {1} @{2} constants into '{3}', host-side folding saved {4} bytes, {5} bytes are still "
+              "folded on the host",
+              constantIdx, constOps.size(), vpux::ovBinSection, initFunc.getName(), deviceBytes.count(),
+              hostBytes.count());
 }
 
 mlir::Operation* IntroduceInitFunctionPass::createMatchingOperation(mlir::OpBuilder& builder, mlir::Value input,
@@ -190,6 +204,9 @@ mlir::Operation* IntroduceInitFunctionPass::createMatchingOperation(mlir::OpBuil
             .Case<Const::CastElemTypeAttr>([&](Const::CastElemTypeAttr convert) {
                 return builder.create<IE::ConvertOp>(loc, input, convert.getElemType());
             })
+            .Case<Const::ConvertElemTypeAttr>([&](Const::ConvertElemTypeAttr convert) {
+                return builder.create<IE::ConvertOp>(loc, input, convert.getElemType());
+            })
             .Case<Const::DequantizeAttr>([&](Const::DequantizeAttr /*dequantize*/) {
                 const auto qElemType =
                         input.getType().cast<NDTypeInterface>().getElementType().cast<mlir::quant::QuantizedType>();
@@ -213,6 +230,13 @@ mlir::Operation* IntroduceInitFunctionPass::createMatchingOperation(mlir::OpBuil
             .Case<Const::QuantCastAttr>([&](Const::QuantCastAttr quantCast) {
                 return builder.create<IE::QuantizeCastOp>(loc, input, quantCast.getElemType());
             })
+            .Case<Const::QuantizeAttr>([&](Const::QuantizeAttr quantize) -> mlir::Operation* {
+                const auto inputElemType = input.getType().cast<NDTypeInterface>().getElementType();
+                if (!mlir::isa<mlir::Float16Type, mlir::Float32Type>(inputElemType)) {
+                    return nullptr;
+                }
+                return builder.create<IE::QuantizeOp>(loc, input, quantize.getTargetType());
+            })
             .Case<Const::ReorderAttr>([&](Const::ReorderAttr reorder) {
                 return builder.create<IE::ReorderOp>(loc, input, reorder.getOrder());
             })
@@ -265,6 +289,9 @@ mlir::Operation* IntroduceInitFunctionPass::createMatchingOperation(mlir::OpBuil
             .Case<Const::TransposeAttr>([&](Const::TransposeAttr transpose) {
                 return builder.create<IE::TransposeOp>(loc, input, /*order=*/nullptr, transpose.getOrder());
             })
+            // Swizzling, sparsification, fusion and weights table relocation produce HW-specific layouts which have
+            // no IE equivalent. BitPack narrows the storage type, which neither IE.QuantizeCast nor IE.Convert can
+            // express. Such constants are still folded during compilation
             .Default([](Const::TransformAttrInterface) {
                 return nullptr;
             });
@@ -285,9 +312,7 @@ void IntroduceInitFunctionPass::safeRunOnModule() {
     IE::CNNNetworkOp::getFromModule(moduleOp, mainInfo, mainFunc);
 
     auto initFunc = insertInitFunction(moduleOp, mainFunc);
-    if (mlir::failed(populateInitFunction(mainFunc, initFunc, initResOp.value()))) {
-        signalPassFailure();
-    }
+    populateInitFunction(mainFunc, initFunc, initResOp.value());
 }
 
 }  // namespace
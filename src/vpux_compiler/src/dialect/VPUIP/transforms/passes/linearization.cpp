@@ -6,7 +6,6 @@
 #include "vpux/compiler/dialect/VPUIP/transforms/passes.hpp"
 
 #include "vpux/compiler/core/async_deps_info.hpp"
-#include "vpux/compiler/dialect/IE/IR/ops.hpp"
 #include "vpux/compiler/utils/error.hpp"
 
 #include <mlir/IR/Value.h>
@@ -23,20 +22,16 @@ public:
     }
 
 private:
-    void safeRunOnModule() final;
+    void safeRunOnFunc() final;
 };
 
-void LinearizationPass::safeRunOnModule() {
-    auto module = getOperation();
+void LinearizationPass::safeRunOnFunc() {
+    auto func = getOperation();
 
-    IE::CNNNetworkOp netOp;
-    mlir::func::FuncOp netFunc;
-    IE::CNNNetworkOp::getFromModule(module, netOp, netFunc);
-
-    auto& depsInfo = getChildAnalysis<AsyncDepsInfo>(netFunc);
+    auto& depsInfo = getAnalysis<AsyncDepsInfo>();
 
     mlir::async::ExecuteOp prevExecOp;
-    for (auto curExecOp : netFunc.getOps<mlir::async::ExecuteOp>()) {
+    for (auto curExecOp : func.getOps<mlir::async::ExecuteOp>()) {
         if (prevExecOp != nullptr) {
             _log.trace("Add explicit dependency from '{0}' to '{1}'", prevExecOp->getLoc(), curExecOp->getLoc());
             depsInfo.addDependency(prevExecOp, curExecOp);
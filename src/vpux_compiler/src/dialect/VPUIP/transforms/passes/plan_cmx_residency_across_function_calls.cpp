@@ -0,0 +1,597 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPUIP/transforms/passes.hpp"
+
+#include "vpux/compiler/core/aliases_info.hpp"
+#include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
+#include "vpux/compiler/dialect/VPUIP/IR/ops.hpp"
+#include "vpux/compiler/dialect/VPUIP/utils/utils.hpp"
+#include "vpux/compiler/dialect/VPURT/IR/ops.hpp"
+#include "vpux/compiler/utils/batch.hpp"
+#include "vpux/compiler/utils/func_dialect.hpp"
+#include "vpux/compiler/utils/hw_settings.hpp"
+
+#include "vpux/utils/core/numeric.hpp"
+
+#include <llvm/ADT/DenseSet.h>
+#include <llvm/ADT/SetVector.h>
+#include <mlir/Dialect/MemRef/IR/MemRef.h>
+
+using namespace vpux;
+
+namespace {
+
+//
+// ResidencyGroup
+//
+
+// Buffers of the main function and arguments of the callees which must share the memory space:
+// a buffer passed to a call binds the corresponding argument of the callee, and the argument binds
+// all the buffers passed to it by other calls
+struct ResidencyGroup {
+    SmallVector<mlir::Value> buffers;
+    SmallVector<mlir::BlockArgument> args;
+    bool isEligible = true;
+    int64_t size = 0;
+    // Number of callee copies which stop touching DDR minus the number of copies in the main function
+    // which start touching CMX
+    int64_t benefit = 0;
+};
+
+class UnionFind {
+public:
+    mlir::Value find(mlir::Value val) {
+        auto it = _parents.find(val);
+        if (it == _parents.end()) {
+            _parents[val] = val;
+            return val;
+        }
+        if (it->second == val) {
+            return val;
+        }
+        auto root = find(it->second);
+        _parents[val] = root;
+        return root;
+    }
+
+    void unite(mlir::Value lhs, mlir::Value rhs) {
+        auto lhsRoot = find(lhs);
+        auto rhsRoot = find(rhs);
+        if (lhsRoot != rhsRoot) {
+            _parents[rhsRoot] = lhsRoot;
+        }
+    }
+
+private:
+    DenseMap<mlir::Value, mlir::Value> _parents;
+};
+
+bool isClusterTiledCopy(mlir::Operation* op) {
+    auto clusterOp = mlir::dyn_cast<VPUIP::NCEClusterTilingOp>(op);
+    return clusterOp != nullptr && clusterOp.getInnerTaskOpOfType<VPUIP::CopyOp>() != nullptr;
+}
+
+// The input argument of a callee can be moved to CMX when it is only read by copies
+bool isResidentInputCandidate(mlir::BlockArgument arg) {
+    return llvm::all_of(arg.getUses(), [](mlir::OpOperand& use) {
+        auto* user = use.getOwner();
+        if (auto copyOp = mlir::dyn_cast<VPUIP::CopyOp>(user)) {
+            return copyOp.getInput() == use.get();
+        }
+        if (isClusterTiledCopy(user)) {
+            auto clusterOp = mlir::cast<VPUIP::NCEClusterTilingOp>(user);
+            return llvm::is_contained(clusterOp.getInputs(), use.get());
+        }
+        return false;
+    });
+}
+
+// The output argument of a callee can be moved to CMX when it is written by a single copy,
+// whose result is returned
+bool isResidentOutputCandidate(mlir::BlockArgument arg) {
+    if (!arg.hasOneUse()) {
+        return false;
+    }
+
+    auto& use = *arg.getUses().begin();
+    auto* user = use.getOwner();
+    if (auto copyOp = mlir::dyn_cast<VPUIP::CopyOp>(user)) {
+        if (copyOp.getOutputBuff() != use.get()) {
+            return false;
+        }
+    } else if (isClusterTiledCopy(user)) {
+        auto clusterOp = mlir::cast<VPUIP::NCEClusterTilingOp>(user);
+        if (clusterOp.getOutputBuffs().size() != 1 || clusterOp.getOutputBuffs().front() != use.get()) {
+            return false;
+        }
+    } else {
+        return false;
+    }
+
+    return llvm::all_of(user->getUsers(), [](mlir::Operation* resultUser) {
+        return mlir::isa<mlir::func::ReturnOp>(resultUser);
+    });
+}
+
+bool isResidentArgCandidate(mlir::func::FuncOp funcOp, mlir::BlockArgument arg) {
+    const auto type = mlir::dyn_cast<mlir::MemRefType>(arg.getType());
+    if (type == nullptr || mlir::cast<NDTypeInterface>(type).getMemoryKind() != VPU::MemoryKind::DDR) {
+        return false;
+    }
+
+    const auto numInputs = VPUIP::getNumInputs(funcOp);
+    return arg.getArgNumber() < numInputs ? isResidentInputCandidate(arg) : isResidentOutputCandidate(arg);
+}
+
+//
+// ResidencySlots
+//
+
+// Places the resident buffers in the reserved CMX range. Two buffers may share memory when every use of one
+// of them precedes the first use of the other through data dependencies, so that no schedule can overlap them.
+class ResidencySlots {
+public:
+    ResidencySlots(mlir::func::FuncOp netFunc, const AliasesInfo& aliasesInfo);
+
+    // Places all the buffers or none of them, when the reserved range would exceed the budget
+    bool tryPlace(ArrayRef<mlir::Value> buffers, int64_t budget);
+
+    int64_t getOffset(mlir::Value buffer) const;
+    int64_t getReservedSize() const;
+
+private:
+    struct Slot {
+        mlir::Value buffer;
+        int64_t size = 0;
+        int64_t offset = 0;
+        // Users in the main function, ordered by position
+        SmallVector<mlir::Operation*> users;
+    };
+
+    Slot createSlot(mlir::Value buffer) const;
+    bool canShareMemory(const Slot& lhs, const Slot& rhs);
+    bool dependsOn(mlir::Operation* op, mlir::Operation* ancestor);
+
+private:
+    const AliasesInfo& _aliasesInfo;
+    mlir::Block& _block;
+    DenseMap<mlir::Operation*, size_t> _positions;
+    DenseMap<std::pair<mlir::Operation*, mlir::Operation*>, bool> _dependencies;
+    SmallVector<Slot> _slots;
+};
+
+ResidencySlots::ResidencySlots(mlir::func::FuncOp netFunc, const AliasesInfo& aliasesInfo)
+        : _aliasesInfo(aliasesInfo), _block(netFunc.getBody().front()) {
+    for (auto& op : _block) {
+        _positions[&op] = _positions.size();
+    }
+}
+
+ResidencySlots::Slot ResidencySlots::createSlot(mlir::Value buffer) const {
+    Slot slot;
+    slot.buffer = buffer;
+    slot.size = alignValUp<int64_t>(mlir::cast<NDTypeInterface>(buffer.getType()).getTotalAllocSize().count(),
+                                    DEFAULT_CMX_ALIGNMENT);
+
+    llvm::SetVector<mlir::Operation*> users;
+    for (auto alias : _aliasesInfo.getAllAliases(buffer)) {
+        for (auto* user : alias.getUsers()) {
+            if (auto* blockUser = _block.findAncestorOpInBlock(*user)) {
+                users.insert(blockUser);
+            }
+        }
+    }
+    slot.users = users.takeVector();
+    llvm::sort(slot.users, [&](mlir::Operation* lhs, mlir::Operation* rhs) {
+        return _positions.lookup(lhs) < _positions.lookup(rhs);
+    });
+    return slot;
+}
+
+bool ResidencySlots::dependsOn(mlir::Operation* op, mlir::Operation* ancestor) {
+    if (op == ancestor) {
+        return true;
+    }
+    const auto ancestorPos = _positions.lookup(ancestor);
+    if (_positions.lookup(op) < ancestorPos) {
+        return false;
+    }
+
+    auto [it, inserted] = _dependencies.try_emplace({op, ancestor}, false);
+    if (!inserted) {
+        return it->second;
+    }
+
+    const auto result = llvm::any_of(op->getOperands(), [&](mlir::Value operand) {
+        auto* producer = operand.getDefiningOp();
+        return producer != nullptr && producer->getBlock() == &_block && dependsOn(producer, ancestor);
+    });
+    _dependencies[{op, ancestor}] = result;
+    return result;
+}
+
+bool ResidencySlots::canShareMemory(const Slot& lhs, const Slot& rhs) {
+    if (lhs.users.empty() || rhs.users.empty()) {
+        return true;
+    }
+
+    const auto isBefore = [&](const Slot& earlier, const Slot& later) {
+        if (_positions.lookup(earlier.users.back()) >= _positions.lookup(later.users.front())) {
+            return false;
+        }
+        // The uses of each buffer are ordered by the dependencies of the buffer itself, the first use of the later
+        // buffer has to wait for all the uses of the earlier one
+        return llvm::all_of(earlier.users, [&](mlir::Operation* user) {
+            return dependsOn(later.users.front(), user);
+        });
+    };
+    return isBefore(lhs, rhs) || isBefore(rhs, lhs);
+}
+
+bool ResidencySlots::tryPlace(ArrayRef<mlir::Value> buffers, int64_t budget) {
+    const auto numPlaced = _slots.size();
+    for (auto buffer : buffers) {
+        auto slot = createSlot(buffer);
+
+        // First fit among the ranges of the slots which live at the same time
+        SmallVector<std::pair<int64_t, int64_t>> occupied;
+        for (const auto& other : _slots) {
+            if (!canShareMemory(slot, other)) {
+                occupied.emplace_back(other.offset, other.offset + other.size);
+            }
+        }
+        llvm::sort(occupied);
+        for (const auto& [begin, end] : occupied) {
+            if (slot.offset + slot.size <= begin) {
+                break;
+            }
+            slot.offset = std::max(slot.offset, end);
+        }
+
+        if (slot.offset + slot.size > budget) {
+            _slots.resize(numPlaced);
+            return false;
+        }
+        _slots.push_back(std::move(slot));
+    }
+    return true;
+}
+
+int64_t ResidencySlots::getOffset(mlir::Value buffer) const {
+    const auto it = llvm::find_if(_slots, [&](const Slot& slot) {
+        return slot.buffer == buffer;
+    });
+    VPUX_THROW_WHEN(it == _slots.end(), "Buffer '{0}' was not placed", buffer.getLoc());
+    return it->offset;
+}
+
+int64_t ResidencySlots::getReservedSize() const {
+    int64_t reservedSize = 0;
+    for (const auto& slot : _slots) {
+        reservedSize = std::max(reservedSize, slot.offset + slot.size);
+    }
+    return reservedSize;
+}
+
+//
+// PlanCMXResidencyAcrossFunctionCallsPass
+//
+
+class PlanCMXResidencyAcrossFunctionCallsPass final :
+        public VPUIP::PlanCMXResidencyAcrossFunctionCallsBase<PlanCMXResidencyAcrossFunctionCallsPass> {
+public:
+    explicit PlanCMXResidencyAcrossFunctionCallsPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnModule() final;
+
+    SmallVector<ResidencyGroup> buildGroups(mlir::func::FuncOp netFunc, const AliasesInfo& aliasesInfo);
+    SmallVector<ResidencyGroup*> selectGroups(MutableArrayRef<ResidencyGroup> groups, ResidencySlots& slots,
+                                              int64_t budget);
+    int64_t getCMXHeadroom(mlir::ModuleOp module);
+    void placeBuffer(mlir::Value buffer, NDTypeInterface newType, int64_t offset);
+    void moveArgToCMX(mlir::BlockArgument arg, NDTypeInterface newType);
+};
+
+SmallVector<ResidencyGroup> PlanCMXResidencyAcrossFunctionCallsPass::buildGroups(mlir::func::FuncOp netFunc,
+                                                                                const AliasesInfo& aliasesInfo) {
+    UnionFind unionFind;
+
+    llvm::DenseSet<mlir::Value> ineligible;
+    DenseMap<mlir::Value, int64_t> numCallUses;
+    SmallVector<mlir::Value> buffers;
+    SmallVector<mlir::BlockArgument> args;
+    // Copies between a buffer and a value which is not a candidate buffer, e.g. a network argument
+    SmallVector<mlir::Value> externalCopies;
+
+    const auto getRoot = [&](mlir::Value val) -> mlir::Value {
+        const auto& roots = aliasesInfo.getRoots(val);
+        return roots.size() == 1 ? *roots.begin() : nullptr;
+    };
+
+    const auto isCandidateBuffer = [](mlir::Value root) {
+        const auto type = mlir::dyn_cast<mlir::MemRefType>(root.getType());
+        return root.getDefiningOp<mlir::memref::AllocOp>() != nullptr && type != nullptr &&
+               mlir::cast<NDTypeInterface>(type).getMemoryKind() == VPU::MemoryKind::DDR;
+    };
+
+    netFunc.walk([&](mlir::func::CallOp callOp) {
+        auto funcOp = getCalledFunction(callOp);
+        const auto isDebatched = DebatchedCallOpAttributeView::extract(callOp).has_value();
+
+        for (auto& operand : callOp->getOpOperands()) {
+            auto arg = funcOp.getArgument(operand.getOperandNumber());
+            if (!numCallUses.contains(arg)) {
+                args.push_back(arg);
+                if (!isResidentArgCandidate(funcOp, arg)) {
+                    ineligible.insert(arg);
+                }
+            }
+            ++numCallUses[arg];
+
+            // Debatched calls remap the CMX of the callee to a subset of tiles on inlining
+            if (isDebatched) {
+                ineligible.insert(arg);
+            }
+
+            auto root = getRoot(operand.get());
+            if (root == nullptr || root.getType() != operand.get().getType()) {
+                ineligible.insert(arg);
+                continue;
+            }
+
+            if (!llvm::is_contained(buffers, root)) {
+                buffers.push_back(root);
+                if (!isCandidateBuffer(root)) {
+                    ineligible.insert(root);
+                }
+            }
+            unionFind.unite(arg, root);
+        }
+    });
+
+    // The buffers must only be passed to calls and copied, the copies to other candidate buffers
+    // keep both buffers in the same memory
+    // Note: the copied buffers are appended during the traversal
+    for (size_t bufferIdx = 0; bufferIdx < buffers.size(); ++bufferIdx) {
+        const auto buffer = buffers[bufferIdx];
+        if (ineligible.contains(buffer)) {
+            continue;
+        }
+
+        SmallVector<mlir::Value> aliases{buffer};
+        for (auto alias : aliasesInfo.getAllAliases(buffer)) {
+            if (alias != buffer) {
+                aliases.push_back(alias);
+            }
+        }
+
+        for (auto alias : aliases) {
+            for (auto& use : alias.getUses()) {
+                auto* user = use.getOwner();
+                if (mlir::isa<mlir::func::CallOp>(user)) {
+                    continue;
+                }
+
+                auto copyOp = mlir::dyn_cast<VPUIP::CopyOp>(user);
+                if (copyOp == nullptr) {
+                    ineligible.insert(buffer);
+                    continue;
+                }
+
+                const auto other = copyOp.getInput() == use.get() ? copyOp.getOutputBuff() : copyOp.getInput();
+                auto otherRoot = getRoot(other);
+                if (otherRoot != nullptr && otherRoot.getType() == other.getType() && isCandidateBuffer(otherRoot)) {
+                    if (!llvm::is_contained(buffers, otherRoot)) {
+                        // Only copied in the main function, it can follow the memory space of the buffer
+                        buffers.push_back(otherRoot);
+                    }
+                    unionFind.unite(buffer, otherRoot);
+                } else {
+                    externalCopies.push_back(buffer);
+                }
+            }
+        }
+    }
+
+    DenseMap<mlir::Value, size_t> groupIndices;
+    SmallVector<ResidencyGroup> groups;
+    const auto getGroup = [&](mlir::Value val) -> ResidencyGroup& {
+        const auto leader = unionFind.find(val);
+        auto [it, inserted] = groupIndices.try_emplace(leader, groups.size());
+        if (inserted) {
+            groups.emplace_back();
+        }
+        return groups[it->second];
+    };
+
+    for (auto buffer : buffers) {
+        auto& group = getGroup(buffer);
+        group.buffers.push_back(buffer);
+        group.isEligible &= !ineligible.contains(buffer);
+        group.size += alignValUp<int64_t>(mlir::cast<NDTypeInterface>(buffer.getType()).getTotalAllocSize().count(),
+                                          DEFAULT_CMX_ALIGNMENT);
+    }
+    for (auto arg : args) {
+        auto& group = getGroup(arg);
+        group.args.push_back(arg);
+        group.isEligible &= !ineligible.contains(arg);
+        group.benefit += numCallUses[arg];
+    }
+    for (auto buffer : externalCopies) {
+        --getGroup(buffer).benefit;
+    }
+
+    return groups;
+}
+
+SmallVector<ResidencyGroup*> PlanCMXResidencyAcrossFunctionCallsPass::selectGroups(
+        MutableArrayRef<ResidencyGroup> groups, ResidencySlots& slots, int64_t budget) {
+    SmallVector<ResidencyGroup*> candidates;
+    for (auto& group : groups) {
+        if (group.isEligible && !group.buffers.empty() && !group.args.empty() && group.benefit > 0) {
+            candidates.push_back(&group);
+        }
+    }
+
+    // Prefer the groups which save the most transfers per byte of the reserved memory
+    llvm::stable_sort(candidates, [](const ResidencyGroup* lhs, const ResidencyGroup* rhs) {
+        return lhs->benefit * rhs->size > rhs->benefit * lhs->size;
+    });
+
+    SmallVector<ResidencyGroup*> selected;
+    for (auto* group : candidates) {
+        if (!slots.tryPlace(group->buffers, budget)) {
+            _log.trace("Group of {0} buffers ({1} bytes) stays in DDR: out of budget", group->buffers.size(),
+                       group->size);
+            continue;
+        }
+        selected.push_back(group);
+    }
+    return selected;
+}
+
+// The tiling sizes the operations against the whole CMX, long before this pass reserves a part of it.
+// The reserved range must fit in what the most demanding operation of the module leaves free.
+int64_t PlanCMXResidencyAcrossFunctionCallsPass::getCMXHeadroom(mlir::ModuleOp module) {
+    const auto cmxSize = VPU::getTotalCMXSize(module).count();
+
+    int64_t maxRequiredCMX = 0;
+    for (auto funcOp : module.getOps<mlir::func::FuncOp>()) {
+        for (auto& op : funcOp.getOps()) {
+            const auto requiredCMX = VPUIP::getRequiredCMXSize(&op).count();
+            if (requiredCMX > maxRequiredCMX) {
+                _log.trace("Operation '{0}' at '{1}' requires {2} bytes of CMX", op.getName(), op.getLoc(),
+                           requiredCMX);
+                maxRequiredCMX = requiredCMX;
+            }
+        }
+    }
+
+    return std::max<int64_t>(cmxSize - maxRequiredCMX, 0);
+}
+
+void PlanCMXResidencyAcrossFunctionCallsPass::placeBuffer(mlir::Value buffer, NDTypeInterface newType,
+                                                          int64_t offset) {
+    auto allocOp = buffer.getDefiningOp<mlir::memref::AllocOp>();
+    mlir::OpBuilder builder(allocOp);
+    auto declOp = builder.create<VPURT::DeclareBufferOp>(allocOp.getLoc(), newType, VPURT::BufferSection::CMX_NN,
+                                                         /*sectionIndex=*/0, offset);
+    declOp->setAttr(VPUIP::cmxResidencyBuffer, builder.getUnitAttr());
+    allocOp.getResult().replaceAllUsesWith(declOp.getBuffer());
+    allocOp.erase();
+
+    // The results of the copies and calls alias their output buffers
+    SmallVector<mlir::Value> worklist{declOp.getBuffer()};
+    while (!worklist.empty()) {
+        auto val = worklist.pop_back_val();
+        for (auto& use : val.getUses()) {
+            auto* user = use.getOwner();
+            if (auto copyOp = mlir::dyn_cast<VPUIP::CopyOp>(user)) {
+                if (copyOp.getOutputBuff() == val) {
+                    copyOp.getOutput().setType(newType);
+                    worklist.push_back(copyOp.getOutput());
+                }
+            } else if (auto callOp = mlir::dyn_cast<mlir::func::CallOp>(user)) {
+                const auto numInputs = VPUIP::getNumInputs(getCalledFunction(callOp));
+                if (use.getOperandNumber() >= numInputs) {
+                    auto result = callOp.getResult(use.getOperandNumber() - numInputs);
+                    result.setType(newType);
+                    worklist.push_back(result);
+                }
+            }
+        }
+    }
+}
+
+void PlanCMXResidencyAcrossFunctionCallsPass::moveArgToCMX(mlir::BlockArgument arg, NDTypeInterface newType) {
+    arg.setType(newType);
+
+    for (auto& use : llvm::make_early_inc_range(arg.getUses())) {
+        auto* user = use.getOwner();
+        if (auto copyOp = mlir::dyn_cast<VPUIP::CopyOp>(user)) {
+            if (copyOp.getOutputBuff() == arg) {
+                copyOp.getOutput().setType(newType);
+            }
+            continue;
+        }
+
+        // The inner arguments of a copy are not distributed, they have the type of the outer operands
+        auto clusterOp = mlir::cast<VPUIP::NCEClusterTilingOp>(user);
+        auto innerArg = clusterOp.getBody().getArgument(use.getOperandNumber());
+        innerArg.setType(newType);
+        if (llvm::is_contained(clusterOp.getOutputBuffs(), arg)) {
+            clusterOp.getInnerTaskOpOfType<VPUIP::CopyOp>().getOutput().setType(newType);
+            clusterOp.getResult(0).setType(newType);
+        }
+    }
+
+    auto funcOp = mlir::cast<mlir::func::FuncOp>(arg.getOwner()->getParentOp());
+    auto returnOp = *funcOp.getOps<mlir::func::ReturnOp>().begin();
+    funcOp.setType(mlir::FunctionType::get(funcOp.getContext(), funcOp.getBody().getArgumentTypes(),
+                                           returnOp.getOperandTypes()));
+}
+
+void PlanCMXResidencyAcrossFunctionCallsPass::safeRunOnModule() {
+    auto module = getOperation();
+    auto* ctx = module.getContext();
+
+    mlir::func::FuncOp netFunc;
+    IE::CNNNetworkOp netInfo;
+    IE::CNNNetworkOp::getFromModule(module, netInfo, netFunc);
+
+    if (netFunc.getOps<mlir::func::CallOp>().empty()) {
+        _log.trace("No function calls in '@{0}'", netFunc.getName());
+        return;
+    }
+
+    AliasesInfo aliasesInfo(netFunc);
+    auto groups = buildGroups(netFunc, aliasesInfo);
+
+    const auto cmxSize = IE::getAvailableMemory(module, VPU::MemoryKind::CMX_NN).size().count();
+    const auto budget = std::min(static_cast<int64_t>(cmxSize * cmxBudgetRatio.getValue()), getCMXHeadroom(module));
+    _log.trace("CMX budget for the resident buffers: {0} bytes", budget);
+    ResidencySlots slots(netFunc, aliasesInfo);
+    const auto selected = selectGroups(groups, slots, budget);
+    if (selected.empty()) {
+        _log.trace("No buffers are kept in CMX across function calls");
+        return;
+    }
+
+    const auto cmxMemSpace = IndexedSymbolAttr::get(ctx, stringifyEnum(VPU::MemoryKind::CMX_NN), 0);
+
+    for (auto* group : selected) {
+        _log.trace("Keep {0} buffers in CMX across function calls, saved transfers: {1}", group->buffers.size(),
+                   group->benefit);
+
+        for (auto buffer : group->buffers) {
+            const auto newType = mlir::cast<NDTypeInterface>(buffer.getType()).changeMemSpace(cmxMemSpace);
+            const auto offset = slots.getOffset(buffer);
+            _log.nest().trace("Buffer '{0}' at relative offset {1}", buffer.getLoc(), offset);
+            placeBuffer(buffer, newType, offset);
+        }
+        for (auto arg : group->args) {
+            const auto newType = mlir::cast<NDTypeInterface>(arg.getType()).changeMemSpace(cmxMemSpace);
+            moveArgToCMX(arg, newType);
+        }
+    }
+
+    auto memSpaceAttr = mlir::SymbolRefAttr::get(ctx, stringifyEnum(VPU::MemoryKind::CMX_NN));
+    IE::setCMXResidencyReservedMemory(module, memSpaceAttr, slots.getReservedSize());
+}
+
+}  // namespace
+
+//
+// createPlanCMXResidencyAcrossFunctionCallsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::VPUIP::createPlanCMXResidencyAcrossFunctionCallsPass(Logger log) {
+    return std::make_unique<PlanCMXResidencyAcrossFunctionCallsPass>(log);
+}
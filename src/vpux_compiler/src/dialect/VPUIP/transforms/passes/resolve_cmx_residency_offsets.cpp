@@ -0,0 +1,71 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPUIP/transforms/passes.hpp"
+
+#include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPUIP/utils/utils.hpp"
+#include "vpux/compiler/dialect/VPURT/IR/ops.hpp"
+
+using namespace vpux;
+
+namespace {
+
+//
+//  ResolveCMXResidencyOffsetsPass
+//
+
+class ResolveCMXResidencyOffsetsPass final :
+        public VPUIP::ResolveCMXResidencyOffsetsBase<ResolveCMXResidencyOffsetsPass> {
+public:
+    explicit ResolveCMXResidencyOffsetsPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnModule() final;
+};
+
+void ResolveCMXResidencyOffsetsPass::safeRunOnModule() {
+    auto module = getOperation();
+    auto* ctx = module->getContext();
+
+    auto memSpaceAttr = mlir::SymbolRefAttr::get(ctx, stringifyEnum(VPU::MemoryKind::CMX_NN));
+    auto resMem = IE::getCMXResidencyReservedMemory(module, memSpaceAttr);
+    if (resMem == nullptr) {
+        return;
+    }
+
+    // Assigns the offsets to the reserved ranges which were not placed explicitly, the same way the allocation does
+    std::ignore = IE::getReservedMemOffsetAndSizeVec(module, memSpaceAttr);
+    VPUX_THROW_UNLESS(resMem.getOffset().has_value(), "No offset setting provided");
+    const auto baseOffset = resMem.getOffset().value();
+
+    _log.trace("CMX residency reserved memory - offset: '{0}', size: '{1}'", baseOffset, resMem.getByteSize());
+
+    module.walk([&](VPURT::DeclareBufferOp declOp) {
+        if (!declOp->hasAttr(VPUIP::cmxResidencyBuffer)) {
+            return;
+        }
+
+        const auto relativeOffset = declOp.getByteOffset();
+        const auto size = mlir::cast<NDTypeInterface>(declOp.getBuffer().getType()).getTotalAllocSize().count();
+        VPUX_THROW_UNLESS(relativeOffset + size <= resMem.getByteSize(),
+                          "Buffer '{0}' is out of the CMX residency reserved memory", declOp.getLoc());
+
+        declOp.setByteOffsetAttr(getIntAttr(ctx, baseOffset + relativeOffset));
+        declOp->removeAttr(VPUIP::cmxResidencyBuffer);
+    });
+}
+
+}  // namespace
+
+//
+// createResolveCMXResidencyOffsetsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::VPUIP::createResolveCMXResidencyOffsetsPass(Logger log) {
+    return std::make_unique<ResolveCMXResidencyOffsetsPass>(log);
+}
@@ -3,7 +3,9 @@
 // SPDX-License-Identifier: Apache 2.0
 //
 
+#include "vpux/compiler/core/cost_model_utils.hpp"
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPU/utils/cost_model/cost_model.hpp"
 #include "vpux/compiler/dialect/VPUIP/IR/attributes.hpp"
 #include "vpux/compiler/dialect/VPUIP/IR/ops.hpp"
 #include "vpux/compiler/dialect/VPUIP/transforms/passes.hpp"
@@ -23,6 +25,7 @@
 #include <mlir/IR/IRMapping.h>
 
 #include <algorithm>
+#include <cmath>
 
 using namespace vpux;
 
@@ -37,8 +40,11 @@ public:
     using ValuesSet = mlir::DenseSet<mlir::Value>;
 
 public:
-    explicit Swizzling(const bool enableWeightSwizzling, const bool enableActivationSwizzling, Logger log)
-            : _enableWeightSwizzling(enableWeightSwizzling), _enableActivationSwizzling(enableActivationSwizzling) {
+    explicit Swizzling(const bool enableWeightSwizzling, const bool enableActivationSwizzling,
+                       const bool enableSwizzlingPlanner, Logger log)
+            : _enableWeightSwizzling(enableWeightSwizzling),
+              _enableActivationSwizzling(enableActivationSwizzling),
+              _enableSwizzlingPlanner(enableSwizzlingPlanner) {
         Base::initLogger(log, Base::getArgumentName());
     }
     mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
@@ -46,6 +52,8 @@ public:
 private:
     bool _enableWeightSwizzling;
     bool _enableActivationSwizzling;
+    bool _enableSwizzlingPlanner;
+    double _spillRiskThreshold = 0.0;
     // Flags used for debug purpose and performance experiments
     bool _checkConstantSizeAlignment = false;
     bool _enableSwizzlingOfFusedConsts = false;
@@ -67,6 +75,16 @@ private:
         DenseMap<VPUIP::NCEClusterTaskOp, OpSwizzlingFlags> opsSwizzlingFlagsMap;
     };
 
+    // Weights or output buffers of an NCE task which the planner may swizzle
+    struct SwizzlingCandidate {
+        VPUIP::NCEClusterTaskOp nceOp;
+        bool isWeights;
+        int64_t dpuGain;
+        int64_t paddingBytes;
+        double spillRisk;
+        int64_t netGain;
+    };
+
     // Store information about NCEClusterTask operands which got swizzled
     void safeRunOnFunc() final;
     void activationBufferSwizzling(mlir::OpBuilder& builder, VPUIP::NCEClusterTaskOp nceOp, DeviceInfo& deviceInfo,
@@ -83,6 +101,9 @@ private:
     bool canSwizzleActivation(VPUIP::NCEClusterTaskOp nceOp, DeviceInfo& deviceInfo, OpsInfo& opsInfo);
     bool checkCMXUsage(VPUIP::NCEClusterTaskOp, const ValuesSet& newBufsToSwizzle, DeviceInfo& deviceInfo,
                        OpsInfo& opsInfo);
+    SwizzlingCandidate evaluateCandidate(VPUIP::NCEClusterTaskOp nceOp, bool isWeights, DeviceInfo& deviceInfo,
+                                         const std::shared_ptr<VPUNN::VPUCostModel>& costModel);
+    void planSwizzling(mlir::func::FuncOp func, DeviceInfo& deviceInfo, OpsInfo& opsInfo);
 };
 
 void adjustReturnTypesForInputChain(mlir::Value value, int64_t swizzlingKey, VPU::ArchKind archKind) {
@@ -175,6 +196,12 @@ mlir::LogicalResult Swizzling::initialize(mlir::MLIRContext* ctx) {
     if (enableActivationSwizzling.hasValue()) {
         _enableActivationSwizzling = enableActivationSwizzling.getValue();
     }
+    if (enableSwizzlingPlanner.hasValue()) {
+        _enableSwizzlingPlanner = enableSwizzlingPlanner.getValue();
+    }
+    _spillRiskThreshold = spillRiskThreshold.getValue();
+    VPUX_THROW_UNLESS(_spillRiskThreshold >= 0.0 && _spillRiskThreshold < 1.0,
+                      "Spill risk threshold must be in [0, 1), got {0}", _spillRiskThreshold);
 
     return mlir::success();
 }
@@ -734,6 +761,197 @@ void Swizzling::activationBufferSwizzling(mlir::OpBuilder& builder, VPUIP::NCECl
     opsInfo.opsToRemove.push_back(nceOp.getOperation());
 }
 
+//
+// Swizzling planner
+//
+
+enum class SwizzledPort { Input, Weights, Output };
+
+bool isCostModelSupported(mlir::Value value) {
+    const auto elemType = value.getType().cast<vpux::NDTypeInterface>().getElementType();
+    return !elemType.isF32() && !elemType.isSignedInteger(32);
+}
+
+// DPU cycles saved when the given ports of the NCE task access swizzled buffers, summed over its variants
+int64_t estimateDPUGain(VPUIP::NCEClusterTaskOp nceOp, ArrayRef<SwizzledPort> ports, VPU::ArchKind arch,
+                        const std::shared_ptr<VPUNN::VPUCostModel>& costModel, Logger log) {
+    if (!isCostModelSupported(nceOp.getInput()) || !isCostModelSupported(nceOp.getOutput())) {
+        return 0;
+    }
+
+    int64_t gain = 0;
+    for (auto dpuTaskOp : nceOp.getVariants().getOps<VPUIP::DPUTaskOp>()) {
+        auto workload = getDPUWorkload(dpuTaskOp, arch);
+        const auto origCost = VPU::checkAndReturnCost(costModel->DPU(workload), log, true);
+
+        for (auto port : ports) {
+            switch (port) {
+            case SwizzledPort::Input:
+                workload.input_swizzling[0] = VPUNN::Swizzling::KEY_5;
+                break;
+            case SwizzledPort::Weights:
+                workload.input_swizzling[1] = VPUNN::Swizzling::KEY_5;
+                break;
+            case SwizzledPort::Output:
+                workload.output_swizzling[0] = VPUNN::Swizzling::KEY_5;
+                break;
+            }
+        }
+        const auto swizzledCost = VPU::checkAndReturnCost(costModel->DPU(workload), log, true);
+
+        if (origCost >= VPU::INVALID_COST_BASE || swizzledCost >= VPU::INVALID_COST_BASE) {
+            continue;
+        }
+        gain += static_cast<int64_t>(origCost) - static_cast<int64_t>(swizzledCost);
+    }
+    return gain;
+}
+
+// Extra CMX bytes taken by a swizzled buffer: the size alignment and on average half of the address alignment
+int64_t getSwizzlingPadding(mlir::Value buffer, VPU::ArchKind arch) {
+    const auto size = buffer.getType().cast<vpux::NDTypeInterface>().getTotalAllocSize().count();
+    const auto alignedSize = alignSizeForSwizzling(size, getSizeAlignmentForSwizzling(arch));
+    const auto addressAlignment = getAddressAlignmentForSwizzling(SWIZZLING_KEY_5, arch);
+    return alignedSize - size + (addressAlignment - vpux::DEFAULT_CMX_ALIGNMENT) / 2;
+}
+
+// Share of the CMX headroom above the threshold taken by the operands of the task, from 0 to 1. The threshold is
+// the share of the available CMX above which the padding added by swizzling starts to risk spilling
+double getSpillRisk(VPUIP::NCEClusterTaskOp nceOp, int64_t extraBytes, int64_t availableCMXSize,
+                    double spillRiskThreshold) {
+    mlir::DenseSet<mlir::Value> operands(nceOp->getOperands().begin(), nceOp->getOperands().end());
+    int64_t footprint = extraBytes;
+    for (auto operand : operands) {
+        footprint += operand.getType().cast<vpux::NDTypeInterface>().getTotalAllocSize().count();
+    }
+
+    const auto threshold = spillRiskThreshold * availableCMXSize;
+    return std::clamp((footprint - threshold) / (availableCMXSize - threshold), 0.0, 1.0);
+}
+
+Swizzling::SwizzlingCandidate Swizzling::evaluateCandidate(VPUIP::NCEClusterTaskOp nceOp, bool isWeights,
+                                                           DeviceInfo& deviceInfo,
+                                                           const std::shared_ptr<VPUNN::VPUCostModel>& costModel) {
+    const auto arch = deviceInfo.archKind;
+    const auto availableCMXSize = deviceInfo.cmxSize - deviceInfo.reservedCMXSize;
+    const auto vpuDevice = VPU::getVPUDeviceType(arch);
+
+    SwizzlingCandidate candidate{nceOp, isWeights, 0, 0, 0.0, 0};
+    double penalty = 0.0;
+
+    if (isWeights) {
+        candidate.dpuGain = estimateDPUGain(nceOp, {SwizzledPort::Weights}, arch, costModel, _log);
+
+        SmallVector<mlir::Value> buffers = {nceOp.getWeights(), nceOp.getWeightTable()};
+        if (auto weightsSM = nceOp.getWeightsSparsityMap()) {
+            buffers.push_back(weightsSM);
+        }
+        for (auto buffer : buffers) {
+            const auto padding = getSwizzlingPadding(buffer, arch);
+            const auto bufferType = buffer.getType().cast<vpux::NDTypeInterface>();
+            const auto dmaCost = static_cast<double>(getDMACost(bufferType, vpuDevice, costModel, 1));
+            candidate.paddingBytes += padding;
+            // Constants are fetched from DDR, the padding makes every fetch longer
+            penalty += dmaCost * padding / bufferType.getTotalAllocSize().count();
+        }
+
+        candidate.spillRisk = getSpillRisk(nceOp, candidate.paddingBytes, availableCMXSize, _spillRiskThreshold);
+        // A spilled constant has to be fetched once more
+        penalty += candidate.spillRisk *
+                   getDMACost(nceOp.getWeights().getType().cast<vpux::NDTypeInterface>(), vpuDevice, costModel, 1);
+    } else {
+        auto output = nceOp.getOutput();
+        candidate.dpuGain = estimateDPUGain(nceOp, {SwizzledPort::Output}, arch, costModel, _log);
+        for (auto user : output.getUsers()) {
+            auto userNceOp = mlir::dyn_cast<VPUIP::NCEClusterTaskOp>(user);
+            if (userNceOp == nullptr) {
+                continue;
+            }
+            SmallVector<SwizzledPort> userPorts;
+            if (userNceOp.getInput() == output) {
+                userPorts.push_back(SwizzledPort::Input);
+            }
+            if (userNceOp.getWeights() == output) {
+                userPorts.push_back(SwizzledPort::Weights);
+            }
+            candidate.dpuGain += estimateDPUGain(userNceOp, userPorts, arch, costModel, _log);
+        }
+
+        candidate.paddingBytes = getSwizzlingPadding(nceOp.getOutputBuff(), arch);
+        if (auto outputSMBuff = nceOp.getOutputSparsityMapBuff()) {
+            candidate.paddingBytes += getSwizzlingPadding(outputSMBuff, arch);
+        }
+
+        candidate.spillRisk = getSpillRisk(nceOp, candidate.paddingBytes, availableCMXSize, _spillRiskThreshold);
+        for (auto user : output.getUsers()) {
+            if (auto userNceOp = mlir::dyn_cast<VPUIP::NCEClusterTaskOp>(user)) {
+                candidate.spillRisk =
+                        std::max(candidate.spillRisk, getSpillRisk(userNceOp, candidate.paddingBytes,
+                                                                   availableCMXSize, _spillRiskThreshold));
+            }
+        }
+        // A spilled activation is copied to DDR and back
+        penalty += candidate.spillRisk * 2 *
+                   getDMACost(output.getType().cast<vpux::NDTypeInterface>(), vpuDevice, costModel, 1);
+    }
+
+    candidate.netGain = candidate.dpuGain - static_cast<int64_t>(std::ceil(penalty));
+    return candidate;
+}
+
+// Swizzles the buffers in the order of their predicted gain, so that the CMX budget of a task goes to the
+// buffers which matter most instead of the ones visited first. Candidates without a positive gain are skipped.
+void Swizzling::planSwizzling(mlir::func::FuncOp func, DeviceInfo& deviceInfo, OpsInfo& opsInfo) {
+    const auto costModel = VPU::createCostModel(deviceInfo.archKind);
+
+    SmallVector<SwizzlingCandidate> candidates;
+    func->walk([&](VPUIP::NCEClusterTaskOp nceOp) {
+        opsInfo.opsSwizzlingFlagsMap[nceOp] = OpSwizzlingFlags();
+        if (_enableWeightSwizzling && nceOp.getWeights() != nullptr && nceOp.getWeightTable() != nullptr &&
+            nceOp.getTaskType() != VPUIP::NCETaskType::ELTWISE) {
+            candidates.push_back(evaluateCandidate(nceOp, /*isWeights=*/true, deviceInfo, costModel));
+        }
+        if (_enableActivationSwizzling) {
+            candidates.push_back(evaluateCandidate(nceOp, /*isWeights=*/false, deviceInfo, costModel));
+        }
+    });
+
+    // Stable sort keeps the IR order for equal gains, which makes the plan deterministic
+    llvm::stable_sort(candidates, [](const SwizzlingCandidate& lhs, const SwizzlingCandidate& rhs) {
+        return lhs.netGain > rhs.netGain;
+    });
+
+    numSwizzlingCandidates += candidates.size();
+    for (const auto& candidate : candidates) {
+        const auto kind = candidate.isWeights ? "weights" : "output";
+        _log.trace("Candidate {0} of '{1}': DPU gain {2} cycles, padding {3} bytes, spill risk {4:F2}, net gain {5}",
+                   kind, candidate.nceOp->getLoc(), candidate.dpuGain, candidate.paddingBytes, candidate.spillRisk,
+                   candidate.netGain);
+
+        if (candidate.netGain <= 0) {
+            _log.nest().trace("Rejected, swizzling is not profitable");
+            ++numRejectedByCost;
+            continue;
+        }
+
+        const auto accepted = candidate.isWeights ? canSwizzleWeights(candidate.nceOp, deviceInfo, opsInfo)
+                                                  : canSwizzleActivation(candidate.nceOp, deviceInfo, opsInfo);
+        if (!accepted) {
+            ++numRejectedByConstraints;
+            continue;
+        }
+
+        auto& flags = opsInfo.opsSwizzlingFlagsMap[candidate.nceOp];
+        if (candidate.isWeights) {
+            flags.weightInput = true;
+        } else {
+            flags.activationOutput = true;
+        }
+        predictedGainCycles += static_cast<uint64_t>(candidate.netGain);
+        paddingBytes += static_cast<uint64_t>(candidate.paddingBytes);
+    }
+}
+
 //
 // safeRunOnFunc
 //
@@ -774,19 +992,23 @@ void Swizzling::safeRunOnFunc() {
     // output writer:
     // - output
     // - output_sparisty_map
-    func->walk([&](VPUIP::NCEClusterTaskOp nceOp) {
-        opsInfo.opsSwizzlingFlagsMap[nceOp] = OpSwizzlingFlags();
-        if (_enableWeightSwizzling && canSwizzleWeights(nceOp, deviceInfo, opsInfo)) {
-            opsInfo.opsSwizzlingFlagsMap[nceOp].weightInput = true;
-        }
-    });
-
-    if (_enableActivationSwizzling) {
+    if (_enableSwizzlingPlanner) {
+        planSwizzling(func, deviceInfo, opsInfo);
+    } else {
         func->walk([&](VPUIP::NCEClusterTaskOp nceOp) {
-            if (canSwizzleActivation(nceOp, deviceInfo, opsInfo)) {
-                opsInfo.opsSwizzlingFlagsMap[nceOp].activationOutput = true;
+            opsInfo.opsSwizzlingFlagsMap[nceOp] = OpSwizzlingFlags();
+            if (_enableWeightSwizzling && canSwizzleWeights(nceOp, deviceInfo, opsInfo)) {
+                opsInfo.opsSwizzlingFlagsMap[nceOp].weightInput = true;
             }
         });
+
+        if (_enableActivationSwizzling) {
+            func->walk([&](VPUIP::NCEClusterTaskOp nceOp) {
+                if (canSwizzleActivation(nceOp, deviceInfo, opsInfo)) {
+                    opsInfo.opsSwizzlingFlagsMap[nceOp].activationOutput = true;
+                }
+            });
+        }
     }
 
     for (auto& opsSwizzlingFlags : opsInfo.opsSwizzlingFlagsMap) {
@@ -887,10 +1109,12 @@ void Swizzling::safeRunOnFunc() {
             constantBufferSwizzling(builder, nceOp, nceOp.getWeights(), deviceInfo);
             constantBufferSwizzling(builder, nceOp, nceOp.getWeightsSparsityMap(), deviceInfo);
             constantBufferSwizzling(builder, nceOp, nceOp.getWeightTable(), deviceInfo);
+            ++numSwizzledWeights;
         }
 
         if (flags.activationOutput) {
             activationBufferSwizzling(builder, nceOp, deviceInfo, opsInfo);
+            ++numSwizzledActivations;
         }
     }
 
@@ -908,6 +1132,7 @@ void Swizzling::safeRunOnFunc() {
 //
 
 std::unique_ptr<mlir::Pass> vpux::VPUIP::createSwizzlingPass(const bool enableWeightSwizzling,
-                                                             const bool enableActivationSwizzling, Logger log) {
-    return std::make_unique<Swizzling>(enableWeightSwizzling, enableActivationSwizzling, log);
+                                                             const bool enableActivationSwizzling,
+                                                             const bool enableSwizzlingPlanner, Logger log) {
+    return std::make_unique<Swizzling>(enableWeightSwizzling, enableActivationSwizzling, enableSwizzlingPlanner, log);
 }
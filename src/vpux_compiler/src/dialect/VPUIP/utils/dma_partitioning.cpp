@@ -0,0 +1,127 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPUIP/utils/dma_partitioning.hpp"
+
+#include "vpux/compiler/core/cost_model_utils.hpp"
+#include "vpux/compiler/utils/types.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <algorithm>
+
+using namespace vpux;
+
+//
+// DMATransferModel
+//
+
+VPUIP::DMATransferModel vpux::VPUIP::getDMATransferModel(VPU::ArchKind arch, mlir::MLIRContext* ctx) {
+    const auto costModel = VPU::createCostModel(arch);
+
+    const auto elemType = getUInt8Type(ctx);
+    const auto ddrType = getMemRefType(ShapeRef({1}), elemType, DimsOrder::C, VPU::MemoryKind::DDR);
+    const auto cmxType = getMemRefType(ShapeRef({1}), elemType, DimsOrder::C, VPU::MemoryKind::CMX_NN);
+    const auto descriptorCycles = checked_cast<int64_t>(
+            getDMACost(ddrType.cast<NDTypeInterface>(), cmxType.cast<NDTypeInterface>(), arch, costModel));
+
+    return {arch, costModel, descriptorCycles};
+}
+
+int64_t vpux::VPUIP::getDMATransferCycles(const DMATransferModel& model, NDTypeInterface inputType,
+                                          NDTypeInterface outputType) {
+    return checked_cast<int64_t>(getDMACost(inputType, outputType, model.arch, model.costModel));
+}
+
+//
+// DMAPartition
+//
+
+SmallVector<int64_t> vpux::VPUIP::getDMASplitPoints(int64_t dimSize) {
+    SmallVector<int64_t> splitPoints;
+    if (dimSize < 2) {
+        return splitPoints;
+    }
+
+    splitPoints.push_back(dimSize / 2);
+    const auto numSteps = std::min(dimSize, DMA_SPLIT_GRANULARITY);
+    for (auto step : irange<int64_t>(1, numSteps)) {
+        const auto splitPoint = step * dimSize / numSteps;
+        if (splitPoint > 0 && splitPoint < dimSize && !llvm::is_contained(splitPoints, splitPoint)) {
+            splitPoints.push_back(splitPoint);
+        }
+    }
+    return splitPoints;
+}
+
+namespace {
+
+// Best assignment of the parts to distinct ports
+VPUIP::DMAPartition getBestPortAssignment(const VPUIP::DMASplitCandidate& candidate, int64_t origPort,
+                                          ArrayRef<int64_t> portLoads) {
+    const auto numPorts = static_cast<int64_t>(portLoads.size());
+    const auto numParts = static_cast<int64_t>(candidate.partCycles.size());
+
+    const auto getFinish = [&](ArrayRef<int64_t> ports) {
+        int64_t finish = 0;
+        for (auto partIdx : irange(numParts)) {
+            finish = std::max(finish, portLoads[ports[partIdx]] + candidate.partCycles[partIdx]);
+        }
+        return finish;
+    };
+
+    // Start from the assignment the port rotation would give, so that ties keep the first part on its port
+    SmallVector<int64_t> ports(numPorts);
+    for (auto idx : irange(numPorts)) {
+        ports[idx] = (origPort + idx) % numPorts;
+    }
+    VPUIP::DMAPartition best{candidate.partSizes, SmallVector<int64_t>(ports.begin(), ports.begin() + numParts),
+                             candidate.partCycles, getFinish(ports)};
+
+    std::sort(ports.begin(), ports.end());
+    do {
+        const auto finish = getFinish(ports);
+        if (finish < best.predictedCycles) {
+            best.partPorts.assign(ports.begin(), ports.begin() + numParts);
+            best.predictedCycles = finish;
+        }
+    } while (std::next_permutation(ports.begin(), ports.end()));
+
+    return best;
+}
+
+}  // namespace
+
+VPUIP::DMAPartition vpux::VPUIP::getDMAPartition(int64_t descriptorCycles, int64_t wholeSize, int64_t wholeCycles,
+                                                 ArrayRef<DMASplitCandidate> candidates, int64_t origPort,
+                                                 ArrayRef<int64_t> portLoads) {
+    const auto numPorts = static_cast<int64_t>(portLoads.size());
+    VPUX_THROW_UNLESS(origPort >= 0 && origPort < numPorts, "DMA port {0} is out of range [0, {1})", origPort,
+                      numPorts);
+
+    const DMAPartition whole{{wholeSize}, {origPort}, {wholeCycles}, portLoads[origPort] + wholeCycles};
+    std::optional<DMAPartition> bestSplit;
+    for (const auto& candidate : candidates) {
+        VPUX_THROW_UNLESS(candidate.partSizes.size() == candidate.partCycles.size(),
+                          "Got {0} part sizes and {1} part cycles", candidate.partSizes.size(),
+                          candidate.partCycles.size());
+        const auto numParts = static_cast<int64_t>(candidate.partCycles.size());
+        if (numParts < 2 || numParts > numPorts) {
+            continue;
+        }
+
+        auto split = getBestPortAssignment(candidate, origPort, portLoads);
+        split.predictedCycles += (numParts - 1) * descriptorCycles;
+        if (!bestSplit.has_value() || split.predictedCycles < bestSplit->predictedCycles) {
+            bestSplit = std::move(split);
+        }
+    }
+
+    if (!bestSplit.has_value() || bestSplit->predictedCycles >= whole.predictedCycles) {
+        return whole;
+    }
+    return bestSplit.value();
+}
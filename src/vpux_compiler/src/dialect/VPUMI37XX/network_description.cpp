@@ -20,6 +20,7 @@
 #include "vpux/utils/core/range.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 using namespace vpux;
 
@@ -217,3 +218,24 @@ NetworkMetadata vpux::VPUMI37XX::getNetworkMetadata(mlir::ArrayRef<uint8_t> blob
 
     return network;
 }
+
+std::optional<PredictedPerformance> vpux::VPUMI37XX::getPredictedPerformance(mlir::ArrayRef<uint8_t> blob) {
+    VPUX_THROW_UNLESS(!blob.empty(), "Got NULL pointer");
+
+    auto accessor = elf::DDRAccessManager<elf::DDRAlwaysEmplace>(blob.data(), blob.size());
+    elf::Reader<elf::ELF_Bitness::Elf64> reader(&accessor);
+
+    for (auto secIndex : irange(reader.getSectionsNum())) {
+        const auto& section = reader.getSection(secIndex);
+
+        const auto secHeader = section.getHeader();
+        if (secHeader->sh_type !=
+            static_cast<elf::Elf_Word>(vpux::ELFNPU37XX::SectionTypeAttr::VPU_SHT_PERF_METRICS)) {
+            continue;
+        }
+
+        return readPredictedPerformance(mlir::ArrayRef<uint8_t>(section.getData<uint8_t>(), secHeader->sh_size));
+    }
+
+    return std::nullopt;
+}
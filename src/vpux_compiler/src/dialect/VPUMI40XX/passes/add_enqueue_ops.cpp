@@ -25,9 +25,9 @@ private:
     void safeRunOnFunc() final;
 };
 
-// Check if barrier that was chosen for enqueuing a task does not depend on a barrier
-// that is to be produced by this task itself what will create a deadlock during execution
-bool verifyEnqueueBarrierHasNoTopoDepOnBarrs(mlir::Value enqueueBar, mlir::ValueRange taskBars, Logger log) {
+// Find a barrier of the task that the barrier chosen for enqueuing it depends on topologically,
+// what would create a deadlock during execution
+mlir::Value findEnqueueBarrierTopoDepOnBarrs(mlir::Value enqueueBar, mlir::ValueRange taskBars) {
     // Identify minimal virtual ID of barrier produced by task. Barriers below
     // this ID will not be analyzed as they cannot be dependant of task barriers
     unsigned int minVid = std::numeric_limits<unsigned int>::max();
@@ -37,7 +37,7 @@ bool verifyEnqueueBarrierHasNoTopoDepOnBarrs(mlir::Value enqueueBar, mlir::Value
     }
 
     if (enqueueBar.getType().cast<VPURegMapped::IndexType>().getValue() < minVid) {
-        return true;
+        return nullptr;
     }
 
     mlir::DenseSet<mlir::Value> explored;
@@ -55,12 +55,7 @@ bool verifyEnqueueBarrierHasNoTopoDepOnBarrs(mlir::Value enqueueBar, mlir::Value
 
         auto taskBarIt = std::find(taskBars.begin(), taskBars.end(), bar);
         if (taskBarIt != taskBars.end()) {
-            auto enqueueBarOp = enqueueBar.getDefiningOp<VPUMI40XX::ConfigureBarrierOp>();
-            auto taskBarOp = (*taskBarIt).getDefiningOp<VPUMI40XX::ConfigureBarrierOp>();
-            log.error("Enqueue barrier '{0}' depends topologically on task to be enqueued itself which updates "
-                      "barrier '{1}'",
-                      enqueueBarOp, taskBarOp);
-            return false;
+            return *taskBarIt;
         }
 
         auto barOp = bar.getDefiningOp<VPUMI40XX::ConfigureBarrierOp>();
@@ -77,9 +72,57 @@ bool verifyEnqueueBarrierHasNoTopoDepOnBarrs(mlir::Value enqueueBar, mlir::Value
         }
     }
 
+    return nullptr;
+}
+
+// Check if barrier that was chosen for enqueuing a task does not depend on a barrier
+// that is to be produced by this task itself what will create a deadlock during execution
+bool verifyEnqueueBarrierHasNoTopoDepOnBarrs(mlir::Value enqueueBar, mlir::ValueRange taskBars, Logger log) {
+    auto taskBar = findEnqueueBarrierTopoDepOnBarrs(enqueueBar, taskBars);
+    if (taskBar != nullptr) {
+        auto enqueueBarOp = enqueueBar.getDefiningOp<VPUMI40XX::ConfigureBarrierOp>();
+        auto taskBarOp = taskBar.getDefiningOp<VPUMI40XX::ConfigureBarrierOp>();
+        log.error("Enqueue barrier '{0}' depends topologically on task to be enqueued itself which updates "
+                  "barrier '{1}'",
+                  enqueueBarOp, taskBarOp);
+        return false;
+    }
+
     return true;
 }
 
+// An enqueue is triggered once its barrier is consumed, i.e. all the consumers of the barrier have started. Estimate
+// it with the cycle at which the last consumer gets its wait barriers released
+std::optional<int64_t> getBarrierConsumptionCycle(mlir::Value barrier) {
+    auto consumptionCycle = VPUMI40XX::getBarrierReleaseCycle(barrier);
+    for (auto user : barrier.getUsers()) {
+        auto consumer = mlir::dyn_cast<VPUMI40XX::ExecutableTaskOpInterface>(user);
+        if (consumer == nullptr || !llvm::is_contained(consumer.waitBarriers(), barrier)) {
+            continue;
+        }
+
+        auto readyCycle = VPUMI40XX::getBarriersReleaseCycle(consumer.waitBarriers());
+        if (!consumptionCycle.has_value() || !readyCycle.has_value()) {
+            return std::nullopt;
+        }
+        consumptionCycle = std::max(consumptionCycle.value(), readyCycle.value());
+    }
+    return consumptionCycle;
+}
+
+// Delaying an enqueue to a later barrier costs nothing when the timeline predicted by AnnotateBarrierReleaseCycles
+// shows that barrier is consumed before the already enqueued tasks may start anyway
+bool canDelayEnqueue(mlir::Value newEnqueueBar, std::optional<int64_t> enqueuedTasksReadyCycle,
+                     mlir::ValueRange enqueuedTasksBars) {
+    auto consumptionCycle = getBarrierConsumptionCycle(newEnqueueBar);
+    if (!consumptionCycle.has_value() || !enqueuedTasksReadyCycle.has_value() ||
+        consumptionCycle.value() > enqueuedTasksReadyCycle.value()) {
+        return false;
+    }
+
+    return findEnqueueBarrierTopoDepOnBarrs(newEnqueueBar, enqueuedTasksBars) == nullptr;
+}
+
 // Go through all enqueue tasks and process whole schedule with respect to barrier consumption events
 // and check if no enqueue task chosen barrier is not yet fully consumed at the moment of enqueuement
 // what means that it will be consumed by some future tasks not yet enqueued
@@ -305,6 +348,9 @@ void addEnqus(VPUMI40XX::MappedInferenceOp mpi, const VPURegMapped::TaskType pri
 
         // reset local previousEnqu
         VPURegMapped::EnqueueOp localPreviousEnqu;
+        // barriers of the tasks of localPreviousEnqu and the predicted cycle at which the first one may start
+        llvm::SmallVector<mlir::Value> previousEnquTaskBarriers;
+        std::optional<int64_t> previousEnquReadyCycle;
 
         // strongly assume that the FIRST OP always has a fetchTask
         auto previousFetchTask = getFetchTask(startVal);
@@ -394,11 +440,20 @@ void addEnqus(VPUMI40XX::MappedInferenceOp mpi, const VPURegMapped::TaskType pri
                                     verifyEnqueueBarrierHasNoTopoDepOnBarrs(enqueueTarget, targetBarriers, log),
                                     "Invalid enqueue barrier found for task '{0}'", taskOp);
 
+            // batch the previous enqueue with this one if it can be delayed for free
+            if (localPreviousEnqu && (localPreviousEnqu.getBarrier() != enqueueTarget) &&
+                canDelayEnqueue(enqueueTarget, previousEnquReadyCycle, previousEnquTaskBarriers)) {
+                log.trace("Enqueue at barrier {0} delayed to {1} to batch it with task {2}",
+                          localPreviousEnqu.getBarrier().getType(), enqueueTarget.getType(), taskOp.getResult());
+                localPreviousEnqu.getBarrierMutable().assign(enqueueTarget);
+            }
+
             // if the previous enqueue's barrier is the same as the target barrier, we can just add this variant
             // range to the previous enqueue. This is made with the assumption that we topologically iterate over
             // the variants list by their listOrder
             if (localPreviousEnqu && (localPreviousEnqu.getBarrier() == enqueueTarget)) {
                 localPreviousEnqu.getEndMutable().assign(lastSecondary->getResult(0));
+                llvm::append_range(previousEnquTaskBarriers, targetBarriers);
             } else {
                 auto index = VPURegMapped::IndexType::get(ctx, counter);
                 mlir::Value previousEnquVal = localPreviousEnqu
@@ -408,6 +463,8 @@ void addEnqus(VPUMI40XX::MappedInferenceOp mpi, const VPURegMapped::TaskType pri
                         taskOp->getLoc(), index, previousEnquVal, enqueueTarget, secondary,
                         firstSecondary->getResult(0), lastSecondary->getResult(0));
                 counter++;
+                previousEnquTaskBarriers = targetBarriers;
+                previousEnquReadyCycle = VPUMI40XX::getBarriersReleaseCycle(barrieredOp.waitBarriers());
 
                 if (!firstEnqu)
                     firstEnqu = localPreviousEnqu.getResult();
@@ -3,15 +3,21 @@
 // SPDX-License-Identifier: Apache 2.0
 //
 
+#include "vpux/compiler/core/cost_model_utils.hpp"
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPU/utils/cost_model/cost_model.hpp"
 #include "vpux/compiler/dialect/VPUIP/utils/utils.hpp"
 #include "vpux/compiler/dialect/VPUMI40XX/ops.hpp"
 #include "vpux/compiler/dialect/VPUMI40XX/passes.hpp"
 #include "vpux/compiler/dialect/VPUMI40XX/utils.hpp"
+#include "vpux/compiler/dialect/VPUMI40XX/wlm_utils.hpp"
 #include "vpux/compiler/dialect/VPURegMapped/ops.hpp"
 
 #include "vpux/compiler/utils/attributes.hpp"
 #include "vpux/compiler/utils/stl_extras.hpp"
+#include "vpux/compiler/utils/types.hpp"
+
+#include <npu_40xx_nnrt.hpp>
 
 using namespace vpux;
 
@@ -42,7 +48,7 @@ void reindexList(VPUMI40XX::MappedInferenceOp mpi, VPURegMapped::FetchTaskOp fir
     mpi.setDmaCountAttr(getIntArrayOfArray(ctx, dmaCount));
 }
 
-VPUMI40XX::NNDMAOp getNextDma(VPURegMapped::FetchTaskOp fetch) {
+VPUMI40XX::NNDMAOp getNextDma(VPURegMapped::TaskOpInterface fetch) {
     auto nextDma = [](VPURegMapped::TaskOpInterface taskOp) -> VPURegMapped::TaskOpInterface {
         auto dmaIt = llvm::find_if(taskOp.getResult().getUsers(), [&taskOp](mlir::Operation* op) {
             auto dma = mlir::dyn_cast<VPURegMapped::TaskOpInterface>(op);
@@ -53,12 +59,12 @@ VPUMI40XX::NNDMAOp getNextDma(VPURegMapped::FetchTaskOp fetch) {
         return res;
     };
 
-    VPURegMapped::TaskOpInterface res = mlir::cast<VPURegMapped::TaskOpInterface>(fetch.getOperation());
+    VPURegMapped::TaskOpInterface res = fetch;
     do {
         res = nextDma(res);
     } while (res && mlir::isa<VPURegMapped::FetchTaskOp>(res));
 
-    return mlir::cast<VPUMI40XX::NNDMAOp>(res.getOperation());
+    return res ? mlir::cast<VPUMI40XX::NNDMAOp>(res.getOperation()) : nullptr;
 }
 
 bool dmaComp(mlir::Operation* lhs, mlir::Operation* rhs) {
@@ -189,6 +195,120 @@ VPUMI40XX::NNDMAOp findLastDma(VPURegMapped::ExecutionGroupOp op, uint32_t listI
     return nullptr;
 }
 
+//
+// Timeline placement
+//
+
+int64_t getDescriptorSize(VPURegMapped::TaskType taskType) {
+    switch (taskType) {
+    case VPURegMapped::TaskType::DPUInvariant:
+        return sizeof(npu40xx::nn_public::VpuDPUInvariant);
+    case VPURegMapped::TaskType::DPUVariant:
+        return sizeof(npu40xx::nn_public::VpuDPUVariant);
+    case VPURegMapped::TaskType::ActKernelInvocation:
+        return sizeof(npu40xx::nn_public::VpuActKernelInvocation);
+    case VPURegMapped::TaskType::ActKernelRange:
+        return sizeof(npu40xx::nn_public::VpuActKernelRange);
+    default:
+        VPUX_THROW("Unknown Task Type {0}", taskType);
+    }
+}
+
+// earliest cycle at which the group may start executing, its descriptors have to be in CMX by then
+std::optional<int64_t> getNeededByCycle(VPURegMapped::ExecutionGroupOp group) {
+    std::optional<int64_t> neededBy;
+    for (auto waitBarr : group.getWaitBarriers()) {
+        auto releaseCycle = VPUMI40XX::getBarrierReleaseCycle(waitBarr);
+        if (!releaseCycle.has_value()) {
+            return std::nullopt;
+        }
+        neededBy = std::min(neededBy.value_or(releaseCycle.value()), releaseCycle.value());
+    }
+    return neededBy;
+}
+
+// Tracks the fetches already placed on the DMA FIFO, so the following fetches can be batched behind them
+class FetchTimeline {
+public:
+    explicit FetchTimeline(VPU::ArchKind arch)
+            : _costModel(VPU::createCostModel(arch)), _vpuDevice(VPU::getVPUDeviceType(arch)) {
+    }
+
+    VPUMI40XX::NNDMAOp findInsertionDma(VPUMI40XX::NNDMAOp earliestDma, VPUMI40XX::NNDMAOp lastDma,
+                                        VPURegMapped::ExecutionGroupOp group, Logger log);
+
+private:
+    int64_t getFetchCost(VPURegMapped::ExecutionGroupOp group) const;
+
+private:
+    std::shared_ptr<VPUNN::VPUCostModel> _costModel;
+    VPUNN::VPUDevice _vpuDevice;
+    // accumulated cost of the fetches placed after the DMA
+    mlir::DenseMap<mlir::Operation*, int64_t> _anchorFetchCycles;
+};
+
+// The fetch is unrolled into two DDR to CMX DMAs copying the descriptors of both lists of the group, see
+// UnrollFetchTaskOps
+int64_t FetchTimeline::getFetchCost(VPURegMapped::ExecutionGroupOp group) const {
+    auto ctx = group.getContext();
+    auto yield = mlir::cast<VPURegMapped::GroupYieldOp>(group.getTasks().front().getTerminator());
+
+    int64_t fetchCost = 0;
+    for (auto listIdx : irange(group.getStartIndexes().size())) {
+        auto startIdx = mlir::cast<VPURegMapped::IndexType>(group.getStartIndexes()[listIdx].getType()).getValue();
+        auto endIdx = mlir::cast<VPURegMapped::IndexType>(group.getEndIndexes()[listIdx].getType()).getValue();
+        auto taskOp = mlir::cast<VPURegMapped::TaskOpInterface>(yield.getListHeads()[listIdx].getDefiningOp());
+
+        const auto descriptorsType = mlir::RankedTensorType::get(
+                {checked_cast<int64_t>(endIdx - startIdx + 1), getDescriptorSize(taskOp.getTaskType())},
+                getUInt8Type(ctx));
+        fetchCost += checked_cast<int64_t>(
+                getDMACost(descriptorsType.cast<vpux::NDTypeInterface>(), _vpuDevice, _costModel, 1));
+    }
+    return fetchCost;
+}
+
+// The earliest DMA is bounded by the descriptor double-buffering, so the descriptors get to CMX as early as the FIFO
+// capacity allows. Any DMA up to the last one producing the wait barriers of the group can carry the fetch though.
+// If some DMA of that window already carries fetches and the whole batch still completes before the group becomes
+// ready, the fetch is appended to it. Batched fetches share the completion barrier, which lets AddEnqueueOps merge
+// the enqueues waiting for them.
+VPUMI40XX::NNDMAOp FetchTimeline::findInsertionDma(VPUMI40XX::NNDMAOp earliestDma, VPUMI40XX::NNDMAOp lastDma,
+                                                   VPURegMapped::ExecutionGroupOp group, Logger log) {
+    const auto fetchCost = getFetchCost(group);
+    const auto neededBy = getNeededByCycle(group);
+
+    auto insertionDma = earliestDma;
+    for (auto dma = earliestDma; neededBy.has_value() && dma && dma != lastDma; dma = getNextDma(dma)) {
+        auto anchorIt = _anchorFetchCycles.find(dma.getOperation());
+        auto nextDma = getNextDma(dma);
+        if (anchorIt == _anchorFetchCycles.end() || !nextDma) {
+            continue;
+        }
+
+        // fetches get no completion event of their own, they are known to be done once the next DMA updating
+        // barriers is done
+        auto nextTask = mlir::cast<VPURegMapped::TaskOpInterface>(nextDma.getOperation());
+        auto completionBarriers = VPUMI40XX::getClosestProductionBarriers(nextTask);
+        auto completionCycle = VPUMI40XX::getBarriersReleaseCycle(completionBarriers);
+        if (completionBarriers.empty() || !completionCycle.has_value()) {
+            continue;
+        }
+
+        if (completionCycle.value() + anchorIt->second + fetchCost <= neededBy.value()) {
+            insertionDma = dma;
+            break;
+        }
+    }
+
+    if (insertionDma != earliestDma) {
+        log.trace("Fetch for {0} batched after DMA {1} instead of {2}", group.getLoc(),
+                  insertionDma.getType().getValue(), earliestDma.getType().getValue());
+    }
+    _anchorFetchCycles[insertionDma.getOperation()] += fetchCost;
+    return insertionDma;
+}
+
 // initial PRIMITIVE implementation that will not try to smartly insert anything, but try to achieve WLM the simplest
 // way possible AKA: find each DPU, and BEFORE EACH DPU task, will insert one ENQUEUE OP, and connecting it's barrier
 // lots of assumptions on this pass, will try to summarize them
@@ -197,9 +317,12 @@ VPUMI40XX::NNDMAOp findLastDma(VPURegMapped::ExecutionGroupOp op, uint32_t listI
 // - assume that said consumer barrier has a DMA producer  ----
 // - assume that the above is true for each tile
 // - assume all DMA-s are in the IR AFTER all DPU tasks - guarantee due to current reordering passes
+// When barriers carry the predicted release cycles the PRIMITIVE position is only the default, the fetch may be batched
+// with a later one, see FetchTimeline::findInsertionDma
 
 void addFetchTasks(VPUMI40XX::MappedInferenceOp mpi, const int64_t tilesCount, const size_t fetchTaskTileIdx,
-                   const size_t fetchTaskListIdx, const VPURegMapped::TaskType taskType) {
+                   const size_t fetchTaskListIdx, const VPURegMapped::TaskType taskType,
+                   std::optional<FetchTimeline>& timeline, Logger log) {
     auto ctx = mpi.getContext();
     auto dmaComp = [](VPUMI40XX::NNDMAOp lhs, VPUMI40XX::NNDMAOp rhs) {
         return lhs.getType().getValue() < rhs.getType().getValue();
@@ -241,14 +364,18 @@ void addFetchTasks(VPUMI40XX::MappedInferenceOp mpi, const int64_t tilesCount, c
         while (travelingGroup) {
             auto parentFetchDma = getNextDma(parentFetch);
             auto firstGrandParentDma = grandParentGroup ? findFirstDma(grandParentGroup, 0, 0) : nullptr;
-            auto insertionDma = grandParentGroup ? std::max(firstGrandParentDma, parentFetchDma, dmaComp)
-                                                 : findLastDma(parentGroup, 0, 0);
+            auto earliestDma = grandParentGroup ? std::max(firstGrandParentDma, parentFetchDma, dmaComp)
+                                                : findLastDma(parentGroup, 0, 0);
 
             auto lastDma = findLastDma(travelingGroup, 0, 0);
             VPUX_THROW_TYPED_WHEN(WlmRollbackException,
-                                  lastDma.getType().getValue() <= insertionDma.getType().getValue(),
+                                  lastDma.getType().getValue() <= earliestDma.getType().getValue(),
                                   "Could not find a suitable DMA location to fetch group {0}", travelingGroup);
 
+            auto insertionDma = timeline.has_value()
+                                        ? timeline->findInsertionDma(earliestDma, lastDma, travelingGroup, log)
+                                        : earliestDma;
+
             // set the insertion point after the finalDMa
             builder.setInsertionPointAfter(insertionDma.getOperation());
             auto fetchTaskOp = builder.create<VPURegMapped::FetchTaskOp>(
@@ -283,8 +410,19 @@ void WorkloadManagementPass::safeRunOnFunc() {
     const size_t DMA_DDR2CMX_LISTIDX = 0;
     const size_t DMA_WLM_TILEIDX = 0;  // all WLM dma's should be on tile0 for now;
 
-    addFetchTasks(mpi, tilesCount, DMA_WLM_TILEIDX, DMA_DDR2CMX_LISTIDX, VPURegMapped::TaskType::DPUInvariant);
-    addFetchTasks(mpi, tilesCount, DMA_WLM_TILEIDX, DMA_DDR2CMX_LISTIDX, VPURegMapped::TaskType::ActKernelRange);
+    // the timeline is only known when the barriers were annotated, see AnnotateBarrierReleaseCycles
+    std::optional<FetchTimeline> timeline;
+    auto barriers = netFunc.getOps<VPUMI40XX::ConfigureBarrierOp>();
+    if (llvm::any_of(barriers, [](VPUMI40XX::ConfigureBarrierOp barrier) {
+            return barrier->hasAttr(barrierReleaseCycle);
+        })) {
+        timeline.emplace(VPU::getArch(parentModule));
+    }
+
+    addFetchTasks(mpi, tilesCount, DMA_WLM_TILEIDX, DMA_DDR2CMX_LISTIDX, VPURegMapped::TaskType::DPUInvariant,
+                  timeline, _log);
+    addFetchTasks(mpi, tilesCount, DMA_WLM_TILEIDX, DMA_DDR2CMX_LISTIDX, VPURegMapped::TaskType::ActKernelRange,
+                  timeline, _log);
 
     return;
 }
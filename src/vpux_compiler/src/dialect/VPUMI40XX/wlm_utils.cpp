@@ -5,6 +5,8 @@
 
 #include "vpux/compiler/dialect/VPUMI40XX/wlm_utils.hpp"
 
+#include "vpux/compiler/core/cost_model_utils.hpp"
+
 namespace vpux {
 namespace VPUMI40XX {
 
@@ -243,5 +245,29 @@ VPUMI40XX::ExecutableTaskOpInterface getBarrieredOp(VPURegMapped::TaskOpInterfac
     return nullptr;
 }
 
+//
+// Timeline Utils
+//
+
+std::optional<int64_t> getBarrierReleaseCycle(mlir::Value barrier) {
+    auto releaseCycle = barrier.getDefiningOp()->getAttrOfType<mlir::IntegerAttr>(barrierReleaseCycle);
+    if (releaseCycle == nullptr) {
+        return std::nullopt;
+    }
+    return releaseCycle.getInt();
+}
+
+std::optional<int64_t> getBarriersReleaseCycle(mlir::ValueRange barriers) {
+    int64_t releaseCycle = 0;
+    for (auto barrier : barriers) {
+        auto barrierRelease = getBarrierReleaseCycle(barrier);
+        if (!barrierRelease.has_value()) {
+            return std::nullopt;
+        }
+        releaseCycle = std::max(releaseCycle, barrierRelease.value());
+    }
+    return releaseCycle;
+}
+
 }  // namespace VPUMI40XX
 }  // namespace vpux
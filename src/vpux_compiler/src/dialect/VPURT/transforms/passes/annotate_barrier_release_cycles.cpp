@@ -0,0 +1,68 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/core/cost_model_utils.hpp"
+#include "vpux/compiler/core/cycle_cost_info.hpp"
+#include "vpux/compiler/dialect/VPURT/interfaces/inference_execution_simulator.hpp"
+#include "vpux/compiler/dialect/VPURT/transforms/passes.hpp"
+#include "vpux/compiler/utils/attributes.hpp"
+
+using namespace vpux;
+
+namespace {
+
+//
+// AnnotateBarrierReleaseCyclesPass
+//
+
+class AnnotateBarrierReleaseCyclesPass final :
+        public VPURT::AnnotateBarrierReleaseCyclesBase<AnnotateBarrierReleaseCyclesPass> {
+public:
+    explicit AnnotateBarrierReleaseCyclesPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnFunc() final;
+};
+
+void AnnotateBarrierReleaseCyclesPass::safeRunOnFunc() {
+    auto funcOp = getOperation();
+    CycleCostInfo cycleCostInfo(funcOp);
+
+    VPURT::InferenceExecutionSimulator infSim(_log, funcOp, cycleCostInfo);
+    infSim.runSim();
+
+    if (auto tasksCountWithInvalidCost = cycleCostInfo.getNumberOfTasksWithInvalidCost()) {
+        _log.warning("There are {0} tasks with invalid cost, barrier release cycles might not be accurate",
+                     tasksCountWithInvalidCost);
+    }
+
+    // Simulator assigns virtual ids to the barriers in IR order
+    uint32_t vid = 0;
+    funcOp->walk([&](mlir::Operation* op) {
+        if (!mlir::isa<VPURT::DeclareVirtualBarrierOp, VPURT::ConfigureBarrierOp>(op)) {
+            return;
+        }
+
+        VPUX_THROW_UNLESS(infSim.getDeclareBarrierOp(vid) == op, "Barrier '{0}' does not match virtual id '{1}'",
+                          op->getLoc(), vid);
+        const auto releaseCycle = infSim.getVirtBarrierConfig(vid).getReleaseCycle();
+        op->setAttr(barrierReleaseCycle, getIntAttr(op->getContext(), checked_cast<int64_t>(releaseCycle)));
+        ++vid;
+    });
+
+    _log.trace("Annotated {0} barriers, inference latency {1} cycles", vid, infSim.getInferenceLatencyInCycles());
+}
+
+}  // namespace
+
+//
+// createAnnotateBarrierReleaseCyclesPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::VPURT::createAnnotateBarrierReleaseCyclesPass(Logger log) {
+    return std::make_unique<AnnotateBarrierReleaseCyclesPass>(log);
+}
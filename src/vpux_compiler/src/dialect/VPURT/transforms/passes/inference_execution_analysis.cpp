@@ -68,6 +68,27 @@ double getActivityFactor(double totalEnergy, size_t totalCycles, size_t numTiles
     return af;
 }
 
+// Cycles when at least one queue of the executor runs a task, overlapping tasks are counted once
+size_t getBusyCycles(const VPURT::TaskConfigVec& tasksCycleConfig) {
+    SmallVector<std::pair<size_t, size_t>> intervals;
+    intervals.reserve(tasksCycleConfig.size());
+    for (const auto& taskConfig : tasksCycleConfig) {
+        intervals.emplace_back(taskConfig.cycleStart, taskConfig.cycleStart + taskConfig.cycleCost);
+    }
+    llvm::sort(intervals);
+
+    size_t busyCycles = 0;
+    size_t busyEnd = 0;
+    for (const auto& [start, end] : intervals) {
+        if (end <= busyEnd) {
+            continue;
+        }
+        busyCycles += end - std::max(start, busyEnd);
+        busyEnd = end;
+    }
+    return busyCycles;
+}
+
 double convertCyclesToNanoSeconds(size_t cycles, double freqInMHz) {
     return (cycles * 1000.0) / freqInMHz;
 }
@@ -190,6 +211,16 @@ void InferenceExecutionAnalysisPass::safeRunOnFunc() {
         auto netOp = netOps.front();
         netOp.setInferenceTiming(std::optional<int64_t>(totalCycles));
         _log.info("[Energy] inferenceTiming {0} cycles by DPU freq {1} MHz", totalCycles, freqInMHz);
+
+        // Per-engine busy time, serialized with the inference time to estimate the utilization without execution
+        const auto dmaBusyCycles = getBusyCycles(infSim.getTaskCycleConfig(VPU::ExecutorKind::DMA_NN));
+        const auto dpuBusyCycles = getBusyCycles(infSim.getTaskCycleConfig(VPU::ExecutorKind::DPU));
+        const auto shaveBusyCycles = getBusyCycles(infSim.getTaskCycleConfig(VPU::ExecutorKind::SHAVE_ACT));
+        netOp.setDmaBusyTiming(std::optional<int64_t>(dmaBusyCycles));
+        netOp.setDpuBusyTiming(std::optional<int64_t>(dpuBusyCycles));
+        netOp.setShaveBusyTiming(std::optional<int64_t>(shaveBusyCycles));
+        _log.info("Estimated busy cycles: DMA {0}, DPU {1}, SHAVE {2}", dmaBusyCycles, dpuBusyCycles,
+                  shaveBusyCycles);
     }
 
     if (_dumpToJson) {
@@ -580,7 +580,19 @@ mlir::func::FuncOp NGraphImporter::buildMainFunc(mlir::OpBuilder& moduleBuilder,
         _importedVals.emplace(paramNode->output(0), funcInputVal);
     }
 
-    for (const auto& origNode : _netGraph->get_ordered_ops()) {
+    const auto orderedOps = _netGraph->get_ordered_ops();
+
+    // Copying and uniquing constant payloads dominates the import time of large models when the constants are not
+    // shared. On request, convert them on the context thread pool while the nodes are walked, the ops are still
+    // created in topological order by this thread. Shared constants only reference the model memory, there is
+    // nothing to offload for them.
+    std::optional<llvm::ThreadPoolTaskGroup> constantsTaskGroup;
+    if (_prefetchConstants && _ctx->isMultithreadingEnabled() && !_sharedConstants) {
+        constantsTaskGroup.emplace(_ctx->getThreadPool());
+        prefetchConstants(orderedOps, constantsTaskGroup.value());
+    }
+
+    for (const auto& origNode : orderedOps) {
         _log.trace("Convert {0} layer {1}", origNode->get_type_name(), origNode->get_friendly_name());
         const auto parser = NGraphImporter::getParser(origNode);
 
@@ -600,6 +612,8 @@ mlir::func::FuncOp NGraphImporter::buildMainFunc(mlir::OpBuilder& moduleBuilder,
         }
     }
 
+    _pendingConstants.clear();
+
     SmallVector<mlir::Value> funcOutputs;
     funcOutputs.reserve(_netGraph->get_results().size());
 
@@ -647,6 +661,31 @@ mlir::func::FuncOp NGraphImporter::buildMainFunc(mlir::OpBuilder& moduleBuilder,
     return func;
 }
 
+void NGraphImporter::prefetchConstants(const std::vector<OrigNodePtr>& orderedOps,
+                                       llvm::ThreadPoolTaskGroup& taskGroup) {
+    for (const auto& origNode : orderedOps) {
+        const auto constNode = std::dynamic_pointer_cast<ov::opset1::Constant>(origNode);
+        if (constNode == nullptr) {
+            continue;
+        }
+
+        const auto tensorType =
+                importTensor(constNode->get_output_partial_shape(0), constNode->get_output_element_type(0));
+        const Bit elemTypeSize = getElemTypeSize(tensorType);
+        if (Const::isSubByte(elemTypeSize.count())) {
+            continue;
+        }
+
+        const auto bufferSize = (elemTypeSize * tensorType.getNumElements()).to<Byte>().count();
+        const auto rawBuffer = ArrayRef(constNode->get_data_ptr<char>(), bufferSize);
+        _pendingConstants.emplace(constNode.get(), taskGroup.async([tensorType, rawBuffer]() -> mlir::ElementsAttr {
+            return mlir::DenseElementsAttr::getFromRawBuffer(tensorType, rawBuffer);
+        }));
+    }
+
+    _log.trace("Converting {0} constants on the thread pool", _pendingConstants.size());
+}
+
 void NGraphImporter::buildBlockFromRegion(mlir::Location loc, mlir::OpBuilder& builder, mlir::Block* block) {
     SmallVector<mlir::Type> inputTypes;
     inputTypes.reserve(_netGraph->get_parameters().size());
@@ -869,6 +908,10 @@ void NGraphImporter::parseNode(mlir::OpBuilder& builder, const std::shared_ptr<o
         // DenseElementsAttr has very limited support for sub byte type (only I1 is supported).
         // Therefore, we need to avoid using DenseElementsAttr to store sub byte type.
         if (!vpux::Const::isSubByte(bitWidth) && !_sharedConstants) {
+            const auto pending = _pendingConstants.find(origNode.get());
+            if (pending != _pendingConstants.end()) {
+                return pending->second.get();
+            }
             return mlir::DenseElementsAttr::getFromRawBuffer(tensorType, rawBuffer);
         }
 
@@ -4616,8 +4659,8 @@ mlir::OwningOpRef<mlir::ModuleOp> vpux::IE::importNetwork(
         mlir::MLIRContext* ctx, const std::shared_ptr<ov::Model>& model,
         const std::vector<std::shared_ptr<const ov::Node>>& originalParameters,
         const std::vector<std::shared_ptr<const ov::Node>>& originalResults, bool sharedConstants,
-        mlir::TimingScope& rootTiming, bool enableProfiling, vpux::DummyOpMode stubLayers, bool dynamicShapeToStatic,
-        vpux::VPU::ArchKind arch, Logger log) {
+        bool prefetchConstants, mlir::TimingScope& rootTiming, bool enableProfiling, vpux::DummyOpMode stubLayers,
+        bool dynamicShapeToStatic, vpux::VPU::ArchKind arch, Logger log, bool runNGraphPasses) {
     log.setName("IE::FrontEnd::importNetwork");
 
     log.trace("Load IE::FrontEnd dependent Dialects");
@@ -4627,8 +4670,10 @@ mlir::OwningOpRef<mlir::ModuleOp> vpux::IE::importNetwork(
         dynamicToStaticShape(model);
     }
 
-    log.trace("Run common nGraph passes");
-    NGraphPasses::runNGraphPasses(model, rootTiming, arch);
+    if (runNGraphPasses) {
+        log.trace("Run common nGraph passes");
+        NGraphPasses::runNGraphPasses(model, rootTiming, arch);
+    }
 
     const auto moduleLoc = IE::createLayerLocation(ctx, "module", "Module");
     auto module = mlir::ModuleOp::create(moduleLoc, StringRef(model->get_friendly_name()));
@@ -4642,7 +4687,7 @@ mlir::OwningOpRef<mlir::ModuleOp> vpux::IE::importNetwork(
     addCNNNetworkOp(builder, mainFuncName, model, originalParameters, originalResults, rootTiming, enableProfiling);
 
     log.trace("Import nGraph function");
-    NGraphImporter importer(ctx, model, sharedConstants, log);
+    NGraphImporter importer(ctx, model, sharedConstants, log, prefetchConstants);
     importer.buildMainFunc(builder, mainFuncName.getValue(), rootTiming, stubLayers, dynamicShapeToStatic);
 
     log.trace("Validate MLIR module");
@@ -364,6 +364,36 @@ std::optional<std::string> getPerformanceHintOverride(const intel_npu::Config& c
     }
 }
 
+namespace {
+
+template <typename Options>
+std::optional<std::string> getShapeBuckets(const intel_npu::Config& config) {
+    const auto options = Options::createFromString(config.get<intel_npu::COMPILATION_MODE_PARAMS>());
+    if (options == nullptr) {
+        return std::nullopt;
+    }
+
+    return options->shapeBuckets;
+}
+
+}  // namespace
+
+// Shape buckets are supported only by DefaultHW mode
+std::optional<std::string> getShapeBuckets(const intel_npu::Config& config) {
+    if (getCompilationMode(config) != VPU::CompilationMode::DefaultHW) {
+        return std::nullopt;
+    }
+
+    const auto arch = getArchKind(config);
+    if (arch == VPU::ArchKind::NPU37XX) {
+        return getShapeBuckets<DefaultHWOptions37XX>(config);
+    } else if (arch == VPU::ArchKind::NPU40XX) {
+        return getShapeBuckets<DefaultHWOptions40XX>(config);
+    } else {
+        return std::nullopt;
+    }
+}
+
 template <typename Options>
 std::optional<bool> getEnableFP16CompressConv(const intel_npu::Config& config) {
     const auto options = Options::createFromString(config.get<intel_npu::COMPILATION_MODE_PARAMS>());
@@ -439,6 +469,25 @@ std::optional<bool> getWlmEnabled(const intel_npu::Config& config) {
     }
 }
 
+template <typename Options>
+std::optional<bool> getSharedWeightsEnabled(const intel_npu::Config& config) {
+    const auto options = Options::createFromString(config.get<intel_npu::BACKEND_COMPILATION_PARAMS>());
+    if (options == nullptr) {
+        return std::nullopt;
+    }
+
+    return options->enableSharedWeights;
+}
+
+std::optional<bool> getSharedWeightsEnabled(const intel_npu::Config& config) {
+    const auto arch = getArchKind(config);
+    if (arch == VPU::ArchKind::NPU40XX) {
+        return getSharedWeightsEnabled<BackendCompilationOptions40XX>(config);
+    } else {
+        return std::nullopt;
+    }
+}
+
 template <typename Options>
 std::optional<bool> getEnableAutoPaddingIDU(const intel_npu::Config& config) {
     const auto options = Options::createFromString(config.get<intel_npu::COMPILATION_MODE_PARAMS>());
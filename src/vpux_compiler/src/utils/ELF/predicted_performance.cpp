@@ -0,0 +1,26 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/ELF/predicted_performance.hpp"
+
+#include <cstring>
+
+using namespace vpux;
+
+std::optional<PredictedPerformance> vpux::readPredictedPerformance(ArrayRef<uint8_t> perfMetricsSection) {
+    // Sections written without the record contain only the firmware structure
+    if (perfMetricsSection.size() <= sizeof(PredictedPerformance)) {
+        return std::nullopt;
+    }
+
+    PredictedPerformance predicted;
+    const auto recordOffset = perfMetricsSection.size() - sizeof(PredictedPerformance);
+    std::memcpy(&predicted, perfMetricsSection.data() + recordOffset, sizeof(PredictedPerformance));
+    if (predicted.magic != PredictedPerformance::MAGIC || predicted.version != PredictedPerformance::VERSION ||
+        predicted.latencyCycles == 0) {
+        return std::nullopt;
+    }
+    return predicted;
+}
@@ -0,0 +1,71 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/ELF/shared_weights.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+
+#include <llvm/Support/xxhash.h>
+
+#include <cstring>
+
+using namespace vpux;
+
+uint64_t vpux::getSharedWeightsHash(ArrayRef<char> content) {
+    return llvm::xxh3_64bits(ArrayRef<uint8_t>(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+}
+
+std::vector<uint8_t> vpux::packSharedWeights(const std::map<uint64_t, ArrayRef<char>>& payloads) {
+    SharedWeightsBlobHeader header{};
+    header.entryCount = payloads.size();
+
+    std::vector<SharedWeightsEntry> entries;
+    entries.reserve(payloads.size());
+    auto offset = alignValUp<uint64_t>(sizeof(SharedWeightsBlobHeader) + payloads.size() * sizeof(SharedWeightsEntry),
+                                       SHARED_WEIGHTS_ALIGNMENT);
+    for (const auto& [hash, payload] : payloads) {
+        entries.push_back(SharedWeightsEntry{hash, offset, payload.size()});
+        offset = alignValUp<uint64_t>(offset + payload.size(), SHARED_WEIGHTS_ALIGNMENT);
+    }
+
+    std::vector<uint8_t> blob(offset, 0);
+    std::memcpy(blob.data(), &header, sizeof(SharedWeightsBlobHeader));
+    std::memcpy(blob.data() + sizeof(SharedWeightsBlobHeader), entries.data(),
+                entries.size() * sizeof(SharedWeightsEntry));
+    for (const auto& entry : entries) {
+        const auto& payload = payloads.at(entry.hash);
+        std::copy(payload.begin(), payload.end(), blob.begin() + entry.offset);
+    }
+    return blob;
+}
+
+std::vector<uint8_t> vpux::mergeSharedWeights(ArrayRef<ArrayRef<uint8_t>> weightsBlobs) {
+    std::map<uint64_t, ArrayRef<char>> payloads;
+    for (auto weightsBlob : weightsBlobs) {
+        SharedWeightsBlobHeader header;
+        VPUX_THROW_WHEN(weightsBlob.size() < sizeof(header), "Shared weights blob is too small");
+        std::memcpy(&header, weightsBlob.data(), sizeof(header));
+        VPUX_THROW_UNLESS(header.magic == SharedWeightsBlobHeader::MAGIC &&
+                                  header.version == SharedWeightsBlobHeader::VERSION,
+                          "Unsupported shared weights blob");
+        VPUX_THROW_WHEN(header.entryCount > (weightsBlob.size() - sizeof(header)) / sizeof(SharedWeightsEntry),
+                        "Corrupted shared weights blob, {0} entries in {1} bytes", header.entryCount,
+                        weightsBlob.size());
+
+        std::vector<SharedWeightsEntry> entries(header.entryCount);
+        std::memcpy(entries.data(), weightsBlob.data() + sizeof(header), entries.size() * sizeof(SharedWeightsEntry));
+        for (const auto& entry : entries) {
+            VPUX_THROW_WHEN(entry.offset > weightsBlob.size() || entry.size > weightsBlob.size() - entry.offset,
+                            "Shared constant {0} is out of the weights blob bounds", entry.hash);
+            const auto payload = ArrayRef<char>(reinterpret_cast<const char*>(weightsBlob.data()) + entry.offset,
+                                                entry.size);
+            const auto stored = payloads.emplace(entry.hash, payload);
+            VPUX_THROW_UNLESS(stored.second || stored.first->second == payload, "Content hash collision for {0}",
+                              entry.hash);
+        }
+    }
+    return packSharedWeights(payloads);
+}
@@ -0,0 +1,117 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/function_timing.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <mlir/Dialect/Func/IR/FuncOps.h>
+#include <mlir/Pass/PassInstrumentation.h>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/StringMap.h>
+
+#include <chrono>
+#include <mutex>
+
+using namespace vpux;
+
+namespace {
+
+//
+// FunctionTimingInstrumentation
+//
+
+class FunctionTimingInstrumentation final : public mlir::PassInstrumentation {
+    using Clock = std::chrono::steady_clock;
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    static constexpr size_t REPORTED_FUNCTIONS = 10;
+
+public:
+    explicit FunctionTimingInstrumentation(Logger log): _log(log) {
+        _log.setName("function-timing");
+    }
+
+    // The top-level PassManager::run does not notify the instrumentations about its own pipeline,
+    // only about the nested ones. So the report is done once the PassManager releases the instrumentation.
+    ~FunctionTimingInstrumentation() override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        report();
+        _funcTimes.clear();
+        _startTimes.clear();
+    }
+
+    void runBeforePass(mlir::Pass* pass, mlir::Operation* op) override {
+        if (!mlir::isa<mlir::func::FuncOp>(op)) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _startTimes[{pass, op}] = Clock::now();
+    }
+
+    void runAfterPass(mlir::Pass* pass, mlir::Operation* op) override {
+        accumulate(pass, op);
+    }
+
+    void runAfterPassFailed(mlir::Pass* pass, mlir::Operation* op) override {
+        accumulate(pass, op);
+    }
+
+private:
+    void accumulate(mlir::Pass* pass, mlir::Operation* op) {
+        auto func = mlir::dyn_cast<mlir::func::FuncOp>(op);
+        if (func == nullptr) {
+            return;
+        }
+
+        const auto endTime = Clock::now();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _startTimes.find({pass, op});
+        if (it == _startTimes.end()) {
+            return;
+        }
+        _funcTimes[func.getSymName()] += Duration(endTime - it->second);
+        _startTimes.erase(it);
+    }
+
+    void report() const {
+        if (_funcTimes.empty()) {
+            return;
+        }
+
+        SmallVector<std::pair<StringRef, Duration>> funcTimes;
+        Duration totalTime(0);
+        for (const auto& entry : _funcTimes) {
+            funcTimes.emplace_back(entry.getKey(), entry.getValue());
+            totalTime += entry.getValue();
+        }
+        llvm::sort(funcTimes, [](const auto& lhs, const auto& rhs) {
+            return lhs.second > rhs.second || (lhs.second == rhs.second && lhs.first < rhs.first);
+        });
+
+        _log.info("Function passes ran on {0} functions in {1:F2} ms, the longest function '{2}' took {3:F2} ms",
+                  funcTimes.size(), totalTime.count(), funcTimes.front().first, funcTimes.front().second.count());
+
+        auto nestedLog = _log.nest();
+        for (const auto& [name, time] : ArrayRef(funcTimes).take_front(REPORTED_FUNCTIONS)) {
+            nestedLog.info("'{0}' : {1:F2} ms ({2:F1}%)", name, time.count(), 100.0 * time / totalTime);
+        }
+    }
+
+private:
+    Logger _log;
+
+    std::mutex _mutex;
+    llvm::DenseMap<std::pair<mlir::Pass*, mlir::Operation*>, Clock::time_point> _startTimes;
+    llvm::StringMap<Duration> _funcTimes;
+};
+
+}  // namespace
+
+void vpux::addFunctionTiming(mlir::PassManager& pm, Logger log) {
+    pm.addInstrumentation(std::make_unique<FunctionTimingInstrumentation>(log));
+}
@@ -0,0 +1,192 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/shape_buckets.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <llvm/ADT/STLExtras.h>
+
+#include <cstring>
+#include <numeric>
+
+using namespace vpux;
+
+SmallVector<SmallVector<int64_t>> vpux::parseShapeBucketSizes(StringRef bucketSizes) {
+    SmallVector<StringRef> tokens;
+    bucketSizes.split(tokens, ',', /*MaxSplit=*/-1, /*KeepEmpty=*/false);
+
+    SmallVector<SmallVector<int64_t>> buckets;
+    for (auto token : tokens) {
+        SmallVector<StringRef> dimTokens;
+        token.split(dimTokens, 'x', /*MaxSplit=*/-1, /*KeepEmpty=*/true);
+
+        SmallVector<int64_t> dimSizes;
+        for (auto dimToken : dimTokens) {
+            int64_t size = 0;
+            VPUX_THROW_WHEN(dimToken.trim().getAsInteger(10, size) || size <= 0,
+                            "Invalid shape bucket size '{0}' in '{1}'", token, bucketSizes);
+            dimSizes.push_back(size);
+        }
+        VPUX_THROW_WHEN(!buckets.empty() && buckets.front().size() != dimSizes.size(),
+                        "Shape buckets in '{0}' have different number of dimensions", bucketSizes);
+        buckets.push_back(std::move(dimSizes));
+    }
+
+    llvm::sort(buckets);
+    buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+    return buckets;
+}
+
+std::vector<uint8_t> vpux::packShapeBuckets(const ShapeBuckets& shapeBuckets) {
+    const auto& buckets = shapeBuckets.buckets;
+    VPUX_THROW_WHEN(buckets.empty(), "No shape buckets to pack");
+    const auto& primary = buckets.back();
+
+    ShapeBucketsHeader header;
+    header.numBuckets = buckets.size();
+    header.numDynamicDims = primary.dimSizes.size();
+
+    SmallVector<int64_t> dimSizes;
+    for (const auto& bucket : buckets) {
+        VPUX_THROW_WHEN(bucket.dimSizes.size() != header.numDynamicDims || bucket.blob.empty(),
+                        "Invalid shape bucket {0}", bucket.dimSizes);
+        const auto isServedByPrimary = llvm::all_of(zip(bucket.dimSizes, primary.dimSizes), [](const auto& sizes) {
+            return std::get<0>(sizes) <= std::get<1>(sizes);
+        });
+        VPUX_THROW_UNLESS(isServedByPrimary, "Shape bucket {0} is larger than the primary bucket {1}",
+                          bucket.dimSizes, primary.dimSizes);
+        dimSizes.append(bucket.dimSizes.begin(), bucket.dimSizes.end());
+    }
+
+    const auto headerOffset = alignValUp<uint64_t>(primary.blob.size(), SHAPE_BUCKETS_BLOB_ALIGNMENT);
+    uint64_t offset = headerOffset + sizeof(ShapeBucketsHeader) + buckets.size() * sizeof(ShapeBucketEntry) +
+                      dimSizes.size() * sizeof(int64_t);
+    if (!shapeBuckets.sharedWeights.empty()) {
+        header.weightsOffset = alignValUp(offset, SHAPE_BUCKETS_BLOB_ALIGNMENT);
+        header.weightsSize = shapeBuckets.sharedWeights.size();
+        offset = header.weightsOffset + header.weightsSize;
+    }
+
+    SmallVector<ShapeBucketEntry> entries;
+    for (const auto& bucket : ArrayRef(buckets).drop_back()) {
+        offset = alignValUp(offset, SHAPE_BUCKETS_BLOB_ALIGNMENT);
+        entries.push_back(ShapeBucketEntry{offset, bucket.blob.size()});
+        offset += bucket.blob.size();
+    }
+    entries.push_back(ShapeBucketEntry{0, primary.blob.size()});
+
+    ShapeBucketsFooter footer;
+    footer.headerOffset = headerOffset;
+
+    std::vector<uint8_t> container(offset + sizeof(ShapeBucketsFooter), 0);
+    auto dst = container.data() + headerOffset;
+    std::memcpy(dst, &header, sizeof(header));
+    dst += sizeof(header);
+    std::memcpy(dst, entries.data(), entries.size() * sizeof(ShapeBucketEntry));
+    dst += entries.size() * sizeof(ShapeBucketEntry);
+    std::memcpy(dst, dimSizes.data(), dimSizes.size() * sizeof(int64_t));
+    std::copy(shapeBuckets.sharedWeights.begin(), shapeBuckets.sharedWeights.end(),
+              container.begin() + header.weightsOffset);
+    for (const auto& [entry, bucket] : zip(entries, buckets)) {
+        std::memcpy(container.data() + entry.offset, bucket.blob.data(), bucket.blob.size());
+    }
+    std::memcpy(container.data() + offset, &footer, sizeof(footer));
+    return container;
+}
+
+namespace {
+
+std::optional<ShapeBucketsFooter> getShapeBucketsFooter(ArrayRef<uint8_t> blob) {
+    if (blob.size() < sizeof(ShapeBucketsFooter) + sizeof(ShapeBucketsHeader)) {
+        return std::nullopt;
+    }
+    ShapeBucketsFooter footer;
+    std::memcpy(&footer, blob.data() + blob.size() - sizeof(footer), sizeof(footer));
+    const auto maxHeaderOffset = blob.size() - sizeof(ShapeBucketsFooter) - sizeof(ShapeBucketsHeader);
+    if (footer.magic != ShapeBucketsHeader::MAGIC || footer.headerOffset > maxHeaderOffset) {
+        return std::nullopt;
+    }
+    return footer;
+}
+
+}  // namespace
+
+bool vpux::isShapeBucketsBlob(ArrayRef<uint8_t> blob) {
+    const auto footer = getShapeBucketsFooter(blob);
+    if (!footer.has_value()) {
+        return false;
+    }
+    ShapeBucketsHeader header;
+    std::memcpy(&header, blob.data() + footer->headerOffset, sizeof(header));
+    return header.magic == ShapeBucketsHeader::MAGIC;
+}
+
+ShapeBuckets vpux::unpackShapeBuckets(ArrayRef<uint8_t> blob) {
+    VPUX_THROW_UNLESS(isShapeBucketsBlob(blob), "The blob is not a shape buckets container");
+
+    const auto headerOffset = getShapeBucketsFooter(blob)->headerOffset;
+    ShapeBucketsHeader header;
+    std::memcpy(&header, blob.data() + headerOffset, sizeof(header));
+    VPUX_THROW_UNLESS(header.version == ShapeBucketsHeader::VERSION, "Unsupported shape buckets version {0}",
+                      header.version);
+
+    // Both counts come from the blob, bound them by the available bytes before multiplying
+    const auto tableSize = blob.size() - sizeof(ShapeBucketsFooter) - headerOffset - sizeof(header);
+    VPUX_THROW_WHEN(header.numDynamicDims == 0 || header.numDynamicDims > tableSize / sizeof(int64_t),
+                    "Corrupted shape buckets container, {0} dynamic dimensions in {1} bytes", header.numDynamicDims,
+                    blob.size());
+    const auto bucketRecordSize = sizeof(ShapeBucketEntry) + header.numDynamicDims * sizeof(int64_t);
+    VPUX_THROW_WHEN(header.numBuckets == 0 || header.numBuckets > tableSize / bucketRecordSize,
+                    "Corrupted shape buckets container, {0} buckets in {1} bytes", header.numBuckets, blob.size());
+    VPUX_THROW_WHEN(header.weightsOffset > blob.size() || header.weightsSize > blob.size() - header.weightsOffset,
+                    "Shared weights are out of the container bounds");
+
+    SmallVector<ShapeBucketEntry> entries(header.numBuckets);
+    const auto entriesPtr = blob.data() + headerOffset + sizeof(header);
+    std::memcpy(entries.data(), entriesPtr, entries.size() * sizeof(ShapeBucketEntry));
+
+    SmallVector<int64_t> dimSizes(header.numBuckets * header.numDynamicDims);
+    const auto dimSizesPtr = entriesPtr + entries.size() * sizeof(ShapeBucketEntry);
+    std::memcpy(dimSizes.data(), dimSizesPtr, dimSizes.size() * sizeof(int64_t));
+
+    ShapeBuckets shapeBuckets;
+    shapeBuckets.sharedWeights = blob.slice(header.weightsOffset, header.weightsSize);
+    shapeBuckets.buckets.reserve(entries.size());
+    for (const auto& [bucketIdx, entry] : entries | indexed) {
+        const auto bucketDims =
+                ArrayRef<int64_t>(dimSizes).slice(bucketIdx * header.numDynamicDims, header.numDynamicDims);
+        VPUX_THROW_WHEN(entry.offset > blob.size() || entry.size > blob.size() - entry.offset,
+                        "Shape bucket {0} is out of the container bounds", bucketDims);
+        shapeBuckets.buckets.push_back(ShapeBucket{to_small_vector(bucketDims), blob.slice(entry.offset, entry.size)});
+    }
+    VPUX_THROW_UNLESS(entries.back().offset == 0, "The primary shape bucket must start the container");
+    return shapeBuckets;
+}
+
+std::optional<size_t> vpux::findShapeBucket(ArrayRef<ShapeBucket> buckets, ArrayRef<int64_t> dimSizes) {
+    std::optional<size_t> bestIdx;
+    int64_t bestNumElements = 0;
+    for (const auto& [bucketIdx, bucket] : buckets | indexed) {
+        VPUX_THROW_UNLESS(bucket.dimSizes.size() == dimSizes.size(), "Expected {0} dynamic dimensions, got {1}",
+                          bucket.dimSizes.size(), dimSizes.size());
+        const auto fits = llvm::all_of(zip(bucket.dimSizes, dimSizes), [](const auto& sizes) {
+            return std::get<1>(sizes) <= std::get<0>(sizes);
+        });
+        if (!fits) {
+            continue;
+        }
+
+        const auto numElements = std::accumulate(bucket.dimSizes.begin(), bucket.dimSizes.end(), int64_t(1),
+                                                 std::multiplies<int64_t>());
+        if (!bestIdx.has_value() || numElements < bestNumElements) {
+            bestIdx = bucketIdx;
+            bestNumElements = numElements;
+        }
+    }
+    return bestIdx;
+}
@@ -23,7 +23,7 @@ extern "C" {
 #endif
 
 #define VCL_COMPILER_VERSION_MAJOR 6
-#define VCL_COMPILER_VERSION_MINOR 1
+#define VCL_COMPILER_VERSION_MINOR 3
 #define VCL_PROFILING_VERSION_MAJOR 2
 #define VCL_PROFILING_VERSION_MINOR 0
 
@@ -245,6 +245,41 @@ VCL_APIEXPORT vcl_result_t VCL_APICALL vclAllocatedExecutableCreate(vcl_compiler
                                                                     vcl_allocator_t const* allocator,
                                                                     uint8_t** blobBuffer, uint64_t* blobSize);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Sink of the compiled blob, receives consecutive parts of the blob in order.
+typedef struct __vcl_blob_stream_t {
+    /// Called for each part of the blob, any result other than VCL_RESULT_SUCCESS stops the export
+    vcl_result_t (*write)(void* userData, const uint8_t* data, uint64_t size);
+    void* userData;      ///< Passed back to each write call unchanged
+    uint64_t chunkSize;  ///< Maximum size of a single part, 0 passes the whole blob in a single call
+} vcl_blob_stream_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Compiles the network and passes the blob to the given stream, e.g. to write it to a file or socket.
+/// The blob storage is owned by the compiler and released right after the last write call.
+/// If a write call fails, the export stops and its result is returned.
+VCL_APIEXPORT vcl_result_t VCL_APICALL vclStreamedExecutableCreate(vcl_compiler_handle_t compiler,
+                                                                   vcl_executable_desc_t desc,
+                                                                   vcl_blob_stream_t const* stream);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Performance of the network predicted at compile time.
+/// Utilization of an engine is the ratio of its busy cycles to the latency.
+typedef struct __vcl_predicted_performance_t {
+    uint64_t latencyCycles;    ///< Predicted inference latency
+    uint64_t dmaBusyCycles;    ///< Cycles when at least one DMA engine is busy
+    uint64_t dpuBusyCycles;    ///< Cycles when at least one DPU is busy
+    uint64_t shaveBusyCycles;  ///< Cycles when at least one SHAVE is busy
+    double frequencyMHz;       ///< Frequency of the clock counting the cycles
+} vcl_predicted_performance_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Reads the performance predicted by the compiler from the blob without executing it.
+/// Returns VCL_RESULT_ERROR_INVALID_ARGUMENT if the blob was compiled without the prediction.
+VCL_APIEXPORT vcl_result_t VCL_APICALL vclGetPredictedPerformance(vcl_compiler_handle_t compiler,
+                                                                  const uint8_t* blobData, uint64_t blobSize,
+                                                                  vcl_predicted_performance_t* performance);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Destroys the executable and releases the cached blob.
 VCL_APIEXPORT vcl_result_t VCL_APICALL vclExecutableDestroy(vcl_executable_handle_t executable);
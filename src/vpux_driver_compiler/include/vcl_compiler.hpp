@@ -87,6 +87,16 @@ public:
      */
     vpux::NetworkDescriptionView importNetwork(BuildInfo& buildInfo, const vcl_allocator_t* allocator);
 
+    /**
+     * @brief Use VPUX MLIR compiler to create blob with user info
+     * @note Blob is passed to the stream in chunks and released once the last chunk is written
+     *
+     * @param buildInfo Include the model data, ioInfo, compilation configs
+     * @param stream The sink of the blob data
+     * @return vcl_result_t The result of the first failed write of the stream, VCL_RESULT_SUCCESS otherwise
+     */
+    vcl_result_t importNetwork(BuildInfo& buildInfo, const vcl_blob_stream_t* stream);
+
     /**
      * @brief Check if a model can be supported by current compiler
      *
@@ -96,7 +106,28 @@ public:
      */
     vcl_result_t queryNetwork(const BuildInfo& buildInfo, VPUXQueryNetworkL0* pQueryNetwork);
 
+    /**
+     * @brief Read the performance predicted by compiler from the blob
+     *
+     * @param blobData The compiled blob
+     * @param blobSize Size of the blob in bytes
+     * @param performance The predicted latency and busy cycles of each engine
+     * @return vcl_result_t
+     */
+    vcl_result_t getPredictedPerformance(const uint8_t* blobData, uint64_t blobSize,
+                                         vcl_predicted_performance_t* performance) const;
+
 private:
+    /**
+     * @brief Use VPUX MLIR compiler to create blob with user info
+     * @note Blob storage is allocated via given allocator, the final ELF is written only once
+     *
+     * @param buildInfo Include the model data, ioInfo, compilation configs
+     * @param allocator Allocator for blob storage allocation
+     * @return vpux::NetworkDescriptionView Include non-owning view into blob and metadata
+     */
+    vpux::NetworkDescriptionView importNetwork(BuildInfo& buildInfo, vpux::BlobAllocator& allocator);
+
     std::shared_ptr<intel_npu::OptionsDesc> _options;  ///< The default compilation configs
     std::unique_ptr<vpux::CompilerImpl> _compiler;     ///< The handle of MLIR compiler
     vcl_compiler_properties_t _compilerProp;           ///< The capabilities of compiler
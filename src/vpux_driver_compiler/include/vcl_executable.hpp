@@ -10,9 +10,9 @@
 
 #pragma once
 
-#include "vcl_common.hpp"
+#include <memory>
 
-using intel_npu::NetworkDescription;
+#include "vcl_common.hpp"
 
 namespace VPUXDriverCompiler {
 
@@ -22,8 +22,7 @@ namespace VPUXDriverCompiler {
  */
 class VPUXExecutableL0 final {
 public:
-    VPUXExecutableL0(const std::shared_ptr<const NetworkDescription>& networkDesc, bool enableProfiling,
-                     VCLLogger* vclLogger);
+    VPUXExecutableL0(std::unique_ptr<uint8_t[]> blob, uint64_t blobSize, bool enableProfiling, VCLLogger* vclLogger);
     /**
      * @brief Get compiled blob from net description
      *
@@ -53,8 +52,9 @@ public:
     }
 
 private:
-    std::shared_ptr<const NetworkDescription> _networkDesc;  ///< The compilation result of MLIR compiler
-    bool enableProfiling;                                    ///< Calc time cost on VCL level
+    std::unique_ptr<uint8_t[]> _blob;  ///< The blob serialized by MLIR compiler
+    uint64_t _blobSize;                ///< The size of the blob
+    bool enableProfiling;              ///< Calc time cost on VCL level
     VCLLogger* _logger;
 };
 
@@ -16,8 +16,51 @@
 
 #include "intel_npu/al/config/compiler.hpp"
 
+#include <functional>
+
 using namespace vpux;
 
+namespace {
+
+/**
+ * @brief Parse the build flags and the model of the descriptor, then compile them with the given callable
+ * @return result of the callable, VCL_RESULT_ERROR_INVALID_ARGUMENT if the compilation throws
+ */
+vcl_result_t compileExecutable(VPUXDriverCompiler::VPUXCompilerL0* pCompiler, const vcl_executable_desc_t& desc,
+                               const std::function<vcl_result_t(VPUXDriverCompiler::BuildInfo&)>& compile) {
+    VPUXDriverCompiler::VCLLogger* vclLogger = pCompiler->getLogger();
+
+    /// To avoid access violation, need to convert to string
+    std::string descOptions(desc.options, desc.optionsSize);
+    vclLogger->info("config: {0}", descOptions);
+
+    /// Create info parser
+    VPUXDriverCompiler::BuildInfo buildInfo(pCompiler);
+    /// Parse user descriptions and store the input && output settings, compilation configs
+    if (auto ret = buildInfo.prepareBuildFlags(descOptions); ret != VCL_RESULT_SUCCESS) {
+        vclLogger->outputError(formatv("Failed to prepare io info and config! DescOptions: {0}", descOptions));
+        return ret;
+    }
+
+    /// Parse serialized model data and create the model container for compiler
+    if (auto ret = buildInfo.prepareModel(desc.modelIRData, desc.modelIRSize); ret != VCL_RESULT_SUCCESS) {
+        vclLogger->outputError("Failed to parse model info! Incorrect format!");
+        return ret;
+    }
+
+    try {
+        return compile(buildInfo);
+    } catch (const std::exception& error) {
+        vclLogger->outputError(error.what());
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+    } catch (...) {
+        vclLogger->outputError("Internal exception! Can't compile model!");
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+}
+
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -267,41 +310,36 @@ DLLEXPORT vcl_result_t vclAllocatedExecutableCreate(vcl_compiler_handle_t compil
     }
 
     VPUXDriverCompiler::VPUXCompilerL0* pCompiler = reinterpret_cast<VPUXDriverCompiler::VPUXCompilerL0*>(compiler);
-    VPUXDriverCompiler::VCLLogger* vclLogger = pCompiler->getLogger();
-
-    /// To avoid access violation, need to convert to string
-    std::string descOptions(desc.options, desc.optionsSize);
-    vclLogger->info("config: {0}", descOptions);
-
-    /// Create info parser
-    VPUXDriverCompiler::BuildInfo buildInfo(pCompiler);
-    /// Parse user descriptions and store the input && output settings, compilation configs
-    if (auto ret = buildInfo.prepareBuildFlags(descOptions); ret != VCL_RESULT_SUCCESS) {
-        vclLogger->outputError(formatv("Failed to prepare io info and config! DescOptions: {0}", descOptions));
-        return ret;
-    }
-
-    /// Parse serialized model data and create the model container for compiler
-    if (auto ret = buildInfo.prepareModel(desc.modelIRData, desc.modelIRSize); ret != VCL_RESULT_SUCCESS) {
-        vclLogger->outputError("Failed to parse model info! Incorrect format!");
-        return ret;
-    }
-
-    try {
+    return compileExecutable(pCompiler, desc, [&](VPUXDriverCompiler::BuildInfo& buildInfo) {
         // NetworkMetadata is part of the result, but unused in VCL
         // it'd just get destroyed at function call here
         auto result = pCompiler->importNetwork(buildInfo, allocator);
         blobResult = result.compiledNetwork.ptr;
         sizeResult = result.compiledNetwork.size;
-    } catch (const std::exception& error) {
-        vclLogger->outputError(error.what());
+        return VCL_RESULT_SUCCESS;
+    });
+}
+
+DLLEXPORT vcl_result_t vclStreamedExecutableCreate(vcl_compiler_handle_t compiler, vcl_executable_desc_t desc,
+                                                   vcl_blob_stream_t const* stream) {
+    if (!compiler || !stream || !stream->write || !desc.modelIRData) {
         return VCL_RESULT_ERROR_INVALID_ARGUMENT;
-    } catch (...) {
-        vclLogger->outputError("Internal exception! Can't compile model!");
+    }
+
+    VPUXDriverCompiler::VPUXCompilerL0* pCompiler = reinterpret_cast<VPUXDriverCompiler::VPUXCompilerL0*>(compiler);
+    return compileExecutable(pCompiler, desc, [&](VPUXDriverCompiler::BuildInfo& buildInfo) {
+        return pCompiler->importNetwork(buildInfo, stream);
+    });
+}
+
+DLLEXPORT vcl_result_t vclGetPredictedPerformance(vcl_compiler_handle_t compiler, const uint8_t* blobData,
+                                                  uint64_t blobSize, vcl_predicted_performance_t* performance) {
+    if (!compiler || !blobData || !blobSize || !performance) {
         return VCL_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    return VCL_RESULT_SUCCESS;
+    VPUXDriverCompiler::VPUXCompilerL0* pCompiler = reinterpret_cast<VPUXDriverCompiler::VPUXCompilerL0*>(compiler);
+    return pCompiler->getPredictedPerformance(blobData, blobSize, performance);
 }
 
 DLLEXPORT vcl_result_t vclExecutableGetSerializableBlob(vcl_executable_handle_t executable, uint8_t* blobBuffer,
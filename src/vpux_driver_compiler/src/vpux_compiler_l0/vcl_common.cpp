@@ -13,6 +13,12 @@
 #include <unordered_set>
 #include <utility>
 
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/Support/FormatVariadic.h>
+#include <llvm/Support/xxhash.h>
+#include <openvino/frontend/manager.hpp>
+#include <openvino/runtime/shared_buffer.hpp>
+
 #include "intel_npu/al/config/compiler.hpp"
 #include "npu_driver_compiler.h"
 #include "vcl_compiler.hpp"
@@ -40,6 +46,104 @@ constexpr std::string_view VALUE_DELIMITER = "\"";  // marks beginning and end o
 const std::unordered_set<std::string> SUPPORTED_LAYOUTS = {"NCDHW", "NDHWC", "NCHW", "NHWC",      "CHW",
                                                            "HWC",   "NC",    "C",    "**SCALAR**"};
 
+/**
+ * @brief Read-only stream buffer over the memory provided by driver, lets the IR frontend parse the xml in place
+ */
+class MemoryStreamBuffer final : public std::streambuf {
+public:
+    MemoryStreamBuffer(const uint8_t* data, uint64_t size) {
+        auto begin = const_cast<char*>(reinterpret_cast<const char*>(data));
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type offset, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        char* base = eback();
+        if (dir == std::ios_base::cur) {
+            base = gptr();
+        } else if (dir == std::ios_base::end) {
+            base = egptr();
+        }
+        char* target = base + offset;
+        if (target < eback() || target > egptr()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), target, egptr());
+        return pos_type(target - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+/**
+ * @brief Check whether the xml is of IR v10, which needs the legacy post-processing of ov::Core::read_model
+ */
+bool isIRv10(std::string_view xml) {
+    const auto netPos = xml.find("<net");
+    if (netPos == std::string_view::npos) {
+        return false;
+    }
+    const auto netTag = xml.substr(netPos, xml.find('>', netPos) - netPos);
+    return netTag.find("version=\"10\"") != std::string_view::npos;
+}
+
+/**
+ * @brief Deserialize the model directly from the driver buffers, neither xml nor weights are copied
+ * @details ov::Core::read_model only accepts the xml as std::string. VCL registers no extensions in its
+ * ov::Core, so the frontend gives the same model, except for IR v10 which is still read by ov::Core
+ *
+ * @param xml The pointer to model xml
+ * @param xmlSize The size of model xml
+ * @param weights The pointer to model weights, can be empty
+ * @param weightsSize The size of model weights
+ */
+std::shared_ptr<ov::Model> readModelInPlace(const uint8_t* xml, uint64_t xmlSize, const uint8_t* weights,
+                                            uint64_t weightsSize) {
+    const std::string_view xmlView(reinterpret_cast<const char*>(xml), xmlSize);
+    if (isIRv10(xmlView)) {
+        ov::Tensor weightsTensor;
+        if (weightsSize > 0) {
+            weightsTensor = ov::Tensor(ov::element::u8, {weightsSize}, const_cast<uint8_t*>(weights));
+        }
+        ov::Core core;
+        return core.read_model(std::string(xmlView), weightsTensor);
+    }
+
+    MemoryStreamBuffer xmlBuffer(xml, xmlSize);
+    std::istream xmlStream(&xmlBuffer);
+
+    ov::AnyVector params{&xmlStream};
+    if (weightsSize > 0) {
+        /// The weights are owned by driver and outlive the compilation, no need to hold any extra reference
+        std::shared_ptr<ov::AlignedBuffer> weightsBuffer = std::make_shared<ov::SharedBuffer<std::nullptr_t>>(
+                const_cast<char*>(reinterpret_cast<const char*>(weights)), weightsSize, nullptr);
+        params.emplace_back(weightsBuffer);
+    }
+
+    ov::frontend::FrontEndManager manager;
+    auto frontEnd = manager.load_by_model(params);
+    OPENVINO_ASSERT(frontEnd != nullptr, "Failed to find a frontend for the model");
+    auto inputModel = frontEnd->load(params);
+    OPENVINO_ASSERT(inputModel != nullptr, "Failed to load the model by frontend ", frontEnd->get_name());
+    return frontEnd->convert(inputModel);
+}
+
+/**
+ * @brief Calculate the identity of model content, which covers both topology and weights
+ *
+ * @return The hex string of the XXH3 hashes of xml and weights
+ */
+std::string computeModelIdentity(const uint8_t* xml, uint64_t xmlSize, const uint8_t* weights, uint64_t weightsSize) {
+    const uint64_t xmlHash = llvm::xxh3_64bits(llvm::ArrayRef<uint8_t>(xml, xmlSize));
+    const uint64_t weightsHash = llvm::xxh3_64bits(llvm::ArrayRef<uint8_t>(weights, weightsSize));
+    return llvm::formatv("{0:x-16}{1:x-16}", xmlHash, weightsHash).str();
+}
+
 }  // namespace
 
 using namespace vpux;
@@ -518,23 +622,23 @@ vcl_result_t BuildInfo::prepareModel(const uint8_t* modelIR, uint64_t modelIRSiz
     const uint8_t* buffer = modelIR + bufferOffset;
     /// The pointer to model weight
     const uint8_t* weights = modelIR + weightsOffset;
-    /// Deserialize the model
-    size_t modelHash;
-    try {
-        std::string modelData(buffer, buffer + bufferSize);
-        modelHash = std::hash<std::string>()(modelData);
 
-        ov::Tensor weightsTensor;
-        if (weightsSize > 0)
-            weightsTensor = ov::Tensor(ov::element::u8, {weightsSize}, const_cast<uint8_t*>(weights));
-        ov::Core core;
+    /// Hash of the model topology, keep the value of std::hash<std::string> since the pre-configured strategies are
+    /// keyed by it. std::hash<std::string_view> is guaranteed to give the same result without copying the xml.
+    const std::string_view modelView(reinterpret_cast<const char*>(buffer), bufferSize);
+    const size_t modelHash = std::hash<std::string_view>()(modelView);
+    /// Identity of the model content, covers both topology and weights
+    const std::string modelIdentity = computeModelIdentity(buffer, bufferSize, weights, weightsSize);
+    logger->debug("Model hash: {0}, model identity: {1}", modelHash, modelIdentity);
 
+    /// Deserialize the model
+    try {
         StopWatch stopWatch;
         if (enableProfiling) {
             stopWatch.start();
         }
 
-        model = core.read_model(modelData, weightsTensor);
+        model = readModelInPlace(buffer, bufferSize, weights, weightsSize);
 
         if (enableProfiling) {
             stopWatch.stop();
@@ -548,7 +652,7 @@ vcl_result_t BuildInfo::prepareModel(const uint8_t* modelIR, uint64_t modelIRSiz
         return VCL_RESULT_ERROR_UNKNOWN;
     }
 
-    const std::string hashOption = "model-hash=" + std::to_string(modelHash);
+    const std::string hashOption = "model-hash=" + std::to_string(modelHash) + " model-identity=" + modelIdentity;
     std::string compilationOptions = hashOption;
     if (parsedConfig.has<intel_npu::COMPILATION_MODE_PARAMS>()) {
         const auto existingOptions = parsedConfig.get<intel_npu::COMPILATION_MODE_PARAMS>();
@@ -7,6 +7,8 @@
 #include "vcl_executable.hpp"
 #include "vcl_query_network.hpp"
 
+#include <algorithm>
+
 #include <openvino/openvino.hpp>
 #include <openvino/util/file_util.hpp>
 #include <transformations/utils/utils.hpp>
@@ -16,6 +18,7 @@
 #include "intel_npu/al/config/runtime.hpp"
 #include "npu_private_properties.hpp"
 #include "vpux/compiler/compiler.hpp"
+#include "vpux/utils/core/error.hpp"
 
 #define xstr(s) str(s)
 #define str(s) #s
@@ -144,47 +147,49 @@ VPUXCompilerL0::VPUXCompilerL0(vcl_compiler_desc_t desc, const std::map<std::str
     _compilerProp.supportedOpsets = _compiler->getSupportedOpsetVersion();
 }
 
-std::pair<VPUXExecutableL0*, vcl_result_t> VPUXCompilerL0::importNetwork(BuildInfo& buildInfo) {
-    std::shared_ptr<ov::Model> model = buildInfo.model;
-    VPUXExecutableL0* exe = nullptr;
-    StopWatch stopWatch;
-    if (buildInfo.enableProfiling) {
-        // Output time cost on vcl level
-        stopWatch.start();
+namespace {
+
+class VCLBlobAllocator : public BlobAllocator {
+public:
+    explicit VCLBlobAllocator(const vcl_allocator_t* driverAllocator): allocator(driverAllocator) {
+    }
+    uint8_t* allocate(Byte size) override {
+        return allocator->allocate(static_cast<uint64_t>(size.count()));
+    }
+    void deallocate(uint8_t* ptr) override {
+        allocator->deallocate(ptr);
     }
-    try {
-        bool isNewAPI = false;
-        int64_t irVersion = OLDEST_IR_VERSION_SUPPORTED;
-        bool useIndices = false;
-
-        ov::RTMap& runtimeInfoMap = model->get_rt_info();
-        const auto& isNewAPIMatch = runtimeInfoMap.find("is_new_api");
-        if (isNewAPIMatch != runtimeInfoMap.end()) {
-            isNewAPI = isNewAPIMatch->second.as<bool>();
-        }
 
-        const auto& irVersionMatch = runtimeInfoMap.find("version");
-        if (irVersionMatch != runtimeInfoMap.end()) {
-            irVersion = irVersionMatch->second.as<int64_t>();
-        }
+private:
+    const vcl_allocator_t* allocator;
+};
 
-        const auto& useIndicesMatch = runtimeInfoMap.find("use_indices_for_io_metadata");
-        if (useIndicesMatch != runtimeInfoMap.end()) {
-            useIndices = useIndicesMatch->second.as<bool>();
-        }
+/**
+ * @brief Allocate blob storage owned by the compiler, the result shall be released with delete[]
+ * @note Unlike std::vector the storage is not zero-initialized before ELF is serialized into it
+ */
+class HostBlobAllocator : public BlobAllocator {
+public:
+    uint8_t* allocate(Byte size) override {
+        return new uint8_t[static_cast<size_t>(size.count())];
+    }
+    void deallocate(uint8_t* ptr) override {
+        delete[] ptr;
+    }
+};
 
-        if (!isNewAPI || irVersion < 11) {
-            model = preprocessModel(model, buildInfo.inputPrecisions, buildInfo.outputPrecisions,
-                                    buildInfo.inputLayouts, buildInfo.outputLayouts, useIndices);
-        }
+}  // namespace
 
-        // Call compiler to compile the model and create blob
-        // Create executable with the result NetworkDescription, profiling option and logger
-        // Note we rely on implicit move semantics thanks to compile result being an rvalue,
-        // failure to move here would lead to a blob copy!
-        auto network = std::make_shared<const NetworkDescription>(_compiler->compile(model, buildInfo.parsedConfig));
+std::pair<VPUXExecutableL0*, vcl_result_t> VPUXCompilerL0::importNetwork(BuildInfo& buildInfo) {
+    VPUXExecutableL0* exe = nullptr;
+    try {
+        // Serialize the blob directly into the storage owned by executable
+        HostBlobAllocator hostAllocator;
+        auto network = importNetwork(buildInfo, hostAllocator);
+        std::unique_ptr<uint8_t[]> blob(network.compiledNetwork.ptr);
 
-        exe = new VPUXExecutableL0(network, buildInfo.enableProfiling, _logger);
+        // Create executable with the result blob, profiling option and logger
+        exe = new VPUXExecutableL0(std::move(blob), network.compiledNetwork.size, buildInfo.enableProfiling, _logger);
     } catch (const std::exception& error) {
         _logger->outputError(formatv("{0}", error.what()));
         return std::pair<VPUXExecutableL0*, vcl_result_t>(nullptr, VCL_RESULT_ERROR_INVALID_ARGUMENT);
@@ -193,34 +198,45 @@ std::pair<VPUXExecutableL0*, vcl_result_t> VPUXCompilerL0::importNetwork(BuildIn
         return std::pair<VPUXExecutableL0*, vcl_result_t>(nullptr, VCL_RESULT_ERROR_INVALID_ARGUMENT);
     }
 
-    if (buildInfo.enableProfiling) {
-        stopWatch.stop();
-        _logger->info("Compile net time: {0} ms", stopWatch.delta_ms());
-    }
-
     return std::pair<VPUXExecutableL0*, vcl_result_t>(exe, VCL_RESULT_SUCCESS);
 }
 
-namespace {
+NetworkDescriptionView VPUXCompilerL0::importNetwork(BuildInfo& buildInfo, const vcl_allocator_t* allocator) {
+    auto vclAllocator = VCLBlobAllocator{allocator};
+    return importNetwork(buildInfo, vclAllocator);
+}
 
-class VCLBlobAllocator : public BlobAllocator {
-public:
-    explicit VCLBlobAllocator(const vcl_allocator_t* driverAllocator): allocator(driverAllocator) {
-    }
-    uint8_t* allocate(Byte size) override {
-        return allocator->allocate(static_cast<uint64_t>(size.count()));
-    }
-    void deallocate(uint8_t* ptr) override {
-        allocator->deallocate(ptr);
+vcl_result_t VPUXCompilerL0::importNetwork(BuildInfo& buildInfo, const vcl_blob_stream_t* stream) {
+    HostBlobAllocator hostAllocator;
+    auto network = importNetwork(buildInfo, hostAllocator);
+    // Release the blob as soon as it is passed to the stream
+    std::unique_ptr<uint8_t[]> blob(network.compiledNetwork.ptr);
+    const uint64_t blobSize = network.compiledNetwork.size;
+
+    StopWatch stopWatch;
+    if (buildInfo.enableProfiling) {
+        stopWatch.start();
     }
 
-private:
-    const vcl_allocator_t* allocator;
-};
+    const uint64_t chunkSize = stream->chunkSize != 0 ? stream->chunkSize : blobSize;
+    for (uint64_t offset = 0; offset < blobSize; offset += chunkSize) {
+        const auto size = std::min(chunkSize, blobSize - offset);
+        // The error of the stream is passed to the caller as is, it may be more specific than any VCL result
+        const auto ret = stream->write(stream->userData, blob.get() + offset, size);
+        if (ret != VCL_RESULT_SUCCESS) {
+            _logger->outputError(formatv("Failed to write blob to stream at offset {0}! Result: {1}", offset, ret));
+            return ret;
+        }
+    }
 
-}  // namespace
+    if (buildInfo.enableProfiling) {
+        stopWatch.stop();
+        _logger->info("Stream blob time: {0} ms", stopWatch.delta_ms());
+    }
+    return VCL_RESULT_SUCCESS;
+}
 
-NetworkDescriptionView VPUXCompilerL0::importNetwork(BuildInfo& buildInfo, const vcl_allocator_t* allocator) {
+NetworkDescriptionView VPUXCompilerL0::importNetwork(BuildInfo& buildInfo, BlobAllocator& allocator) {
     StopWatch stopWatch;
     if (buildInfo.enableProfiling) {
         // Output time cost on vcl level
@@ -258,8 +274,8 @@ NetworkDescriptionView VPUXCompilerL0::importNetwork(BuildInfo& buildInfo, const
                                 buildInfo.outputLayouts, useIndices);
     }
 
-    auto vclAllocator = VCLBlobAllocator{allocator};
-    return _compiler->compile(model, buildInfo.parsedConfig, vclAllocator);
+    // All paths, including batching fallback and profiling, serialize the final ELF once into the given storage
+    return _compiler->compile(model, buildInfo.parsedConfig, allocator);
 }
 
 vcl_result_t VPUXCompilerL0::queryNetwork(const BuildInfo& buildInfo, VPUXQueryNetworkL0* pQueryNetwork) {
@@ -281,4 +297,30 @@ vcl_result_t VPUXCompilerL0::queryNetwork(const BuildInfo& buildInfo, VPUXQueryN
     return ret;
 }
 
+vcl_result_t VPUXCompilerL0::getPredictedPerformance(const uint8_t* blobData, uint64_t blobSize,
+                                                     vcl_predicted_performance_t* performance) const {
+    std::optional<vpux::PredictedPerformance> predicted;
+    try {
+        predicted = _compiler->parsePredictedPerformance(vpux::ArrayRef<uint8_t>(blobData, blobSize));
+    } catch (const std::exception& error) {
+        _logger->outputError(error.what());
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+    } catch (...) {
+        _logger->outputError("Failed to parse the blob!");
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (!predicted.has_value()) {
+        _logger->outputError("The blob does not contain predicted performance!");
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    performance->latencyCycles = predicted->latencyCycles;
+    performance->dmaBusyCycles = predicted->dmaBusyCycles;
+    performance->dpuBusyCycles = predicted->dpuBusyCycles;
+    performance->shaveBusyCycles = predicted->shaveBusyCycles;
+    performance->frequencyMHz = predicted->frequencyMHz;
+    return VCL_RESULT_SUCCESS;
+}
+
 }  // namespace VPUXDriverCompiler
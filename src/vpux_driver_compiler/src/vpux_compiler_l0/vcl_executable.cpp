@@ -8,9 +8,9 @@
 using namespace vpux;
 
 namespace VPUXDriverCompiler {
-VPUXExecutableL0::VPUXExecutableL0(const std::shared_ptr<const NetworkDescription>& networkDesc, bool enableProfiling,
+VPUXExecutableL0::VPUXExecutableL0(std::unique_ptr<uint8_t[]> blob, uint64_t blobSize, bool enableProfiling,
                                    VCLLogger* vclLogger)
-        : _networkDesc(networkDesc), enableProfiling(enableProfiling), _logger(vclLogger) {
+        : _blob(std::move(blob)), _blobSize(blobSize), enableProfiling(enableProfiling), _logger(vclLogger) {
 }
 
 vcl_result_t VPUXExecutableL0::serializeNetwork() {
@@ -31,8 +31,7 @@ vcl_result_t VPUXExecutableL0::getNetworkSize(uint64_t* blobSize) const {
         _logger->outputError("Can not return blob size for NULL argument!");
         return VCL_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    const auto& blob = _networkDesc->compiledNetwork;
-    *blobSize = blob.size();
+    *blobSize = _blob != nullptr ? _blobSize : 0;
     if (*blobSize == 0) {
         // The executable handle do not contain a legal network.
         _logger->outputError("No blob created! The compiled network is empty!");
@@ -43,8 +42,7 @@ vcl_result_t VPUXExecutableL0::getNetworkSize(uint64_t* blobSize) const {
 }
 
 vcl_result_t VPUXExecutableL0::exportNetwork(uint8_t* blobOut, uint64_t blobSize) const {
-    const auto& blob = _networkDesc->compiledNetwork;
-    if (!blobOut || blobSize != blob.size()) {
+    if (!blobOut || _blob == nullptr || blobSize != _blobSize) {
         _logger->outputError("Invalid argument to export network");
         return VCL_RESULT_ERROR_INVALID_ARGUMENT;
     }
@@ -53,7 +51,7 @@ vcl_result_t VPUXExecutableL0::exportNetwork(uint8_t* blobOut, uint64_t blobSize
     if (enableProfiling)
         stopWatch.start();
 
-    memcpy(blobOut, blob.data(), blobSize);
+    memcpy(blobOut, _blob.get(), blobSize);
 
     if (enableProfiling) {
         stopWatch.stop();
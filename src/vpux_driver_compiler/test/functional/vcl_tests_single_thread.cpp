@@ -17,6 +17,16 @@ public:
      * @param options Build flags of a model
      */
     vcl_result_t run(const std::string& options);
+
+    /**
+     * @brief Return the blob created by the last successful compilation
+     */
+    const std::vector<uint8_t>& getBlob() const {
+        return blobData;
+    }
+
+private:
+    std::vector<uint8_t> blobData;
 };
 
 vcl_result_t VCLSingleThreadTest::run(const std::string& options) {
@@ -71,6 +81,7 @@ vcl_result_t VCLSingleThreadTest::run(const std::string& options) {
         }
         ret = vclExecutableGetSerializableBlob(executable, blob, &blobSize);
         if (ret == VCL_RESULT_SUCCESS) {
+            blobData.assign(blob, blob + blobSize);
 #ifdef BLOB_DUMP
             const std::string blobName = std::string("output.net");
             std::ofstream bfos(blobName, std::ios::binary);
@@ -108,6 +119,18 @@ TEST_P(VCLSingleThreadTest, compileModel) {
     EXPECT_EQ(run(getNetOptions()), VCL_RESULT_SUCCESS);
 }
 
+TEST_P(VCLSingleThreadTest, compileModelTwiceFromSameBuffer) {
+    /// The model is parsed from the buffer owned by driver, which must stay untouched for the next compilation
+    const std::vector<uint8_t> modelIR = getModelIR();
+    ASSERT_EQ(run(getNetOptions()), VCL_RESULT_SUCCESS);
+    EXPECT_EQ(getModelIR(), modelIR);
+    const std::vector<uint8_t> firstBlob = getBlob();
+
+    /// The same model hash is passed to compiler, so the strategies and the blob are the same
+    ASSERT_EQ(run(getNetOptions()), VCL_RESULT_SUCCESS);
+    EXPECT_EQ(getBlob(), firstBlob);
+}
+
 /// The path of config files for tests
 const auto cidTool = VCLSingleThreadTest::getCidToolPath();
 /// Models and configs for smoke test
@@ -0,0 +1,130 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vcl_tests_common.h"
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+/// Collects the parts of the blob passed by vclStreamedExecutableCreate
+struct BlobSink {
+    std::vector<uint8_t> blob;
+    uint64_t maxPartSize = 0;
+    size_t numWrites = 0;
+    /// Result returned by the write call with this index, the other calls succeed
+    size_t failingWrite = SIZE_MAX;
+    vcl_result_t failure = VCL_RESULT_SUCCESS;
+};
+
+vcl_result_t writeToSink(void* userData, const uint8_t* data, uint64_t size) {
+    auto* sink = static_cast<BlobSink*>(userData);
+    if (sink->numWrites++ == sink->failingWrite) {
+        return sink->failure;
+    }
+    sink->blob.insert(sink->blob.end(), data, data + size);
+    sink->maxPartSize = std::max(sink->maxPartSize, size);
+    return VCL_RESULT_SUCCESS;
+}
+
+}  // namespace
+
+class VCLStreamedExportTest : public VCLTestsUtils::VCLTestsCommon {
+public:
+    void SetUp() override {
+        VCLTestsCommon::SetUp();
+        if (IsSkipped()) {
+            return;
+        }
+        vcl_compiler_desc_t compilerDesc = {VCL_PLATFORM_VPU3720, VCL_LOG_ERROR};
+        ASSERT_EQ(vclCompilerCreate(compilerDesc, &compiler, nullptr), VCL_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        if (compiler != nullptr) {
+            EXPECT_EQ(vclCompilerDestroy(compiler), VCL_RESULT_SUCCESS);
+        }
+    }
+
+    vcl_executable_desc_t getExecutableDesc() {
+        const auto& options = getNetOptions();
+        return {getModelIR().data(), getModelIRSize(), options.c_str(), options.size() + 1};
+    }
+
+    /**
+     * @brief Compile the model with vclExecutableCreate and return its blob
+     */
+    std::vector<uint8_t> compileToExecutable() {
+        std::vector<uint8_t> blob;
+        vcl_executable_handle_t executable = nullptr;
+        if (vclExecutableCreate(compiler, getExecutableDesc(), &executable) != VCL_RESULT_SUCCESS) {
+            std::cerr << "Failed to create executable handle!" << std::endl;
+            return blob;
+        }
+        uint64_t blobSize = 0;
+        if (vclExecutableGetSerializableBlob(executable, nullptr, &blobSize) == VCL_RESULT_SUCCESS) {
+            blob.resize(blobSize);
+            if (vclExecutableGetSerializableBlob(executable, blob.data(), &blobSize) != VCL_RESULT_SUCCESS) {
+                blob.clear();
+            }
+        }
+        vclExecutableDestroy(executable);
+        return blob;
+    }
+
+    vcl_result_t compileToStream(BlobSink& sink, uint64_t chunkSize) {
+        const vcl_blob_stream_t stream = {writeToSink, &sink, chunkSize};
+        return vclStreamedExecutableCreate(compiler, getExecutableDesc(), &stream);
+    }
+
+protected:
+    vcl_compiler_handle_t compiler = nullptr;
+};
+
+TEST_P(VCLStreamedExportTest, streamedBlobMatchesExecutableBlob) {
+    const auto blob = compileToExecutable();
+    ASSERT_FALSE(blob.empty());
+
+    /// The whole blob in a single write call
+    BlobSink wholeSink;
+    ASSERT_EQ(compileToStream(wholeSink, /*chunkSize=*/0), VCL_RESULT_SUCCESS);
+    EXPECT_EQ(wholeSink.numWrites, 1u);
+    EXPECT_EQ(wholeSink.blob, blob);
+
+    /// A chunk size which doesn't divide the blob size, the last part is shorter
+    const uint64_t chunkSize = 4093;
+    BlobSink chunkedSink;
+    ASSERT_EQ(compileToStream(chunkedSink, chunkSize), VCL_RESULT_SUCCESS);
+    EXPECT_EQ(chunkedSink.numWrites, (blob.size() + chunkSize - 1) / chunkSize);
+    EXPECT_LE(chunkedSink.maxPartSize, chunkSize);
+    EXPECT_EQ(chunkedSink.blob, blob);
+}
+
+TEST_P(VCLStreamedExportTest, returnsErrorOfStream) {
+    BlobSink sink;
+    sink.failingWrite = 1;
+    sink.failure = VCL_RESULT_ERROR_OUT_OF_MEMORY;
+    EXPECT_EQ(compileToStream(sink, /*chunkSize=*/64), VCL_RESULT_ERROR_OUT_OF_MEMORY);
+    /// The export stops at the failed write
+    EXPECT_EQ(sink.numWrites, 2u);
+}
+
+TEST_P(VCLStreamedExportTest, rejectsStreamWithoutWrite) {
+    const vcl_blob_stream_t stream = {nullptr, nullptr, 0};
+    EXPECT_EQ(vclStreamedExecutableCreate(compiler, getExecutableDesc(), &stream), VCL_RESULT_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(vclStreamedExecutableCreate(compiler, getExecutableDesc(), nullptr), VCL_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+/// The path of config files for tests
+const auto cidTool = VCLStreamedExportTest::getCidToolPath();
+/// Models and configs for smoke test
+const auto smokeIRInfos = VCLStreamedExportTest::readJson2Vec(cidTool + VCLTestsUtils::SMOKE_TEST_CONFIG);
+/// Params for somke tests
+const auto smokeParams = testing::Combine(testing::ValuesIn(smokeIRInfos));
+
+INSTANTIATE_TEST_SUITE_P(smoke_StreamedExport, VCLStreamedExportTest, smokeParams,
+                         VCLStreamedExportTest::getTestCaseName);
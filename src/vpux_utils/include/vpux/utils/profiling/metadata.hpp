@@ -24,7 +24,7 @@ constexpr uint32_t PROFILING_SECTION_ENCODING = 1;  // Profiling metadata encode
 
 constexpr uint32_t PROFILING_METADATA_VERSION_MAJOR = 2;  // Initial major version of FB schema
 
-constexpr uint32_t PROFILING_METADATA_VERSION_MINOR = 0;  // Initial minor version of FB schema
+constexpr uint32_t PROFILING_METADATA_VERSION_MINOR = 1;  // Task coverage of sampled profiling
 
 // The layout is:
 // +----------------------------+-----------------------
@@ -9,6 +9,7 @@
 
 #include "vpux/utils/core/logger.hpp"
 #include "vpux/utils/profiling/common.hpp"
+#include "vpux/utils/profiling/parser/api.hpp"
 #include "vpux/utils/profiling/parser/device.hpp"
 #include "vpux/utils/profiling/parser/hw.hpp"
 #include "vpux/utils/profiling/taskinfo.hpp"
@@ -20,6 +21,10 @@
 #include <utility>
 #include <vector>
 
+namespace ProfilingFB {
+struct ProfilingMeta;
+}
+
 namespace vpux::profiling {
 
 class RawProfilingRecord;
@@ -45,10 +50,20 @@ struct RawProfilingData {
 // Map of exec. type to section offset and size
 using RawDataLayout = std::map<ExecutorType, std::pair<uint32_t, uint32_t>>;
 
+// Number of instrumented tasks of an engine. Sampled profiling leaves part of the tasks without records
+struct TaskCoverage {
+    uint32_t totalTasks = 0;
+    uint32_t profiledTasks = 0;
+};
+
+// Map of exec. type to its coverage. Empty for blobs compiled before coverage was recorded
+using TaskCoverageMap = std::map<ExecutorType, TaskCoverage>;
+
 struct RawData {
     RawDataLayout sections;
     RawProfilingData rawRecords;
     TargetDevice device;
+    TaskCoverageMap coverage;
 };
 
 /**
@@ -64,6 +79,30 @@ struct RawData {
 RawData getRawProfilingTasks(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
                              bool ignoreSanitizationErrors = false);
 
+/**
+ * @fn getRawProfilingTasks
+ * @brief Parse raw counters using profiling metadata extracted from the blob beforehand
+ * @param profilingSchema profiling metadata, must outlive the returned records
+ * @param profData pointer to the buffer with raw profiling data
+ * @param profSize raw profiling data size
+ * @param ignoreSanitizationErrors to ignore sanitization errors
+ * @return RawData
+ */
+RawData getRawProfilingTasks(const ProfilingFB::ProfilingMeta* profilingSchema, const uint8_t* profData,
+                             size_t profSize, bool ignoreSanitizationErrors = false);
+
+/**
+ * @fn getTaskInfo
+ * @brief Convert parsed raw counters to per-tasks info
+ * @param rawData output from \b getRawProfilingTasks function
+ * @param verbosity amount of DPU info to print, may be LOW|MEDIUM|HIGH
+ * @param fpga whether buffer was obtained from FPGA
+ * @param highFreqPerfClk use the high frequency perf_clk value (NPU40XX only)
+ * @return std::vector of TaskInfo structures
+ */
+std::vector<TaskInfo> getTaskInfo(const RawData& rawData, VerbosityLevel verbosity, bool fpga = false,
+                                  bool highFreqPerfClk = false);
+
 struct FrequenciesSetup {
 public:
     static constexpr double MIN_FREQ_MHZ = 700.0;
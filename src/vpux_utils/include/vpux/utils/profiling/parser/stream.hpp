@@ -0,0 +1,227 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// Continuous profiling: ring buffer of per-inference profiling outputs and its streaming decoder
+
+#pragma once
+
+#include "vpux/utils/profiling/parser/api.hpp"
+#include "vpux/utils/profiling/taskinfo.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+namespace ProfilingFB {
+struct ProfilingMeta;
+}
+
+namespace vpux::profiling {
+
+constexpr uint32_t PROFILING_RING_RECORD_MAGIC = 0x474E5250;  // "PRNG"
+
+enum RingRecordFlags : uint32_t {
+    RING_RECORD_FLAG_NONE = 0,
+    RING_RECORD_FLAG_WRAPAROUND = 1,  ///< Record took the slot of an older one, which is lost
+};
+
+// Every record of the ring starts with this header, followed by payloadSize bytes of raw profiling output
+// +---------------------------------------------------+-----------------------
+// | RingRecordHeader: magic, flags, sequence, size... |  PAYLOAD...
+// +---------------------------------------------------+-----------------------
+struct RingRecordHeader {
+    uint32_t magic;
+    uint32_t flags;        ///< RingRecordFlags
+    uint64_t sequence;     ///< Inference number, starts at 0 and never wraps
+    uint32_t payloadSize;  ///< Size of raw profiling output in bytes
+    uint32_t reserved;
+};
+
+static_assert(sizeof(RingRecordHeader) == 24);
+
+/**
+ * @class ProfilingRingBuffer
+ * @brief Keeps raw profiling outputs of the last K inferences in a storage allocated once
+ */
+class ProfilingRingBuffer final {
+public:
+    /**
+     * @param capacity number of inferences to keep
+     * @param profSize size of raw profiling output of one inference in bytes
+     */
+    ProfilingRingBuffer(size_t capacity, size_t profSize);
+
+    /**
+     * @brief Copy raw profiling output of the next inference, overwriting the oldest one when the ring is full
+     * @return sequence number of the stored record
+     */
+    uint64_t push(const uint8_t* profData, size_t profSize);
+
+    /**
+     * @brief Serialize the kept records with sequence >= fromSequence, oldest first
+     * @return stream of records which can be fed to ProfilingStreamDecoder in chunks of any size
+     */
+    std::vector<uint8_t> read(uint64_t fromSequence = 0) const;
+
+    // Ring storage in its in-memory layout, records are ordered by slot and not by sequence
+    const std::vector<uint8_t>& data() const {
+        return _storage;
+    }
+
+    size_t size() const;
+    size_t capacity() const {
+        return _capacity;
+    }
+    // Sequence number of the oldest kept record, equals nextSequence() for the empty ring
+    uint64_t oldestSequence() const {
+        return _nextSequence - size();
+    }
+    uint64_t nextSequence() const {
+        return _nextSequence;
+    }
+
+private:
+    size_t getRecordStride() const {
+        return sizeof(RingRecordHeader) + _profSize;
+    }
+
+private:
+    size_t _capacity;
+    size_t _profSize;
+    uint64_t _nextSequence = 0;
+    std::vector<uint8_t> _storage;
+};
+
+struct RingRecord {
+    RingRecordHeader header;
+    std::vector<uint8_t> payload;
+};
+
+/**
+ * @class RingRecordReader
+ * @brief Reassembles ring records from a stream split into chunks at arbitrary bytes
+ */
+class RingRecordReader final {
+public:
+    /**
+     * @param profSize expected payload size of every record in bytes
+     */
+    explicit RingRecordReader(size_t profSize);
+
+    /**
+     * @brief Consume the next chunk of the stream
+     * @return records completed by this chunk, the incomplete tail is kept until the next call
+     * @note A corrupted record header (bad magic or payload size) doesn't stop the stream: the reader resyncs to the
+     * next record magic and counts the bytes in between in skippedBytes()
+     */
+    std::vector<RingRecord> feed(const uint8_t* data, size_t size);
+
+    // Bytes of an incomplete record waiting for the rest of the stream
+    size_t pendingBytes() const {
+        return _pending.size();
+    }
+
+    // Bytes dropped while resyncing after corrupted records
+    size_t skippedBytes() const {
+        return _skippedBytes;
+    }
+
+private:
+    size_t findNextMagic(size_t offset) const;
+
+private:
+    size_t _profSize;
+    std::vector<uint8_t> _pending;
+    size_t _consumedBytes = 0;
+    size_t _skippedBytes = 0;
+};
+
+/**
+ * @struct StreamedProfInfo
+ * @brief Per-tasks info of one inference decoded from the ring stream
+ */
+struct StreamedProfInfo {
+    uint64_t sequence;
+    uint64_t lostRecords;  ///< Records overwritten in the ring before they were consumed
+    bool wrapped;          ///< Record was stored after the ring had wrapped around
+    std::vector<TaskInfo> tasks;
+};
+
+/**
+ * @class ProfilingStreamDecoder
+ * @brief Incremental decoder of the ring record stream. Blob metadata is read once, so each record costs only the
+ * parsing of its own raw counters. Chunks may split records at any byte
+ */
+class ProfilingStreamDecoder final {
+public:
+    /**
+     * @param blobData pointer to the buffer with blob binary, must outlive the decoder
+     * @param blobSize blob size in bytes
+     * @param verbosity amount of DPU info to print, may be LOW|MEDIUM|HIGH
+     * @param fpga whether buffer was obtained from FPGA
+     * @param highFreqPerfClk use the high frequency perf_clk value (NPU40XX only)
+     */
+    ProfilingStreamDecoder(const uint8_t* blobData, size_t blobSize, VerbosityLevel verbosity = VerbosityLevel::LOW,
+                           bool fpga = false, bool highFreqPerfClk = false);
+
+    /**
+     * @param profilingSchema already parsed profiling metadata, must outlive the decoder
+     * @param verbosity amount of DPU info to print, may be LOW|MEDIUM|HIGH
+     * @param fpga whether buffer was obtained from FPGA
+     * @param highFreqPerfClk use the high frequency perf_clk value (NPU40XX only)
+     */
+    explicit ProfilingStreamDecoder(const ProfilingFB::ProfilingMeta* profilingSchema,
+                                    VerbosityLevel verbosity = VerbosityLevel::LOW, bool fpga = false,
+                                    bool highFreqPerfClk = false);
+
+    /**
+     * @brief Consume the next chunk of the stream
+     * @return records completed by this chunk, the incomplete tail is kept until the next call
+     * @throws when a record fails to decode. That record is dropped and counted as lost by the next one, the records
+     * decoded before it and the complete records after it are kept and returned by the next call, which may pass an
+     * empty chunk
+     */
+    std::vector<StreamedProfInfo> feed(const uint8_t* data, size_t size);
+
+    // Bytes of an incomplete record waiting for the rest of the stream
+    size_t pendingBytes() const {
+        return _reader.pendingBytes();
+    }
+
+    // Complete records left by a failed feed() call, decoded or not
+    size_t pendingRecords() const {
+        return _decoded.size() + _undecoded.size();
+    }
+
+    // Bytes dropped while resyncing after corrupted records, these records are counted in lostRecords
+    size_t skippedBytes() const {
+        return _reader.skippedBytes();
+    }
+
+    // Size of raw profiling output of one inference, the same for every record of the stream
+    size_t getProfSize() const {
+        return _profSize;
+    }
+
+private:
+    StreamedProfInfo decodeRecord(const RingRecord& record);
+
+private:
+    const ProfilingFB::ProfilingMeta* _profilingSchema;
+    size_t _profSize;
+    VerbosityLevel _verbosity;
+    bool _fpga;
+    bool _highFreqPerfClk;
+
+    RingRecordReader _reader;
+    std::optional<uint64_t> _lastSequence;
+    // Kept across feed() calls when decoding of a record throws
+    std::vector<StreamedProfInfo> _decoded;
+    std::deque<RingRecord> _undecoded;
+};
+
+}  // namespace vpux::profiling
@@ -77,6 +77,21 @@ void printDebugWorkpointsSetup(const RawProfilingData& rawProfData, std::ostream
     outStream.flags(ostreamFlags);
 }
 
+void printDebugCoverage(const TaskCoverageMap& coverage, std::ostream& outStream) {
+    if (coverage.empty()) {
+        return;
+    }
+
+    const auto ostreamFlags = outStream.flags();
+    outStream << std::dec << std::setw(14) << "Engine" << std::setw(10) << "Profiled" << std::setw(10) << "Total"
+              << std::endl;
+    for (const auto& [execType, engineCoverage] : coverage) {
+        outStream << std::setw(14) << convertExecTypeToName(execType) << std::setw(10) << engineCoverage.profiledTasks
+                  << std::setw(10) << engineCoverage.totalTasks << std::endl;
+    }
+    outStream.flags(ostreamFlags);
+}
+
 RawProfilingRecords getTaskOfType(const RawProfilingData& rawRecords, ExecutorType type) {
     switch (type) {
     case ExecutorType::DMA_HW:
@@ -105,4 +120,5 @@ void vpux::profiling::writeDebugProfilingInfo(std::ostream& outStream, const uin
         printDebugProfilingInfoSection(tasks, outStream, typeAndOffset.second);
     }
     printDebugWorkpointsSetup(rawRecords, outStream);
+    printDebugCoverage(rawData.coverage, outStream);
 }
@@ -376,6 +376,31 @@ RawDataLayout getRawDataLayoutFB(const ProfilingFB::ProfilingBuffer* profBuffer,
     return sections;
 }
 
+TaskCoverageMap getTaskCoverageFB(
+        const flatbuffers::Vector<flatbuffers::Offset<ProfilingFB::TaskCoverage>>* coverageMeta) {
+    TaskCoverageMap coverage;
+    if (coverageMeta == nullptr) {
+        return coverage;
+    }
+    for (const auto& engineCoverage : *coverageMeta) {
+        VPUX_THROW_WHEN(engineCoverage->profiledTasks() > engineCoverage->totalTasks(),
+                        "Executor {0} has {1} profiled tasks out of {2}", engineCoverage->type(),
+                        engineCoverage->profiledTasks(), engineCoverage->totalTasks());
+        const auto execType = static_cast<ExecutorType>(engineCoverage->type());
+        coverage[execType] = {engineCoverage->totalTasks(), engineCoverage->profiledTasks()};
+    }
+    return coverage;
+}
+
+void logPartialCoverage(const TaskCoverageMap& coverage, vpux::Logger& log) {
+    for (const auto& [execType, engineCoverage] : coverage) {
+        if (engineCoverage.profiledTasks != engineCoverage.totalTasks) {
+            log.info("Sampled profiling: {0} records cover {1} of {2} tasks", convertExecTypeToName(execType),
+                     engineCoverage.profiledTasks, engineCoverage.totalTasks);
+        }
+    }
+}
+
 RawProfilingRecords makeFakeDpuInvariants(const RawProfilingRecords& variants) {
     RawProfilingRecords invariants;
 
@@ -506,8 +531,17 @@ RawData getRawProfilingTasks(const uint8_t* blobData, size_t blobSize, const uin
         VPUX_THROW("Empty input data");
     }
 
+    return getRawProfilingTasks(getProfilingSectionMeta(blobData, blobSize), profData, profSize,
+                                ignoreSanitizationErrors);
+}
+
+RawData getRawProfilingTasks(const ProfilingFB::ProfilingMeta* profilingDataSchema, const uint8_t* profData,
+                             size_t profSize, bool ignoreSanitizationErrors) {
+    if ((nullptr == profilingDataSchema) || (nullptr == profData)) {
+        VPUX_THROW("Empty input data");
+    }
+
     auto log = vpux::Logger::global();
-    const auto profilingDataSchema = getProfilingSectionMeta(blobData, blobSize);
     auto device = (TargetDevice)profilingDataSchema->platform()->device();
     VPUX_THROW_WHEN(device == TargetDevice::TargetDevice_NONE, "Unknown device");
     log.trace("Using target device {0}", EnumNameTargetDevice(device));
@@ -518,7 +552,7 @@ RawData getRawProfilingTasks(const uint8_t* blobData, size_t blobSize, const uin
     RawProfilingData rawProfData =
             parseProfilingTaskLists(sections, device, profData, profilingDataSchema, log, ignoreSanitizationErrors);
 
-    return {sections, std::move(rawProfData), device};
+    return {sections, std::move(rawProfData), device, getTaskCoverageFB(profilingDataSchema->coverage())};
 }
 
 ProfInfo getProfInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
@@ -528,6 +562,7 @@ ProfInfo getProfInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* pr
     auto log = vpux::Logger::global();
     FrequenciesSetup frequenciesSetup =
             getFrequencySetup(rawData.device, rawData.rawRecords.workpoints, highFreqPerfClk, fpga, log);
+    logPartialCoverage(rawData.coverage, log);
     ProfInfo profInfo;
     profInfo.tasks = convertRawTasksToTaskInfo(rawData.rawRecords, frequenciesSetup, verbosity, log);
     profInfo.layers = getLayerInfo(profInfo.tasks);
@@ -538,14 +573,19 @@ ProfInfo getProfInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* pr
     VPUX_THROW("Profiling post-processing failed. {0}", ex.what());
 }
 
-std::vector<TaskInfo> getTaskInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
-                                  VerbosityLevel verbosity, bool fpga, bool highFreqPerfClk) try {
-    const auto rawData = getRawProfilingTasks(blobData, blobSize, profData, profSize);
-
+std::vector<TaskInfo> getTaskInfo(const RawData& rawData, VerbosityLevel verbosity, bool fpga, bool highFreqPerfClk) {
     auto log = vpux::Logger::global();
     FrequenciesSetup frequenciesSetup =
             getFrequencySetup(rawData.device, rawData.rawRecords.workpoints, highFreqPerfClk, fpga, log);
     return convertRawTasksToTaskInfo(rawData.rawRecords, frequenciesSetup, verbosity, log);
+}
+
+std::vector<TaskInfo> getTaskInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
+                                  VerbosityLevel verbosity, bool fpga, bool highFreqPerfClk) try {
+    const auto rawData = getRawProfilingTasks(blobData, blobSize, profData, profSize);
+    auto log = vpux::Logger::global();
+    logPartialCoverage(rawData.coverage, log);
+    return getTaskInfo(rawData, verbosity, fpga, highFreqPerfClk);
 } catch (const std::exception& ex) {
     VPUX_THROW("Profiling post-processing failed. {0}", ex.what());
 }
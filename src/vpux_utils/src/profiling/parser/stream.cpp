@@ -0,0 +1,183 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/profiling/parser/stream.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/profiling/metadata.hpp"
+#include "vpux/utils/profiling/parser/parser.hpp"
+
+#include "schema/profiling_generated.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+using namespace vpux::profiling;
+
+namespace {
+
+size_t getProfilingBufferSize(const ProfilingFB::ProfilingMeta* profilingSchema) {
+    VPUX_THROW_WHEN(profilingSchema == nullptr, "Empty profiling metadata");
+    const auto* profilingBuffer = profilingSchema->profilingBuffer();
+    VPUX_THROW_WHEN(profilingBuffer == nullptr, "Profiling metadata doesn't describe the profiling buffer");
+    return profilingBuffer->size();
+}
+
+}  // namespace
+
+//
+// ProfilingRingBuffer
+//
+
+ProfilingRingBuffer::ProfilingRingBuffer(size_t capacity, size_t profSize): _capacity(capacity), _profSize(profSize) {
+    VPUX_THROW_WHEN(capacity == 0, "Profiling ring buffer must keep at least one record");
+    VPUX_THROW_WHEN(profSize == 0, "Profiling ring buffer record must not be empty");
+    _storage.resize(_capacity * getRecordStride());
+}
+
+uint64_t ProfilingRingBuffer::push(const uint8_t* profData, size_t profSize) {
+    VPUX_THROW_WHEN(profData == nullptr, "Empty input data");
+    VPUX_THROW_UNLESS(profSize == _profSize, "Profiling output of {0} bytes doesn't fit ring record of {1} bytes",
+                      profSize, _profSize);
+
+    const auto sequence = _nextSequence++;
+    RingRecordHeader header{};
+    header.magic = PROFILING_RING_RECORD_MAGIC;
+    header.flags = sequence >= _capacity ? RING_RECORD_FLAG_WRAPAROUND : RING_RECORD_FLAG_NONE;
+    header.sequence = sequence;
+    header.payloadSize = static_cast<uint32_t>(_profSize);
+
+    auto* slot = _storage.data() + (sequence % _capacity) * getRecordStride();
+    std::memcpy(slot, &header, sizeof(header));
+    std::memcpy(slot + sizeof(header), profData, _profSize);
+    return sequence;
+}
+
+std::vector<uint8_t> ProfilingRingBuffer::read(uint64_t fromSequence) const {
+    const auto firstSequence = std::max(fromSequence, oldestSequence());
+    std::vector<uint8_t> stream;
+    if (firstSequence >= _nextSequence) {
+        return stream;
+    }
+
+    stream.reserve((_nextSequence - firstSequence) * getRecordStride());
+    for (auto sequence = firstSequence; sequence < _nextSequence; ++sequence) {
+        const auto* slot = _storage.data() + (sequence % _capacity) * getRecordStride();
+        stream.insert(stream.end(), slot, slot + getRecordStride());
+    }
+    return stream;
+}
+
+size_t ProfilingRingBuffer::size() const {
+    return static_cast<size_t>(std::min<uint64_t>(_nextSequence, _capacity));
+}
+
+//
+// RingRecordReader
+//
+
+RingRecordReader::RingRecordReader(size_t profSize): _profSize(profSize) {
+}
+
+std::vector<RingRecord> RingRecordReader::feed(const uint8_t* data, size_t size) {
+    VPUX_THROW_WHEN(data == nullptr && size != 0, "Empty input data");
+    _pending.insert(_pending.end(), data, data + size);
+
+    std::vector<RingRecord> records;
+    const auto recordSize = sizeof(RingRecordHeader) + _profSize;
+    size_t offset = 0;
+    while (_pending.size() - offset >= sizeof(RingRecordHeader)) {
+        RingRecord record;
+        std::memcpy(&record.header, _pending.data() + offset, sizeof(RingRecordHeader));
+        if (record.header.magic != PROFILING_RING_RECORD_MAGIC || record.header.payloadSize != _profSize) {
+            // The records up to the next magic are lost, the decoder sees them as a gap in the sequence
+            const auto nextOffset = findNextMagic(offset + 1);
+            vpux::Logger::global().warning("Corrupted profiling ring stream at offset {0}, skipped {1} bytes",
+                                     _consumedBytes + offset, nextOffset - offset);
+            _skippedBytes += nextOffset - offset;
+            offset = nextOffset;
+            continue;
+        }
+        if (_pending.size() - offset < recordSize) {
+            break;
+        }
+
+        const auto payloadBegin = _pending.begin() + offset + sizeof(RingRecordHeader);
+        record.payload.assign(payloadBegin, payloadBegin + _profSize);
+        records.push_back(std::move(record));
+        offset += recordSize;
+    }
+    _pending.erase(_pending.begin(), _pending.begin() + offset);
+    _consumedBytes += offset;
+    return records;
+}
+
+size_t RingRecordReader::findNextMagic(size_t offset) const {
+    constexpr auto magicSize = sizeof(PROFILING_RING_RECORD_MAGIC);
+    for (; offset + magicSize <= _pending.size(); ++offset) {
+        uint32_t magic = 0;
+        std::memcpy(&magic, _pending.data() + offset, magicSize);
+        if (magic == PROFILING_RING_RECORD_MAGIC) {
+            return offset;
+        }
+    }
+    // The tail may hold the beginning of a magic split by the chunk boundary
+    return std::min(offset, _pending.size());
+}
+
+//
+// ProfilingStreamDecoder
+//
+
+ProfilingStreamDecoder::ProfilingStreamDecoder(const uint8_t* blobData, size_t blobSize, VerbosityLevel verbosity,
+                                               bool fpga, bool highFreqPerfClk)
+        : ProfilingStreamDecoder(getProfilingSectionMeta(blobData, blobSize), verbosity, fpga, highFreqPerfClk) {
+}
+
+ProfilingStreamDecoder::ProfilingStreamDecoder(const ProfilingFB::ProfilingMeta* profilingSchema,
+                                               VerbosityLevel verbosity, bool fpga, bool highFreqPerfClk)
+        : _profilingSchema(profilingSchema),
+          _profSize(getProfilingBufferSize(profilingSchema)),
+          _verbosity(verbosity),
+          _fpga(fpga),
+          _highFreqPerfClk(highFreqPerfClk),
+          _reader(_profSize) {
+}
+
+std::vector<StreamedProfInfo> ProfilingStreamDecoder::feed(const uint8_t* data, size_t size) {
+    for (auto& record : _reader.feed(data, size)) {
+        _undecoded.push_back(std::move(record));
+    }
+    while (!_undecoded.empty()) {
+        // The record leaves the queue before decoding, so a broken one is dropped instead of blocking the stream
+        const auto record = std::move(_undecoded.front());
+        _undecoded.pop_front();
+        _decoded.push_back(decodeRecord(record));
+    }
+    return std::exchange(_decoded, {});
+}
+
+StreamedProfInfo ProfilingStreamDecoder::decodeRecord(const RingRecord& record) try {
+    const auto sequence = record.header.sequence;
+    VPUX_THROW_WHEN(_lastSequence.has_value() && sequence <= _lastSequence.value(),
+                    "Profiling ring record {0} follows record {1}", sequence, _lastSequence.value());
+
+    StreamedProfInfo info;
+    info.sequence = sequence;
+    // The first record seen may be preceded by records which were dropped before the stream was attached, these are
+    // not counted as lost
+    info.lostRecords = _lastSequence.has_value() ? sequence - _lastSequence.value() - 1 : 0;
+    info.wrapped = (record.header.flags & RING_RECORD_FLAG_WRAPAROUND) != 0;
+
+    const auto rawData = getRawProfilingTasks(_profilingSchema, record.payload.data(), record.payload.size());
+    info.tasks = getTaskInfo(rawData, _verbosity, _fpga, _highFreqPerfClk);
+
+    _lastSequence = sequence;
+    return info;
+} catch (const std::exception& ex) {
+    VPUX_THROW("Profiling post-processing of ring record {0} failed. {1}", record.header.sequence, ex.what());
+}
@@ -0,0 +1,65 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --apply-profile-guided-costs="profile=%data_path_npu%/pgo_profile.json" %s | FileCheck %s
+// REQUIRES: arch-NPU37XX
+
+// CHECK-LABEL: module @ProfiledTaskCost
+module @ProfiledTaskCost attributes {VPU.arch = #VPU.arch_kind<NPU37XX>, VPU.compilationMode = #VPU.compilation_mode<DefaultHW>} {
+    IE.TileResource 2 of @NCE at 1.300000e+03 MHz {
+        IE.ExecutorResource 1 of @DPU
+        IE.ExecutorResource 2 of @SHAVE_ACT
+        IE.ExecutorResource 1 of @SHAVE_NN
+        IE.MemoryResource 1784217 bytes of @CMX_NN_FragmentationAware
+        IE.MemoryResource 1982464 bytes of @CMX_NN {VPU.bandwidth = 32 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+    }
+    IE.ExecutorResource 2 of @DMA_NN
+    IE.MemoryResource 524288000 bytes of @DDR {VPU.bandwidth = 8 : i64, VPU.derateFactor = 6.000000e-01 : f64}
+
+    func.func @main(%arg0: memref<1x16x8x8xf16>) -> (memref<1x16x8x8xf16, @CMX_NN>, memref<1x16x8x8xf16, @CMX_NN>) {
+        %0 = memref.alloc() : memref<1x16x8x8xf16, @CMX_NN>
+        %1 = VPUIP.Copy inputs(%arg0 : memref<1x16x8x8xf16>) outputs(%0 : memref<1x16x8x8xf16, @CMX_NN>)
+                -> memref<1x16x8x8xf16, @CMX_NN> loc(fused<{type = "Convolution"}>["conv", "_cluster_copy"])
+        %2 = memref.alloc() : memref<1x16x8x8xf16, @CMX_NN>
+        %3 = VPUIP.Copy inputs(%arg0 : memref<1x16x8x8xf16>) outputs(%2 : memref<1x16x8x8xf16, @CMX_NN>)
+                -> memref<1x16x8x8xf16, @CMX_NN> loc(fused<{type = "Convolution"}>["conv2", "_cluster_copy"])
+        return %1, %3 : memref<1x16x8x8xf16, @CMX_NN>, memref<1x16x8x8xf16, @CMX_NN>
+    }
+
+    // 500ns at 1300MHz
+    // CHECK:       VPUIP.Copy {profiledCycleCost = 650 : i64}
+    // The task of conv2 was not profiled
+    // CHECK-NOT:   profiledCycleCost
+    // CHECK:       VPUIP.Copy inputs
+}
+
+// -----
+
+// CHECK-LABEL: module @ProfiledLayerCostScale
+module @ProfiledLayerCostScale attributes {VPU.arch = #VPU.arch_kind<NPU37XX>, VPU.compilationMode = #VPU.compilation_mode<DefaultHW>} {
+    IE.TileResource 2 of @NCE at 1.300000e+03 MHz {
+        IE.ExecutorResource 1 of @DPU
+        IE.ExecutorResource 2 of @SHAVE_ACT
+        IE.ExecutorResource 1 of @SHAVE_NN
+        IE.MemoryResource 1784217 bytes of @CMX_NN_FragmentationAware
+        IE.MemoryResource 1982464 bytes of @CMX_NN {VPU.bandwidth = 32 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+    }
+    IE.ExecutorResource 2 of @DMA_NN
+    IE.MemoryResource 524288000 bytes of @DDR {VPU.bandwidth = 8 : i64, VPU.derateFactor = 6.000000e-01 : f64}
+
+    func.func @main(%arg0: tensor<1x16x32x32xf16>) -> (tensor<1x16x32x32xf16>, tensor<1x16x32x32xf16>) {
+        %0 = VPU.SoftMax(%arg0) {axisInd = 1 : i64} : tensor<1x16x32x32xf16> -> tensor<1x16x32x32xf16>
+                loc(fused<{type = "SoftMax"}>["softmax"])
+        %1 = VPU.SoftMax(%arg0) {axisInd = 1 : i64} : tensor<1x16x32x32xf16> -> tensor<1x16x32x32xf16>
+                loc(fused<{type = "SoftMax"}>["softmax2"])
+        return %0, %1 : tensor<1x16x32x32xf16>, tensor<1x16x32x32xf16>
+    }
+
+    // The slowest cluster defines the measured duration of the layer
+    // CHECK:       VPU.SoftMax(%arg0) {axisInd = 1 : i64, profiledCostScale = {{[0-9.eE+-]+}} : f64}
+    // The layer softmax2 was not profiled
+    // CHECK-NOT:   profiledCostScale
+    // CHECK:       VPU.SoftMax(%arg0) {axisInd = 1 : i64} :
+}
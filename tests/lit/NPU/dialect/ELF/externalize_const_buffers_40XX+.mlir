@@ -0,0 +1,55 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --externalize-const-buffers %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+func.func @SharedConstants() {
+  ELF.Main @ELFMain {
+    ELF.CreateLogicalSection @buffer.CMX_NN.0 aligned(64) secType(SHT_NOBITS) secFlags("SHF_NONE") {
+      VPUASM.DeclareBuffer @DeclareBuffer0 !VPUASM.Buffer< "CMX_NN"[0] <0> : memref<1x16x1x1xf16, [@CMX_NN, 0]> :  swizzling(0)>
+    }
+    ELF.CreateLogicalSection @program.DMA.cmx.0.0 aligned(64) secType(SHT_PROGBITS) secFlags("SHF_NONE") {
+      VPUASM.DeclareTaskBuffer @DeclareTaskBuffer_DMA_0_0_0 idx(!VPURegMapped.Index<0:0:0>) <DMA>
+      VPUASM.DeclareTaskBuffer @DeclareTaskBuffer_DMA_0_0_1 idx(!VPURegMapped.Index<0:0:1>) <DMA>
+    }
+    ELF.CreateSection @buffer.Constant.0.constant aligned(64) secType(SHT_PROGBITS) secFlags(SHF_ALLOC) {
+      VPUASM.ConstBuffer @Declare0 !VPUASM.Buffer< "Constant"[0] <0> : memref<1x16x1x1xf16> :  swizzling(0)> = dense<1.000000e+00> : tensor<1x16x1x1xf16>
+      VPUASM.ConstBuffer @Declare1 !VPUASM.Buffer< "Constant"[0] <0> : memref<1x16x1x1xf16> :  swizzling(0)> = dense<2.000000e+00> : tensor<1x16x1x1xf16>
+    }
+    ELF.CreateSection @task.dma.0.0 aligned(64) secType(SHT_PROGBITS) secFlags(SHF_ALLOC) {
+      VPUASM.NNDMA @NNDMA_0_0_0 idx(!VPURegMapped.Index<0:0:0>) taskLocation(@program.DMA.cmx.0.0::@DeclareTaskBuffer_DMA_0_0_0) input(@buffer.Constant.0.constant::@Declare0) outputs([@buffer.CMX_NN.0::@DeclareBuffer0]) waits([]) updates([]) start_after(0) clean_after(0) descriptor(#VPUIP.DMADescriptorAttr<numPlanes = 0 : i4, len = 0 : i4, srcWidth = 0 : i4, srcStride = 0 : i4, srcPlaneStride = 0 : i4, dstWidth = 0 : i4, dstStride = 0 : i4, dstPlaneStride = 0 : i4>) acceleration_mode(<DISABLE>)
+      VPUASM.NNDMA @NNDMA_0_0_1 idx(!VPURegMapped.Index<0:0:1>) taskLocation(@program.DMA.cmx.0.0::@DeclareTaskBuffer_DMA_0_0_1) input(@buffer.Constant.0.constant::@Declare1) outputs([@buffer.CMX_NN.0::@DeclareBuffer0]) waits([]) updates([]) start_after(0) clean_after(0) descriptor(#VPUIP.DMADescriptorAttr<numPlanes = 0 : i4, len = 0 : i4, srcWidth = 0 : i4, srcStride = 0 : i4, srcPlaneStride = 0 : i4, dstWidth = 0 : i4, dstStride = 0 : i4, dstPlaneStride = 0 : i4>) acceleration_mode(<DISABLE>)
+    }
+  }
+  return
+}
+
+// CHECK:       ELF.CreateLogicalSection @buffer.Constant.0.constant aligned(64) secType(VPU_SHT_SHARED_WEIGHTS) secFlags(SHF_ALLOC)
+// CHECK-NEXT:    VPUASM.ConstBuffer @Declare0
+// CHECK-NEXT:    VPUASM.ConstBuffer @Declare1
+// CHECK-NEXT:  }
+// CHECK-NEXT:  ELF.CreateSection @buffer.Constant.0.constant.map aligned(8) secType(VPU_SHT_SHARED_WEIGHTS_MAP) secFlags("SHF_NONE")
+// CHECK-NEXT:    ELF.SharedWeightsMap @SharedWeightsMap section(@buffer.Constant.0.constant)
+// CHECK-NEXT:  }
+// CHECK:       ELF.CreateSection @task.dma.0.0 aligned(64) secType(SHT_PROGBITS) secFlags(SHF_ALLOC)
+// CHECK:         VPUASM.NNDMA @NNDMA_0_0_0
+// CHECK-SAME:      input(@buffer.Constant.0.constant::@Declare0)
+// CHECK:         VPUASM.NNDMA @NNDMA_0_0_1
+// CHECK-SAME:      input(@buffer.Constant.0.constant::@Declare1)
+
+// -----
+
+func.func @NoConstants() {
+  ELF.Main @ELFMain {
+    ELF.CreateLogicalSection @buffer.CMX_NN.0 aligned(64) secType(SHT_NOBITS) secFlags("SHF_NONE") {
+      VPUASM.DeclareBuffer @DeclareBuffer0 !VPUASM.Buffer< "CMX_NN"[0] <0> : memref<1x16x1x1xf16, [@CMX_NN, 0]> :  swizzling(0)>
+    }
+  }
+  return
+}
+
+// CHECK:       ELF.CreateLogicalSection @buffer.CMX_NN.0 aligned(64) secType(SHT_NOBITS) secFlags("SHF_NONE")
+// CHECK-NOT:   ELF.SharedWeightsMap
@@ -0,0 +1,202 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% compilation-mode=DefaultHW" --wrap-ops-in-sparsify-pairs="enable-activation-sparsity-mode=cost" %s | FileCheck %s
+// REQUIRES: arch-NPU37XX || arch-NPU40XX
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+module @main {
+    // 64 channels: 96 of the 128 bytes of a storage element are read with 25% of zeros (the non-zero values are
+    // rounded up to 16 bytes), the 32 bytes saved exceed the 16 bytes of sparsity map traffic
+    func.func @WrapProfitableFP16Input(%arg0: tensor<1x64x16x16xf16, {order = #NHWC}>, %wt: tensor<64x1x1x4xsi32>, %weights: tensor<64x64x1x1xf16, {order = #NHWC}>) -> tensor<1x64x16x16xf16, {order = #NHWC}> {
+        %0 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [64, 64, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x64x16x16xf16, {order = #NHWC}> loc(fused["Conv_0", "t_Convolution"])
+        %1 = VPU.NCE.Convolution(%0, %weights, %wt) {
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [64, 64, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x64x16x16xf16, {order = #NHWC}> loc(fused["Conv_1", "t_Convolution"])
+
+        return %1 : tensor<1x64x16x16xf16, {order = #NHWC}>
+
+        // CHECK:       [[VAL0:%.+]] = VPU.NCE.Convolution(%arg0, %arg2, %arg1)
+        // CHECK:       [[VAL1:%.+]] = VPU.Sparsify([[VAL0]])
+        // CHECK:       [[VAL2:%.+]] = VPU.Desparsify([[VAL1]]
+        // CHECK:       [[VAL3:%.+]] = VPU.Sparsify([[VAL2]])
+        // CHECK-NOT:   VPU.Desparsify
+        // CHECK:       [[VAL4:%.+]] = VPU.NCE.Convolution([[VAL3]], %arg2, %arg1)
+        // CHECK:       [[VAL5:%.+]] = VPU.Sparsify([[VAL4]])
+        // CHECK:       [[VAL6:%.+]] = VPU.Desparsify([[VAL5]]
+        // CHECK:       return [[VAL6]]
+    }
+
+    IE.SparsityStatistics sparsityInfo : {
+        IE.SparsityInfo 0.25 at input 0 of "Conv_1" loc(#loc0)
+    }
+}
+
+//
+// -----
+//
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+module @main {
+    // 64 channels: 102.4 bytes of non-zero values are rounded up to 112 bytes, the 16 bytes saved do not exceed the
+    // 16 bytes of sparsity map traffic
+    func.func @DoNotWrapUnprofitableFP16Input(%arg0: tensor<1x64x16x16xf16, {order = #NHWC}>, %wt: tensor<64x1x1x4xsi32>, %weights: tensor<64x64x1x1xf16, {order = #NHWC}>) -> tensor<1x64x16x16xf16, {order = #NHWC}> {
+        %0 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [64, 64, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x64x16x16xf16, {order = #NHWC}> loc(fused["Conv_0", "t_Convolution"])
+        %1 = VPU.NCE.Convolution(%0, %weights, %wt) {
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [64, 64, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x64x16x16xf16, {order = #NHWC}> loc(fused["Conv_1", "t_Convolution"])
+
+        return %1 : tensor<1x64x16x16xf16, {order = #NHWC}>
+
+        // CHECK:       [[VAL0:%.+]] = VPU.NCE.Convolution(%arg0, %arg2, %arg1)
+        // CHECK:       [[VAL1:%.+]] = VPU.Sparsify([[VAL0]])
+        // CHECK:       [[VAL2:%.+]] = VPU.Desparsify([[VAL1]]
+        // CHECK-NOT:   VPU.Sparsify([[VAL2]])
+        // CHECK:       [[VAL3:%.+]] = VPU.NCE.Convolution([[VAL2]], %arg2, %arg1)
+        // CHECK:       [[VAL4:%.+]] = VPU.Sparsify([[VAL3]])
+        // CHECK:       [[VAL5:%.+]] = VPU.Desparsify([[VAL4]]
+        // CHECK:       return [[VAL5]]
+    }
+
+    IE.SparsityStatistics sparsityInfo : {
+        IE.SparsityInfo 0.2 at input 0 of "Conv_1" loc(#loc0)
+    }
+}
+
+//
+// -----
+//
+
+!qElemType = !quant.uniform<u8:f16, 1.000000e+00>
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+module @main {
+    // 64 channels: 44.8 bytes of non-zero values are rounded up to 48 bytes, the 16 bytes saved do not exceed the
+    // 16 bytes of sparsity map traffic
+    func.func @DoNotWrapUnprofitableU8Input(%arg0: tensor<1x64x16x16x!qElemType, {order = #NHWC}>, %wt: tensor<64x1x1x4xsi32>, %weights: tensor<64x64x1x1x!qElemType, {order = #NHWC}>) -> tensor<1x64x16x16x!qElemType, {order = #NHWC}> {
+        %0 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [64, 64, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x64x16x16x!qElemType, {order = #NHWC}> loc(fused["Conv_0", "t_Convolution"])
+        %1 = VPU.NCE.Convolution(%0, %weights, %wt) {
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [64, 64, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x64x16x16x!qElemType, {order = #NHWC}> loc(fused["Conv_1", "t_Convolution"])
+
+        return %1 : tensor<1x64x16x16x!qElemType, {order = #NHWC}>
+
+        // CHECK:       [[VAL0:%.+]] = VPU.NCE.Convolution(%arg0, %arg2, %arg1)
+        // CHECK:       [[VAL1:%.+]] = VPU.Sparsify([[VAL0]])
+        // CHECK:       [[VAL2:%.+]] = VPU.Desparsify([[VAL1]]
+        // CHECK-NOT:   VPU.Sparsify([[VAL2]])
+        // CHECK:       [[VAL3:%.+]] = VPU.NCE.Convolution([[VAL2]], %arg2, %arg1)
+        // CHECK:       [[VAL4:%.+]] = VPU.Sparsify([[VAL3]])
+        // CHECK:       [[VAL5:%.+]] = VPU.Desparsify([[VAL4]]
+        // CHECK:       return [[VAL5]]
+    }
+
+    IE.SparsityStatistics sparsityInfo : {
+        IE.SparsityInfo 0.3 at input 0 of "Conv_1" loc(#loc0)
+    }
+}
+
+//
+// -----
+//
+
+!qElemType = !quant.uniform<u8:f16, 1.000000e+00>
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+module @main {
+    // 64 channels: 32 of the 64 bytes of a storage element are read with 50% of zeros, the 32 bytes saved exceed the
+    // 16 bytes of sparsity map traffic
+    func.func @WrapProfitableU8Input(%arg0: tensor<1x64x16x16x!qElemType, {order = #NHWC}>, %wt: tensor<64x1x1x4xsi32>, %weights: tensor<64x64x1x1x!qElemType, {order = #NHWC}>) -> tensor<1x64x16x16x!qElemType, {order = #NHWC}> {
+        %0 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [64, 64, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x64x16x16x!qElemType, {order = #NHWC}> loc(fused["Conv_0", "t_Convolution"])
+        %1 = VPU.NCE.Convolution(%0, %weights, %wt) {
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [64, 64, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x64x16x16x!qElemType, {order = #NHWC}> loc(fused["Conv_1", "t_Convolution"])
+
+        return %1 : tensor<1x64x16x16x!qElemType, {order = #NHWC}>
+
+        // CHECK:       [[VAL0:%.+]] = VPU.NCE.Convolution(%arg0, %arg2, %arg1)
+        // CHECK:       [[VAL1:%.+]] = VPU.Sparsify([[VAL0]])
+        // CHECK:       [[VAL2:%.+]] = VPU.Desparsify([[VAL1]]
+        // CHECK:       [[VAL3:%.+]] = VPU.Sparsify([[VAL2]])
+        // CHECK-NOT:   VPU.Desparsify
+        // CHECK:       [[VAL4:%.+]] = VPU.NCE.Convolution([[VAL3]], %arg2, %arg1)
+        // CHECK:       [[VAL5:%.+]] = VPU.Sparsify([[VAL4]])
+        // CHECK:       [[VAL6:%.+]] = VPU.Desparsify([[VAL5]]
+        // CHECK:       return [[VAL6]]
+    }
+
+    IE.SparsityStatistics sparsityInfo : {
+        IE.SparsityInfo 0.5 at input 0 of "Conv_1" loc(#loc0)
+    }
+}
+
+//
+// -----
+//
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+module @main {
+    // A network input cannot be written sparse by an NCE producer, its Sparsify would cost an extra task
+    func.func @DoNotWrapNetworkInput(%arg0: tensor<1x64x16x16xf16, {order = #NHWC}>, %wt: tensor<64x1x1x4xsi32>, %weights: tensor<64x64x1x1xf16, {order = #NHWC}>) -> tensor<1x64x16x16xf16, {order = #NHWC}> {
+        %0 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [64, 64, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x64x16x16xf16, {order = #NHWC}> loc(fused["Conv_0", "t_Convolution"])
+
+        return %0 : tensor<1x64x16x16xf16, {order = #NHWC}>
+
+        // CHECK-NOT:   VPU.Sparsify(%arg0)
+        // CHECK:       [[VAL0:%.+]] = VPU.NCE.Convolution(%arg0, %arg2, %arg1)
+        // CHECK:       [[VAL1:%.+]] = VPU.Sparsify([[VAL0]])
+        // CHECK:       [[VAL2:%.+]] = VPU.Desparsify([[VAL1]]
+        // CHECK:       return [[VAL2]]
+    }
+
+    IE.SparsityStatistics sparsityInfo : {
+        IE.SparsityInfo 0.9 at input 0 of "Conv_0" loc(#loc0)
+    }
+}
@@ -0,0 +1,113 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --enable-weights-sparsity="weights-sparsity-heuristic=COST" %s | FileCheck %s
+// REQUIRES: arch-NPU37XX
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// CHECK-LABEL: @DoNotSparsifyFullyDense
+func.func @DoNotSparsifyFullyDense(%arg0: tensor<1x16x16x16xf16, {order = #NHWC}>, %arg1: tensor<16x1x1x4xsi32>) -> tensor<1x16x16x16xf16, {order = #NHWC}> {
+    %weights = const.Declare tensor<16x16x1x1xf16, {order = #NHWC}> = dense<1.0> : tensor<16x16x1x1xf16>, [#const.Reorder<#NHWC>]
+    %1 = VPU.NCE.Convolution(%arg0, %weights, %arg1) {
+            opaque_ppe = #VPU.PPEStub<>,
+            pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            rawFilterShape = [16, 16, 1, 1],
+            strides = [1, 1]
+        } -> tensor<1x16x16x16xf16, {order = #NHWC}>
+
+    return %1 : tensor<1x16x16x16xf16, {order = #NHWC}>
+
+    // CHECK-NOT:  const.Sparsify
+    // CHECK-NOT:  VPU.GroupSparseTensor
+    // CHECK:      [[WEIGHTS:%.+]] = const.Declare tensor<16x16x1x1xf16, {order = #NHWC}> = dense<1.000000e+00>
+    // CHECK:      VPU.NCE.Convolution(%arg0, [[WEIGHTS]], %arg1)
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// 87.5% of the 2MB of weights are zero, the sparse weights remove the need for tiling and most of the weights DMA
+// CHECK-LABEL: @SparsifyLargeSparseWeights
+func.func @SparsifyLargeSparseWeights(%arg0: tensor<1x1024x4x4xf16, {order = #NHWC}>, %arg1: tensor<1024x1x1x4xsi32>) -> tensor<1x1024x4x4xf16, {order = #NHWC}> {
+    %weights = const.Declare tensor<1024x1024x1x1xf16, {order = #NHWC}> = dense<1.0> : tensor<1024x128x1x1xf16>, [
+        #const.PadWithZero<[0, 0, 0, 0], [0, 896, 0, 0]>, #const.Reorder<#NHWC>]
+    %1 = VPU.NCE.Convolution(%arg0, %weights, %arg1) {
+            opaque_ppe = #VPU.PPEStub<>,
+            pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            rawFilterShape = [1024, 1024, 1, 1],
+            strides = [1, 1]
+        } -> tensor<1x1024x4x4xf16, {order = #NHWC}>
+
+    return %1 : tensor<1x1024x4x4xf16, {order = #NHWC}>
+
+    // CHECK:      [[DATA:%.+]] = const.Declare tensor<1024x1024x1x1xf16, {order = #NHWC}> = {{.*}} [#const.Sparsify<false>]
+    // CHECK:      [[MAP:%.+]] = const.Declare tensor<1024x1x1x{{[0-9]+}}xi1> = {{.*}} [#const.GetSparsityMap]
+    // CHECK:      [[SPARSE:%.+]] = VPU.GroupSparseTensor([[DATA]], [[MAP]])
+    // CHECK:      VPU.NCE.Convolution(%arg0, [[SPARSE]], %arg1)
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// One input channel out of 64 is zero: the compressed weight sets are rounded up to 16 bytes, so they are as large
+// as the dense ones and the sparsity map only adds traffic. The sparse candidate is rejected by the cost model
+// CHECK-LABEL: @DoNotSparsifyUnprofitablePartiallySparse
+func.func @DoNotSparsifyUnprofitablePartiallySparse(%arg0: tensor<1x64x16x16xf16, {order = #NHWC}>, %arg1: tensor<64x1x1x4xsi32>) -> tensor<1x64x16x16xf16, {order = #NHWC}> {
+    %weights = const.Declare tensor<64x64x1x1xf16, {order = #NHWC}> = dense<1.0> : tensor<64x63x1x1xf16>, [
+        #const.PadWithZero<[0, 0, 0, 0], [0, 1, 0, 0]>, #const.Reorder<#NHWC>]
+    %1 = VPU.NCE.Convolution(%arg0, %weights, %arg1) {
+            opaque_ppe = #VPU.PPEStub<>,
+            pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            rawFilterShape = [64, 64, 1, 1],
+            strides = [1, 1]
+        } -> tensor<1x64x16x16xf16, {order = #NHWC}>
+
+    return %1 : tensor<1x64x16x16xf16, {order = #NHWC}>
+
+    // The sparse constants created for the evaluation are erased
+    // CHECK-NOT:  #const.Sparsify
+    // CHECK-NOT:  #const.GetSparsityMap
+    // CHECK-NOT:  VPU.GroupSparseTensor
+    // CHECK:      [[WEIGHTS:%.+]] = const.Declare tensor<64x64x1x1xf16, {order = #NHWC}>
+    // CHECK-NOT:  #const.Sparsify
+    // CHECK:      VPU.NCE.Convolution(%arg0, [[WEIGHTS]], %arg1)
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// The weights are shared by two convolutions. The first one is dominated by the weights DMA and gets the sparse
+// weights, the second one is dominated by the DPU time over a large activation and keeps the dense weights, so both
+// constants stay in the IR
+// CHECK-LABEL: @SharedWeightsWithDifferentDecisions
+func.func @SharedWeightsWithDifferentDecisions(%arg0: tensor<1x512x4x4xf16, {order = #NHWC}>, %arg1: tensor<1x512x64x64xf16, {order = #NHWC}>, %arg2: tensor<512x1x1x4xsi32>) -> (tensor<1x512x4x4xf16, {order = #NHWC}>, tensor<1x512x64x64xf16, {order = #NHWC}>) {
+    %weights = const.Declare tensor<512x512x1x1xf16, {order = #NHWC}> = dense<1.0> : tensor<512x64x1x1xf16>, [
+        #const.PadWithZero<[0, 0, 0, 0], [0, 448, 0, 0]>, #const.Reorder<#NHWC>]
+    %1 = VPU.NCE.Convolution(%arg0, %weights, %arg2) {
+            opaque_ppe = #VPU.PPEStub<>,
+            pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            rawFilterShape = [512, 512, 1, 1],
+            strides = [1, 1]
+        } -> tensor<1x512x4x4xf16, {order = #NHWC}>
+    %2 = VPU.NCE.Convolution(%arg1, %weights, %arg2) {
+            opaque_ppe = #VPU.PPEStub<>,
+            pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            rawFilterShape = [512, 512, 1, 1],
+            strides = [1, 1]
+        } -> tensor<1x512x64x64xf16, {order = #NHWC}>
+
+    return %1, %2 : tensor<1x512x4x4xf16, {order = #NHWC}>, tensor<1x512x64x64xf16, {order = #NHWC}>
+
+    // CHECK:      [[DATA:%.+]] = const.Declare tensor<512x512x1x1xf16, {order = #NHWC}> = {{.*}} [#const.Sparsify<false>]
+    // CHECK:      [[MAP:%.+]] = const.Declare tensor<512x1x1x{{[0-9]+}}xi1> = {{.*}} [#const.GetSparsityMap]
+    // CHECK:      [[SPARSE:%.+]] = VPU.GroupSparseTensor([[DATA]], [[MAP]])
+    // CHECK:      [[WEIGHTS:%.+]] = const.Declare tensor<512x512x1x1xf16, {order = #NHWC}> = dense<1.000000e+00> : tensor<512x64x1x1xf16>, [#const.PadWithZero<[0, 0, 0, 0], [0, 448, 0, 0]>, #const.Reorder<#NHWC>]
+    // CHECK:      VPU.NCE.Convolution(%arg0, [[SPARSE]], %arg2)
+    // CHECK:      VPU.NCE.Convolution(%arg1, [[WEIGHTS]], %arg2)
+}
@@ -0,0 +1,128 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --add-sw-kernel-instruction-prefetch %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+!CMXType = memref<1x1x1x1000xf16, [@CMX_NN, 0]>
+!DDRType = memref<1x1x1x1000xf16, @DDR>
+
+// CHECK-LABEL: @RegroupAndPrefetch
+module @RegroupAndPrefetch {
+    module @VPU.SW {
+        func.func private @builtin_hswish(memref<*xf16>, memref<*xf16>) attributes {VPU.kernel_code = "activation_hswish.cpp", VPU.kernel_entry = "activation_hswish"}
+        func.func private @builtin_sigmoid(memref<*xf16>, memref<*xf16>) attributes {VPU.kernel_code = "activation_sigmoid.cpp", VPU.kernel_entry = "activation_sigmoid"}
+        func.func private @runtime() attributes {VPU.kernel_code = "nnActEntry"}
+    }
+
+    func.func @main(%arg0: !DDRType, %arg1: !DDRType) -> !DDRType {
+        %in = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> !CMXType
+        %out0 = VPURT.DeclareBuffer <CMX_NN> [0] <2000> -> !CMXType
+        %out1 = VPURT.DeclareBuffer <CMX_NN> [0] <4000> -> !CMXType
+        %out2 = VPURT.DeclareBuffer <CMX_NN> [0] <6000> -> !CMXType
+
+        %b0 = VPURT.DeclareVirtualBarrier -> !VPURT.Barrier
+        %b1 = VPURT.DeclareVirtualBarrier -> !VPURT.Barrier
+
+        VPURT.Task updates(%b0 : !VPURT.Barrier) {
+            %0 = VPUIP.NNDMA {port = 0 : i64} inputs(%arg0 : !DDRType) outputs(%in : !CMXType) -> !CMXType
+        }
+        VPURT.Task waits(%b0 : !VPURT.Barrier) updates(%b1 : !VPURT.Barrier) {
+            %0 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_hswish
+                        inputs(%in as %arg2: !CMXType) outputs(%out0 as %arg3: !CMXType) on tile 0 -> !CMXType {
+                VPUIP.SW.Kernel.run(%arg2, %arg3) : !CMXType, !CMXType
+            }
+        }
+        VPURT.Task waits(%b0 : !VPURT.Barrier) updates(%b1 : !VPURT.Barrier) {
+            %0 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_sigmoid
+                        inputs(%in as %arg2: !CMXType) outputs(%out1 as %arg3: !CMXType) on tile 0 -> !CMXType {
+                VPUIP.SW.Kernel.run(%arg2, %arg3) : !CMXType, !CMXType
+            }
+        }
+        VPURT.Task waits(%b0 : !VPURT.Barrier) updates(%b1 : !VPURT.Barrier) {
+            %0 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_hswish
+                        inputs(%in as %arg2: !CMXType) outputs(%out2 as %arg3: !CMXType) on tile 0 -> !CMXType {
+                VPUIP.SW.Kernel.run(%arg2, %arg3) : !CMXType, !CMXType
+            }
+        }
+        VPURT.Task waits(%b1 : !VPURT.Barrier) {
+            %0 = VPUIP.NNDMA {port = 0 : i64} inputs(%out2 : !CMXType) outputs(%arg1 : !DDRType) -> !DDRType
+        }
+        return %arg1 : !DDRType
+    }
+
+    // CHECK:       module @VPU.SW
+    // CHECK:         func.func private @cache_prefetch() attributes {VPU.task_type = @CACHE_PREFETCH}
+
+    // CHECK:       [[IN:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <0>
+    // CHECK:       [[OUT0:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <2000>
+    // CHECK:       [[OUT1:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <4000>
+    // CHECK:       [[OUT2:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <6000>
+    // CHECK:       [[B0:%.+]] = VPURT.DeclareVirtualBarrier
+    // CHECK:       [[B1:%.+]] = VPURT.DeclareVirtualBarrier
+
+    // CHECK:       VPURT.Task updates([[B0]] : !VPURT.Barrier)
+    // CHECK:         VPUIP.NNDMA
+
+    // CHECK:       VPURT.Task {
+    // CHECK-NEXT:    VPUIP.SW.Kernel {kernelElfName = "activation_hswish", resultSegmentSizes = array<i32: 0, 0, 0>} @VPU.SW::@cache_prefetch inputs() outputs() on tile 0
+    // CHECK:       VPURT.Task {
+    // CHECK-NEXT:    VPUIP.SW.Kernel {kernelElfName = "activation_sigmoid", resultSegmentSizes = array<i32: 0, 0, 0>} @VPU.SW::@cache_prefetch inputs() outputs() on tile 0
+
+    // CHECK:       VPURT.Task waits([[B0]] : !VPURT.Barrier) updates([[B1]] : !VPURT.Barrier)
+    // CHECK-NEXT:    VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_hswish inputs([[IN]] as {{[^:]+}}: memref<1x1x1x1000xf16, [@CMX_NN, 0]>) outputs([[OUT0]] as
+    // CHECK:       VPURT.Task waits([[B0]] : !VPURT.Barrier) updates([[B1]] : !VPURT.Barrier)
+    // CHECK-NEXT:    VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_hswish inputs([[IN]] as {{[^:]+}}: memref<1x1x1x1000xf16, [@CMX_NN, 0]>) outputs([[OUT2]] as
+    // CHECK:       VPURT.Task waits([[B0]] : !VPURT.Barrier) updates([[B1]] : !VPURT.Barrier)
+    // CHECK-NEXT:    VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_sigmoid inputs([[IN]] as {{[^:]+}}: memref<1x1x1x1000xf16, [@CMX_NN, 0]>) outputs([[OUT1]] as
+
+    // CHECK:       VPURT.Task waits([[B1]] : !VPURT.Barrier)
+    // CHECK:         VPUIP.NNDMA
+}
+
+// -----
+
+!CMXType = memref<1x1x1x1000xf16, [@CMX_NN, 0]>
+!DDRType = memref<1x1x1x1000xf16, @DDR>
+
+// CHECK-LABEL: @NoPrefetchForCachedKernel
+module @NoPrefetchForCachedKernel {
+    module @VPU.SW {
+        func.func private @builtin_hswish(memref<*xf16>, memref<*xf16>) attributes {VPU.kernel_code = "activation_hswish.cpp", VPU.kernel_entry = "activation_hswish"}
+        func.func private @runtime() attributes {VPU.kernel_code = "nnActEntry"}
+    }
+
+    func.func @main(%arg0: !DDRType, %arg1: !DDRType) -> !DDRType {
+        %in = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> !CMXType
+        %out = VPURT.DeclareBuffer <CMX_NN> [0] <2000> -> !CMXType
+
+        %b0 = VPURT.DeclareVirtualBarrier -> !VPURT.Barrier
+        %b1 = VPURT.DeclareVirtualBarrier -> !VPURT.Barrier
+
+        VPURT.Task {
+            %0 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_hswish
+                        inputs(%in as %arg2: !CMXType) outputs(%out as %arg3: !CMXType) on tile 0 -> !CMXType {
+                VPUIP.SW.Kernel.run(%arg2, %arg3) : !CMXType, !CMXType
+            }
+        }
+        VPURT.Task updates(%b0 : !VPURT.Barrier) {
+            %0 = VPUIP.NNDMA {port = 0 : i64} inputs(%arg0 : !DDRType) outputs(%in : !CMXType) -> !CMXType
+        }
+        VPURT.Task waits(%b0 : !VPURT.Barrier) updates(%b1 : !VPURT.Barrier) {
+            %0 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_hswish
+                        inputs(%in as %arg2: !CMXType) outputs(%out as %arg3: !CMXType) on tile 0 -> !CMXType {
+                VPUIP.SW.Kernel.run(%arg2, %arg3) : !CMXType, !CMXType
+            }
+        }
+        VPURT.Task waits(%b1 : !VPURT.Barrier) {
+            %0 = VPUIP.NNDMA {port = 0 : i64} inputs(%out : !CMXType) outputs(%arg1 : !DDRType) -> !DDRType
+        }
+        return %arg1 : !DDRType
+    }
+
+    // The first task has no barriers to wait for and the second one hits the cache
+
+    // CHECK-NOT:   @cache_prefetch
+}
@@ -0,0 +1,162 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --adjust-spill-size="compress-ddr-intermediates=true" %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+!dataTypeDdr = memref<1x64x56x56xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>
+!dataTypeCmx = memref<1x64x56x56xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>
+
+module @DdrIntermediateReadTwice {
+  IE.TileResource 1 of @NCE at 1.300000e+03 MHz {
+    builtin.module @ReservedMemory {
+      module @CompressDmaReservedMemory {
+        IE.MemoryResource 64 bytes of @CMX_NN
+      }
+    }
+  }
+
+  IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "data" : tensor<1x64x56x56xf16>
+  } outputsInfo : {
+    DataInfo "prob" : tensor<1x64x56x56xf16>
+  }
+  func.func @main(%arg0: !dataTypeDdr) -> !dataTypeDdr {
+
+    %buf_in = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> !dataTypeCmx
+    %buf_ddr = memref.alloc() : !dataTypeDdr
+    %buf_read = VPURT.DeclareBuffer <CMX_NN> [0] <401408> -> !dataTypeCmx
+    %buf_out = memref.alloc() : !dataTypeDdr
+
+    %t0, %r0 = async.execute -> !async.value<!dataTypeCmx> attributes {VPUIP.executor = @DMA_NN, VPUIP.executorIdx = [0, 1], "async-deps-index" = 0 : i64, cycleBegin = 0 : i64, cycleEnd = 100 : i64} {
+        %0 = VPUIP.NNDMA inputs(%arg0 : !dataTypeDdr) outputs(%buf_in : !dataTypeCmx) -> !dataTypeCmx
+        async.yield %0 : !dataTypeCmx
+    }
+
+    %t1, %r1 = async.execute [%t0] -> !async.value<!dataTypeDdr> attributes {VPUIP.executor = @DMA_NN, VPUIP.executorIdx = [0, 1], "async-deps-index" = 1 : i64, cycleBegin = 100 : i64, cycleEnd = 200 : i64} {
+        %0 = VPUIP.NNDMA inputs(%buf_in : !dataTypeCmx) outputs(%buf_ddr : !dataTypeDdr) -> !dataTypeDdr
+        async.yield %0 : !dataTypeDdr
+    }
+
+    %t2, %r2 = async.execute [%t1] (%r1 as %arg2: !async.value<!dataTypeDdr>) -> !async.value<!dataTypeCmx> attributes {VPUIP.executor = @DMA_NN, VPUIP.executorIdx = [0, 1], "async-deps-index" = 2 : i64, cycleBegin = 200 : i64, cycleEnd = 300 : i64} {
+        %0 = VPUIP.NNDMA inputs(%arg2 : !dataTypeDdr) outputs(%buf_read : !dataTypeCmx) -> !dataTypeCmx
+        async.yield %0 : !dataTypeCmx
+    }
+
+    %t3, %r3 = async.execute [%t2] (%r1 as %arg2: !async.value<!dataTypeDdr>) -> !async.value<!dataTypeCmx> attributes {VPUIP.executor = @DMA_NN, VPUIP.executorIdx = [0, 1], "async-deps-index" = 3 : i64, cycleBegin = 300 : i64, cycleEnd = 400 : i64} {
+        %0 = VPUIP.NNDMA inputs(%arg2 : !dataTypeDdr) outputs(%buf_in : !dataTypeCmx) -> !dataTypeCmx
+        async.yield %0 : !dataTypeCmx
+    }
+
+    %t4, %r4 = async.execute [%t3] (%r3 as %arg2: !async.value<!dataTypeCmx>) -> !async.value<!dataTypeDdr> attributes {VPUIP.executor = @DMA_NN, VPUIP.executorIdx = [0, 1], "async-deps-index" = 4 : i64, cycleBegin = 400 : i64, cycleEnd = 500 : i64} {
+        %0 = VPUIP.NNDMA inputs(%arg2 : !dataTypeCmx) outputs(%buf_out : !dataTypeDdr) -> !dataTypeDdr
+        async.yield %0 : !dataTypeDdr
+    }
+
+    %r5 = async.await %r4 : !async.value<!dataTypeDdr>
+    return %r5 : !dataTypeDdr
+  }
+
+    // CHECK:       [[BUF_IN:%.*]] = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> memref<1x64x56x56xf16, #NHWC, [@CMX_NN, 0]>
+    // CHECK:       [[BUF_DDR:%.*]] = memref.alloc() : memref<1x64x56x56xf16, {allocSize = 407712 : i64, compression = #VPUIP.Compression<CompressionCandidate>, order = #NHWC}, @DDR>
+    // CHECK:       [[BUF_READ:%.*]] = VPURT.DeclareBuffer <CMX_NN> [0] <401408> -> memref<1x64x56x56xf16, #NHWC, [@CMX_NN, 0]>
+    // CHECK:       [[BUF_OUT:%.*]] = memref.alloc() : memref<1x64x56x56xf16, #NHWC, @DDR>
+
+    // CHECK:       [[T0:%.+]], [[R0:%.+]] = async.execute
+    // CHECK-NEXT:      VPUIP.NNDMA
+    // CHECK-NOT:           compress_candidate
+    // CHECK-SAME:          inputs(%arg0 : memref<1x64x56x56xf16, #NHWC, @DDR>)
+
+    // CHECK:       [[T1:%.+]], [[R1:%.+]] = async.execute
+    // CHECK-SAME:      -> !async.value<memref<1x64x56x56xf16, {allocSize = 407712 : i64, compression = #VPUIP.Compression<CompressionCandidate>, order = #NHWC}, @DDR>>
+    // CHECK-NEXT:      VPUIP.NNDMA
+    // CHECK-SAME:          {compress_candidate, spillId = 0 : i64}
+    // CHECK-SAME:          inputs([[BUF_IN]] : memref<1x64x56x56xf16, #NHWC, [@CMX_NN, 0]>)
+    // CHECK-SAME:          outputs([[BUF_DDR]] : memref<1x64x56x56xf16, {allocSize = 407712 : i64, compression = #VPUIP.Compression<CompressionCandidate>, order = #NHWC}, @DDR>)
+
+    // CHECK:       [[T2:%.+]], [[R2:%.+]] = async.execute
+    // CHECK-SAME:      ([[R1]] as [[ARG2:%.*]]: !async.value<memref<1x64x56x56xf16, {allocSize = 407712 : i64, compression = #VPUIP.Compression<CompressionCandidate>, order = #NHWC}, @DDR>>)
+    // CHECK-NEXT:      VPUIP.NNDMA
+    // CHECK-SAME:          {compress_candidate, spillId = 0 : i64}
+    // CHECK-SAME:          inputs([[ARG2]] : memref<1x64x56x56xf16, {allocSize = 407712 : i64, compression = #VPUIP.Compression<CompressionCandidate>, order = #NHWC}, @DDR>)
+    // CHECK-SAME:          outputs([[BUF_READ]] : memref<1x64x56x56xf16, #NHWC, [@CMX_NN, 0]>)
+
+    // CHECK:       [[T3:%.+]], [[R3:%.+]] = async.execute
+    // CHECK-SAME:      ([[R1]] as [[ARG3:%.*]]: !async.value<memref<1x64x56x56xf16, {allocSize = 407712 : i64, compression = #VPUIP.Compression<CompressionCandidate>, order = #NHWC}, @DDR>>)
+    // CHECK-NEXT:      VPUIP.NNDMA
+    // CHECK-SAME:          {compress_candidate, spillId = 0 : i64}
+    // CHECK-SAME:          inputs([[ARG3]] : memref<1x64x56x56xf16, {allocSize = 407712 : i64, compression = #VPUIP.Compression<CompressionCandidate>, order = #NHWC}, @DDR>)
+    // CHECK-SAME:          outputs([[BUF_IN]] : memref<1x64x56x56xf16, #NHWC, [@CMX_NN, 0]>)
+
+    // CHECK:       [[T4:%.+]], [[R4:%.+]] = async.execute
+    // CHECK-SAME:      -> !async.value<memref<1x64x56x56xf16, #NHWC, @DDR>>
+    // CHECK-NEXT:      VPUIP.NNDMA
+    // CHECK-NOT:           compress_candidate
+    // CHECK-SAME:          outputs([[BUF_OUT]] : memref<1x64x56x56xf16, #NHWC, @DDR>)
+}
+
+// -----
+
+!dataTypeDdr = memref<1x16x4x4xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>
+!dataTypeCmx = memref<1x16x4x4xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>
+
+module @DdrIntermediateNotBeneficial {
+  IE.TileResource 1 of @NCE at 1.300000e+03 MHz {
+    builtin.module @ReservedMemory {
+      module @CompressDmaReservedMemory {
+        IE.MemoryResource 64 bytes of @CMX_NN
+      }
+    }
+  }
+
+  IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "data" : tensor<1x16x4x4xf16>
+  } outputsInfo : {
+    DataInfo "prob" : tensor<1x16x4x4xf16>
+  }
+  func.func @main(%arg0: !dataTypeDdr) -> !dataTypeDdr {
+
+    %buf_in = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> !dataTypeCmx
+    %buf_ddr = memref.alloc() : !dataTypeDdr
+    %buf_read = VPURT.DeclareBuffer <CMX_NN> [0] <512> -> !dataTypeCmx
+
+    %t0, %r0 = async.execute -> !async.value<!dataTypeCmx> attributes {VPUIP.executor = @DMA_NN, VPUIP.executorIdx = [0, 1], "async-deps-index" = 0 : i64, cycleBegin = 0 : i64, cycleEnd = 100 : i64} {
+        %0 = VPUIP.NNDMA inputs(%arg0 : !dataTypeDdr) outputs(%buf_in : !dataTypeCmx) -> !dataTypeCmx
+        async.yield %0 : !dataTypeCmx
+    }
+
+    %t1, %r1 = async.execute [%t0] -> !async.value<!dataTypeDdr> attributes {VPUIP.executor = @DMA_NN, VPUIP.executorIdx = [0, 1], "async-deps-index" = 1 : i64, cycleBegin = 100 : i64, cycleEnd = 200 : i64} {
+        %0 = VPUIP.NNDMA inputs(%buf_in : !dataTypeCmx) outputs(%buf_ddr : !dataTypeDdr) -> !dataTypeDdr
+        async.yield %0 : !dataTypeDdr
+    }
+
+    %t2, %r2 = async.execute [%t1] (%r1 as %arg2: !async.value<!dataTypeDdr>) -> !async.value<!dataTypeCmx> attributes {VPUIP.executor = @DMA_NN, VPUIP.executorIdx = [0, 1], "async-deps-index" = 2 : i64, cycleBegin = 200 : i64, cycleEnd = 300 : i64} {
+        %0 = VPUIP.NNDMA inputs(%arg2 : !dataTypeDdr) outputs(%buf_read : !dataTypeCmx) -> !dataTypeCmx
+        async.yield %0 : !dataTypeCmx
+    }
+
+    %t3, %r3 = async.execute [%t2] (%r2 as %arg2: !async.value<!dataTypeCmx>) -> !async.value<!dataTypeDdr> attributes {VPUIP.executor = @DMA_NN, VPUIP.executorIdx = [0, 1], "async-deps-index" = 3 : i64, cycleBegin = 300 : i64, cycleEnd = 400 : i64} {
+        %0 = VPUIP.NNDMA inputs(%arg2 : !dataTypeCmx) outputs(%arg0 : !dataTypeDdr) -> !dataTypeDdr
+        async.yield %0 : !dataTypeDdr
+    }
+
+    %r4 = async.await %r3 : !async.value<!dataTypeDdr>
+    return %r4 : !dataTypeDdr
+  }
+
+    // Transferring 512 bytes takes less time than the compression overhead
+
+    // CHECK:       [[BUF_DDR:%.*]] = memref.alloc() : memref<1x16x4x4xf16, #NHWC, @DDR>
+
+    // CHECK:       [[T1:%.+]], [[R1:%.+]] = async.execute
+    // CHECK-NEXT:      VPUIP.NNDMA
+    // CHECK-NOT:           compress_candidate
+    // CHECK-SAME:          outputs([[BUF_DDR]] : memref<1x16x4x4xf16, #NHWC, @DDR>)
+
+    // CHECK:       [[T2:%.+]], [[R2:%.+]] = async.execute
+    // CHECK-NEXT:      VPUIP.NNDMA
+    // CHECK-NOT:           compress_candidate
+    // CHECK-SAME:          outputs({{%.+}} : memref<1x16x4x4xf16, #NHWC, [@CMX_NN, 0]>)
+}
@@ -0,0 +1,125 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --feasible-allocation="memory-space=CMX_NN second-level-memory-space=DDR prefetch-lookahead=2" %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+!act_type_DDR = memref<1x32x72x96xf16, #NHWC>
+!act_type_CMX = memref<1x32x72x96xf16, #NHWC, [@CMX_NN, 0]>
+!act_type = tensor<1x32x72x96xf16>
+!wt_type = tensor<32x1x1x4xsi32>
+!wt_type_CMX = memref<32x1x1x4xsi32, [@CMX_NN, 0]>
+
+// The constant of the Eltwise fits into CMX next to the MaxPool, so it is prefetched ahead of the MaxPool
+// instead of being fetched right before its consumer
+
+// CHECK-LABEL: @PrefetchLookahead
+module @PrefetchLookahead {
+IE.ExecutorResource 2 of @DMA_NN
+IE.TileResource 6 of @NCE at 1.700000e+03 MHz {
+    IE.MemoryResource 1474560 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+    IE.ExecutorResource 1 of @DPU
+}
+
+IE.CNNNetwork
+    entryPoint : @main
+    inputsInfo : {
+        DataInfo "data" : !act_type
+    }
+    outputsInfo : {
+        DataInfo "prob" : !act_type
+    }
+
+func.func @main(%in: !act_type_DDR, %out: !act_type_DDR) -> !act_type_DDR {
+    %cst0 = const.Declare !act_type_DDR = dense<2.0> : !act_type, [#const.Reorder<#NHWC>]
+    %wt = const.Declare !wt_type_CMX = dense<1> : !wt_type
+
+    %buf_in = memref.alloc() : !act_type_CMX
+    %buf_cst = memref.alloc() : !act_type_CMX
+    %buf0 = memref.alloc() : !act_type_CMX
+    %buf1 = memref.alloc() : !act_type_CMX
+
+    %t0, %r0 = async.execute -> !async.value<!act_type_CMX> attributes {VPUIP.executor = @DMA_NN, VPUIP.num_units = 1 : i64, "async-deps-index" = 0 : i64} {
+        %0 = VPUIP.NNDMA inputs(%in : !act_type_DDR) outputs(%buf_in : !act_type_CMX) -> !act_type_CMX
+        async.yield %0 : !act_type_CMX
+    }
+
+    %t1, %r1 = async.execute [%t0] (%r0 as %0 : !async.value<!act_type_CMX>)
+            -> !async.value<!act_type_CMX> attributes {VPUIP.executor = @DPU, VPUIP.num_units = 1 : i64, "async-deps-index" = 1 : i64} {
+        %1 = VPUIP.NCEClusterTask {
+                kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                kernel_size = [1, 1],
+                kernel_strides = [1, 1],
+                task_type = #VPUIP.nce_task_type<MAXPOOL>
+            }
+            input(%0 : !act_type_CMX)
+            weight_table(%wt : !wt_type_CMX)
+            parent_input(%0 : !act_type_CMX)
+            parent_output(%buf0 : !act_type_CMX)
+            outputs(%buf0 : !act_type_CMX) -> !act_type_CMX
+            variants :
+            {
+                DPUTask { outEnd = [95, 71, 31], mpe_mode = #VPU.mpe_mode<VECTOR_FP16>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, outStart = [0, 0, 0] }
+            }
+            PPE : {
+            }
+        async.yield %1 : !act_type_CMX
+    }
+
+    %t2, %r2 = async.execute -> !async.value<!act_type_CMX> attributes {VPUIP.executor = @DMA_NN, VPUIP.num_units = 1 : i64, "async-deps-index" = 2 : i64} {
+        %0 = VPUIP.NNDMA inputs(%cst0 : !act_type_DDR) outputs(%buf_cst : !act_type_CMX) -> !act_type_CMX
+        async.yield %0 : !act_type_CMX
+    }
+
+    %t3, %r3 = async.execute [%t1, %t2] (%r1 as %0 : !async.value<!act_type_CMX>, %r2 as %1 : !async.value<!act_type_CMX>)
+            -> !async.value<!act_type_CMX> attributes {VPUIP.executor = @DPU, VPUIP.num_units = 1 : i64, "async-deps-index" = 3 : i64} {
+        %2 = VPUIP.NCEClusterTask {
+                task_type = #VPUIP.nce_task_type<ELTWISE>
+            }
+            input(%0 : !act_type_CMX)
+            weights(%1 : !act_type_CMX)
+            parent_input(%0 : !act_type_CMX)
+            parent_output(%buf1 : !act_type_CMX)
+            outputs(%buf1 : !act_type_CMX) -> !act_type_CMX
+            variants :
+            {
+                DPUTask { outEnd = [95, 71, 31], mpe_mode = #VPU.mpe_mode<VECTOR_FP16>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, outStart = [0, 0, 0] }
+            }
+            PPE : {
+                PPETask {opaque_ppe = #VPU.PPEStub<>}
+            }
+        async.yield %2 : !act_type_CMX
+    }
+
+    %t4, %r4 = async.execute [%t3] (%r3 as %0 : !async.value<!act_type_CMX>)
+            -> !async.value<!act_type_DDR> attributes {VPUIP.executor = @DMA_NN, VPUIP.num_units = 1 : i64, "async-deps-index" = 4 : i64} {
+        %1 = VPUIP.NNDMA inputs(%0 : !act_type_CMX) outputs(%out : !act_type_DDR) -> !act_type_DDR
+        async.yield %1 : !act_type_DDR
+    }
+
+    %4 = async.await %r4 : !async.value<!act_type_DDR>
+    return %4 : !act_type_DDR
+
+    // CHECK:       [[CST:%.+]] = const.Declare memref<1x32x72x96xf16, #NHWC>
+
+    // CHECK:       async.execute
+    // CHECK-NEXT:      VPUIP.NNDMA
+    // CHECK-SAME:      inputs([[CST]] : memref<1x32x72x96xf16, #NHWC>)
+
+    // CHECK:       async.execute
+    // CHECK-NEXT:      VPUIP.NCEClusterTask
+    // CHECK-SAME:      task_type = #VPUIP.nce_task_type<MAXPOOL>
+
+    // CHECK:       async.execute
+    // CHECK-NEXT:      VPUIP.NCEClusterTask
+    // CHECK-SAME:      task_type = #VPUIP.nce_task_type<ELTWISE>
+
+    // CHECK:       async.execute
+    // CHECK-NEXT:      VPUIP.NNDMA
+}
+
+}
@@ -0,0 +1,221 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --feasible-allocation="memory-space=CMX_NN second-level-memory-space=DDR prefetching=false pipelining=false" %s | FileCheck %s
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --feasible-allocation="memory-space=CMX_NN second-level-memory-space=DDR prefetching=false pipelining=false spill-cost-eviction=true" %s | FileCheck %s --check-prefix=CHECK-COST
+// REQUIRES: arch-NPU40XX
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+!large_type_DDR = memref<1x32x72x96xf16, #NHWC>
+!large_type_CMX = memref<1x32x72x96xf16, #NHWC, [@CMX_NN, 0]>
+!large_type = tensor<1x32x72x96xf16>
+!small_type_DDR = memref<1x16x8x8xf16, #NHWC>
+!small_type_CMX = memref<1x16x8x8xf16, #NHWC, [@CMX_NN, 0]>
+!small_type = tensor<1x16x8x8xf16>
+!wt_type = tensor<32x1x1x4xsi32>
+!wt_type_CMX = memref<32x1x1x4xsi32, [@CMX_NN, 0]>
+
+// The Eltwise of two fetched constants does not fit while the small and the large activations are alive.
+// By default the small buffer, whose consumer comes last, is spilled first, which does not free enough CMX
+// and the large one has to be spilled as well. With the spill cost the large buffer, which is the cheapest
+// to spill per freed byte, is spilled alone.
+
+// CHECK-LABEL: @SpillCostEviction
+// CHECK-COST-LABEL: @SpillCostEviction
+module @SpillCostEviction {
+IE.ExecutorResource 2 of @DMA_NN
+IE.TileResource 6 of @NCE at 1.700000e+03 MHz {
+    IE.MemoryResource 1474560 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+    IE.ExecutorResource 1 of @DPU
+}
+
+IE.CNNNetwork
+    entryPoint : @main
+    inputsInfo : {
+        DataInfo "data" : !large_type
+        DataInfo "data_small" : !small_type
+    }
+    outputsInfo : {
+        DataInfo "prob" : !large_type
+        DataInfo "prob_small" : !small_type
+    }
+
+func.func @main(%in: !large_type_DDR, %in_small: !small_type_DDR, %out: !large_type_DDR, %out_small: !small_type_DDR)
+        -> (!large_type_DDR, !small_type_DDR) {
+    %cst0 = const.Declare !large_type_DDR = dense<2.0> : !large_type, [#const.Reorder<#NHWC>]
+    %cst1 = const.Declare !large_type_DDR = dense<3.0> : !large_type, [#const.Reorder<#NHWC>]
+    %wt = const.Declare !wt_type_CMX = dense<1> : !wt_type
+
+    %buf_in_small = memref.alloc() : !small_type_CMX
+    %buf_in = memref.alloc() : !large_type_CMX
+    %buf_small = memref.alloc() : !small_type_CMX
+    %buf_large = memref.alloc() : !large_type_CMX
+    %buf_cst0 = memref.alloc() : !large_type_CMX
+    %buf_cst1 = memref.alloc() : !large_type_CMX
+    %buf_sum = memref.alloc() : !large_type_CMX
+    %buf_out = memref.alloc() : !large_type_CMX
+    %buf_out_small = memref.alloc() : !small_type_CMX
+
+    %t0, %r0 = async.execute -> !async.value<!small_type_CMX> attributes {VPUIP.executor = @DMA_NN, VPUIP.num_units = 1 : i64, "async-deps-index" = 0 : i64} {
+        %0 = VPUIP.NNDMA inputs(%in_small : !small_type_DDR) outputs(%buf_in_small : !small_type_CMX) -> !small_type_CMX
+        async.yield %0 : !small_type_CMX
+    }
+
+    %t1, %r1 = async.execute -> !async.value<!large_type_CMX> attributes {VPUIP.executor = @DMA_NN, VPUIP.num_units = 1 : i64, "async-deps-index" = 1 : i64} {
+        %0 = VPUIP.NNDMA inputs(%in : !large_type_DDR) outputs(%buf_in : !large_type_CMX) -> !large_type_CMX
+        async.yield %0 : !large_type_CMX
+    }
+
+    %t2, %r2 = async.execute [%t0] (%r0 as %0 : !async.value<!small_type_CMX>)
+            -> !async.value<!small_type_CMX> attributes {VPUIP.executor = @DPU, VPUIP.num_units = 1 : i64, "async-deps-index" = 2 : i64} {
+        %1 = VPUIP.NCEClusterTask {
+                kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                kernel_size = [1, 1],
+                kernel_strides = [1, 1],
+                task_type = #VPUIP.nce_task_type<MAXPOOL>
+            }
+            input(%0 : !small_type_CMX)
+            weight_table(%wt : !wt_type_CMX)
+            parent_input(%0 : !small_type_CMX)
+            parent_output(%buf_small : !small_type_CMX)
+            outputs(%buf_small : !small_type_CMX) -> !small_type_CMX
+            variants :
+            {
+                DPUTask { outEnd = [7, 7, 15], mpe_mode = #VPU.mpe_mode<VECTOR_FP16>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, outStart = [0, 0, 0] }
+            }
+            PPE : {
+            }
+        async.yield %1 : !small_type_CMX
+    }
+
+    %t3, %r3 = async.execute [%t1] (%r1 as %0 : !async.value<!large_type_CMX>)
+            -> !async.value<!large_type_CMX> attributes {VPUIP.executor = @DPU, VPUIP.num_units = 1 : i64, "async-deps-index" = 3 : i64} {
+        %1 = VPUIP.NCEClusterTask {
+                kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                kernel_size = [1, 1],
+                kernel_strides = [1, 1],
+                task_type = #VPUIP.nce_task_type<MAXPOOL>
+            }
+            input(%0 : !large_type_CMX)
+            weight_table(%wt : !wt_type_CMX)
+            parent_input(%0 : !large_type_CMX)
+            parent_output(%buf_large : !large_type_CMX)
+            outputs(%buf_large : !large_type_CMX) -> !large_type_CMX
+            variants :
+            {
+                DPUTask { outEnd = [95, 71, 31], mpe_mode = #VPU.mpe_mode<VECTOR_FP16>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, outStart = [0, 0, 0] }
+            }
+            PPE : {
+            }
+        async.yield %1 : !large_type_CMX
+    }
+
+    %t4, %r4 = async.execute -> !async.value<!large_type_CMX> attributes {VPUIP.executor = @DMA_NN, VPUIP.num_units = 1 : i64, "async-deps-index" = 4 : i64} {
+        %0 = VPUIP.NNDMA inputs(%cst0 : !large_type_DDR) outputs(%buf_cst0 : !large_type_CMX) -> !large_type_CMX
+        async.yield %0 : !large_type_CMX
+    }
+
+    %t5, %r5 = async.execute -> !async.value<!large_type_CMX> attributes {VPUIP.executor = @DMA_NN, VPUIP.num_units = 1 : i64, "async-deps-index" = 5 : i64} {
+        %0 = VPUIP.NNDMA inputs(%cst1 : !large_type_DDR) outputs(%buf_cst1 : !large_type_CMX) -> !large_type_CMX
+        async.yield %0 : !large_type_CMX
+    }
+
+    %t6, %r6 = async.execute [%t4, %t5] (%r4 as %0 : !async.value<!large_type_CMX>, %r5 as %1 : !async.value<!large_type_CMX>)
+            -> !async.value<!large_type_CMX> attributes {VPUIP.executor = @DPU, VPUIP.num_units = 1 : i64, "async-deps-index" = 6 : i64} {
+        %2 = VPUIP.NCEClusterTask {
+                task_type = #VPUIP.nce_task_type<ELTWISE>
+            }
+            input(%0 : !large_type_CMX)
+            weights(%1 : !large_type_CMX)
+            parent_input(%0 : !large_type_CMX)
+            parent_output(%buf_sum : !large_type_CMX)
+            outputs(%buf_sum : !large_type_CMX) -> !large_type_CMX
+            variants :
+            {
+                DPUTask { outEnd = [95, 71, 31], mpe_mode = #VPU.mpe_mode<VECTOR_FP16>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, outStart = [0, 0, 0] }
+            }
+            PPE : {
+                PPETask {opaque_ppe = #VPU.PPEStub<>}
+            }
+        async.yield %2 : !large_type_CMX
+    }
+
+    %t7, %r7 = async.execute [%t3, %t6] (%r3 as %0 : !async.value<!large_type_CMX>, %r6 as %1 : !async.value<!large_type_CMX>)
+            -> !async.value<!large_type_CMX> attributes {VPUIP.executor = @DPU, VPUIP.num_units = 1 : i64, "async-deps-index" = 7 : i64} {
+        %2 = VPUIP.NCEClusterTask {
+                task_type = #VPUIP.nce_task_type<ELTWISE>
+            }
+            input(%0 : !large_type_CMX)
+            weights(%1 : !large_type_CMX)
+            parent_input(%0 : !large_type_CMX)
+            parent_output(%buf_out : !large_type_CMX)
+            outputs(%buf_out : !large_type_CMX) -> !large_type_CMX
+            variants :
+            {
+                DPUTask { outEnd = [95, 71, 31], mpe_mode = #VPU.mpe_mode<VECTOR_FP16>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, outStart = [0, 0, 0] }
+            }
+            PPE : {
+                PPETask {opaque_ppe = #VPU.PPEStub<>}
+            }
+        async.yield %2 : !large_type_CMX
+    }
+
+    %t8, %r8 = async.execute [%t2] (%r2 as %0 : !async.value<!small_type_CMX>)
+            -> !async.value<!small_type_CMX> attributes {VPUIP.executor = @DPU, VPUIP.num_units = 1 : i64, "async-deps-index" = 8 : i64} {
+        %1 = VPUIP.NCEClusterTask {
+                kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                kernel_size = [1, 1],
+                kernel_strides = [1, 1],
+                task_type = #VPUIP.nce_task_type<MAXPOOL>
+            }
+            input(%0 : !small_type_CMX)
+            weight_table(%wt : !wt_type_CMX)
+            parent_input(%0 : !small_type_CMX)
+            parent_output(%buf_out_small : !small_type_CMX)
+            outputs(%buf_out_small : !small_type_CMX) -> !small_type_CMX
+            variants :
+            {
+                DPUTask { outEnd = [7, 7, 15], mpe_mode = #VPU.mpe_mode<VECTOR_FP16>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, outStart = [0, 0, 0] }
+            }
+            PPE : {
+            }
+        async.yield %1 : !small_type_CMX
+    }
+
+    %t9, %r9 = async.execute [%t7] (%r7 as %0 : !async.value<!large_type_CMX>)
+            -> !async.value<!large_type_DDR> attributes {VPUIP.executor = @DMA_NN, VPUIP.num_units = 1 : i64, "async-deps-index" = 9 : i64} {
+        %1 = VPUIP.NNDMA inputs(%0 : !large_type_CMX) outputs(%out : !large_type_DDR) -> !large_type_DDR
+        async.yield %1 : !large_type_DDR
+    }
+
+    %t10, %r10 = async.execute [%t8] (%r8 as %0 : !async.value<!small_type_CMX>)
+            -> !async.value<!small_type_DDR> attributes {VPUIP.executor = @DMA_NN, VPUIP.num_units = 1 : i64, "async-deps-index" = 10 : i64} {
+        %1 = VPUIP.NNDMA inputs(%0 : !small_type_CMX) outputs(%out_small : !small_type_DDR) -> !small_type_DDR
+        async.yield %1 : !small_type_DDR
+    }
+
+    %9 = async.await %r9 : !async.value<!large_type_DDR>
+    %10 = async.await %r10 : !async.value<!small_type_DDR>
+    return %9, %10 : !large_type_DDR, !small_type_DDR
+
+    // CHECK:       VPUIP.NNDMA
+    // CHECK-SAME:      spillId
+    // CHECK-SAME:      inputs({{%.+}} : memref<1x16x8x8xf16, #NHWC, [@CMX_NN, 0]>)
+    // CHECK-SAME:      outputs({{%.+}} : memref<1x16x8x8xf16, #NHWC, @DDR>)
+    // CHECK:       VPUIP.NNDMA
+    // CHECK-SAME:      spillId
+    // CHECK-SAME:      inputs({{%.+}} : memref<1x32x72x96xf16, #NHWC, [@CMX_NN, 0]>)
+    // CHECK-SAME:      outputs({{%.+}} : memref<1x32x72x96xf16, #NHWC, @DDR>)
+
+    // CHECK-COST-NOT:  outputs({{%.+}} : memref<1x16x8x8xf16, #NHWC, @DDR>)
+    // CHECK-COST:      VPUIP.NNDMA
+    // CHECK-COST-SAME:     spillId
+    // CHECK-COST-SAME:     inputs({{%.+}} : memref<1x32x72x96xf16, #NHWC, [@CMX_NN, 0]>)
+    // CHECK-COST-SAME:     outputs({{%.+}} : memref<1x32x72x96xf16, #NHWC, @DDR>)
+    // CHECK-COST-NOT:  outputs({{%.+}} : memref<1x16x8x8xf16, #NHWC, @DDR>)
+}
+
+}
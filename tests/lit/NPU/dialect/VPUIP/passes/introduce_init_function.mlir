@@ -220,6 +220,41 @@ module @TransformationCastElemType {
 
 // -----
 
+// CHECK-LABEL: @TransformationConvertElemType
+module @TransformationConvertElemType {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+    } outputsInfo : {
+        DataInfo "output" : tensor<32x16x3x3xf16>
+    }
+
+    const.Data @ov_bin {
+        const.Rodata @value dense<1.000000e+00> : tensor<32x16x3x3xf32>
+    }
+    func.func @main() -> memref<32x16x3x3xf16> {
+        %cst = const.Declare memref<32x16x3x3xf16> = ref<@ov_bin::@value> : tensor<32x16x3x3xf32>, [#const.ConvertElemType<f16>]
+        return %cst : memref<32x16x3x3xf16>
+    }
+
+    // CHECK:  const.Data @ov_bin {
+    // CHECK:      const.Rodata [[CST_SYM:@.+]] dense<1.000000e+00> : tensor<32x16x3x3xf32>
+    // CHECK:  }
+    // CHECK:  const.Data @init_res {
+    // CHECK:      const.Ref [[FOLDED_SYM:@.+]] : tensor<32x16x3x3xf16>
+    // CHECK:  }
+    // CHECK:  func.func @init() {
+    // CHECK:      [[LOAD:%.+]] = const.Load @ov_bin::[[CST_SYM]] -> tensor<32x16x3x3xf32>
+    // CHECK:      [[CONVERT:%.+]] = IE.Convert([[LOAD]]) {dstElemType = f16} : tensor<32x16x3x3xf32> -> tensor<32x16x3x3xf16>
+    // CHECK:      const.Store [[CONVERT]], @init_res::[[FOLDED_SYM]] : tensor<32x16x3x3xf16>
+    // CHECK:      return
+    // CHECK:  }
+    // CHECK:  func.func @main() -> memref<32x16x3x3xf16> {
+    // CHECK:      [[CST:%.+]] = const.Load @init_res::[[FOLDED_SYM]] -> memref<32x16x3x3xf16>
+    // CHECK:      return [[CST]]
+    // CHECK:  }
+}
+
+// -----
+
 !qElemType = !quant.uniform<u8:f16, 1.000000e+00>
 // CHECK:  [[QELEMTYPE:!.+]] = !quant.uniform<u8:f16, 1.000000e+00>
 
@@ -765,3 +800,115 @@ module @ReusedSymbol {
     // CHECK:      return [[CST0]], [[CST1]]
     // CHECK:  }
 }
+
+// -----
+
+!qElemType = !quant.uniform<u8:f16, 5.000000e-01:128>
+
+// CHECK-LABEL: @TransformationQuantize
+module @TransformationQuantize {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+    } outputsInfo : {
+        DataInfo "output" : tensor<16x16x1x1xf16>
+    }
+
+    const.Data @ov_bin {
+        const.Rodata @value dense<1.000000e+00> : tensor<16x16x1x1xf16>
+    }
+
+    func.func @main() -> memref<16x16x1x1x!qElemType> {
+        %cst = const.Declare memref<16x16x1x1x!qElemType> = ref<@ov_bin::@value> : tensor<16x16x1x1xf16>, [#const.Quantize<!qElemType>]
+        return %cst : memref<16x16x1x1x!qElemType>
+    }
+
+    // CHECK:  const.Data @init_res {
+    // CHECK:      const.Ref [[FOLDED_SYM:@.+]] : tensor<16x16x1x1x!qElemType>
+    // CHECK:  }
+    // CHECK:  func.func @init() {
+    // CHECK:      [[LOAD:%.+]] = const.Load @ov_bin::@value -> tensor<16x16x1x1xf16>
+    // CHECK:      [[QUANTIZE:%.+]] = IE.Quantize([[LOAD]]) {dstElemType = !qElemType} : tensor<16x16x1x1xf16> -> tensor<16x16x1x1x!qElemType>
+    // CHECK:      const.Store [[QUANTIZE]], @init_res::[[FOLDED_SYM]] : tensor<16x16x1x1x!qElemType>
+    // CHECK:      return
+    // CHECK:  }
+    // CHECK:  func.func @main() -> memref<16x16x1x1x!qElemType> {
+    // CHECK:      [[CST:%.+]] = const.Load @init_res::[[FOLDED_SYM]] -> memref<16x16x1x1x!qElemType>
+    // CHECK:      return [[CST]]
+    // CHECK:  }
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// CHECK-LABEL: @UnsupportedTransformation
+module @UnsupportedTransformation {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+    } outputsInfo : {
+        DataInfo "output1" : tensor<32x16x3x3xf16>
+        DataInfo "output2" : tensor<32x16x3x3xf16>
+    }
+
+    const.Data @ov_bin {
+        const.Rodata @value dense<1.000000e+00> : tensor<32x16x3x3xf16>
+    }
+
+    // The swizzled constant stays folded on the host, the other one is still moved into @init
+    func.func @main() -> (memref<32x16x3x3xf16, #NHWC>, memref<32x16x3x3xf16, #NHWC>) {
+        %cst0 = const.Declare memref<32x16x3x3xf16, #NHWC> = ref<@ov_bin::@value> : tensor<32x16x3x3xf16>, [#const.Reorder<#NHWC>, #const.SwizzleConstant<5 : i64, 3 : i64>]
+        %cst1 = const.Declare memref<32x16x3x3xf16, #NHWC> = ref<@ov_bin::@value> : tensor<32x16x3x3xf16>, [#const.Reorder<#NHWC>]
+        return %cst0, %cst1 : memref<32x16x3x3xf16, #NHWC>, memref<32x16x3x3xf16, #NHWC>
+    }
+
+    // CHECK:  const.Data @init_res {
+    // CHECK:      const.Ref [[FOLDED_SYM:@.+]] : tensor<32x16x3x3xf16, {order = #NHWC}>
+    // CHECK:  }
+    // CHECK:  func.func @init() {
+    // CHECK-NEXT: [[LOAD:%.+]] = const.Load @ov_bin::@value -> tensor<32x16x3x3xf16>
+    // CHECK-NEXT: [[REORDER:%.+]] = IE.Reorder([[LOAD]]) {dstOrder = #NHWC} : tensor<32x16x3x3xf16> -> tensor<32x16x3x3xf16, {order = #NHWC}>
+    // CHECK-NEXT: const.Store [[REORDER]], @init_res::[[FOLDED_SYM]] : tensor<32x16x3x3xf16, {order = #NHWC}>
+    // CHECK-NEXT: return
+    // CHECK:  }
+    // CHECK:  func.func @main() -> (memref<32x16x3x3xf16, #NHWC>, memref<32x16x3x3xf16, #NHWC>) {
+    // CHECK:      [[CST0:%.+]] = const.Declare memref<32x16x3x3xf16, #NHWC> = ref<@ov_bin::@value> : tensor<32x16x3x3xf16>, [#const.Reorder<#NHWC>, #const.SwizzleConstant<5 : i64, 3 : i64>]
+    // CHECK:      [[CST1:%.+]] = const.Load @init_res::[[FOLDED_SYM]] -> memref<32x16x3x3xf16, #NHWC>
+    // CHECK:      return [[CST0]], [[CST1]]
+    // CHECK:  }
+}
+
+// -----
+
+// CHECK-LABEL: @BitPackStaysOnHost
+module @BitPackStaysOnHost {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+    } outputsInfo : {
+        DataInfo "output1" : tensor<16x16x1x1xui4>
+        DataInfo "output2" : tensor<16x16x1x1xui8>
+    }
+
+    const.Data @ov_bin {
+        const.Rodata @value dense<1.000000e+00> : tensor<16x16x1x1xf16>
+    }
+
+    // BitPack narrows the storage type, so the first constant stays folded on the host and the IE.Convert created
+    // for its first transformation is rolled back. The second constant shares the prefix of the chain and is moved
+    func.func @main() -> (memref<16x16x1x1xui4>, memref<16x16x1x1xui8>) {
+        %cst0 = const.Declare memref<16x16x1x1xui4> = ref<@ov_bin::@value> : tensor<16x16x1x1xf16>, [#const.ConvertElemType<ui8>, #const.BitPack<4 : i64>]
+        %cst1 = const.Declare memref<16x16x1x1xui8> = ref<@ov_bin::@value> : tensor<16x16x1x1xf16>, [#const.ConvertElemType<ui8>]
+        return %cst0, %cst1 : memref<16x16x1x1xui4>, memref<16x16x1x1xui8>
+    }
+
+    // CHECK:  const.Data @init_res {
+    // CHECK-NEXT: const.Ref [[FOLDED_SYM:@.+]] : tensor<16x16x1x1xui8>
+    // CHECK-NEXT: }
+    // CHECK:  func.func @init() {
+    // CHECK-NEXT: [[LOAD:%.+]] = const.Load @ov_bin::@value -> tensor<16x16x1x1xf16>
+    // CHECK-NEXT: [[CONVERT:%.+]] = IE.Convert([[LOAD]]) {dstElemType = ui8} : tensor<16x16x1x1xf16> -> tensor<16x16x1x1xui8>
+    // CHECK-NEXT: const.Store [[CONVERT]], @init_res::[[FOLDED_SYM]] : tensor<16x16x1x1xui8>
+    // CHECK-NEXT: return
+    // CHECK:  }
+    // CHECK:  func.func @main() -> (memref<16x16x1x1xui4>, memref<16x16x1x1xui8>) {
+    // CHECK:      [[CST0:%.+]] = const.Declare memref<16x16x1x1xui4> = ref<@ov_bin::@value> : tensor<16x16x1x1xf16>, [#const.ConvertElemType<ui8>, #const.BitPack<4 : i64>]
+    // CHECK:      [[CST1:%.+]] = const.Load @init_res::[[FOLDED_SYM]] -> memref<16x16x1x1xui8>
+    // CHECK:      return [[CST0]], [[CST1]]
+    // CHECK:  }
+}
@@ -0,0 +1,322 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --plan-cmx-residency-across-function-calls %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+!DDR = memref<1x16x8x8xf16, @DDR>
+!CMX = memref<1x16x8x8xf16, [@CMX_NN, 0]>
+
+// CHECK-LABEL: @ChainedCalls
+module @ChainedCalls {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+        DataInfo "input" : tensor<1x16x8x8xf16>
+    } outputsInfo : {
+        DataInfo "output" : tensor<1x16x8x8xf16>
+    }
+
+    module @VPU.SW {
+        func.func private @builtin_SoftMax(memref<*xf16, [@CMX_NN, 0]>, memref<*xf16, [@CMX_NN, 0]>, i64, i64)
+            attributes {VPU.kernel_code = "softmax.cpp", VPU.kernel_entry = "softmax", VPU.task_type = @COMPUTE}
+        func.func private @runtime() attributes {VPU.kernel_code = "nnActEntry"}
+    }
+
+    // CHECK:       IE.TileResource
+    // CHECK:           ReservedMemory
+    // CHECK-NEXT:          CMXResidencyReservedMemory
+    // CHECK-NEXT:              IE.MemoryResource 2048 bytes of @CMX_NN
+
+    // CHECK: func.func private @foo1([[IN:%.+]]: memref<1x16x8x8xf16, @DDR>, [[OUT:%.+]]: memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+    // CHECK-SAME:  -> memref<1x16x8x8xf16, [@CMX_NN, 0]>
+    func.func private @foo1(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf0 = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf0 : !CMX) -> !CMX
+        %buf1 = memref.alloc() : !CMX
+        %1 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_SoftMax
+            inputs(%0 as %arg0: !CMX) outputs(%buf1 as %arg1: !CMX) on tile 0 -> !CMX {
+            VPUIP.SW.Kernel.run {attrs = [0, 0]} (%arg0, %arg1) : !CMX, !CMX
+        }
+        %2 = VPUIP.Copy inputs(%1 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %2 : !DDR
+
+        // CHECK: [[RES:%.+]] = VPUIP.Copy inputs({{%.+}} : memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+        // CHECK-SAME:  outputs([[OUT]] : memref<1x16x8x8xf16, [@CMX_NN, 0]>) -> memref<1x16x8x8xf16, [@CMX_NN, 0]>
+        // CHECK: return [[RES]] : memref<1x16x8x8xf16, [@CMX_NN, 0]>
+    }
+
+    // CHECK: func.func private @foo2([[IN:%.+]]: memref<1x16x8x8xf16, [@CMX_NN, 0]>, [[OUT:%.+]]: memref<1x16x8x8xf16, @DDR>)
+    // CHECK-SAME:  -> memref<1x16x8x8xf16, @DDR>
+    func.func private @foo2(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf0 = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf0 : !CMX) -> !CMX
+        %buf1 = memref.alloc() : !CMX
+        %1 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_SoftMax
+            inputs(%0 as %arg0: !CMX) outputs(%buf1 as %arg1: !CMX) on tile 0 -> !CMX {
+            VPUIP.SW.Kernel.run {attrs = [0, 0]} (%arg0, %arg1) : !CMX, !CMX
+        }
+        %2 = VPUIP.Copy inputs(%1 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %2 : !DDR
+
+        // CHECK: VPUIP.Copy inputs([[IN]] : memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+        // CHECK-SAME:  outputs({{%.+}} : memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+    }
+
+    // CHECK: func.func @main([[ARG0:%.+]]: memref<1x16x8x8xf16, @DDR>, [[ARG1:%.+]]: memref<1x16x8x8xf16, @DDR>)
+    func.func @main(%arg0: !DDR, %arg1: !DDR) -> !DDR {
+        %alloc0 = memref.alloc() : !DDR
+        %alloc1 = memref.alloc() : !DDR
+        %0 = func.call @foo1(%arg0, %alloc0) : (!DDR, !DDR) -> !DDR
+        %1 = func.call @foo2(%0, %alloc1) : (!DDR, !DDR) -> !DDR
+        %2 = VPUIP.Copy inputs(%1 : !DDR) outputs(%arg1 : !DDR) -> !DDR
+        return %2 : !DDR
+
+        // The result of @foo2 is copied to the network output, keeping it in CMX does not save a transfer
+
+        // CHECK:      [[RESIDENT:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <0> {cmxResidencyBuffer}
+        // CHECK-SAME:     -> memref<1x16x8x8xf16, [@CMX_NN, 0]>
+        // CHECK:      [[ALLOC:%.+]] = memref.alloc() : memref<1x16x8x8xf16, @DDR>
+        // CHECK:      [[CALL0:%.+]] = call @foo1([[ARG0]], [[RESIDENT]])
+        // CHECK-SAME:     : (memref<1x16x8x8xf16, @DDR>, memref<1x16x8x8xf16, [@CMX_NN, 0]>) -> memref<1x16x8x8xf16, [@CMX_NN, 0]>
+        // CHECK:      [[CALL1:%.+]] = call @foo2([[CALL0]], [[ALLOC]])
+        // CHECK-SAME:     : (memref<1x16x8x8xf16, [@CMX_NN, 0]>, memref<1x16x8x8xf16, @DDR>) -> memref<1x16x8x8xf16, @DDR>
+        // CHECK:      [[OUT:%.+]] = VPUIP.Copy inputs([[CALL1]] : memref<1x16x8x8xf16, @DDR>)
+        // CHECK-SAME:     outputs([[ARG1]] : memref<1x16x8x8xf16, @DDR>)
+        // CHECK:      return [[OUT]]
+    }
+}
+
+// -----
+
+!DDR = memref<1x16x8x8xf16, @DDR>
+!CMX = memref<1x16x8x8xf16, [@CMX_NN, 0]>
+
+// CHECK-LABEL: @RepeatingCalls
+module @RepeatingCalls {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+        DataInfo "input" : tensor<1x16x8x8xf16>
+    } outputsInfo : {
+        DataInfo "output" : tensor<1x16x8x8xf16>
+    }
+
+    // CHECK: func.func private @foo([[IN:%.+]]: memref<1x16x8x8xf16, [@CMX_NN, 0]>, [[OUT:%.+]]: memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+    // CHECK-SAME:  -> memref<1x16x8x8xf16, [@CMX_NN, 0]>
+    func.func private @foo(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %1 : !DDR
+    }
+
+    // CHECK: func.func @main([[ARG0:%.+]]: memref<1x16x8x8xf16, @DDR>, [[ARG1:%.+]]: memref<1x16x8x8xf16, @DDR>)
+    func.func @main(%arg0: !DDR, %arg1: !DDR) -> !DDR {
+        // Common buffers of the repeating calls, as created by LegalizeRepeatingFuncCalls
+        %in = memref.alloc() : !DDR
+        %out = memref.alloc() : !DDR
+
+        %0 = VPUIP.Copy inputs(%arg0 : !DDR) outputs(%in : !DDR) -> !DDR
+        %1 = func.call @foo(%0, %out) : (!DDR, !DDR) -> !DDR
+        %2 = VPUIP.Copy inputs(%1 : !DDR) outputs(%in : !DDR) -> !DDR
+        %3 = func.call @foo(%2, %out) : (!DDR, !DDR) -> !DDR
+        %4 = VPUIP.Copy inputs(%3 : !DDR) outputs(%in : !DDR) -> !DDR
+        %5 = func.call @foo(%4, %out) : (!DDR, !DDR) -> !DDR
+        %6 = VPUIP.Copy inputs(%5 : !DDR) outputs(%arg1 : !DDR) -> !DDR
+        return %6 : !DDR
+
+        // The network input and output are spilled/filled in the caller, the copies between the calls stay in CMX
+
+        // CHECK:      [[IN:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <0> {cmxResidencyBuffer}
+        // CHECK:      [[OUT:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <2048> {cmxResidencyBuffer}
+        // CHECK:      [[FILL:%.+]] = VPUIP.Copy inputs([[ARG0]] : memref<1x16x8x8xf16, @DDR>)
+        // CHECK-SAME:     outputs([[IN]] : memref<1x16x8x8xf16, [@CMX_NN, 0]>) -> memref<1x16x8x8xf16, [@CMX_NN, 0]>
+        // CHECK:      [[CALL0:%.+]] = call @foo([[FILL]], [[OUT]])
+        // CHECK:      [[COPY0:%.+]] = VPUIP.Copy inputs([[CALL0]] : memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+        // CHECK-SAME:     outputs([[IN]] : memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+        // CHECK:      [[CALL1:%.+]] = call @foo([[COPY0]], [[OUT]])
+        // CHECK:      [[COPY1:%.+]] = VPUIP.Copy inputs([[CALL1]] : memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+        // CHECK-SAME:     outputs([[IN]] : memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+        // CHECK:      [[CALL2:%.+]] = call @foo([[COPY1]], [[OUT]])
+        // CHECK:      [[SPILL:%.+]] = VPUIP.Copy inputs([[CALL2]] : memref<1x16x8x8xf16, [@CMX_NN, 0]>)
+        // CHECK-SAME:     outputs([[ARG1]] : memref<1x16x8x8xf16, @DDR>) -> memref<1x16x8x8xf16, @DDR>
+        // CHECK:      return [[SPILL]]
+    }
+}
+
+// -----
+
+!DDR = memref<1x16x8x8xf16, @DDR>
+!CMX = memref<1x16x8x8xf16, [@CMX_NN, 0]>
+
+// CHECK-LABEL: @NonCopyUser
+module @NonCopyUser {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+        DataInfo "input" : tensor<1x16x8x8xf16>
+    } outputsInfo : {
+        DataInfo "output" : tensor<1x16x8x8xf16>
+    }
+
+    module @VPU.SW {
+        func.func private @builtin_SoftMax(memref<*xf16, @DDR>, memref<*xf16, @DDR>, i64, i64)
+            attributes {VPU.kernel_code = "softmax.cpp", VPU.kernel_entry = "softmax", VPU.task_type = @COMPUTE}
+        func.func private @runtime() attributes {VPU.kernel_code = "nnActEntry"}
+    }
+
+    func.func private @foo1(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %1 : !DDR
+    }
+
+    // The argument is read by a kernel in DDR, it can not be moved to CMX
+    func.func private @foo2(%in: !DDR, %out: !DDR) -> !DDR {
+        %0 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_SoftMax
+            inputs(%in as %arg0: !DDR) outputs(%out as %arg1: !DDR) on tile 0 -> !DDR {
+            VPUIP.SW.Kernel.run {attrs = [0, 0]} (%arg0, %arg1) : !DDR, !DDR
+        }
+        return %0 : !DDR
+    }
+
+    // CHECK: func.func @main
+    func.func @main(%arg0: !DDR, %arg1: !DDR) -> !DDR {
+        %alloc0 = memref.alloc() : !DDR
+        %alloc1 = memref.alloc() : !DDR
+        %0 = func.call @foo1(%arg0, %alloc0) : (!DDR, !DDR) -> !DDR
+        %1 = func.call @foo2(%0, %alloc1) : (!DDR, !DDR) -> !DDR
+        %2 = VPUIP.Copy inputs(%1 : !DDR) outputs(%arg1 : !DDR) -> !DDR
+        return %2 : !DDR
+
+        // CHECK-NOT:  VPURT.DeclareBuffer
+        // CHECK:      call @foo1
+        // CHECK-SAME:     : (memref<1x16x8x8xf16, @DDR>, memref<1x16x8x8xf16, @DDR>) -> memref<1x16x8x8xf16, @DDR>
+        // CHECK:      call @foo2
+        // CHECK-SAME:     : (memref<1x16x8x8xf16, @DDR>, memref<1x16x8x8xf16, @DDR>) -> memref<1x16x8x8xf16, @DDR>
+    }
+}
+
+// -----
+
+!DDR = memref<1x16x8x8xf16, @DDR>
+!CMX = memref<1x16x8x8xf16, [@CMX_NN, 0]>
+
+// CHECK-LABEL: @SequentialBuffersShareSlot
+module @SequentialBuffersShareSlot {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+        DataInfo "input" : tensor<1x16x8x8xf16>
+    } outputsInfo : {
+        DataInfo "output" : tensor<1x16x8x8xf16>
+    }
+
+    // Three resident buffers, the first and the last ones are never alive at the same time
+
+    // CHECK:       IE.TileResource
+    // CHECK:           ReservedMemory
+    // CHECK-NEXT:          CMXResidencyReservedMemory
+    // CHECK-NEXT:              IE.MemoryResource 4096 bytes of @CMX_NN
+
+    func.func private @foo1(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %1 : !DDR
+    }
+
+    func.func private @foo2(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %1 : !DDR
+    }
+
+    func.func private @foo3(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %1 : !DDR
+    }
+
+    func.func private @foo4(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %1 : !DDR
+    }
+
+    // CHECK: func.func @main([[ARG0:%.+]]: memref<1x16x8x8xf16, @DDR>, [[ARG1:%.+]]: memref<1x16x8x8xf16, @DDR>)
+    func.func @main(%arg0: !DDR, %arg1: !DDR) -> !DDR {
+        %alloc0 = memref.alloc() : !DDR
+        %alloc1 = memref.alloc() : !DDR
+        %alloc2 = memref.alloc() : !DDR
+        %alloc3 = memref.alloc() : !DDR
+        %0 = func.call @foo1(%arg0, %alloc0) : (!DDR, !DDR) -> !DDR
+        %1 = func.call @foo2(%0, %alloc1) : (!DDR, !DDR) -> !DDR
+        %2 = func.call @foo3(%1, %alloc2) : (!DDR, !DDR) -> !DDR
+        %3 = func.call @foo4(%2, %alloc3) : (!DDR, !DDR) -> !DDR
+        %4 = VPUIP.Copy inputs(%3 : !DDR) outputs(%arg1 : !DDR) -> !DDR
+        return %4 : !DDR
+
+        // CHECK:      [[BUF0:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <0> {cmxResidencyBuffer}
+        // CHECK:      [[BUF1:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <2048> {cmxResidencyBuffer}
+        // CHECK:      [[BUF2:%.+]] = VPURT.DeclareBuffer <CMX_NN> [0] <0> {cmxResidencyBuffer}
+        // CHECK:      [[ALLOC:%.+]] = memref.alloc() : memref<1x16x8x8xf16, @DDR>
+        // CHECK:      [[CALL0:%.+]] = call @foo1([[ARG0]], [[BUF0]])
+        // CHECK:      [[CALL1:%.+]] = call @foo2([[CALL0]], [[BUF1]])
+        // CHECK:      [[CALL2:%.+]] = call @foo3([[CALL1]], [[BUF2]])
+        // CHECK:      [[CALL3:%.+]] = call @foo4([[CALL2]], [[ALLOC]])
+    }
+}
+
+// -----
+
+!DDR = memref<1x16x8x8xf16, @DDR>
+!CMX = memref<1x16x8x8xf16, [@CMX_NN, 0]>
+
+// CHECK-LABEL: @IndependentBuffersDontShareSlot
+module @IndependentBuffersDontShareSlot {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+        DataInfo "input" : tensor<1x16x8x8xf16>
+    } outputsInfo : {
+        DataInfo "output0" : tensor<1x16x8x8xf16>
+        DataInfo "output1" : tensor<1x16x8x8xf16>
+    }
+
+    // The second chain does not depend on the first one, the schedule may run them at the same time
+
+    // CHECK:       IE.TileResource
+    // CHECK:           ReservedMemory
+    // CHECK-NEXT:          CMXResidencyReservedMemory
+    // CHECK-NEXT:              IE.MemoryResource 4096 bytes of @CMX_NN
+
+    func.func private @producer(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %1 : !DDR
+    }
+
+    func.func private @consumer(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %1 : !DDR
+    }
+
+    // CHECK: func.func @main
+    func.func @main(%arg0: !DDR, %arg1: !DDR, %arg2: !DDR) -> (!DDR, !DDR) {
+        %alloc0 = memref.alloc() : !DDR
+        %alloc1 = memref.alloc() : !DDR
+        %alloc2 = memref.alloc() : !DDR
+        %alloc3 = memref.alloc() : !DDR
+        %0 = func.call @producer(%arg0, %alloc0) : (!DDR, !DDR) -> !DDR
+        %1 = func.call @consumer(%0, %alloc1) : (!DDR, !DDR) -> !DDR
+        %2 = func.call @producer(%arg0, %alloc2) : (!DDR, !DDR) -> !DDR
+        %3 = func.call @consumer(%2, %alloc3) : (!DDR, !DDR) -> !DDR
+        %4 = VPUIP.Copy inputs(%1 : !DDR) outputs(%arg1 : !DDR) -> !DDR
+        %5 = VPUIP.Copy inputs(%3 : !DDR) outputs(%arg2 : !DDR) -> !DDR
+        return %4, %5 : !DDR, !DDR
+
+        // CHECK:      VPURT.DeclareBuffer <CMX_NN> [0] <0> {cmxResidencyBuffer}
+        // CHECK:      VPURT.DeclareBuffer <CMX_NN> [0] <2048> {cmxResidencyBuffer}
+    }
+}
@@ -0,0 +1,75 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% available-cmx-memory=1048576 allow-custom-values=true" --plan-cmx-residency-across-function-calls %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+!DDR = memref<1x16x8x8xf16, @DDR>
+!CMX = memref<1x16x8x8xf16, [@CMX_NN, 0]>
+!BigCMX = memref<1x16x120x136xf16, [@CMX_NN, 0]>
+
+// The SoftMax of @foo2 uses 1044480 bytes out of the 1044992 bytes of CMX available for tiling,
+// the remaining 512 bytes can not hold the 2048 bytes of the buffer passed between the calls
+
+// CHECK-LABEL: @CalleeCloseToCMXLimit
+module @CalleeCloseToCMXLimit {
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+        DataInfo "input" : tensor<1x16x8x8xf16>
+    } outputsInfo : {
+        DataInfo "output" : tensor<1x16x8x8xf16>
+    }
+
+    module @VPU.SW {
+        func.func private @builtin_SoftMax(memref<*xf16, [@CMX_NN, 0]>, memref<*xf16, [@CMX_NN, 0]>, i64, i64)
+            attributes {VPU.kernel_code = "softmax.cpp", VPU.kernel_entry = "softmax", VPU.task_type = @COMPUTE}
+        func.func private @runtime() attributes {VPU.kernel_code = "nnActEntry"}
+    }
+
+    // CHECK-NOT:   CMXResidencyReservedMemory
+
+    // CHECK: func.func private @foo1({{%.+}}: memref<1x16x8x8xf16, @DDR>, {{%.+}}: memref<1x16x8x8xf16, @DDR>)
+    // CHECK-SAME:  -> memref<1x16x8x8xf16, @DDR>
+    func.func private @foo1(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf0 = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf0 : !CMX) -> !CMX
+        %buf1 = memref.alloc() : !CMX
+        %1 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_SoftMax
+            inputs(%0 as %arg0: !CMX) outputs(%buf1 as %arg1: !CMX) on tile 0 -> !CMX {
+            VPUIP.SW.Kernel.run {attrs = [0, 0]} (%arg0, %arg1) : !CMX, !CMX
+        }
+        %2 = VPUIP.Copy inputs(%1 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %2 : !DDR
+    }
+
+    // CHECK: func.func private @foo2({{%.+}}: memref<1x16x8x8xf16, @DDR>, {{%.+}}: memref<1x16x8x8xf16, @DDR>)
+    // CHECK-SAME:  -> memref<1x16x8x8xf16, @DDR>
+    func.func private @foo2(%in: !DDR, %out: !DDR) -> !DDR {
+        %buf0 = memref.alloc() : !CMX
+        %0 = VPUIP.Copy inputs(%in : !DDR) outputs(%buf0 : !CMX) -> !CMX
+        %big0 = memref.alloc() : !BigCMX
+        %big1 = memref.alloc() : !BigCMX
+        %1 = VPUIP.SW.Kernel {resultSegmentSizes = array<i32: 1, 0, 0>} @VPU.SW::@builtin_SoftMax
+            inputs(%big0 as %arg0: !BigCMX) outputs(%big1 as %arg1: !BigCMX) on tile 0 -> !BigCMX {
+            VPUIP.SW.Kernel.run {attrs = [0, 0]} (%arg0, %arg1) : !BigCMX, !BigCMX
+        }
+        %2 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !DDR) -> !DDR
+        return %2 : !DDR
+    }
+
+    // CHECK: func.func @main
+    func.func @main(%arg0: !DDR, %arg1: !DDR) -> !DDR {
+        %alloc0 = memref.alloc() : !DDR
+        %alloc1 = memref.alloc() : !DDR
+        %0 = func.call @foo1(%arg0, %alloc0) : (!DDR, !DDR) -> !DDR
+        %1 = func.call @foo2(%0, %alloc1) : (!DDR, !DDR) -> !DDR
+        %2 = VPUIP.Copy inputs(%1 : !DDR) outputs(%arg1 : !DDR) -> !DDR
+        return %2 : !DDR
+
+        // CHECK-NOT:  cmxResidencyBuffer
+        // CHECK:      [[ALLOC0:%.+]] = memref.alloc() : memref<1x16x8x8xf16, @DDR>
+        // CHECK:      [[ALLOC1:%.+]] = memref.alloc() : memref<1x16x8x8xf16, @DDR>
+        // CHECK:      call @foo1({{%.+}}, [[ALLOC0]])
+    }
+}
@@ -0,0 +1,173 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% compilation-mode=DefaultHW" --dpu-profiling="sampling-period=2" %s | FileCheck %s
+// REQUIRES: arch-NPU37XX || arch-NPU40XX
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+!Output_DDR = memref<1x48x60x60xf16, #NHWC, @DDR>
+
+!Input_CMX = memref<1x16x62x62xf16, #NHWC, @CMX_NN>
+!Output_CMX = memref<1x48x60x60xf16, #NHWC, @CMX_NN>
+!Weights_CMX = memref<48x16x3x3xf16, #NHWC, @CMX_NN>
+!WeightsTable_CMX = memref<48x1x1x4xsi32, #NHWC, @CMX_NN>
+
+// CHECK-LABEL: @DpuProfilingSampled
+// CHECK-SAME:  VPUIP.dpuProfilingSampling = {numTasks = 3 : i64, samplingPeriod = 2 : i64}
+module @DpuProfilingSampled  {
+
+  IE.CNNNetwork entryPoint : @main inputsInfo :  {
+    DataInfo "input" : tensor<1x16x62x62xf16>
+    DataInfo "weights" : tensor<48x16x3x3xf16>
+    DataInfo "weightsTable" : tensor<48x1x1x4xsi32>
+  } outputsInfo :  {
+    DataInfo "output" : tensor<1x48x60x60xf16>
+  } profilingOutputsInfo :  {
+  }
+
+  func.func @main(%arg0: !Input_CMX, %arg1: !Weights_CMX, %arg2: !WeightsTable_CMX, %arg3: !Output_DDR) -> !Output_DDR {
+
+    %0 = memref.alloc() : !Output_CMX
+    %1 = VPUIP.NCEClusterTask {
+            kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            kernel_size = [3, 3],
+            kernel_strides = [1, 1],
+            task_type = #VPUIP.nce_task_type<CONV>
+        }  input(%arg0 : !Input_CMX)
+            weights(%arg1 : !Weights_CMX)
+            weight_table(%arg2 : !WeightsTable_CMX)
+            parent_input(%arg0 : !Input_CMX)
+            parent_output(%0 : !Output_CMX)
+            outputs(%0 : !Output_CMX)
+            -> !Output_CMX variants :  {
+            DPUTask {
+                outEnd = [59, 59, 47],
+                mpe_mode = #VPU.mpe_mode<VECTOR_FP16>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                outStart = [0, 0, 0]
+            }
+    } PPE :  {
+    }
+    %2 = memref.alloc() : !Output_CMX
+    %3 = VPUIP.NCEClusterTask {
+            kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            kernel_size = [3, 3],
+            kernel_strides = [1, 1],
+            task_type = #VPUIP.nce_task_type<CONV>
+        }  input(%arg0 : !Input_CMX)
+            weights(%arg1 : !Weights_CMX)
+            weight_table(%arg2 : !WeightsTable_CMX)
+            parent_input(%arg0 : !Input_CMX)
+            parent_output(%2 : !Output_CMX)
+            outputs(%2 : !Output_CMX)
+            -> !Output_CMX variants :  {
+            DPUTask {
+                outEnd = [59, 59, 47],
+                mpe_mode = #VPU.mpe_mode<VECTOR_FP16>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                outStart = [0, 0, 0]
+            }
+    } PPE :  {
+    }
+    %4 = memref.alloc() : !Output_CMX
+    %5 = VPUIP.NCEClusterTask {
+            kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            kernel_size = [3, 3],
+            kernel_strides = [1, 1],
+            task_type = #VPUIP.nce_task_type<CONV>
+        }  input(%arg0 : !Input_CMX)
+            weights(%arg1 : !Weights_CMX)
+            weight_table(%arg2 : !WeightsTable_CMX)
+            parent_input(%arg0 : !Input_CMX)
+            parent_output(%4 : !Output_CMX)
+            outputs(%4 : !Output_CMX)
+            -> !Output_CMX variants :  {
+            DPUTask {
+                outEnd = [59, 59, 47],
+                mpe_mode = #VPU.mpe_mode<VECTOR_FP16>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                outStart = [0, 0, 0]
+            }
+    } PPE :  {
+    }
+    %6 = VPUIP.NNDMA inputs(%5 : !Output_CMX) outputs(%arg3 : !Output_DDR) -> !Output_DDR
+    return %6 : !Output_DDR
+  }
+
+    // Only the 1st and the 3rd task are instrumented
+
+    //CHECK:        profilingOutputsInfo
+    //CHECK-NEXT:   DataInfo "dpu"
+
+    //CHECK:        [[NCE0:%[0-9]+]]:2 = VPUIP.NCEClusterTask
+    //CHECK-SAME:   profilingMetadata = #VPUIP.DpuProfilingMetadataAttr<bufferId = 0 : i64, taskId = 1 : i64, maxVariants = 1 : i64, numVariants = 1 : i64, clusterId = 0 : i64>
+
+    //CHECK:        [[NCE1:%[0-9]+]] = VPUIP.NCEClusterTask
+    //CHECK-NOT:    profilingMetadata
+    //CHECK-NOT:    profiling_data
+
+    //CHECK:        [[NCE2:%[0-9]+]]:2 = VPUIP.NCEClusterTask
+    //CHECK-SAME:   profilingMetadata = #VPUIP.DpuProfilingMetadataAttr<bufferId = 0 : i64, taskId = 2 : i64, maxVariants = 1 : i64, numVariants = 1 : i64, clusterId = 0 : i64>
+
+    //CHECK:        VPUIP.ConcatView inputs([[NCE0]]#1, [[NCE2]]#1
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+!Output_DDR = memref<1x48x60x60xf16, #NHWC, @DDR>
+
+!Input_CMX = memref<1x16x62x62xf16, #NHWC, @CMX_NN>
+!Output_CMX = memref<1x48x60x60xf16, #NHWC, @CMX_NN>
+!Weights_CMX = memref<48x16x3x3xf16, #NHWC, @CMX_NN>
+!WeightsTable_CMX = memref<48x1x1x4xsi32, #NHWC, @CMX_NN>
+
+// A single task is always instrumented, as the first one in the sampled sequence
+
+// CHECK-LABEL: @DpuProfilingSampledSingleTask
+// CHECK-SAME:  VPUIP.dpuProfilingSampling = {numTasks = 1 : i64, samplingPeriod = 2 : i64}
+module @DpuProfilingSampledSingleTask  {
+
+  IE.CNNNetwork entryPoint : @main inputsInfo :  {
+    DataInfo "input" : tensor<1x16x62x62xf16>
+    DataInfo "weights" : tensor<48x16x3x3xf16>
+    DataInfo "weightsTable" : tensor<48x1x1x4xsi32>
+  } outputsInfo :  {
+    DataInfo "output" : tensor<1x48x60x60xf16>
+  } profilingOutputsInfo :  {
+  }
+
+  func.func @main(%arg0: !Input_CMX, %arg1: !Weights_CMX, %arg2: !WeightsTable_CMX, %arg3: !Output_DDR) -> !Output_DDR {
+
+    %0 = memref.alloc() : !Output_CMX
+    %1 = VPUIP.NCEClusterTask {
+            kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            kernel_size = [3, 3],
+            kernel_strides = [1, 1],
+            task_type = #VPUIP.nce_task_type<CONV>
+        }  input(%arg0 : !Input_CMX)
+            weights(%arg1 : !Weights_CMX)
+            weight_table(%arg2 : !WeightsTable_CMX)
+            parent_input(%arg0 : !Input_CMX)
+            parent_output(%0 : !Output_CMX)
+            outputs(%0 : !Output_CMX)
+            -> !Output_CMX variants :  {
+            DPUTask {
+                outEnd = [59, 59, 47],
+                mpe_mode = #VPU.mpe_mode<VECTOR_FP16>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                outStart = [0, 0, 0]
+            }
+    } PPE :  {
+    }
+    %2 = VPUIP.NNDMA inputs(%1 : !Output_CMX) outputs(%arg3 : !Output_DDR) -> !Output_DDR
+    return %2 : !Output_DDR
+  }
+
+    //CHECK:        VPUIP.NCEClusterTask
+    //CHECK-SAME:   profilingMetadata = #VPUIP.DpuProfilingMetadataAttr<bufferId = 0 : i64, taskId = 1 : i64, maxVariants = 1 : i64, numVariants = 1 : i64, clusterId = 0 : i64>
+}
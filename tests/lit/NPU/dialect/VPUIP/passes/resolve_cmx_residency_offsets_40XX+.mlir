@@ -0,0 +1,84 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --resolve-cmx-residency-offsets %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+!DDR = memref<1x16x8x8xf16, @DDR>
+!CMX = memref<1x16x8x8xf16, [@CMX_NN, 0]>
+
+// CHECK-LABEL: @ImplicitOffset
+module @ImplicitOffset {
+    IE.TileResource 1 of @NCE at 1.300000e+03 MHz {
+        IE.MemoryResource 1474560 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+        builtin.module @ReservedMemory {
+            module @CustomReservedMemory {
+                IE.MemoryResource 512 bytes of @CMX_NN
+            }
+            module @CMXResidencyReservedMemory {
+                IE.MemoryResource 4096 bytes of @CMX_NN
+            }
+        }
+    }
+
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+        DataInfo "input" : tensor<1x16x8x8xf16>
+    } outputsInfo : {
+        DataInfo "output" : tensor<1x16x8x8xf16>
+    }
+
+    func.func @main(%arg0: !DDR, %arg1: !DDR) -> !DDR {
+        %in = VPURT.DeclareBuffer <CMX_NN> [0] <0> {cmxResidencyBuffer} -> !CMX
+        %out = VPURT.DeclareBuffer <CMX_NN> [0] <2048> {cmxResidencyBuffer} -> !CMX
+        %0 = VPUIP.Copy inputs(%arg0 : !DDR) outputs(%in : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%out : !CMX) -> !CMX
+        %2 = VPUIP.Copy inputs(%1 : !CMX) outputs(%arg1 : !DDR) -> !DDR
+        return %2 : !DDR
+    }
+
+    // The reserved ranges without an explicit offset are placed one after another from the beginning of CMX
+
+    // CHECK:       CustomReservedMemory
+    // CHECK-NEXT:      IE.MemoryResource 512 bytes of @CMX_NN offset 0
+    // CHECK:       CMXResidencyReservedMemory
+    // CHECK-NEXT:      IE.MemoryResource 4096 bytes of @CMX_NN offset 512
+
+    // CHECK:       func.func @main
+    // CHECK:       VPURT.DeclareBuffer <CMX_NN> [0] <512> -> memref<1x16x8x8xf16, [@CMX_NN, 0]>
+    // CHECK:       VPURT.DeclareBuffer <CMX_NN> [0] <2560> -> memref<1x16x8x8xf16, [@CMX_NN, 0]>
+}
+
+// -----
+
+!DDR = memref<1x16x8x8xf16, @DDR>
+!CMX = memref<1x16x8x8xf16, [@CMX_NN, 0]>
+
+// CHECK-LABEL: @ExplicitOffset
+module @ExplicitOffset {
+    IE.TileResource 1 of @NCE at 1.300000e+03 MHz {
+        IE.MemoryResource 1474560 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+        builtin.module @ReservedMemory {
+            module @CMXResidencyReservedMemory {
+                IE.MemoryResource 2048 bytes of @CMX_NN offset 1472512
+            }
+        }
+    }
+
+    IE.CNNNetwork entryPoint : @main inputsInfo : {
+        DataInfo "input" : tensor<1x16x8x8xf16>
+    } outputsInfo : {
+        DataInfo "output" : tensor<1x16x8x8xf16>
+    }
+
+    func.func @main(%arg0: !DDR, %arg1: !DDR) -> !DDR {
+        %buf = VPURT.DeclareBuffer <CMX_NN> [0] <0> {cmxResidencyBuffer} -> !CMX
+        %0 = VPUIP.Copy inputs(%arg0 : !DDR) outputs(%buf : !CMX) -> !CMX
+        %1 = VPUIP.Copy inputs(%0 : !CMX) outputs(%arg1 : !DDR) -> !DDR
+        return %1 : !DDR
+    }
+
+    // CHECK:       func.func @main
+    // CHECK:       VPURT.DeclareBuffer <CMX_NN> [0] <1472512> -> memref<1x16x8x8xf16, [@CMX_NN, 0]>
+}
@@ -0,0 +1,161 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt  --split-input-file --init-compiler="vpu-arch=%arch%" --split-dma-to-balance-load="dma-cost-model=true"  %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+!DummyT = memref<1x3x224x224xf16, @DDR>
+
+// Both ports are idle, the even split finishes first
+// CHECK-LABEL: @SplitWhenOtherPortIsIdle
+func.func @SplitWhenOtherPortIsIdle(%arg0: !DummyT) -> !DummyT {
+    %0 = VPURT.DeclareBuffer <DDR> <0> -> memref<1x48x18x56xf16, @DDR>
+    %1 = VPURT.DeclareBuffer <CMX_NN> [2] <100000> -> memref<1x48x18x56xf16, [@CMX_NN, 2]>
+    VPURT.Task {
+      %2 = VPUIP.NNDMA {port = 0 : i64, split_candidate} inputs(%0 : memref<1x48x18x56xf16, @DDR>) outputs(%1 : memref<1x48x18x56xf16, [@CMX_NN, 2]>) -> memref<1x48x18x56xf16, [@CMX_NN, 2]>
+    }
+    // CHECK:       [[BUFFER_DDR_0:%.+]] = VPURT.DeclareBuffer <DDR> <0> -> memref<1x24x18x56xf16, {order = #NCHW, strides = [48384, 1008, 56, 1]}, @DDR>
+    // CHECK:       [[BUFFER_DDR_1:%.+]] = VPURT.DeclareBuffer <DDR> <48384> -> memref<1x24x18x56xf16, {order = #NCHW, strides = [48384, 1008, 56, 1]}, @DDR>
+    // CHECK:       [[BUFFER_CMX_0:%.+]] = VPURT.DeclareBuffer <CMX_NN> [2] <100000> -> memref<1x24x18x56xf16, {order = #NCHW, strides = [48384, 1008, 56, 1]}, [@CMX_NN, 2]>
+    // CHECK:       [[BUFFER_CMX_1:%.+]] = VPURT.DeclareBuffer <CMX_NN> [2] <148384> -> memref<1x24x18x56xf16, {order = #NCHW, strides = [48384, 1008, 56, 1]}, [@CMX_NN, 2]>
+
+    // CHECK:       VPUIP.NNDMA {port = 0 : i64} inputs([[BUFFER_DDR_0]]
+    // CHECK-SAME:         outputs([[BUFFER_CMX_0]]
+    // CHECK:       VPUIP.NNDMA {port = 1 : i64} inputs([[BUFFER_DDR_1]]
+    // CHECK-SAME:         outputs([[BUFFER_CMX_1]]
+
+    return %arg0 : !DummyT
+}
+
+//
+// -----
+//
+
+!DummyT = memref<1x3x224x224xf16, @DDR>
+
+// Moving half of the 5KB in parallel saves less than the latency of a second descriptor
+// CHECK-LABEL: @KeepSmallDmaWhole
+func.func @KeepSmallDmaWhole(%arg0: !DummyT) -> !DummyT {
+    %cst = const.Declare memref<320x1x1x4xsi32> = dense<1> : tensor<320x1x1x4xsi32>
+    %0 = VPURT.DeclareBuffer <CMX_NN> [2] <0> -> memref<320x1x1x4xsi32, [@CMX_NN, 2]>
+    VPURT.Task {
+      %1 = VPUIP.NNDMA {port = 0 : i64, split_candidate} inputs(%cst : memref<320x1x1x4xsi32>) outputs(%0 : memref<320x1x1x4xsi32, [@CMX_NN, 2]>) -> memref<320x1x1x4xsi32, [@CMX_NN, 2]>
+    }
+
+    // CHECK:       [[CST:%.+]] = const.Declare memref<320x1x1x4xsi32> = dense<1> : tensor<320x1x1x4xsi32>
+    // CHECK:       [[BUFFER_CMX:%.+]] = VPURT.DeclareBuffer <CMX_NN> [2] <0> -> memref<320x1x1x4xsi32, [@CMX_NN, 2]>
+    // CHECK:       VPUIP.NNDMA {port = 0 : i64} inputs([[CST]] : memref<320x1x1x4xsi32>)
+    // CHECK-SAME:         outputs([[BUFFER_CMX]] : memref<320x1x1x4xsi32, [@CMX_NN, 2]>)
+    // CHECK-NOT:   VPUIP.NNDMA
+
+    return %arg0 : !DummyT
+}
+
+//
+// -----
+//
+
+!DummyT = memref<1x3x224x224xf16, @DDR>
+
+// Port 0: |- DMA 0 -|
+// Port 1: |------------------- DMA 1 -------------------|
+// Port 1 is busy with a transfer more than 7 times larger for the whole duration of DMA 0, so any split finishes later
+// CHECK-LABEL: @KeepWholeWhenOtherPortIsBusy
+func.func @KeepWholeWhenOtherPortIsBusy(%arg0: !DummyT) -> !DummyT {
+    %0 = VPURT.DeclareBuffer <DDR> <0> -> memref<1x48x18x56xf16, @DDR>
+    %1 = VPURT.DeclareBuffer <CMX_NN> [2] <100000> -> memref<1x48x18x56xf16, [@CMX_NN, 2]>
+    %2 = VPURT.DeclareBuffer <DDR> <200000> -> memref<1x1x1x368768xf16, @DDR>
+    %3 = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> memref<1x1x1x368768xf16, [@CMX_NN, 0]>
+    VPURT.Task {
+      %4 = VPUIP.NNDMA {port = 0 : i64, split_candidate} inputs(%0 : memref<1x48x18x56xf16, @DDR>) outputs(%1 : memref<1x48x18x56xf16, [@CMX_NN, 2]>) -> memref<1x48x18x56xf16, [@CMX_NN, 2]>
+    }
+    VPURT.Task {
+      %4 = VPUIP.NNDMA {port = 1 : i64} inputs(%2 : memref<1x1x1x368768xf16, @DDR>) outputs(%3 : memref<1x1x1x368768xf16, [@CMX_NN, 0]>) -> memref<1x1x1x368768xf16, [@CMX_NN, 0]>
+    }
+
+    // CHECK:       [[BUFFER_DDR:%.+]] = VPURT.DeclareBuffer <DDR> <0> -> memref<1x48x18x56xf16, @DDR>
+    // CHECK:       [[BUFFER_CMX:%.+]] = VPURT.DeclareBuffer <CMX_NN> [2] <100000> -> memref<1x48x18x56xf16, [@CMX_NN, 2]>
+    // CHECK:       VPUIP.NNDMA {port = 0 : i64} inputs([[BUFFER_DDR]] : memref<1x48x18x56xf16, @DDR>)
+    // CHECK-SAME:         outputs([[BUFFER_CMX]] : memref<1x48x18x56xf16, [@CMX_NN, 2]>)
+    // CHECK:       VPUIP.NNDMA {port = 1 : i64}
+
+    return %arg0 : !DummyT
+}
+
+//
+// -----
+//
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+!DummyT = memref<1x3x224x224xf16, @DDR>
+
+// Port 0: |------------ DMA 0 ------------|
+// Port 1: |- DMA 1 -|
+// DMA 1 moves about an eighth of DMA 0 on port 1, the 3 rows part goes to the idle port and the 2 rows part after DMA 1
+// CHECK-LABEL: @AssignLargerPartToIdlePort
+func.func @AssignLargerPartToIdlePort(%arg0: !DummyT) -> !DummyT {
+    %0 = VPURT.DeclareBuffer <DDR> <100000> -> memref<1x512x5x80xf16, {order = #NHWC, strides = [29491200, 1, 40960, 512]}, @DDR>
+    %1 = VPURT.DeclareBuffer <CMX_NN> [2] <0> -> memref<1x512x5x80xf16, #NHWC, [@CMX_NN, 2]>
+    %2 = VPURT.DeclareBuffer <DDR> <0> -> memref<1x1x1x24000xf16, @DDR>
+    %3 = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> memref<1x1x1x24000xf16, [@CMX_NN, 0]>
+    // CHECK:       [[BUFFER_DDR_0:%.+]] = VPURT.DeclareBuffer <DDR> <100000> -> memref<1x512x2x80xf16, {order = #NHWC, strides = [29491200, 1, 40960, 512]}, @DDR>
+    // CHECK:       [[BUFFER_DDR_1:%.+]] = VPURT.DeclareBuffer <DDR> <263840> -> memref<1x512x3x80xf16, {order = #NHWC, strides = [29491200, 1, 40960, 512]}, @DDR>
+    // CHECK:       [[BUFFER_CMX_0:%.+]] = VPURT.DeclareBuffer <CMX_NN> [2] <0> -> memref<1x512x2x80xf16, {order = #NHWC, strides = [204800, 1, 40960, 512]}, [@CMX_NN, 2]>
+    // CHECK:       [[BUFFER_CMX_1:%.+]] = VPURT.DeclareBuffer <CMX_NN> [2] <163840> -> memref<1x512x3x80xf16, {order = #NHWC, strides = [204800, 1, 40960, 512]}, [@CMX_NN, 2]>
+
+    VPURT.Task {
+      %4 = VPUIP.NNDMA {port = 0 : i64, split_candidate} inputs(%0 : memref<1x512x5x80xf16, {order = #NHWC, strides = [29491200, 1, 40960, 512]}, @DDR>) outputs(%1 : memref<1x512x5x80xf16, #NHWC, [@CMX_NN, 2]>) -> memref<1x512x5x80xf16, #NHWC, [@CMX_NN, 2]>
+    }
+    VPURT.Task {
+      %4 = VPUIP.NNDMA {port = 1 : i64} inputs(%2 : memref<1x1x1x24000xf16, @DDR>) outputs(%3 : memref<1x1x1x24000xf16, [@CMX_NN, 0]>) -> memref<1x1x1x24000xf16, [@CMX_NN, 0]>
+    }
+
+    // CHECK:       VPUIP.NNDMA {port = 1 : i64} inputs([[BUFFER_DDR_0]]
+    // CHECK-SAME:         outputs([[BUFFER_CMX_0]]
+    // CHECK:       VPUIP.NNDMA {port = 0 : i64} inputs([[BUFFER_DDR_1]]
+    // CHECK-SAME:         outputs([[BUFFER_CMX_1]]
+    // CHECK:       VPUIP.NNDMA {port = 1 : i64}
+
+    return %arg0 : !DummyT
+}
+
+//
+// -----
+//
+
+!DummyT = memref<1x3x224x224xf16, @DDR>
+
+// Port 0: |------------ DMA 0 ------------|
+// Port 1: |------ DMA 1 ------|
+// DMA 1 moves half of DMA 0 on port 1, so the even split would finish after the whole transfer. The split point is
+// moved by steps of 1/8 of the channels until both ports finish close to each other, the smaller part on port 1
+// CHECK-LABEL: @UnevenSplitWhenOtherPortIsBusy
+func.func @UnevenSplitWhenOtherPortIsBusy(%arg0: !DummyT) -> !DummyT {
+    %0 = VPURT.DeclareBuffer <DDR> <0> -> memref<1x48x72x56xf16, @DDR>
+    %1 = VPURT.DeclareBuffer <CMX_NN> [2] <0> -> memref<1x48x72x56xf16, [@CMX_NN, 2]>
+    %2 = VPURT.DeclareBuffer <DDR> <400000> -> memref<1x1x1x96768xf16, @DDR>
+    %3 = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> memref<1x1x1x96768xf16, [@CMX_NN, 0]>
+    VPURT.Task {
+      %4 = VPUIP.NNDMA {port = 0 : i64, split_candidate} inputs(%0 : memref<1x48x72x56xf16, @DDR>) outputs(%1 : memref<1x48x72x56xf16, [@CMX_NN, 2]>) -> memref<1x48x72x56xf16, [@CMX_NN, 2]>
+    }
+    VPURT.Task {
+      %4 = VPUIP.NNDMA {port = 1 : i64} inputs(%2 : memref<1x1x1x96768xf16, @DDR>) outputs(%3 : memref<1x1x1x96768xf16, [@CMX_NN, 0]>) -> memref<1x1x1x96768xf16, [@CMX_NN, 0]>
+    }
+
+    // CHECK-NOT:   memref<1x24x72x56xf16
+    // CHECK:       [[BUFFER_DDR_0:%.+]] = VPURT.DeclareBuffer <DDR> <0> -> memref<1x{{[0-9]+}}x72x56xf16
+    // CHECK:       [[BUFFER_DDR_1:%.+]] = VPURT.DeclareBuffer <DDR> <{{[0-9]+}}> -> memref<1x{{[0-9]+}}x72x56xf16
+    // CHECK:       [[BUFFER_CMX_0:%.+]] = VPURT.DeclareBuffer <CMX_NN> [2] <0> -> memref<1x{{[0-9]+}}x72x56xf16
+    // CHECK:       [[BUFFER_CMX_1:%.+]] = VPURT.DeclareBuffer <CMX_NN> [2] <{{[0-9]+}}> -> memref<1x{{[0-9]+}}x72x56xf16
+    // CHECK-NOT:   memref<1x24x72x56xf16
+
+    // CHECK:       VPUIP.NNDMA {port = 1 : i64} inputs([[BUFFER_DDR_0]]
+    // CHECK-SAME:         outputs([[BUFFER_CMX_0]]
+    // CHECK:       VPUIP.NNDMA {port = 0 : i64} inputs([[BUFFER_DDR_1]]
+    // CHECK-SAME:         outputs([[BUFFER_CMX_1]]
+    // CHECK:       VPUIP.NNDMA {port = 1 : i64}
+
+    return %arg0 : !DummyT
+}
@@ -0,0 +1,113 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --swizzling="enable-weights-swizzling=false enable-swizzling-planner=true" %s | FileCheck %s
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --swizzling="enable-weights-swizzling=false enable-swizzling-planner=true spill-risk-threshold=0.1" %s | FileCheck %s --check-prefix=CHECK-LOW-THRESHOLD
+// REQUIRES: arch-NPU40XX
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+IE.TileResource 1 of @NCE at 1.700000e+03 MHz {
+    IE.MemoryResource 1470000 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+    IE.ExecutorResource 1 of @DPU
+}
+
+// The operands of each conv take about 72% of CMX. With the default threshold of 80% there is no spill risk and
+// the DPU gain makes the intermediate buffer swizzled. With a threshold of 10% the predicted spill costs more than
+// the DPU cycles saved and the buffer is left as is.
+
+// CHECK-LABEL: @SwizzlingPlannerSpillRisk
+// CHECK-LOW-THRESHOLD-LABEL: @SwizzlingPlannerSpillRisk
+func.func @SwizzlingPlannerSpillRisk(%in : memref<1x64x64x64xf16, #NHWC, @DDR>,
+                        %weight_table : memref<64x1x1x4xsi32, #NHWC, @CMX_NN>,
+                        %weights : memref<64x64x1x1xf16, #NHWC, @CMX_NN>)
+                        -> memref<1x64x64x64xf16, #NHWC, @DDR> {
+
+    %buf0 = memref.alloc() : memref<1x64x64x64xf16, #NHWC, @CMX_NN>
+    %buf1 = memref.alloc() : memref<1x64x64x64xf16, #NHWC, @CMX_NN>
+    %buf2 = memref.alloc() : memref<1x64x64x64xf16, #NHWC, @CMX_NN>
+    %buf3 = memref.alloc() : memref<1x64x64x64xf16, #NHWC, @DDR>
+
+    %0 = VPUIP.Copy
+            inputs(%in : memref<1x64x64x64xf16, #NHWC, @DDR>)
+            outputs(%buf0 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+             -> memref<1x64x64x64xf16, #NHWC, @CMX_NN>
+
+    %1 = VPUIP.NCEClusterTask
+        {
+            kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            kernel_size = [1, 1],
+            kernel_strides = [1, 1],
+            task_type = #VPUIP.nce_task_type<CONV>
+        }
+        input(%0 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+        weights(%weights : memref<64x64x1x1xf16, #NHWC, @CMX_NN>)
+        weight_table(%weight_table : memref<64x1x1x4xsi32, #NHWC, @CMX_NN>)
+        parent_input(%0 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+        parent_output(%buf1 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+        outputs(%buf1 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>) -> memref<1x64x64x64xf16, #NHWC, @CMX_NN>
+        variants :
+        {
+            DPUTask
+                {
+                    outEnd = [63, 63, 63], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>,
+                    pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                    outStart = [0, 0, 0]
+                }
+        }
+        PPE :
+        {
+        }
+
+    %2 = VPUIP.NCEClusterTask
+        {
+            kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+            kernel_size = [1, 1],
+            kernel_strides = [1, 1],
+            task_type = #VPUIP.nce_task_type<CONV>
+        }
+        input(%1 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+        weights(%weights : memref<64x64x1x1xf16, #NHWC, @CMX_NN>)
+        weight_table(%weight_table : memref<64x1x1x4xsi32, #NHWC, @CMX_NN>)
+        parent_input(%1 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+        parent_output(%buf2 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+        outputs(%buf2 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>) -> memref<1x64x64x64xf16, #NHWC, @CMX_NN>
+        variants :
+        {
+            DPUTask
+                {
+                    outEnd = [63, 63, 63], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>,
+                    pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                    outStart = [0, 0, 0]
+                }
+        }
+        PPE :
+        {
+        }
+
+    %3 = VPUIP.Copy
+            inputs(%2 : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+            outputs(%buf3 : memref<1x64x64x64xf16, #NHWC, @DDR>)
+             -> memref<1x64x64x64xf16, #NHWC, @DDR>
+
+    return %3 : memref<1x64x64x64xf16, #NHWC, @DDR>
+
+    // CHECK:      [[BUF0:%.+]] = memref.alloc() : memref<1x64x64x64xf16, #NHWC, @CMX_NN>
+    // CHECK:      [[BUF1:%.+]] = VPURT.Alloc {alignment = 32768 : i64, swizzlingKey = 5 : i64} -> memref<1x64x64x64xf16, {order = #NHWC, swizzlingScheme = #VPUIP.SwizzlingSchemeAttr<key = 5 : i64, sizeAlignment = 1024 : i64>}, @CMX_NN>
+    // CHECK:      [[BUF2:%.+]] = memref.alloc() : memref<1x64x64x64xf16, #NHWC, @CMX_NN>
+
+    // CHECK:      [[CONV0:%.+]] = VPUIP.NCEClusterTask
+    // CHECK-SAME:      outputs([[BUF1]] : memref<1x64x64x64xf16, {order = #NHWC, swizzlingScheme = #VPUIP.SwizzlingSchemeAttr<key = 5 : i64, sizeAlignment = 1024 : i64>}, @CMX_NN>)
+    // CHECK:      [[CONV1:%.+]] = VPUIP.NCEClusterTask
+    // CHECK-SAME:      input([[CONV0]] : memref<1x64x64x64xf16, {order = #NHWC, swizzlingScheme = #VPUIP.SwizzlingSchemeAttr<key = 5 : i64, sizeAlignment = 1024 : i64>}, @CMX_NN>)
+    // CHECK-SAME:      outputs([[BUF2]] : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+
+    // CHECK-LOW-THRESHOLD-NOT:  VPURT.Alloc
+    // CHECK-LOW-THRESHOLD:      [[CONV0:%.+]] = VPUIP.NCEClusterTask
+    // CHECK-LOW-THRESHOLD-SAME:      outputs({{%.+}} : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+    // CHECK-LOW-THRESHOLD:      VPUIP.NCEClusterTask
+    // CHECK-LOW-THRESHOLD-SAME:      input([[CONV0]] : memref<1x64x64x64xf16, #NHWC, @CMX_NN>)
+}
+
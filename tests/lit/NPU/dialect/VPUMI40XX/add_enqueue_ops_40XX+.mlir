@@ -162,3 +162,113 @@ module @WaitAndUpdateBarrierSafetyForEnqueue attributes {VPU.compilationMode = #
 //CHECK: [[VAL31:%.*]] = VPURegMapped.Enqueue previousTaskIdx([[VAL30]] : !VPURegMapped.Index<0:0:0>) at([[VAL10]] : !VPURegMapped.Index<0:0:0>) ([[VAL19]] -> [[VAL19]] : <0:0:0> -> <0:0:0>) -> !VPURegMapped.Index<0:0:1> {taskType = #VPURegMapped.task_type<DPUVariant>}
 //CHECK: [[VAL32:%.*]] = VPURegMapped.Enqueue previousTaskIdx([[VAL31]] : !VPURegMapped.Index<0:0:1>) at([[VAL11]] : !VPURegMapped.Index<0:0:1>) ([[VAL20]] -> [[VAL20]] : <0:0:1> -> <0:0:1>) -> !VPURegMapped.Index<0:0:2> {taskType = #VPURegMapped.task_type<DPUVariant>}
 //CHECK: [[VAL33:%.*]] = VPURegMapped.Enqueue previousTaskIdx([[VAL32]] : !VPURegMapped.Index<0:0:2>) at([[VAL12]] : !VPURegMapped.Index<0:0:2>)
+
+// -----
+
+// The second DPU task can only be enqueued once the DMA waiting for barrier 1 started. The first DPU task waits for
+// barrier 2 produced by that DMA, so its enqueue is delayed to barrier 1 and both tasks share one enqueue.
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+module @BatchEnqueuesOnTimeline attributes {VPU.compilationMode = #VPU.compilation_mode<DefaultHW>} {
+  IE.TileResource 1 of @NCE at 1.700000e+03 MHz {
+    IE.MemoryResource 1474560 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+    IE.ExecutorResource 1 of @DPU
+  }
+  IE.ExecutorResource 1 of @DMA_NN
+  IE.MemoryResource 4194304000 bytes of @DDR {VPU.bandwidth = 64 : i64, VPU.derateFactor = 6.000000e-01 : f64}
+  IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "input" : tensor<1x16x16x16xf16>
+  } outputsInfo : {
+    DataInfo "output" : tensor<1x16x16x16xf16>
+  }
+  func.func @main(%arg0: memref<1x16x16x16xf16, @DDR>, %arg1: memref<1x16x16x16xf16, @DDR>) -> memref<1x16x16x16xf16, @DDR> {
+    %in = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>
+    %out = VPURT.DeclareBuffer <CMX_NN> [0] <8192> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>
+    %cmx = VPURT.DeclareBuffer <CMX_NN> [0] <16384> -> memref<1x16x16x16xf16, [@CMX_NN, 0]>
+    %b0 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 1000 : i64} <0, 3> -> !VPURegMapped.Index<0:0:0>
+    %b1 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 2000 : i64}(%b0 : !VPURegMapped.Index<0:0:0>) <1, 4> -> !VPURegMapped.Index<0:0:1>
+    %b2 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 3000 : i64}(%b1 : !VPURegMapped.Index<0:0:1>) <2, 5> -> !VPURegMapped.Index<0:0:2>
+    %b3 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 4000 : i64}(%b2 : !VPURegMapped.Index<0:0:2>) <0, -1> -> !VPURegMapped.Index<0:0:3>
+    %b4 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 5000 : i64}(%b3 : !VPURegMapped.Index<0:0:3>) <1, -1> -> !VPURegMapped.Index<0:0:4>
+    %b5 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, isFinalBarrier, producer_count = 1 : ui8, releaseCycle = 6000 : i64}(%b4 : !VPURegMapped.Index<0:0:4>) <2, -1> -> !VPURegMapped.Index<0:0:5>
+    %inv0 = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} input(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) weights(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) outputs(%out : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) waits(%b2 : !VPURegMapped.Index<0:0:2>) updates(%b3 : !VPURegMapped.Index<0:0:3>) -> <0:0:0> PPE : {
+      VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+    }
+    %inv1 = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} previousTask(%inv0 : !VPURegMapped.Index<0:0:0>) input(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) weights(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) outputs(%out : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) waits(%b3 : !VPURegMapped.Index<0:0:3>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <0:0:1> PPE : {
+      VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+    }
+    %var0 = VPUMI40XX.DPUVariant calls(%inv0 : <0:0:0>) weights(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <0:0:0>
+    %var1 = VPUMI40XX.DPUVariant previousTask(%var0 : !VPURegMapped.Index<0:0:0>) calls(%inv1 : <0:0:1>) weights(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <0:0:1>
+    %fetch = VPURegMapped.FetchTask primary(%inv0 -> %inv1) secondary(%var0 -> %var1) (<0:0:0> -> <0:0:1> : !VPURegMapped.Index<0:0:0> -> !VPURegMapped.Index<0:0:1>) -> <0:0:0>
+    %dma0 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%fetch : !VPURegMapped.Index<0:0:0>) updates(%b0 : !VPURegMapped.Index<0:0:0>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:1>
+    %dma1 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma0 : !VPURegMapped.Index<0:0:1>) waits(%b0 : !VPURegMapped.Index<0:0:0>) updates(%b1 : !VPURegMapped.Index<0:0:1>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:2>
+    %dma2 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma1 : !VPURegMapped.Index<0:0:2>) waits(%b1 : !VPURegMapped.Index<0:0:1>) updates(%b2 : !VPURegMapped.Index<0:0:2>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:3>
+    %dmaOut = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) outputs(%arg1 : memref<1x16x16x16xf16, @DDR>) waits(%b4 : !VPURegMapped.Index<0:0:4>) updates(%b5 : !VPURegMapped.Index<0:0:5>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:1:0>
+    %mpi = VPUMI40XX.MappedInference dmas((%fetch, %dmaOut) : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:1:0>)) invariants(%inv0 : !VPURegMapped.Index<0:0:0>) variants(%var0 : !VPURegMapped.Index<0:0:0>) barriers(%b0 : !VPURegMapped.Index<0:0:0>) dmaCount([[4, 1]]) invariantCount([2]) variantCount([2]) actKernelRangesCount([0]) actKernelInvocationsCount([0]) mediaCount(0) barrierCount(6) -> !VPURegMapped.Index<0:0:0>
+    return %arg1 : memref<1x16x16x16xf16, @DDR>
+  }
+}
+
+//CHECK:      [[BAR1:%.+]] = VPUMI40XX.ConfigureBarrier {{.+}} <1, 4> -> !VPURegMapped.Index<0:0:1>
+//CHECK:      [[VAR0:%.+]] = VPUMI40XX.DPUVariant
+//CHECK:      [[VAR1:%.+]] = VPUMI40XX.DPUVariant
+//CHECK:      VPURegMapped.Enqueue at([[BAR1]] : !VPURegMapped.Index<0:0:1>) ([[VAR0]] -> [[VAR1]] : <0:0:0> -> <0:0:1>)
+//CHECK-SAME:     {taskType = #VPURegMapped.task_type<DPUVariant>}
+//CHECK-NOT:  task_type<DPUVariant>
+
+// -----
+
+// Barrier 2 is produced ahead of barrier 1 in the DMA FIFO, so the first DPU task may start before barrier 1 is
+// consumed. Delaying its enqueue would stall it, both tasks keep their own enqueue.
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+module @KeepEnqueuesAheadOfTimeline attributes {VPU.compilationMode = #VPU.compilation_mode<DefaultHW>} {
+  IE.TileResource 1 of @NCE at 1.700000e+03 MHz {
+    IE.MemoryResource 1474560 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+    IE.ExecutorResource 1 of @DPU
+  }
+  IE.ExecutorResource 1 of @DMA_NN
+  IE.MemoryResource 4194304000 bytes of @DDR {VPU.bandwidth = 64 : i64, VPU.derateFactor = 6.000000e-01 : f64}
+  IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "input" : tensor<1x16x16x16xf16>
+  } outputsInfo : {
+    DataInfo "output" : tensor<1x16x16x16xf16>
+  }
+  func.func @main(%arg0: memref<1x16x16x16xf16, @DDR>, %arg1: memref<1x16x16x16xf16, @DDR>) -> memref<1x16x16x16xf16, @DDR> {
+    %in = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>
+    %out = VPURT.DeclareBuffer <CMX_NN> [0] <8192> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>
+    %cmx = VPURT.DeclareBuffer <CMX_NN> [0] <16384> -> memref<1x16x16x16xf16, [@CMX_NN, 0]>
+    %b0 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 1000 : i64} <0, 3> -> !VPURegMapped.Index<0:0:0>
+    %b1 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 3000 : i64}(%b0 : !VPURegMapped.Index<0:0:0>) <1, 4> -> !VPURegMapped.Index<0:0:1>
+    %b2 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 2000 : i64}(%b1 : !VPURegMapped.Index<0:0:1>) <2, 5> -> !VPURegMapped.Index<0:0:2>
+    %b3 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 4000 : i64}(%b2 : !VPURegMapped.Index<0:0:2>) <0, -1> -> !VPURegMapped.Index<0:0:3>
+    %b4 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 5000 : i64}(%b3 : !VPURegMapped.Index<0:0:3>) <1, -1> -> !VPURegMapped.Index<0:0:4>
+    %b5 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, isFinalBarrier, producer_count = 1 : ui8, releaseCycle = 6000 : i64}(%b4 : !VPURegMapped.Index<0:0:4>) <2, -1> -> !VPURegMapped.Index<0:0:5>
+    %inv0 = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} input(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) weights(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) outputs(%out : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) waits(%b2 : !VPURegMapped.Index<0:0:2>) updates(%b3 : !VPURegMapped.Index<0:0:3>) -> <0:0:0> PPE : {
+      VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+    }
+    %inv1 = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} previousTask(%inv0 : !VPURegMapped.Index<0:0:0>) input(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) weights(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) outputs(%out : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) waits(%b3 : !VPURegMapped.Index<0:0:3>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <0:0:1> PPE : {
+      VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+    }
+    %var0 = VPUMI40XX.DPUVariant calls(%inv0 : <0:0:0>) weights(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <0:0:0>
+    %var1 = VPUMI40XX.DPUVariant previousTask(%var0 : !VPURegMapped.Index<0:0:0>) calls(%inv1 : <0:0:1>) weights(%in : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <0:0:1>
+    %fetch = VPURegMapped.FetchTask primary(%inv0 -> %inv1) secondary(%var0 -> %var1) (<0:0:0> -> <0:0:1> : !VPURegMapped.Index<0:0:0> -> !VPURegMapped.Index<0:0:1>) -> <0:0:0>
+    %dma0 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%fetch : !VPURegMapped.Index<0:0:0>) updates(%b0 : !VPURegMapped.Index<0:0:0>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:1>
+    %dma1 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma0 : !VPURegMapped.Index<0:0:1>) updates(%b2 : !VPURegMapped.Index<0:0:2>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:2>
+    %dma2 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma1 : !VPURegMapped.Index<0:0:2>) waits(%b0 : !VPURegMapped.Index<0:0:0>) updates(%b1 : !VPURegMapped.Index<0:0:1>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:3>
+    %dma3 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma2 : !VPURegMapped.Index<0:0:3>) waits(%b1 : !VPURegMapped.Index<0:0:1>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:4>
+    %dmaOut = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) outputs(%arg1 : memref<1x16x16x16xf16, @DDR>) waits(%b4 : !VPURegMapped.Index<0:0:4>) updates(%b5 : !VPURegMapped.Index<0:0:5>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:1:0>
+    %mpi = VPUMI40XX.MappedInference dmas((%fetch, %dmaOut) : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:1:0>)) invariants(%inv0 : !VPURegMapped.Index<0:0:0>) variants(%var0 : !VPURegMapped.Index<0:0:0>) barriers(%b0 : !VPURegMapped.Index<0:0:0>) dmaCount([[5, 1]]) invariantCount([2]) variantCount([2]) actKernelRangesCount([0]) actKernelInvocationsCount([0]) mediaCount(0) barrierCount(6) -> !VPURegMapped.Index<0:0:0>
+    return %arg1 : memref<1x16x16x16xf16, @DDR>
+  }
+}
+
+//CHECK:      [[BAR0:%.+]] = VPUMI40XX.ConfigureBarrier {{.+}} <0, 3> -> !VPURegMapped.Index<0:0:0>
+//CHECK:      [[BAR1:%.+]] = VPUMI40XX.ConfigureBarrier {{.+}} <1, 4> -> !VPURegMapped.Index<0:0:1>
+//CHECK:      [[VAR0:%.+]] = VPUMI40XX.DPUVariant
+//CHECK:      [[VAR1:%.+]] = VPUMI40XX.DPUVariant
+//CHECK:      VPURegMapped.Enqueue at([[BAR0]] : !VPURegMapped.Index<0:0:0>) ([[VAR0]] -> [[VAR0]] : <0:0:0> -> <0:0:0>)
+//CHECK-SAME:     {taskType = #VPURegMapped.task_type<DPUVariant>}
+//CHECK:      VPURegMapped.Enqueue
+//CHECK-SAME:     at([[BAR1]] : !VPURegMapped.Index<0:0:1>) ([[VAR1]] -> [[VAR1]] : <0:0:1> -> <0:0:1>)
+//CHECK-SAME:     {taskType = #VPURegMapped.task_type<DPUVariant>}
@@ -0,0 +1,189 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch% allow-custom-values=true" --workload-management %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+// Two tiles with two groups each. The first group of tile 0 waits for DMA1, the one of tile 1 for DMA0, the second
+// groups of both tiles wait for DMA3. The fetch of the second group of tile 0 can't go before DMA1, the fetch of
+// the second group of tile 1 is batched with it, as the batch completes with DMA2 long before DMA3.
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+module @TwoTiles attributes {VPU.compilationMode = #VPU.compilation_mode<DefaultHW>} {
+  IE.TileResource 2 of @NCE at 1.700000e+03 MHz {
+    IE.MemoryResource 1474560 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+    IE.ExecutorResource 1 of @DPU
+  }
+  IE.ExecutorResource 1 of @DMA_NN
+  IE.MemoryResource 4194304000 bytes of @DDR {VPU.bandwidth = 64 : i64, VPU.derateFactor = 6.000000e-01 : f64}
+  IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "input" : tensor<1x16x16x16xf16>
+  } outputsInfo : {
+    DataInfo "output" : tensor<1x16x16x16xf16>
+  }
+  func.func @main(%arg0: memref<1x16x16x16xf16, @DDR>, %arg1: memref<1x16x16x16xf16, @DDR>) -> memref<1x16x16x16xf16, @DDR> {
+    %in0 = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>
+    %out0 = VPURT.DeclareBuffer <CMX_NN> [0] <8192> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>
+    %in1 = VPURT.DeclareBuffer <CMX_NN> [1] <0> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>
+    %out1 = VPURT.DeclareBuffer <CMX_NN> [1] <8192> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>
+    %cmx = VPURT.DeclareBuffer <CMX_NN> [0] <16384> -> memref<1x16x16x16xf16, [@CMX_NN, 0]>
+    %b0 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 1000 : i64} <0, -1> -> !VPURegMapped.Index<0:0:0>
+    %b1 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 2000 : i64} <1, -1> -> !VPURegMapped.Index<0:0:1>
+    %b2 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 3000 : i64} <2, -1> -> !VPURegMapped.Index<0:0:2>
+    %b3 = VPUMI40XX.ConfigureBarrier {consumer_count = 2 : ui8, producer_count = 1 : ui8, releaseCycle = 100000 : i64} <3, -1> -> !VPURegMapped.Index<0:0:3>
+    %b4 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 4 : ui8, releaseCycle = 200000 : i64} <4, -1> -> !VPURegMapped.Index<0:0:4>
+    %b5 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, isFinalBarrier, producer_count = 1 : ui8, releaseCycle = 210000 : i64} <5, -1> -> !VPURegMapped.Index<0:0:5>
+    %g0s:2, %g0e:2 = "VPURegMapped.ExecutionGroup"(%b1, %b4) ({
+      %g0_inv = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} input(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) weights(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) outputs(%out0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) waits(%b1 : !VPURegMapped.Index<0:0:1>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <0:0:0> PPE : {
+        VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+      }
+      %g0_var = VPUMI40XX.DPUVariant calls(%g0_inv : <0:0:0>) weights(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <0:0:0>
+      "VPURegMapped.GroupYield"(%g0_inv, %g0_var, %g0_inv, %g0_var) {operandSegmentSizes = array<i32: 2, 2>} : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>) -> ()
+    }) {operandSegmentSizes = array<i32: 0, 1, 1>, resultSegmentSizes = array<i32: 2, 2>, task_type = #VPURegMapped.task_type<DPUInvariant>} : (!VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:4>) -> (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>)
+    %g1s:2, %g1e:2 = "VPURegMapped.ExecutionGroup"(%g0e#0, %g0e#1, %b3, %b4) ({
+    ^bb0(%g1_prev0: !VPURegMapped.Index<0:0:0>, %g1_prev1: !VPURegMapped.Index<0:0:0>):
+      %g1_inv = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} previousTask(%g1_prev0 : !VPURegMapped.Index<0:0:0>) input(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) weights(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) outputs(%out0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) waits(%b3 : !VPURegMapped.Index<0:0:3>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <0:0:1> PPE : {
+        VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+      }
+      %g1_var = VPUMI40XX.DPUVariant previousTask(%g1_prev1 : !VPURegMapped.Index<0:0:0>) calls(%g1_inv : <0:0:1>) weights(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <0:0:1>
+      "VPURegMapped.GroupYield"(%g1_inv, %g1_var, %g1_inv, %g1_var) {operandSegmentSizes = array<i32: 2, 2>} : (!VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>) -> ()
+    }) {operandSegmentSizes = array<i32: 2, 1, 1>, resultSegmentSizes = array<i32: 2, 2>, task_type = #VPURegMapped.task_type<DPUInvariant>} : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:3>, !VPURegMapped.Index<0:0:4>) -> (!VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>)
+    %h0s:2, %h0e:2 = "VPURegMapped.ExecutionGroup"(%b0, %b4) ({
+      %h0_inv = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} input(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) weights(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) outputs(%out1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) waits(%b0 : !VPURegMapped.Index<0:0:0>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <1:0:0> PPE : {
+        VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+      }
+      %h0_var = VPUMI40XX.DPUVariant calls(%h0_inv : <1:0:0>) weights(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <1:0:0>
+      "VPURegMapped.GroupYield"(%h0_inv, %h0_var, %h0_inv, %h0_var) {operandSegmentSizes = array<i32: 2, 2>} : (!VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>) -> ()
+    }) {operandSegmentSizes = array<i32: 0, 1, 1>, resultSegmentSizes = array<i32: 2, 2>, task_type = #VPURegMapped.task_type<DPUInvariant>} : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:4>) -> (!VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>)
+    %h1s:2, %h1e:2 = "VPURegMapped.ExecutionGroup"(%h0e#0, %h0e#1, %b3, %b4) ({
+    ^bb0(%h1_prev0: !VPURegMapped.Index<1:0:0>, %h1_prev1: !VPURegMapped.Index<1:0:0>):
+      %h1_inv = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} previousTask(%h1_prev0 : !VPURegMapped.Index<1:0:0>) input(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) weights(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) outputs(%out1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) waits(%b3 : !VPURegMapped.Index<0:0:3>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <1:0:1> PPE : {
+        VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+      }
+      %h1_var = VPUMI40XX.DPUVariant previousTask(%h1_prev1 : !VPURegMapped.Index<1:0:0>) calls(%h1_inv : <1:0:1>) weights(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <1:0:1>
+      "VPURegMapped.GroupYield"(%h1_inv, %h1_var, %h1_inv, %h1_var) {operandSegmentSizes = array<i32: 2, 2>} : (!VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>) -> ()
+    }) {operandSegmentSizes = array<i32: 2, 1, 1>, resultSegmentSizes = array<i32: 2, 2>, task_type = #VPURegMapped.task_type<DPUInvariant>} : (!VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<0:0:3>, !VPURegMapped.Index<0:0:4>) -> (!VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>)
+    %dma0 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) updates(%b0 : !VPURegMapped.Index<0:0:0>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:0>
+    %dma1 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma0 : !VPURegMapped.Index<0:0:0>) updates(%b1 : !VPURegMapped.Index<0:0:1>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:1>
+    %dma2 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma1 : !VPURegMapped.Index<0:0:1>) updates(%b2 : !VPURegMapped.Index<0:0:2>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:2>
+    %dma3 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma2 : !VPURegMapped.Index<0:0:2>) updates(%b3 : !VPURegMapped.Index<0:0:3>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:3>
+    %dmaOut = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) outputs(%arg1 : memref<1x16x16x16xf16, @DDR>) waits(%b2, %b4 : !VPURegMapped.Index<0:0:2>, !VPURegMapped.Index<0:0:4>) updates(%b5 : !VPURegMapped.Index<0:0:5>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:1:0>
+    %mpi = VPUMI40XX.MappedInference dmas((%dma0, %dmaOut) : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:1:0>)) invariants(%g0s#0, %h0s#0 : !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<1:0:0>) variants(%g0s#1, %h0s#1 : !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<1:0:0>) barriers(%b0 : !VPURegMapped.Index<0:0:0>) dmaCount([[4, 1], [0, 0]]) invariantCount([2, 2]) variantCount([2, 2]) actKernelRangesCount([0, 0]) actKernelInvocationsCount([0, 0]) mediaCount(0) barrierCount(6) -> !VPURegMapped.Index<0:0:0>
+    return %arg1 : memref<1x16x16x16xf16, @DDR>
+  }
+}
+
+// CHECK:       [[G0S:%[a-zA-Z0-9_]+]]:2, [[G0E:%[a-zA-Z0-9_]+]]:2 = "VPURegMapped.ExecutionGroup"
+// CHECK:       [[G1S:%[a-zA-Z0-9_]+]]:2, [[G1E:%[a-zA-Z0-9_]+]]:2 = "VPURegMapped.ExecutionGroup"
+// CHECK:       [[H0S:%[a-zA-Z0-9_]+]]:2, [[H0E:%[a-zA-Z0-9_]+]]:2 = "VPURegMapped.ExecutionGroup"
+// CHECK:       [[H1S:%[a-zA-Z0-9_]+]]:2, [[H1E:%[a-zA-Z0-9_]+]]:2 = "VPURegMapped.ExecutionGroup"
+// CHECK:       [[FETCH_H0:%.+]] = VPURegMapped.FetchTask primary([[H0S]]#0 -> [[H0E]]#0) secondary([[H0S]]#1 -> [[H0E]]#1)
+// CHECK-SAME:      -> <0:0:0>
+// CHECK-NEXT:  [[FETCH_G0:%.+]] = VPURegMapped.FetchTask previousTask([[FETCH_H0]] : !VPURegMapped.Index<0:0:0>) primary([[G0S]]#0 -> [[G0E]]#0)
+// CHECK-SAME:      -> <0:0:1>
+// CHECK-NEXT:  [[DMA0:%.+]] = VPUMI40XX.NNDMA
+// CHECK-SAME:      previousDMA([[FETCH_G0]] : !VPURegMapped.Index<0:0:1>)
+// CHECK-SAME:      -> !VPURegMapped.Index<0:0:2>
+// CHECK-NEXT:  [[DMA1:%.+]] = VPUMI40XX.NNDMA
+// CHECK-SAME:      previousDMA([[DMA0]] : !VPURegMapped.Index<0:0:2>)
+// CHECK-SAME:      -> !VPURegMapped.Index<0:0:3>
+// CHECK-NEXT:  [[FETCH_H1:%.+]] = VPURegMapped.FetchTask previousTask([[DMA1]] : !VPURegMapped.Index<0:0:3>) primary([[H1S]]#0 -> [[H1E]]#0)
+// CHECK-SAME:      -> <0:0:4>
+// CHECK-NEXT:  [[FETCH_G1:%.+]] = VPURegMapped.FetchTask previousTask([[FETCH_H1]] : !VPURegMapped.Index<0:0:4>) primary([[G1S]]#0 -> [[G1E]]#0)
+// CHECK-SAME:      -> <0:0:5>
+// CHECK-NEXT:  [[DMA2:%.+]] = VPUMI40XX.NNDMA
+// CHECK-SAME:      previousDMA([[FETCH_G1]] : !VPURegMapped.Index<0:0:5>)
+// CHECK-SAME:      -> !VPURegMapped.Index<0:0:6>
+// CHECK:       VPUMI40XX.MappedInference
+// CHECK-SAME:      dmaCount({{\[}}[8, 1], [0, 0]])
+
+// -----
+
+// Same as above, but DMA2 completes only when the second groups become ready, so the fetch of the second group of
+// tile 1 can't be batched and stays at its earliest position after DMA0.
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+module @TwoTiles attributes {VPU.compilationMode = #VPU.compilation_mode<DefaultHW>} {
+  IE.TileResource 2 of @NCE at 1.700000e+03 MHz {
+    IE.MemoryResource 1474560 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+    IE.ExecutorResource 1 of @DPU
+  }
+  IE.ExecutorResource 1 of @DMA_NN
+  IE.MemoryResource 4194304000 bytes of @DDR {VPU.bandwidth = 64 : i64, VPU.derateFactor = 6.000000e-01 : f64}
+  IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "input" : tensor<1x16x16x16xf16>
+  } outputsInfo : {
+    DataInfo "output" : tensor<1x16x16x16xf16>
+  }
+  func.func @main(%arg0: memref<1x16x16x16xf16, @DDR>, %arg1: memref<1x16x16x16xf16, @DDR>) -> memref<1x16x16x16xf16, @DDR> {
+    %in0 = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>
+    %out0 = VPURT.DeclareBuffer <CMX_NN> [0] <8192> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>
+    %in1 = VPURT.DeclareBuffer <CMX_NN> [1] <0> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>
+    %out1 = VPURT.DeclareBuffer <CMX_NN> [1] <8192> -> memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>
+    %cmx = VPURT.DeclareBuffer <CMX_NN> [0] <16384> -> memref<1x16x16x16xf16, [@CMX_NN, 0]>
+    %b0 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 1000 : i64} <0, -1> -> !VPURegMapped.Index<0:0:0>
+    %b1 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 2000 : i64} <1, -1> -> !VPURegMapped.Index<0:0:1>
+    %b2 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 1 : ui8, releaseCycle = 100000 : i64} <2, -1> -> !VPURegMapped.Index<0:0:2>
+    %b3 = VPUMI40XX.ConfigureBarrier {consumer_count = 2 : ui8, producer_count = 1 : ui8, releaseCycle = 100000 : i64} <3, -1> -> !VPURegMapped.Index<0:0:3>
+    %b4 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, producer_count = 4 : ui8, releaseCycle = 200000 : i64} <4, -1> -> !VPURegMapped.Index<0:0:4>
+    %b5 = VPUMI40XX.ConfigureBarrier {consumer_count = 1 : ui8, isFinalBarrier, producer_count = 1 : ui8, releaseCycle = 210000 : i64} <5, -1> -> !VPURegMapped.Index<0:0:5>
+    %g0s:2, %g0e:2 = "VPURegMapped.ExecutionGroup"(%b1, %b4) ({
+      %g0_inv = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} input(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) weights(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) outputs(%out0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) waits(%b1 : !VPURegMapped.Index<0:0:1>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <0:0:0> PPE : {
+        VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+      }
+      %g0_var = VPUMI40XX.DPUVariant calls(%g0_inv : <0:0:0>) weights(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <0:0:0>
+      "VPURegMapped.GroupYield"(%g0_inv, %g0_var, %g0_inv, %g0_var) {operandSegmentSizes = array<i32: 2, 2>} : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>) -> ()
+    }) {operandSegmentSizes = array<i32: 0, 1, 1>, resultSegmentSizes = array<i32: 2, 2>, task_type = #VPURegMapped.task_type<DPUInvariant>} : (!VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:4>) -> (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>)
+    %g1s:2, %g1e:2 = "VPURegMapped.ExecutionGroup"(%g0e#0, %g0e#1, %b3, %b4) ({
+    ^bb0(%g1_prev0: !VPURegMapped.Index<0:0:0>, %g1_prev1: !VPURegMapped.Index<0:0:0>):
+      %g1_inv = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} previousTask(%g1_prev0 : !VPURegMapped.Index<0:0:0>) input(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) weights(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) outputs(%out0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) waits(%b3 : !VPURegMapped.Index<0:0:3>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <0:0:1> PPE : {
+        VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+      }
+      %g1_var = VPUMI40XX.DPUVariant previousTask(%g1_prev1 : !VPURegMapped.Index<0:0:0>) calls(%g1_inv : <0:0:1>) weights(%in0 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 0]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <0:0:1>
+      "VPURegMapped.GroupYield"(%g1_inv, %g1_var, %g1_inv, %g1_var) {operandSegmentSizes = array<i32: 2, 2>} : (!VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>) -> ()
+    }) {operandSegmentSizes = array<i32: 2, 1, 1>, resultSegmentSizes = array<i32: 2, 2>, task_type = #VPURegMapped.task_type<DPUInvariant>} : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:3>, !VPURegMapped.Index<0:0:4>) -> (!VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>, !VPURegMapped.Index<0:0:1>)
+    %h0s:2, %h0e:2 = "VPURegMapped.ExecutionGroup"(%b0, %b4) ({
+      %h0_inv = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} input(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) weights(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) outputs(%out1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) waits(%b0 : !VPURegMapped.Index<0:0:0>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <1:0:0> PPE : {
+        VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+      }
+      %h0_var = VPUMI40XX.DPUVariant calls(%h0_inv : <1:0:0>) weights(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <1:0:0>
+      "VPURegMapped.GroupYield"(%h0_inv, %h0_var, %h0_inv, %h0_var) {operandSegmentSizes = array<i32: 2, 2>} : (!VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>) -> ()
+    }) {operandSegmentSizes = array<i32: 0, 1, 1>, resultSegmentSizes = array<i32: 2, 2>, task_type = #VPURegMapped.task_type<DPUInvariant>} : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:0:4>) -> (!VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>)
+    %h1s:2, %h1e:2 = "VPURegMapped.ExecutionGroup"(%h0e#0, %h0e#1, %b3, %b4) ({
+    ^bb0(%h1_prev0: !VPURegMapped.Index<1:0:0>, %h1_prev1: !VPURegMapped.Index<1:0:0>):
+      %h1_inv = VPUMI40XX.DPUInvariant {clean_after = 0 : ui64, mpe_frequent_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, start_after = 0 : ui64} previousTask(%h1_prev0 : !VPURegMapped.Index<1:0:0>) input(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) weights(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) outputs(%out1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) waits(%b3 : !VPURegMapped.Index<0:0:3>) updates(%b4 : !VPURegMapped.Index<0:0:4>) -> <1:0:1> PPE : {
+        VPUMI40XX.PPETask {opaque_ppe = #VPU.PPEStub<>}
+      }
+      %h1_var = VPUMI40XX.DPUVariant previousTask(%h1_prev1 : !VPURegMapped.Index<1:0:0>) calls(%h1_inv : <1:0:1>) weights(%in1 : memref<1x16x16x16xf16, #NHWC, [@CMX_NN, 1]>) {end = [15, 15, 15], inEnd = [15, 15, 15], inStart = [0, 0, 0], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, nce_task_type = #VPUIP.nce_task_type<ELTWISE>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, start = [0, 0, 0]} -> <1:0:1>
+      "VPURegMapped.GroupYield"(%h1_inv, %h1_var, %h1_inv, %h1_var) {operandSegmentSizes = array<i32: 2, 2>} : (!VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>) -> ()
+    }) {operandSegmentSizes = array<i32: 2, 1, 1>, resultSegmentSizes = array<i32: 2, 2>, task_type = #VPURegMapped.task_type<DPUInvariant>} : (!VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<1:0:0>, !VPURegMapped.Index<0:0:3>, !VPURegMapped.Index<0:0:4>) -> (!VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>, !VPURegMapped.Index<1:0:1>)
+    %dma0 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) updates(%b0 : !VPURegMapped.Index<0:0:0>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:0>
+    %dma1 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma0 : !VPURegMapped.Index<0:0:0>) updates(%b1 : !VPURegMapped.Index<0:0:1>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:1>
+    %dma2 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma1 : !VPURegMapped.Index<0:0:1>) updates(%b2 : !VPURegMapped.Index<0:0:2>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:2>
+    %dma3 = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%arg0 : memref<1x16x16x16xf16, @DDR>) outputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) previousDMA(%dma2 : !VPURegMapped.Index<0:0:2>) updates(%b3 : !VPURegMapped.Index<0:0:3>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:0:3>
+    %dmaOut = VPUMI40XX.NNDMA {port = 0 : i64} inputs(%cmx : memref<1x16x16x16xf16, [@CMX_NN, 0]>) outputs(%arg1 : memref<1x16x16x16xf16, @DDR>) waits(%b2, %b4 : !VPURegMapped.Index<0:0:2>, !VPURegMapped.Index<0:0:4>) updates(%b5 : !VPURegMapped.Index<0:0:5>) start_after(0) clean_after(0) acceleration_mode(<DISABLE>) -> !VPURegMapped.Index<0:1:0>
+    %mpi = VPUMI40XX.MappedInference dmas((%dma0, %dmaOut) : (!VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<0:1:0>)) invariants(%g0s#0, %h0s#0 : !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<1:0:0>) variants(%g0s#1, %h0s#1 : !VPURegMapped.Index<0:0:0>, !VPURegMapped.Index<1:0:0>) barriers(%b0 : !VPURegMapped.Index<0:0:0>) dmaCount([[4, 1], [0, 0]]) invariantCount([2, 2]) variantCount([2, 2]) actKernelRangesCount([0, 0]) actKernelInvocationsCount([0, 0]) mediaCount(0) barrierCount(6) -> !VPURegMapped.Index<0:0:0>
+    return %arg1 : memref<1x16x16x16xf16, @DDR>
+  }
+}
+
+// CHECK:       [[G0S:%[a-zA-Z0-9_]+]]:2, [[G0E:%[a-zA-Z0-9_]+]]:2 = "VPURegMapped.ExecutionGroup"
+// CHECK:       [[G1S:%[a-zA-Z0-9_]+]]:2, [[G1E:%[a-zA-Z0-9_]+]]:2 = "VPURegMapped.ExecutionGroup"
+// CHECK:       [[H0S:%[a-zA-Z0-9_]+]]:2, [[H0E:%[a-zA-Z0-9_]+]]:2 = "VPURegMapped.ExecutionGroup"
+// CHECK:       [[H1S:%[a-zA-Z0-9_]+]]:2, [[H1E:%[a-zA-Z0-9_]+]]:2 = "VPURegMapped.ExecutionGroup"
+// CHECK:       [[FETCH_H0:%.+]] = VPURegMapped.FetchTask primary([[H0S]]#0 -> [[H0E]]#0) secondary([[H0S]]#1 -> [[H0E]]#1)
+// CHECK-SAME:      -> <0:0:0>
+// CHECK-NEXT:  [[FETCH_G0:%.+]] = VPURegMapped.FetchTask previousTask([[FETCH_H0]] : !VPURegMapped.Index<0:0:0>) primary([[G0S]]#0 -> [[G0E]]#0)
+// CHECK-SAME:      -> <0:0:1>
+// CHECK-NEXT:  [[DMA0:%.+]] = VPUMI40XX.NNDMA
+// CHECK-SAME:      previousDMA([[FETCH_G0]] : !VPURegMapped.Index<0:0:1>)
+// CHECK-SAME:      -> !VPURegMapped.Index<0:0:2>
+// CHECK-NEXT:  [[FETCH_H1:%.+]] = VPURegMapped.FetchTask previousTask([[DMA0]] : !VPURegMapped.Index<0:0:2>) primary([[H1S]]#0 -> [[H1E]]#0)
+// CHECK-SAME:      -> <0:0:3>
+// CHECK-NEXT:  [[DMA1:%.+]] = VPUMI40XX.NNDMA
+// CHECK-SAME:      previousDMA([[FETCH_H1]] : !VPURegMapped.Index<0:0:3>)
+// CHECK-SAME:      -> !VPURegMapped.Index<0:0:4>
+// CHECK-NEXT:  [[FETCH_G1:%.+]] = VPURegMapped.FetchTask previousTask([[DMA1]] : !VPURegMapped.Index<0:0:4>) primary([[G1S]]#0 -> [[G1E]]#0)
+// CHECK-SAME:      -> <0:0:5>
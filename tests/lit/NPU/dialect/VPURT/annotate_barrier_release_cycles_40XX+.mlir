@@ -0,0 +1,29 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --annotate-barrier-release-cycles %s | FileCheck %s
+// REQUIRES: arch-NPU40XX
+
+!DDRType = memref<1x16x32x32xf16, @DDR>
+!CMXType = memref<1x16x32x32xf16, [@CMX_NN, 0]>
+
+// The DMAs are serialized by the barrier, each one takes the profiled cost
+// CHECK-LABEL: @DmaChain
+func.func @DmaChain(%arg0: !DDRType, %arg1: !DDRType) -> !DDRType {
+    %bar0 = VPURT.ConfigureBarrier<0> -> !VPURT.Barrier
+    %bar1 = VPURT.ConfigureBarrier<1> {isFinalBarrier} -> !VPURT.Barrier
+    %buf = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> !CMXType
+
+    VPURT.Task updates(%bar0 : !VPURT.Barrier) {
+        %0 = VPUIP.NNDMA {port = 0 : i64, profiledCycleCost = 1000 : i64} inputs(%arg0 : !DDRType) outputs(%buf : !CMXType) -> !CMXType
+    }
+    VPURT.Task waits(%bar0 : !VPURT.Barrier) updates(%bar1 : !VPURT.Barrier) {
+        %0 = VPUIP.NNDMA {port = 0 : i64, profiledCycleCost = 1000 : i64} inputs(%buf : !CMXType) outputs(%arg1 : !DDRType) -> !DDRType
+    }
+    return %arg1 : !DDRType
+
+    // CHECK:       VPURT.ConfigureBarrier<0> {releaseCycle = 1000 : i64}
+    // CHECK:       VPURT.ConfigureBarrier<1> {isFinalBarrier, releaseCycle = 2000 : i64}
+}
@@ -69,6 +69,24 @@ TEST_F(MLIR_FunctionOutliningSplitterOptions, ParamsWellFormedDefaultValues) {
     ASSERT_EQ(options.getIf<NaiveOptions>(1)->numParts, NaiveOptions::NUM_PARTS_DEFAULT);
 }
 
+TEST_F(MLIR_FunctionOutliningSplitterOptions, ParamsHashMatching) {
+    std::string param = "'repeating-blocks=hash-matching=true, repeating-blocks-separate-functions=hash-matching=true'";
+    auto options = OutlinerPassOptions::createFromString(param);
+
+    ASSERT_NE(options.getIf<RepeatingBlocksOptions>(0), nullptr);
+    ASSERT_NE(options.getIf<RepeatingBlocksSeparateFunctionsOptions>(1), nullptr);
+
+    ASSERT_EQ(options.getIf<RepeatingBlocksOptions>(0)->hashMatching, true);
+    ASSERT_EQ(options.getIf<RepeatingBlocksOptions>(0)->weightsAsInputs,
+              RepeatingBlocksOptions::WEIGHTS_AS_INPUTS_DEFAULT);
+    ASSERT_EQ(options.getIf<RepeatingBlocksSeparateFunctionsOptions>(1)->hashMatching, true);
+
+    auto defaultOptions = OutlinerPassOptions::createFromString("repeating-blocks");
+    ASSERT_NE(defaultOptions.getIf<RepeatingBlocksOptions>(0), nullptr);
+    ASSERT_EQ(defaultOptions.getIf<RepeatingBlocksOptions>(0)->hashMatching,
+              RepeatingBlocksOptions::HASH_MATCHING_DEFAULT);
+}
+
 TEST_F(MLIR_FunctionOutliningSplitterOptions, ParamsIllFormedNoInteger) {
     std::string param = " '   repeating-blocks= min-ops-in-block=def     max-num-iterations=11    ,   naive=   "
                         "num-parts=33'   ";
@@ -1735,3 +1735,219 @@ TEST_F(MLIR_FunctionOutliningSplitterRepeating, FirstInstanceInputReuse) {
         }
     }
 }
+
+/**
+ * Same IR as in the MultipleBlocks test, with the blocks identified as repeating sequences of operations:
+ *
+ *  MaxPool -> AvgPool -> AvgPool -> SoftMax -> Add -> Multiply -> MaxPool -> AvgPool -> AvgPool -> Add -> Multiply
+ */
+TEST_F(MLIR_FunctionOutliningSplitterRepeating, MultipleBlocksHashMatching) {
+    auto registry = vpux::createDialectRegistry();
+
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<IE::IEDialect>();
+
+    constexpr StringLiteral inputIR = R"(
+        module @test {
+            func.func @main(%input: tensor<1x3x300x300xf32>) -> tensor<1x3x300x300xf32> {
+                %maxpool1 = IE.MaxPool(%input) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("maxpool1")
+                %avgpool1 = IE.AvgPool(%maxpool1) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("avgpool1")
+                %avgpool2 = IE.AvgPool(%avgpool1) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("avgpool2")
+
+                %softmax = IE.SoftMax(%avgpool2) {axisInd = -1} : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("softmax")
+
+                %add1 = IE.Add(%softmax, %softmax) {
+                        auto_broadcast = #IE.auto_broadcast_type<NUMPY>
+                    } : tensor<1x3x300x300xf32>, tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("add1")
+                %multiply1 = IE.Multiply(%add1, %add1) {
+                        auto_broadcast = #IE.auto_broadcast_type<NUMPY>
+                    } : tensor<1x3x300x300xf32>, tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("multiply1")
+
+                %maxpool2 = IE.MaxPool(%multiply1) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("maxpool2")
+                %avgpool3 = IE.AvgPool(%maxpool2) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("avgpool3")
+                %avgpool4 = IE.AvgPool(%avgpool3) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("avgpool4")
+
+                %add2 = IE.Add(%avgpool4, %avgpool4) {
+                        auto_broadcast = #IE.auto_broadcast_type<NUMPY>
+                    } : tensor<1x3x300x300xf32>, tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("add2")
+                %multiply2 = IE.Multiply(%add2, %add2) {
+                        auto_broadcast = #IE.auto_broadcast_type<NUMPY>
+                    } : tensor<1x3x300x300xf32>, tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("multiply2")
+
+                return %multiply2 : tensor<1x3x300x300xf32>
+            }
+        }
+    )";
+
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+
+    {
+        const size_t minOpsInBlock = 2;
+        const size_t maxNumIterations = 10;
+        const bool weightsAsInputs = false;
+        const bool separateFunctions = false;
+        const bool hashMatching = true;
+        FunctionOutlinerRepeatingBlocks splitter(minOpsInBlock, maxNumIterations, separateFunctions, weightsAsInputs,
+                                                 Logger::global(), hashMatching);
+        const auto functionInstances = splitter.getOutliningTargets(func);
+        ASSERT_EQ(functionInstances.size(), 2);
+
+        {
+            auto& function = functionInstances[0];
+            ASSERT_EQ(function.size(), 2) << "Expected two IR slices to be outlined into this function";
+            {
+                auto& irSlice = function[0];
+                ASSERT_EQ(irSlice.operations.size(), 3);
+                EXPECT_EQ(getName(irSlice.operations[0]), "maxpool1");
+                EXPECT_EQ(getName(irSlice.operations[1]), "avgpool1");
+                EXPECT_EQ(getName(irSlice.operations[2]), "avgpool2");
+
+                ASSERT_EQ(irSlice.inputs.size(), 1);
+                EXPECT_TRUE(mlir::isa<mlir::BlockArgument>(irSlice.inputs[0]));
+                ASSERT_EQ(irSlice.outputs.size(), 1);
+                EXPECT_EQ(getName(irSlice.outputs[0].getDefiningOp()), "avgpool2");
+            }
+            {
+                auto& irSlice = function[1];
+                ASSERT_EQ(irSlice.operations.size(), 3);
+                EXPECT_EQ(getName(irSlice.operations[0]), "maxpool2");
+                EXPECT_EQ(getName(irSlice.operations[1]), "avgpool3");
+                EXPECT_EQ(getName(irSlice.operations[2]), "avgpool4");
+
+                ASSERT_EQ(irSlice.inputs.size(), 1);
+                EXPECT_EQ(getName(irSlice.inputs[0].getDefiningOp()), "multiply1");
+                ASSERT_EQ(irSlice.outputs.size(), 1);
+                EXPECT_EQ(getName(irSlice.outputs[0].getDefiningOp()), "avgpool4");
+            }
+        }
+        {
+            auto& function = functionInstances[1];
+            ASSERT_EQ(function.size(), 2) << "Expected two IR slices to be outlined into this function";
+            {
+                auto& irSlice = function[0];
+                ASSERT_EQ(irSlice.operations.size(), 2);
+                EXPECT_EQ(getName(irSlice.operations[0]), "add1");
+                EXPECT_EQ(getName(irSlice.operations[1]), "multiply1");
+            }
+            {
+                auto& irSlice = function[1];
+                ASSERT_EQ(irSlice.operations.size(), 2);
+                EXPECT_EQ(getName(irSlice.operations[0]), "add2");
+                EXPECT_EQ(getName(irSlice.operations[1]), "multiply2");
+            }
+        }
+    }
+}
+
+/**
+ * Four identical layers, where the connections of the last one differ:
+ *
+ *  [input] -> MaxPool -> AvgPool -> Add(AvgPool, AvgPool) -> ... -> MaxPool -> AvgPool -> Add(MaxPool, AvgPool)
+ *
+ * Only the first three layers can be outlined with the same function
+ */
+TEST_F(MLIR_FunctionOutliningSplitterRepeating, RepeatingLayersHashMatching) {
+    auto registry = vpux::createDialectRegistry();
+
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<IE::IEDialect>();
+
+    constexpr StringLiteral inputIR = R"(
+        module @test {
+            func.func @main(%input: tensor<1x3x300x300xf32>) -> tensor<1x3x300x300xf32> {
+                %maxpool1 = IE.MaxPool(%input) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("maxpool1")
+                %avgpool1 = IE.AvgPool(%maxpool1) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("avgpool1")
+                %add1 = IE.Add(%avgpool1, %avgpool1) {
+                        auto_broadcast = #IE.auto_broadcast_type<NUMPY>
+                    } : tensor<1x3x300x300xf32>, tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("add1")
+
+                %maxpool2 = IE.MaxPool(%add1) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("maxpool2")
+                %avgpool2 = IE.AvgPool(%maxpool2) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("avgpool2")
+                %add2 = IE.Add(%avgpool2, %avgpool2) {
+                        auto_broadcast = #IE.auto_broadcast_type<NUMPY>
+                    } : tensor<1x3x300x300xf32>, tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("add2")
+
+                %maxpool3 = IE.MaxPool(%add2) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("maxpool3")
+                %avgpool3 = IE.AvgPool(%maxpool3) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("avgpool3")
+                %add3 = IE.Add(%avgpool3, %avgpool3) {
+                        auto_broadcast = #IE.auto_broadcast_type<NUMPY>
+                    } : tensor<1x3x300x300xf32>, tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("add3")
+
+                %maxpool4 = IE.MaxPool(%add3) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("maxpool4")
+                %avgpool4 = IE.AvgPool(%maxpool4) {
+                        kernel_size = [3, 3], pads_begin = [1, 1], pads_end = [1, 1], rounding_type = #IE.rounding_type<FLOOR>, strides = [1, 1]
+                    } : tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("avgpool4")
+                %add4 = IE.Add(%maxpool4, %avgpool4) {
+                        auto_broadcast = #IE.auto_broadcast_type<NUMPY>
+                    } : tensor<1x3x300x300xf32>, tensor<1x3x300x300xf32> -> tensor<1x3x300x300xf32> loc("add4")
+
+                return %add4 : tensor<1x3x300x300xf32>
+            }
+        }
+    )";
+
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+
+    {
+        const size_t minOpsInBlock = 3;
+        const size_t maxNumIterations = 10;
+        const bool weightsAsInputs = false;
+        const bool separateFunctions = false;
+        const bool hashMatching = true;
+        FunctionOutlinerRepeatingBlocks splitter(minOpsInBlock, maxNumIterations, separateFunctions, weightsAsInputs,
+                                                 Logger::global(), hashMatching);
+        const auto functionInstances = splitter.getOutliningTargets(func);
+        ASSERT_EQ(functionInstances.size(), 1);
+
+        auto& function = functionInstances[0];
+        ASSERT_EQ(function.size(), 3) << "Expected three IR slices to be outlined into this function";
+        for (const auto& [idx, irSlice] : function | indexed) {
+            const auto layer = std::to_string(idx + 1);
+            ASSERT_EQ(irSlice.operations.size(), 3);
+            EXPECT_EQ(getName(irSlice.operations[0]), "maxpool" + layer);
+            EXPECT_EQ(getName(irSlice.operations[1]), "avgpool" + layer);
+            EXPECT_EQ(getName(irSlice.operations[2]), "add" + layer);
+
+            ASSERT_EQ(irSlice.inputs.size(), 1);
+            ASSERT_EQ(irSlice.outputs.size(), 1);
+            EXPECT_EQ(getName(irSlice.outputs[0].getDefiningOp()), "add" + layer);
+        }
+        EXPECT_TRUE(mlir::isa<mlir::BlockArgument>(function[0].inputs[0]));
+        EXPECT_EQ(getName(function[1].inputs[0].getDefiningOp()), "add1");
+        EXPECT_EQ(getName(function[2].inputs[0].getDefiningOp()), "add2");
+    }
+}
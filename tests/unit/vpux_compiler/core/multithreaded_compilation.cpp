@@ -316,6 +316,102 @@ private:
     std::vector<std::string> _modelNames;
 };
 
+using CompilationParamsOutlined = std::tuple<size_t,  // number of compiler threads
+                                             size_t   // number of compilation iterations
+                                             >;
+
+// Compiles a model split into several functions, whose function passes run in parallel on the compiler threads.
+// The blob must not depend on the order in which the functions are processed, so every multithreaded compilation
+// is compared with a single-threaded one.
+class CompilationTestOutlined :
+        public testing::WithParamInterface<CompilationParamsOutlined>,
+        virtual public CompilationTestBase {
+public:
+    CompilationTestOutlined(): CompilationTestBase() {
+        _log.setName("CompilationTestOutlined");
+    }
+
+    static std::string getTestCaseName(const testing::TestParamInfo<CompilationParamsOutlined>& obj) {
+        size_t numThreads;
+        size_t numIterations;
+        std::tie(numThreads, numIterations) = obj.param;
+
+        std::ostringstream result;
+        result << "compilerThreads=" << numThreads << "_";
+        result << "iterations=" << numIterations;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        _numThreads = std::get<0>(GetParam());
+        _numIterations = std::get<1>(GetParam());
+
+        registerCommonOptions(*_options);
+        registerCompilerOptions(*_options);
+
+        _compiler = std::make_shared<CompilerImpl>();
+    }
+
+    void Run() {
+        const auto model = createRepeatingBlocksModel();
+        _config.update({{COMPILATION_MODE_PARAMS::key().data(), "function-outlining='naive=num-parts=4'"}});
+
+        const auto compileNetwork = [&](size_t numThreads) -> Checksum {
+            auto config = _config;
+            config.update({{COMPILATION_NUM_THREADS::key().data(), std::to_string(numThreads)}});
+            const auto netDesc = _compiler->compile(model, config);
+            return llvm::SHA256::hash(netDesc.compiledNetwork);
+        };
+
+        const auto referenceChecksum = compileNetwork(1);
+        for (auto i : irange(_numIterations)) {
+            _log.trace("Iteration {0} / {1} with {2} compiler threads", i + 1, _numIterations, _numThreads);
+            const auto checksum = compileNetwork(_numThreads);
+            ASSERT_EQ(checksum, referenceChecksum)
+                    << "Checksum for iteration " << i + 1 << " (" << stringifyChecksum(checksum)
+                    << ") different than single-threaded checksum (" << stringifyChecksum(referenceChecksum) << ")";
+        }
+    }
+
+private:
+    std::shared_ptr<ov::Model> createRepeatingBlocksModel() const {
+        static constexpr size_t NUM_BLOCKS = 8;
+
+        auto elementType = ov::element::f16;
+        auto input = std::make_shared<ov::op::v0::Parameter>(elementType, ov::Shape{1, 16, 32, 32});
+        input->set_layout("NCHW");
+        input->set_friendly_name("input");
+        input->output(0).get_tensor().set_names({"input"});
+
+        ov::Output<ov::Node> last = input;
+        for (auto blockIdx : irange(NUM_BLOCKS)) {
+            const auto suffix = "_" + std::to_string(blockIdx);
+
+            const auto convWeights = ov::op::v0::Constant::create(elementType, {16, 16, 3, 3},
+                                                                  std::vector<float>{1.f / (blockIdx + 1)});
+            const auto conv = std::make_shared<ov::op::v1::Convolution>(
+                    last, convWeights, /*strides=*/ov::Strides{1, 1}, /*padsBegin=*/ov::CoordinateDiff{1, 1},
+                    /*padsEnd=*/ov::CoordinateDiff{1, 1}, /*dilations=*/ov::Strides{1, 1});
+            convWeights->set_friendly_name("conv_weights" + suffix);
+            conv->set_friendly_name("conv" + suffix);
+
+            const auto add = std::make_shared<ov::op::v1::Add>(conv, last);
+            add->set_friendly_name("add" + suffix);
+            last = add;
+        }
+
+        auto output = std::make_shared<ov::op::v0::Result>(last);
+        output->set_friendly_name("output");
+        output->output(0).get_tensor().set_names({"output"});
+
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{output}, ov::ParameterVector{input});
+        model->set_friendly_name("model_repeating_blocks");
+
+        return model;
+    }
+};
+
 class CompilationTestIR : public testing::WithParamInterface<CompilationParamsIR>, virtual public CompilationTestBase {
 public:
     CompilationTestIR(): CompilationTestBase(), _modelPaths{} {
@@ -461,3 +557,14 @@ INSTANTIATE_TEST_SUITE_P(precommit_multithreaded_two_models, CompilationTestMode
                                             ::testing::Values(2)                          // num iterations per thread
                                             ),
                          CompilationTestModel::getTestCaseName);
+
+TEST_P(CompilationTestOutlined, NPU4000) {
+    SetPlatform("VPU4000");
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(precommit_outlined, CompilationTestOutlined,
+                         ::testing::Combine(::testing::ValuesIn(std::vector<size_t>{4, 8}),  // num compiler threads
+                                            ::testing::Values(3)                            // num iterations
+                                            ),
+                         CompilationTestOutlined::getTestCaseName);
@@ -0,0 +1,72 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/core/profile_guided_costs.hpp"
+
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+namespace {
+
+constexpr llvm::StringLiteral traceEventsReport = R"({"traceEvents":[
+{"name": "process_name", "ph": "M", "pid":0, "args": {"name" : "DMA"}},
+{"name":"conv?t_Convolution/_cluster_copy", "cat":"DMA", "ph":"X", "ts":0.000, "dur":0.500, "pid":0, "tid":0},
+{"name":"conv?t_Convolution/cluster_0", "cat":"DPU", "ph":"X", "ts":1.000, "dur":2.000, "pid":1, "tid":0},
+{"name":"conv?t_Convolution/cluster_1", "cat":"DPU", "ph":"X", "ts":1.000, "dur":3.000, "pid":1, "tid":1},
+{"name":"conv?t_Convolution/cluster_1/variant_0", "cat":"DPU", "ph":"X", "ts":1.000, "dur":1.000, "pid":1, "tid":2},
+{"name":"softmax?t_SoftMax/cluster_0/variant_0", "cat":"SW", "ph":"X", "ts":4.000, "dur":1.500, "pid":1, "tid":3},
+{"name":"softmax?t_SoftMax/tile_1/cluster_0", "cat":"SW", "ph":"X", "ts":4.000, "dur":0.500, "pid":1, "tid":4},
+{"name":"conv", "cat":"Layer", "ph":"X", "ts":0.000, "dur":4.000, "pid":2, "tid":0}
+],
+"displayTimeUnit": "ns"
+})";
+
+class ProfileGuidedCostsTests : public testing::Test {
+protected:
+    void SetUp() override {
+        int fd = -1;
+        ASSERT_FALSE(llvm::sys::fs::createTemporaryFile("profiling_report", "json", fd, _fileName));
+        llvm::raw_fd_ostream stream(fd, /*shouldClose=*/true);
+        stream << traceEventsReport;
+    }
+
+    void TearDown() override {
+        llvm::sys::fs::remove(_fileName);
+    }
+
+    SmallString<128> _fileName;
+};
+
+}  // namespace
+
+TEST_F(ProfileGuidedCostsTests, TaskDurations) {
+    const auto report = ProfilingReport::parse(_fileName);
+
+    // the slowest cluster defines the duration of the task
+    EXPECT_EQ(report.getTaskDurationNs("conv?t_Convolution"), 3000.0);
+    EXPECT_EQ(report.getTaskDurationNs("conv?t_Convolution/_cluster_copy"), 500.0);
+    // variants are used only when the task has no cluster-level entry
+    EXPECT_EQ(report.getTaskDurationNs("softmax?t_SoftMax"), 1500.0);
+    EXPECT_EQ(report.getTaskDurationNs("softmax?t_SoftMax/tile_1"), 500.0);
+    EXPECT_FALSE(report.getTaskDurationNs("conv").has_value());
+    EXPECT_EQ(report.getNumTasks(), 4u);
+}
+
+TEST_F(ProfileGuidedCostsTests, LayerDurations) {
+    const auto report = ProfilingReport::parse(_fileName);
+
+    // only compute tasks contribute to the layer duration
+    EXPECT_EQ(report.getLayerDurationNs("conv"), 3000.0);
+    EXPECT_EQ(report.getLayerDurationNs("softmax"), 2000.0);
+    EXPECT_FALSE(report.getLayerDurationNs("relu").has_value());
+}
+
+TEST(ProfileGuidedCostsConversionTests, NanoSecondsToCycles) {
+    EXPECT_DOUBLE_EQ(convertNanoSecondsToCycles(1000.0, 1700.0), 1700.0);
+}
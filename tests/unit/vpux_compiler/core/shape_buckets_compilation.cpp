@@ -0,0 +1,106 @@
+//
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "intel_npu/al/config/common.hpp"
+#include "intel_npu/al/config/compiler.hpp"
+#include "vpux/compiler/compiler.hpp"
+#include "vpux/compiler/utils/shape_buckets.hpp"
+
+#include <gtest/gtest.h>
+#include <openvino/openvino.hpp>
+#include <openvino/opsets/opset1.hpp>
+
+using namespace vpux;
+using namespace intel_npu;
+
+namespace {
+
+class ShapeBucketsCompilationTest : public testing::Test {
+public:
+    ShapeBucketsCompilationTest(): _options(std::make_shared<OptionsDesc>()), _config(_options) {
+    }
+
+protected:
+    void SetUp() override {
+        registerCommonOptions(*_options);
+        registerCompilerOptions(*_options);
+        _config.update({{PLATFORM::key().data(), "VPU4000"}});
+        _compiler = std::make_shared<CompilerImpl>();
+    }
+
+    NetworkDescription compile(const std::shared_ptr<const ov::Model>& model, const std::string& shapeBuckets) const {
+        auto config = _config;
+        config.update({{COMPILATION_MODE_PARAMS::key().data(), "shape-buckets=" + shapeBuckets}});
+        return _compiler->compile(model, config);
+    }
+
+    // Input with a dynamic height, bounded by [1, 64]
+    static std::shared_ptr<ov::Model> createDynamicModel() {
+        const auto elementType = ov::element::f16;
+        auto input = std::make_shared<ov::op::v0::Parameter>(
+                elementType, ov::PartialShape{1, 16, ov::Dimension(1, 64), 16});
+        input->set_friendly_name("input");
+        input->output(0).get_tensor().set_names({"input"});
+
+        const auto addConstant = ov::op::v0::Constant::create(elementType, {1, 16, 1, 1}, std::vector<float>{1.f});
+        const auto add = std::make_shared<ov::op::v1::Add>(input, addConstant);
+        addConstant->set_friendly_name("add_constant");
+        add->set_friendly_name("add");
+
+        auto output = std::make_shared<ov::op::v0::Result>(add);
+        output->set_friendly_name("output");
+        output->output(0).get_tensor().set_names({"output"});
+
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{output}, ov::ParameterVector{input});
+        model->set_friendly_name("model_dynamic_height");
+        return model;
+    }
+
+    std::shared_ptr<OptionsDesc> _options;
+    Config _config;
+    std::shared_ptr<CompilerImpl> _compiler;
+};
+
+}  // namespace
+
+TEST_F(ShapeBucketsCompilationTest, CompilesEveryBucket) {
+    const auto netDesc = compile(createDynamicModel(), "32,16");
+    const auto& blob = netDesc.compiledNetwork;
+    ASSERT_TRUE(isShapeBucketsBlob(blob));
+
+    const auto shapeBuckets = unpackShapeBuckets(blob);
+    ASSERT_EQ(shapeBuckets.buckets.size(), 2u);
+    EXPECT_EQ(shapeBuckets.buckets[0].dimSizes, SmallVector<int64_t>({16}));
+    EXPECT_EQ(shapeBuckets.buckets[1].dimSizes, SmallVector<int64_t>({32}));
+
+    // The primary specialization is a regular ELF at the beginning of the blob
+    const auto& primary = shapeBuckets.buckets.back().blob;
+    EXPECT_EQ(primary.data(), blob.data());
+    ASSERT_GE(primary.size(), 4u);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(primary.data()) + 1, 3), "ELF");
+
+    // Every specialization is described by the I/O of the dynamic model
+    const auto metadata = _compiler->parse(blob, _config);
+    EXPECT_EQ(metadata.inputs.size(), 1u);
+    EXPECT_EQ(metadata.outputs.size(), 1u);
+}
+
+TEST_F(ShapeBucketsCompilationTest, SkipsOutOfBoundsBuckets) {
+    const auto netDesc = compile(createDynamicModel(), "16,100");
+    const auto shapeBuckets = unpackShapeBuckets(netDesc.compiledNetwork);
+    ASSERT_EQ(shapeBuckets.buckets.size(), 1u);
+    EXPECT_EQ(shapeBuckets.buckets.back().dimSizes, SmallVector<int64_t>({16}));
+}
+
+TEST_F(ShapeBucketsCompilationTest, IgnoresStaticModels) {
+    auto model = createDynamicModel();
+    model->reshape(ov::PartialShape{1, 16, 16, 16});
+    const auto netDesc = compile(model, "16,32");
+    EXPECT_FALSE(isShapeBucketsBlob(netDesc.compiledNetwork));
+}
+
+TEST_F(ShapeBucketsCompilationTest, RejectsOutOfBoundsBuckets) {
+    EXPECT_ANY_THROW(compile(createDynamicModel(), "128"));
+}
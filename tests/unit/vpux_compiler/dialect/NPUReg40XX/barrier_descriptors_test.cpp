@@ -0,0 +1,96 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <npu_40xx_nnrt.hpp>
+
+#include "vpux/compiler/NPU40XX/dialect/NPUReg40XX/descriptors.hpp"
+
+#include <cstring>
+
+using namespace npu40xx;
+using namespace vpux::NPUReg40XX;
+
+namespace {
+
+template <class Reference, class Descriptor>
+bool isContentEqual(const Reference& reference, const Descriptor& actual) {
+    const auto actualStorage = actual.getStorage();
+    return actualStorage.size() == sizeof(reference) &&
+           std::memcmp(&reference, actualStorage.data(), sizeof(reference)) == 0;
+}
+
+}  // namespace
+
+TEST(NPUReg40XX_BarrierDescriptorsTest, VpuBarrierCountConfig) {
+    nn_public::VpuBarrierCountConfig reference;
+    std::memset(reinterpret_cast<void*>(&reference), 0, sizeof(reference));
+    reference.next_same_id_ = 0xFFFFFFFF;
+    reference.producer_count_ = 0x1234;
+    reference.consumer_count_ = 0xFFFF;
+    reference.real_id_ = 0x5A;
+
+    Descriptors::VpuBarrierCountConfig actual;
+    actual.write<Fields::next_same_id_>(0xFFFFFFFF);
+    actual.write<Fields::producer_count_>(0x1234);
+    actual.write<Fields::consumer_count_>(0xFFFF);
+    actual.write<Fields::real_id_>(0x5A);
+
+    ASSERT_EQ(actual.read<Fields::producer_count_>(), 0x1234u);
+    ASSERT_TRUE(isContentEqual(reference, actual));
+}
+
+TEST(NPUReg40XX_BarrierDescriptorsTest, VpuTaskBarrierMap) {
+    nn_public::VpuTaskBarrierMap reference;
+    std::memset(reinterpret_cast<void*>(&reference), 0, sizeof(reference));
+    reference.next_same_id = 0xFFFFFFFF;
+    reference.producer_count = 0x0F0F;
+    reference.consumer_count = 0xF0F0;
+    reference.real_id = 0x3C;
+    reference.work_item_idx = 0x12345678;
+    reference.enqueue_count = 0x9ABCDEF0;
+
+    Descriptors::vpuTaskBarrierMap actual;
+    actual.write<Fields::tb_next_same_id>(0xFFFFFFFF);
+    actual.write<Fields::tb_producer_count>(0x0F0F);
+    actual.write<Fields::tb_consumer_count>(0xF0F0);
+    actual.write<Fields::tb_real_id>(0x3C);
+    actual.write<Fields::tb_work_item_idx>(0x12345678);
+    actual.write<Fields::tb_enqueue_count>(0x9ABCDEF0);
+
+    ASSERT_EQ(actual.read<Fields::tb_work_item_idx>(), 0x12345678u);
+    ASSERT_TRUE(isContentEqual(reference, actual));
+}
+
+TEST(NPUReg40XX_BarrierDescriptorsTest, WorkItem) {
+    nn_public::VpuWorkItem reference;
+    std::memset(reinterpret_cast<void*>(&reference), 0, sizeof(reference));
+    reference.wi_desc_ptr = 0x0123456789ABCDEF;
+    reference.type = nn_public::VpuWorkItem::VpuTaskType::DMA;
+    reference.unit = 0x5;
+    reference.sub_unit = 0xA;
+
+    Descriptors::WorkItem actual;
+    actual.write<Fields::desc_ptr>(0x0123456789ABCDEF);
+    actual.write<Fields::wi_type>(static_cast<uint64_t>(nn_public::VpuWorkItem::VpuTaskType::DMA));
+    actual.write<Fields::wi_unit>(0x5);
+    actual.write<Fields::wi_sub_unit>(0xA);
+
+    ASSERT_EQ(actual.read<Fields::desc_ptr>(), 0x0123456789ABCDEFu);
+    ASSERT_TRUE(isContentEqual(reference, actual));
+}
+
+TEST(NPUReg40XX_BarrierDescriptorsTest, CompareByStorage) {
+    Descriptors::VpuBarrierCountConfig lhs;
+    Descriptors::VpuBarrierCountConfig rhs;
+    lhs.write<Fields::real_id_>(1);
+    rhs.write<Fields::real_id_>(1);
+    ASSERT_TRUE(lhs == rhs);
+    ASSERT_EQ(lhs.hash_value(), rhs.hash_value());
+
+    rhs.write<Fields::real_id_>(2);
+    ASSERT_FALSE(lhs == rhs);
+}
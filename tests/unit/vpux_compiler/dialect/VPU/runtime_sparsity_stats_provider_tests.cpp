@@ -10,6 +10,8 @@
 #include "vpux/compiler/dialect/VPU/transforms/passes.hpp"
 #include "vpux/compiler/dialect/VPU/utils/nce_sparsity.hpp"
 
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
 #include <mlir/IR/MLIRContext.h>
 #include <mlir/Parser/Parser.h>
 #include <mlir/Pass/PassManager.h>
@@ -128,3 +130,114 @@ TEST_F(MLIR_VPU_RT_SPARSITY_STATS_PROVIDER, WithStats) {
         ASSERT_TRUE(rtStatsProvider.likelySparsityConsumer(poolOp, 0));
     });
 }
+
+TEST_F(MLIR_VPU_RT_SPARSITY_STATS_PROVIDER, ProfitableConsumer) {
+    constexpr llvm::StringLiteral inputIR = R"(
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+!qElemType = !quant.uniform<u8:f16, 1.000000e+00>
+
+#loc0 = loc(unknown)
+    module @main {
+        func.func @main(%arg0: tensor<1x64x16x16xf16, {order = #NHWC}>, %arg1: tensor<1x64x16x16x!qElemType, {order = #NHWC}>) -> (tensor<1x64x16x16xf16, {order = #NHWC}>, tensor<1x64x16x16x!qElemType, {order = #NHWC}>, tensor<1x64x16x16xf16, {order = #NHWC}>) {
+        %0 = VPU.NCE.Eltwise(%arg0, %arg0) {
+                    op_type = #VPU.eltwise_type<ADD>,
+                    opaque_ppe = #VPU.PPEStub<>
+                } -> tensor<1x64x16x16xf16, {order = #NHWC}> loc(fused["Add_0", "t_Eltwise"])
+        %1 = VPU.NCE.Eltwise(%0, %0) {
+                    op_type = #VPU.eltwise_type<ADD>,
+                    opaque_ppe = #VPU.PPEStub<>
+                } -> tensor<1x64x16x16xf16, {order = #NHWC}> loc(fused["Add_1", "t_Eltwise"])
+        %2 = VPU.NCE.Eltwise(%arg1, %arg1) {
+                    op_type = #VPU.eltwise_type<ADD>,
+                    opaque_ppe = #VPU.PPEStub<>
+                } -> tensor<1x64x16x16x!qElemType, {order = #NHWC}> loc(fused["Add_2", "t_Eltwise"])
+        %3 = VPU.NCE.Eltwise(%2, %2) {
+                    op_type = #VPU.eltwise_type<ADD>,
+                    opaque_ppe = #VPU.PPEStub<>
+                } -> tensor<1x64x16x16x!qElemType, {order = #NHWC}> loc(fused["Add_3", "t_Eltwise"])
+
+        return %1, %3, %0 : tensor<1x64x16x16xf16, {order = #NHWC}>, tensor<1x64x16x16x!qElemType, {order = #NHWC}>, tensor<1x64x16x16xf16, {order = #NHWC}>
+    }
+    IE.SparsityStatistics sparsityInfo : {
+        IE.SparsityInfo 0.9 at input 0 of "Add_0" loc(#loc0)
+        IE.SparsityInfo 0.2 at input 0 of "Add_1" loc(#loc0)
+        IE.SparsityInfo 0.3 at input 1 of "Add_1" loc(#loc0)
+        IE.SparsityInfo 0.3 at input 0 of "Add_3" loc(#loc0)
+        IE.SparsityInfo 0.5 at input 1 of "Add_3" loc(#loc0)
+    }
+
+    }
+    )";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+
+    auto logger = vpux::Logger::global();
+    auto rtStatsProvider = VPU::NCESparsity::RuntimeSparsityStatsProvider(func, logger);
+
+    auto eltwiseOps = to_small_vector(func.getOps<VPU::NCEEltwiseOp>());
+    ASSERT_EQ(eltwiseOps.size(), 4u);
+
+    // A network input is not written sparse by an NCE producer, whatever its ratio
+    ASSERT_FALSE(rtStatsProvider.profitableSparsityConsumer(eltwiseOps[0], 0));
+    // 64 x f16 per storage element: the non-zero values rounded up to 16 bytes must save more than the 16 bytes of
+    // sparsity map traffic
+    ASSERT_FALSE(rtStatsProvider.profitableSparsityConsumer(eltwiseOps[1], 0));
+    ASSERT_TRUE(rtStatsProvider.profitableSparsityConsumer(eltwiseOps[1], 1));
+    // The same ratio pays off less for 8-bit data
+    ASSERT_FALSE(rtStatsProvider.profitableSparsityConsumer(eltwiseOps[3], 0));
+    ASSERT_TRUE(rtStatsProvider.profitableSparsityConsumer(eltwiseOps[3], 1));
+}
+
+TEST_F(MLIR_VPU_RT_SPARSITY_STATS_PROVIDER, StatsFile) {
+    constexpr llvm::StringLiteral inputIR = R"(
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+    module @main {
+        func.func @main(%arg0: tensor<1x16x16x16xf16, {order = #NHWC}>) -> tensor<1x16x16x16xf16, {order = #NHWC}> {
+        %1 = VPU.NCE.Eltwise(%arg0, %arg0) {
+                    op_type = #VPU.eltwise_type<ADD>,
+                    opaque_ppe = #VPU.PPEStub<>
+                } -> tensor<1x16x16x16xf16, {order = #NHWC}> loc(fused["Add_1", "t_Eltwise"])
+
+        return %1 : tensor<1x16x16x16xf16, {order = #NHWC}>
+    }
+    IE.SparsityStatistics sparsityInfo : {
+        IE.SparsityInfo 0.8 at input 0 of "Add_1" loc(#loc0)
+    }
+
+    }
+    )";
+    constexpr llvm::StringLiteral statsFile = R"({
+    "0": {"node_name": "Add_1", "port_id": 0, "statistic": 0.05},
+    "1": {"node_name": "Add_1", "port_id": 1, "statistic": 0.5}
+})";
+
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+
+    int fd = -1;
+    SmallString<128> fileName;
+    ASSERT_FALSE(llvm::sys::fs::createTemporaryFile("sparsity_stats", "json", fd, fileName));
+    {
+        llvm::raw_fd_ostream stream(fd, /*shouldClose=*/true);
+        stream << statsFile;
+    }
+
+    auto logger = vpux::Logger::global();
+    auto rtStatsProvider = VPU::NCESparsity::RuntimeSparsityStatsProvider(func, logger, fileName);
+    llvm::sys::fs::remove(fileName);
+
+    auto eltwiseOp = *func.getOps<VPU::NCEEltwiseOp>().begin();
+    // The calibration file has priority over the statistics of the module
+    ASSERT_EQ(rtStatsProvider.getSparsityRatio(eltwiseOp, 0), 0.05);
+    ASSERT_EQ(rtStatsProvider.getSparsityRatio(eltwiseOp, 1), 0.5);
+    ASSERT_FALSE(rtStatsProvider.likelySparsityConsumer(eltwiseOp, 0));
+    ASSERT_TRUE(rtStatsProvider.likelySparsityConsumer(eltwiseOp, 1));
+}
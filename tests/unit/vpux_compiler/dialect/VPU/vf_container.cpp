@@ -8,6 +8,7 @@
 #include "vpux/compiler/dialect/VPU/IR/types.hpp"
 #include "vpux/compiler/dialect/VPU/transforms/passes.hpp"
 #include "vpux/compiler/dialect/VPU/utils/vertical_fusion_pipeline_container.hpp"
+#include "vpux/compiler/dialect/VPU/utils/vertical_fusion_utils.hpp"
 
 #include "common/utils.hpp"
 
@@ -130,3 +131,62 @@ TEST_F(MLIR_VPU_VFPipelineContainer, VF_ContainerCost) {
 
     EXPECT_EQ(container.maxCost(layerCost), softMaxCost);
 }
+
+TEST_F(MLIR_VPU_VFPipelineContainer, VF_PipelinedCost) {
+    constexpr llvm::StringLiteral inputIR = R"(
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+    module @main {
+       func.func @main(%arg0: tensor<1x48x16x16xf16, {order = #NHWC}>) -> tensor<1x1024x16x16xf16, {order = #NHWC}> {
+            %cst = const.Declare tensor<1024x48x1x1xf16, {order = #NHWC}> = dense<1.0> : tensor<1024x48x1x1xf16>, [#const.Reorder<#NHWC>]
+            %cst_0 = const.Declare tensor<1024x1x1x4xsi32> = dense<1> : tensor<1024x1x1x4xsi32>
+
+            %0 = VPU.NCE.Convolution(%arg0, %cst, %cst_0)
+                {multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverHeight>,
+                opaque_ppe = #VPU.PPEStub<>,
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [1024, 48, 1, 1], strides = [1, 1]}
+                -> tensor<1x1024x16x16xf16, {order = #NHWC}>
+            %1 = VPU.SoftMax(%0)
+                {axisInd = 1 : i64, multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverHeight>} : tensor<1x1024x16x16xf16, {order = #NHWC}>
+                -> tensor<1x1024x16x16xf16, {order = #NHWC}>
+            return %1 : tensor<1x1024x16x16xf16, {order = #NHWC}>
+       }
+    }
+    )";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+
+    mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
+    auto initCompilerOptions = VPU::InitCompilerOptions(ArchKind::NPU40XX, VPU::CompilationMode::DefaultHW);
+
+    VPU::buildInitCompilerPipeline(pm, initCompilerOptions, vpux::Logger::global());
+
+    ASSERT_TRUE(mlir::succeeded(pm.run(module.get())));
+
+    SmallVector<mlir::Operation*> operations;
+    func->walk([&](VPU::NCEConvolutionOp conv) {
+        operations.push_back(conv.getOperation());
+    });
+    func->walk([&](VPU::SoftMaxOp softMax) {
+        operations.push_back(softMax.getOperation());
+    });
+    ASSERT_EQ(operations.size(), 2);
+
+    const auto layerCost = VPU::LayerVPUNNCost(func);
+    VPU::VPUNNCostParameters params(VPU::MultiClusterStrategy::Clustering);
+    const auto convCost = layerCost.getStrategyCost(operations[0], params);
+    const auto softMaxCost = layerCost.getStrategyCost(operations[1], params);
+
+    // 2 tiles of each operation: second conv tile runs together with first SoftMax tile
+    const SmallVector<SmallVector<VPU::VPUNNCostParameters>> tilesCostParams = {{params, params}, {params, params}};
+    EXPECT_EQ(VPU::getPipelinedCost(operations, tilesCostParams, layerCost),
+              convCost + std::max(convCost, softMaxCost) + softMaxCost);
+
+    const SmallVector<SmallVector<VPU::VPUNNCostParameters>> mismatchedCostParams = {{params, params}};
+    EXPECT_ANY_THROW(VPU::getPipelinedCost(operations, mismatchedCostParams, layerCost));
+}
@@ -0,0 +1,100 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPUIP/IR/dialect.hpp"
+#include "vpux/compiler/dialect/VPUIP/utils/dma_partitioning.hpp"
+#include "vpux/compiler/utils/types.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+using MLIR_DMAPartitioning = MLIR_UnitBase;
+
+namespace {
+
+NDTypeInterface getBufferType(mlir::MLIRContext* ctx, ArrayRef<int64_t> shape, VPU::MemoryKind memKind) {
+    return getMemRefType(ShapeRef(shape), mlir::Float16Type::get(ctx), DimsOrder::NCHW, memKind)
+            .cast<NDTypeInterface>();
+}
+
+}  // namespace
+
+TEST_F(MLIR_DMAPartitioning, TransferCycles) {
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<VPUIP::VPUIPDialect>();
+
+    const auto model = VPUIP::getDMATransferModel(VPU::ArchKind::NPU40XX, &ctx);
+    EXPECT_GT(model.descriptorCycles, 0);
+
+    const auto getCycles = [&](ArrayRef<int64_t> shape) {
+        return VPUIP::getDMATransferCycles(model, getBufferType(&ctx, shape, VPU::MemoryKind::DDR),
+                                           getBufferType(&ctx, shape, VPU::MemoryKind::CMX_NN));
+    };
+    const auto wholeCycles = getCycles({1, 48, 18, 56});
+    const auto halfCycles = getCycles({1, 24, 18, 56});
+    EXPECT_LT(model.descriptorCycles, halfCycles);
+    EXPECT_LT(halfCycles, wholeCycles);
+}
+
+TEST_F(MLIR_DMAPartitioning, SplitPoints) {
+    EXPECT_EQ(VPUIP::getDMASplitPoints(1), SmallVector<int64_t>());
+    EXPECT_EQ(VPUIP::getDMASplitPoints(2), SmallVector<int64_t>({1}));
+    EXPECT_EQ(VPUIP::getDMASplitPoints(5), SmallVector<int64_t>({2, 1, 3, 4}));
+    EXPECT_EQ(VPUIP::getDMASplitPoints(48), SmallVector<int64_t>({24, 6, 12, 18, 30, 36, 42}));
+}
+
+TEST_F(MLIR_DMAPartitioning, SplitOnIdlePorts) {
+    const auto partition = VPUIP::getDMAPartition(/*descriptorCycles=*/250, /*wholeSize=*/48, 1762,
+                                                  {{{24, 24}, {1006, 1006}}}, /*origPort=*/1, {0, 0});
+    ASSERT_TRUE(partition.isSplit());
+    EXPECT_EQ(partition.partSizes, SmallVector<int64_t>({24, 24}));
+    EXPECT_EQ(partition.partPorts, SmallVector<int64_t>({1, 0}));
+    EXPECT_EQ(partition.predictedCycles, 1006 + 250);
+}
+
+TEST_F(MLIR_DMAPartitioning, KeepSmallTransferWhole) {
+    // The split saves 40 cycles, less than the latency of the second descriptor
+    const auto partition = VPUIP::getDMAPartition(/*descriptorCycles=*/250, /*wholeSize=*/320, 330,
+                                                  {{{160, 160}, {290, 290}}}, /*origPort=*/0, {0, 0});
+    EXPECT_FALSE(partition.isSplit());
+    EXPECT_EQ(partition.partSizes, SmallVector<int64_t>({320}));
+    EXPECT_EQ(partition.partPorts, SmallVector<int64_t>({0}));
+    EXPECT_EQ(partition.partCycles, SmallVector<int64_t>({330}));
+    EXPECT_EQ(partition.predictedCycles, 330);
+}
+
+TEST_F(MLIR_DMAPartitioning, KeepWholeWhenOtherPortIsBusy) {
+    const auto partition = VPUIP::getDMAPartition(/*descriptorCycles=*/250, /*wholeSize=*/48, 1762,
+                                                  {{{24, 24}, {1006, 1006}}}, /*origPort=*/0, {0, 11774});
+    EXPECT_FALSE(partition.isSplit());
+    EXPECT_EQ(partition.predictedCycles, 1762);
+}
+
+TEST_F(MLIR_DMAPartitioning, LargerPartGoesToIdlePort) {
+    const auto partition = VPUIP::getDMAPartition(/*descriptorCycles=*/250, /*wholeSize=*/5, 6650,
+                                                  {{{2, 3}, {2810, 4090}}}, /*origPort=*/0, {0, 1000});
+    ASSERT_TRUE(partition.isSplit());
+    EXPECT_EQ(partition.partSizes, SmallVector<int64_t>({2, 3}));
+    EXPECT_EQ(partition.partPorts, SmallVector<int64_t>({1, 0}));
+    EXPECT_EQ(partition.partCycles, SmallVector<int64_t>({2810, 4090}));
+    EXPECT_EQ(partition.predictedCycles, 4090 + 250);
+}
+
+TEST_F(MLIR_DMAPartitioning, UnevenSplitBalancesBusyPort) {
+    // Port 1 is busy for 2000 cycles: the even split finishes at 2000 + 1250, a quarter of the transfer on port 1
+    // finishes at 2000 + 750 while the remaining three quarters take 2250 cycles on port 0
+    const auto partition = VPUIP::getDMAPartition(/*descriptorCycles=*/250, /*wholeSize=*/48, 4250,
+                                                  {{{24, 24}, {1250, 1250}}, {{12, 36}, {750, 2250}}},
+                                                  /*origPort=*/0, {0, 2000});
+    ASSERT_TRUE(partition.isSplit());
+    EXPECT_EQ(partition.partSizes, SmallVector<int64_t>({12, 36}));
+    EXPECT_EQ(partition.partPorts, SmallVector<int64_t>({1, 0}));
+    EXPECT_EQ(partition.predictedCycles, 2750 + 250);
+}
@@ -0,0 +1,74 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/frontend/IE.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/IR/BuiltinOps.h>
+#include <mlir/Support/Timing.h>
+
+#include <openvino/opsets/opset1.hpp>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace vpux;
+
+namespace {
+
+// Chain of Add layers, each one with its own constant, so that the constants are converted concurrently
+std::shared_ptr<ov::Model> buildModel(size_t numConstants) {
+    const ov::Shape shape{1, 16, 8, 8};
+    auto param = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+    param->set_friendly_name("input");
+
+    std::shared_ptr<ov::Node> last = param;
+    for (size_t i = 0; i < numConstants; ++i) {
+        std::vector<float> values(ov::shape_size(shape));
+        std::iota(values.begin(), values.end(), static_cast<float>(i));
+        auto constant = std::make_shared<ov::opset1::Constant>(ov::element::f32, shape, values);
+        constant->set_friendly_name("constant_" + std::to_string(i));
+        last = std::make_shared<ov::opset1::Add>(last, constant);
+        last->set_friendly_name("add_" + std::to_string(i));
+    }
+
+    auto result = std::make_shared<ov::opset1::Result>(last);
+    result->set_friendly_name("output");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "PrefetchConstants");
+}
+
+std::string importModel(mlir::MLIRContext& ctx, bool prefetchConstants) {
+    const auto model = buildModel(/*numConstants=*/16);
+    const auto parameters = IE::buildOVParams(model);
+    const auto results = IE::buildOVResults(model);
+
+    mlir::DefaultTimingManager tm;
+    auto rootTiming = tm.getRootScope();
+    auto module = IE::importNetwork(&ctx, model, parameters, results, /*sharedConstants=*/false, prefetchConstants,
+                                    rootTiming, /*enableProfiling=*/false, DummyOpMode::DISABLED,
+                                    /*dynamicShapeToStatic=*/false, VPU::ArchKind::NPU37XX);
+    EXPECT_TRUE(module.get() != nullptr);
+
+    std::string ir;
+    llvm::raw_string_ostream stream(ir);
+    module->print(stream, mlir::OpPrintingFlags().enableDebugInfo());
+    return ir;
+}
+
+}  // namespace
+
+using MLIR_IE_PrefetchConstants = MLIR_UnitBase;
+
+TEST_F(MLIR_IE_PrefetchConstants, SameIRWithAndWithoutPrefetch) {
+    mlir::MLIRContext ctx(registry);
+    ASSERT_TRUE(ctx.isMultithreadingEnabled());
+
+    const auto referenceIR = importModel(ctx, /*prefetchConstants=*/false);
+    const auto prefetchedIR = importModel(ctx, /*prefetchConstants=*/true);
+
+    EXPECT_EQ(referenceIR, prefetchedIR);
+}
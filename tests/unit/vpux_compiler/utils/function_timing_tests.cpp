@@ -0,0 +1,52 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/function_timing.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/Dialect/Func/IR/FuncOps.h>
+#include <mlir/Parser/Parser.h>
+#include <mlir/Transforms/Passes.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+using MLIR_FunctionTiming = MLIR_UnitBase;
+
+TEST_F(MLIR_FunctionTiming, ReportIsEmitted) {
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<mlir::func::FuncDialect>();
+
+    constexpr llvm::StringLiteral inputIR = R"(
+    module @main {
+        func.func @foo(%arg0: tensor<1x8xf16>) -> tensor<1x8xf16> {
+            return %arg0 : tensor<1x8xf16>
+        }
+        func.func @bar(%arg0: tensor<1x8xf16>) -> tensor<1x8xf16> {
+            %0 = call @foo(%arg0) : (tensor<1x8xf16>) -> tensor<1x8xf16>
+            return %0 : tensor<1x8xf16>
+        }
+    }
+    )";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    testing::internal::CaptureStdout();
+    {
+        mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
+        pm.addNestedPass<mlir::func::FuncOp>(mlir::createCanonicalizerPass());
+        addFunctionTiming(pm, Logger("function-timing-test", LogLevel::Info));
+
+        ASSERT_TRUE(mlir::succeeded(pm.run(module.get())));
+    }
+    llvm::outs().flush();
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(output.find("Function passes ran on 2 functions"), std::string::npos) << output;
+    EXPECT_NE(output.find("'foo'"), std::string::npos) << output;
+    EXPECT_NE(output.find("'bar'"), std::string::npos) << output;
+}
@@ -0,0 +1,66 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "vpux/compiler/utils/ELF/predicted_performance.hpp"
+
+#include <cstring>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+// Size of VpuPerformanceMetrics, the structure consumed by the firmware at the beginning of the section
+constexpr size_t FIRMWARE_METRICS_SIZE = 320;
+
+std::vector<uint8_t> makeSection(const std::optional<PredictedPerformance>& predicted) {
+    std::vector<uint8_t> section(FIRMWARE_METRICS_SIZE, 0xAB);
+    if (predicted.has_value()) {
+        const auto recordPtr = reinterpret_cast<const uint8_t*>(&predicted.value());
+        section.insert(section.end(), recordPtr, recordPtr + sizeof(PredictedPerformance));
+    }
+    return section;
+}
+
+}  // namespace
+
+TEST(MLIR_PredictedPerformance, RoundTrip) {
+    PredictedPerformance written;
+    written.latencyCycles = 123456;
+    written.dmaBusyCycles = 1000;
+    written.dpuBusyCycles = 2000;
+    written.shaveBusyCycles = 3000;
+    written.frequencyMHz = 1850.0;
+
+    const auto section = makeSection(written);
+    const auto read = readPredictedPerformance(section);
+    ASSERT_TRUE(read.has_value());
+    EXPECT_EQ(read->magic, PredictedPerformance::MAGIC);
+    EXPECT_EQ(read->version, PredictedPerformance::VERSION);
+    EXPECT_EQ(read->latencyCycles, written.latencyCycles);
+    EXPECT_EQ(read->dmaBusyCycles, written.dmaBusyCycles);
+    EXPECT_EQ(read->dpuBusyCycles, written.dpuBusyCycles);
+    EXPECT_EQ(read->shaveBusyCycles, written.shaveBusyCycles);
+    EXPECT_EQ(read->frequencyMHz, written.frequencyMHz);
+}
+
+TEST(MLIR_PredictedPerformance, SectionWithoutRecord) {
+    // Blobs compiled before the record was introduced or without the inference simulation
+    const auto section = makeSection(std::nullopt);
+    EXPECT_FALSE(readPredictedPerformance(section).has_value());
+
+    EXPECT_FALSE(readPredictedPerformance(ArrayRef<uint8_t>()).has_value());
+}
+
+TEST(MLIR_PredictedPerformance, UnknownVersion) {
+    PredictedPerformance written;
+    written.version = PredictedPerformance::VERSION + 1;
+    written.latencyCycles = 100;
+
+    const auto section = makeSection(written);
+    EXPECT_FALSE(readPredictedPerformance(section).has_value());
+}
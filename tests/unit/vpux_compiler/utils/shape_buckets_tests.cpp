@@ -0,0 +1,118 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "vpux/compiler/utils/shape_buckets.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <cstring>
+#include <limits>
+
+using namespace vpux;
+
+TEST(MLIR_ShapeBuckets, ParseBucketSizes) {
+    const auto sizes = parseShapeBucketSizes("512, 128,256,128");
+    EXPECT_EQ(sizes, SmallVector<SmallVector<int64_t>>({{128}, {256}, {512}}));
+
+    const auto perDimSizes = parseShapeBucketSizes("256x64,128x128, 128x64");
+    EXPECT_EQ(perDimSizes, SmallVector<SmallVector<int64_t>>({{128, 64}, {128, 128}, {256, 64}}));
+
+    EXPECT_TRUE(parseShapeBucketSizes("").empty());
+    EXPECT_ANY_THROW(parseShapeBucketSizes("128,abc"));
+    EXPECT_ANY_THROW(parseShapeBucketSizes("0,128"));
+    EXPECT_ANY_THROW(parseShapeBucketSizes("128x"));
+    EXPECT_ANY_THROW(parseShapeBucketSizes("128x64,256"));
+}
+
+TEST(MLIR_ShapeBuckets, PackUnpack) {
+    const std::vector<uint8_t> blob128(100, 1);
+    const std::vector<uint8_t> blob256(37, 2);
+    const std::vector<uint8_t> blob512(200, 3);
+    const std::vector<uint8_t> weights(150, 4);
+    ShapeBuckets shapeBuckets;
+    shapeBuckets.buckets = {
+            {{128, 64}, blob128},
+            {{256, 64}, blob256},
+            {{256, 512}, blob512},
+    };
+    shapeBuckets.sharedWeights = weights;
+
+    const auto container = packShapeBuckets(shapeBuckets);
+    ASSERT_TRUE(isShapeBucketsBlob(container));
+
+    const auto unpacked = unpackShapeBuckets(container);
+    EXPECT_EQ(unpacked.sharedWeights, ArrayRef<uint8_t>(weights));
+    const auto weightsOffset = static_cast<uint64_t>(unpacked.sharedWeights.data() - container.data());
+    EXPECT_EQ(weightsOffset % SHAPE_BUCKETS_BLOB_ALIGNMENT, 0);
+
+    const auto& buckets = unpacked.buckets;
+    ASSERT_EQ(buckets.size(), shapeBuckets.buckets.size());
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        EXPECT_EQ(buckets[i].dimSizes, shapeBuckets.buckets[i].dimSizes);
+        EXPECT_EQ(buckets[i].blob, shapeBuckets.buckets[i].blob);
+        const auto offset = static_cast<uint64_t>(buckets[i].blob.data() - container.data());
+        EXPECT_EQ(offset % SHAPE_BUCKETS_BLOB_ALIGNMENT, 0);
+    }
+    // The primary specialization starts the container, so the runtime can load it as a plain ELF
+    EXPECT_EQ(buckets.back().blob.data(), container.data());
+
+    EXPECT_EQ(findShapeBucket(buckets, {1, 1}), 0);
+    EXPECT_EQ(findShapeBucket(buckets, {128, 64}), 0);
+    EXPECT_EQ(findShapeBucket(buckets, {129, 64}), 1);
+    EXPECT_EQ(findShapeBucket(buckets, {100, 65}), 2);
+    EXPECT_EQ(findShapeBucket(buckets, {257, 1}), std::nullopt);
+    EXPECT_ANY_THROW(findShapeBucket(buckets, {1}));
+}
+
+TEST(MLIR_ShapeBuckets, InvalidContainer) {
+    const std::vector<uint8_t> blob(64, 1);
+    EXPECT_FALSE(isShapeBucketsBlob(blob));
+    EXPECT_ANY_THROW(unpackShapeBuckets(blob));
+
+    ShapeBuckets mismatchedDims;
+    mismatchedDims.buckets = {
+            {{128}, blob},
+            {{128, 64}, blob},
+    };
+    EXPECT_ANY_THROW(packShapeBuckets(mismatchedDims));
+
+    EXPECT_ANY_THROW(packShapeBuckets(ShapeBuckets{}));
+
+    ShapeBuckets single;
+    single.buckets = {{{128}, blob}};
+    auto truncated = packShapeBuckets(single);
+    truncated.resize(truncated.size() - 1);
+    EXPECT_ANY_THROW(unpackShapeBuckets(truncated));
+}
+
+TEST(MLIR_ShapeBuckets, PrimaryServesAllBuckets) {
+    const std::vector<uint8_t> blob(64, 1);
+    ShapeBuckets shapeBuckets;
+    shapeBuckets.buckets = {
+            {{128, 128}, blob},
+            {{256, 64}, blob},
+    };
+    EXPECT_ANY_THROW(packShapeBuckets(shapeBuckets));
+}
+
+TEST(MLIR_ShapeBuckets, CorruptedNumDynamicDims) {
+    const std::vector<uint8_t> blob(64, 1);
+    ShapeBuckets shapeBuckets;
+    shapeBuckets.buckets = {{{128}, blob}, {{256}, blob}};
+    auto container = packShapeBuckets(shapeBuckets);
+    ASSERT_NO_THROW(unpackShapeBuckets(container));
+
+    ShapeBucketsFooter footer;
+    std::memcpy(&footer, container.data() + container.size() - sizeof(footer), sizeof(footer));
+    ShapeBucketsHeader header;
+    std::memcpy(&header, container.data() + footer.headerOffset, sizeof(header));
+
+    // The size of the dimensions table would overflow 64 bits
+    header.numDynamicDims = std::numeric_limits<uint64_t>::max() / sizeof(int64_t) + 2;
+    std::memcpy(container.data() + footer.headerOffset, &header, sizeof(header));
+    EXPECT_ANY_THROW(unpackShapeBuckets(container));
+}
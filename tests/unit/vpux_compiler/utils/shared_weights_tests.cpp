@@ -0,0 +1,60 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "vpux/compiler/utils/ELF/shared_weights.hpp"
+
+#include <cstring>
+
+using namespace vpux;
+
+namespace {
+
+std::map<uint64_t, SharedWeightsEntry> readEntries(ArrayRef<uint8_t> blob) {
+    SharedWeightsBlobHeader header;
+    std::memcpy(&header, blob.data(), sizeof(header));
+    EXPECT_EQ(header.magic, SharedWeightsBlobHeader::MAGIC);
+
+    std::vector<SharedWeightsEntry> entries(header.entryCount);
+    std::memcpy(entries.data(), blob.data() + sizeof(header), entries.size() * sizeof(SharedWeightsEntry));
+
+    std::map<uint64_t, SharedWeightsEntry> entriesByHash;
+    for (const auto& entry : entries) {
+        EXPECT_EQ(entry.offset % SHARED_WEIGHTS_ALIGNMENT, 0);
+        entriesByHash.emplace(entry.hash, entry);
+    }
+    return entriesByHash;
+}
+
+}  // namespace
+
+TEST(MLIR_SharedWeights, MergeKeepsEachContentOnce) {
+    const std::vector<char> common(100, 1);
+    const std::vector<char> first(30, 2);
+    const std::vector<char> second(70, 3);
+    const auto commonHash = getSharedWeightsHash(common);
+    const auto firstHash = getSharedWeightsHash(first);
+    const auto secondHash = getSharedWeightsHash(second);
+
+    const auto firstBlob = packSharedWeights({{commonHash, common}, {firstHash, first}});
+    const auto secondBlob = packSharedWeights({{commonHash, common}, {secondHash, second}});
+    const auto merged = mergeSharedWeights({firstBlob, secondBlob});
+
+    const auto entries = readEntries(merged);
+    ASSERT_EQ(entries.size(), 3);
+    for (const auto& [hash, content] : {std::make_pair(commonHash, common), std::make_pair(firstHash, first),
+                                        std::make_pair(secondHash, second)}) {
+        ASSERT_EQ(entries.count(hash), 1);
+        const auto& entry = entries.at(hash);
+        ASSERT_EQ(entry.size, content.size());
+        EXPECT_EQ(std::memcmp(merged.data() + entry.offset, content.data(), content.size()), 0);
+    }
+}
+
+TEST(MLIR_SharedWeights, MergeRejectsInvalidBlob) {
+    const std::vector<uint8_t> invalid(64, 0);
+    EXPECT_ANY_THROW(mergeSharedWeights({invalid}));
+}
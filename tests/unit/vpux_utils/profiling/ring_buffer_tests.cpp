@@ -0,0 +1,223 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/profiling/parser/stream.hpp"
+#include "vpux/utils/profiling/metadata.hpp"
+
+#include "schema/profiling_generated.h"
+
+#include <gtest/gtest.h>
+
+using namespace vpux::profiling;
+
+namespace {
+
+constexpr size_t PROF_SIZE = 64;
+
+std::vector<uint8_t> makeProfOutput(uint8_t fill) {
+    return std::vector<uint8_t>(PROF_SIZE, fill);
+}
+
+// Metadata without tasks, so every record decodes to an empty list
+flatbuffers::DetachedBuffer buildMetadata() {
+    flatbuffers::FlatBufferBuilder builder;
+
+    const auto sectionsOffset = builder.CreateVector(std::vector<flatbuffers::Offset<ProfilingFB::ProfilingSection>>{});
+    const auto profilingBufferOffset =
+            ProfilingFB::CreateProfilingBuffer(builder, sectionsOffset, static_cast<uint32_t>(PROF_SIZE));
+    const auto platformOffset = ProfilingFB::CreatePlatform(builder, static_cast<int8_t>(TargetDevice_VPUX40XX));
+
+    const auto metadataOffset =
+            ProfilingFB::CreateProfilingMeta(builder, PROFILING_METADATA_VERSION_MAJOR,
+                                             PROFILING_METADATA_VERSION_MINOR, platformOffset, profilingBufferOffset);
+    builder.Finish(metadataOffset);
+    return builder.Release();
+}
+
+}  // namespace
+
+TEST(ProfilingRingBuffer, KeepsLastRecords) {
+    ProfilingRingBuffer ring(/*capacity=*/3, PROF_SIZE);
+    EXPECT_EQ(ring.data().size(), 3 * (sizeof(RingRecordHeader) + PROF_SIZE));
+    EXPECT_TRUE(ring.read().empty());
+
+    for (uint8_t inference = 0; inference < 5; ++inference) {
+        const auto output = makeProfOutput(inference);
+        EXPECT_EQ(ring.push(output.data(), output.size()), static_cast<uint64_t>(inference));
+    }
+    EXPECT_EQ(ring.size(), 3u);
+    EXPECT_EQ(ring.oldestSequence(), 2u);
+    EXPECT_EQ(ring.nextSequence(), 5u);
+
+    RingRecordReader reader(PROF_SIZE);
+    const auto stream = ring.read();
+    const auto records = reader.feed(stream.data(), stream.size());
+    ASSERT_EQ(records.size(), 3u);
+    for (size_t idx = 0; idx < records.size(); ++idx) {
+        const auto& record = records[idx];
+        EXPECT_EQ(record.header.sequence, static_cast<uint64_t>(idx + 2));
+        EXPECT_EQ(record.payload, makeProfOutput(static_cast<uint8_t>(idx + 2)));
+        // Records 3 and 4 took the slots of records 0 and 1
+        const uint32_t expectedFlags =
+                record.header.sequence >= 3 ? RING_RECORD_FLAG_WRAPAROUND : RING_RECORD_FLAG_NONE;
+        EXPECT_EQ(record.header.flags, expectedFlags);
+    }
+    EXPECT_EQ(reader.pendingBytes(), 0u);
+}
+
+TEST(ProfilingRingBuffer, ReadFromSequence) {
+    ProfilingRingBuffer ring(/*capacity=*/4, PROF_SIZE);
+    for (uint8_t inference = 0; inference < 6; ++inference) {
+        const auto output = makeProfOutput(inference);
+        ring.push(output.data(), output.size());
+    }
+
+    RingRecordReader reader(PROF_SIZE);
+    const auto stream = ring.read(/*fromSequence=*/4);
+    const auto records = reader.feed(stream.data(), stream.size());
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].header.sequence, 4u);
+    EXPECT_EQ(records[1].header.sequence, 5u);
+
+    // Records 0 and 1 are already overwritten, reading starts from the oldest kept one
+    const auto fullStream = ring.read(/*fromSequence=*/0);
+    EXPECT_EQ(fullStream.size(), 4 * (sizeof(RingRecordHeader) + PROF_SIZE));
+    EXPECT_TRUE(ring.read(/*fromSequence=*/6).empty());
+}
+
+TEST(ProfilingRingBuffer, ReaderConsumesPartialChunks) {
+    ProfilingRingBuffer ring(/*capacity=*/2, PROF_SIZE);
+    for (uint8_t inference = 0; inference < 2; ++inference) {
+        const auto output = makeProfOutput(inference);
+        ring.push(output.data(), output.size());
+    }
+    const auto stream = ring.read();
+
+    // Split the stream in the middle of the first header and in the middle of the second payload
+    RingRecordReader reader(PROF_SIZE);
+    const size_t firstSplit = sizeof(RingRecordHeader) / 2;
+    const size_t secondSplit = 2 * sizeof(RingRecordHeader) + PROF_SIZE + PROF_SIZE / 2;
+
+    EXPECT_TRUE(reader.feed(stream.data(), firstSplit).empty());
+    EXPECT_EQ(reader.pendingBytes(), firstSplit);
+
+    auto records = reader.feed(stream.data() + firstSplit, secondSplit - firstSplit);
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].header.sequence, 0u);
+    EXPECT_EQ(reader.pendingBytes(), sizeof(RingRecordHeader) + PROF_SIZE / 2);
+
+    records = reader.feed(stream.data() + secondSplit, stream.size() - secondSplit);
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].header.sequence, 1u);
+    EXPECT_EQ(records[0].payload, makeProfOutput(1));
+    EXPECT_EQ(reader.pendingBytes(), 0u);
+}
+
+TEST(ProfilingRingBuffer, RejectsMismatchedOutput) {
+    ProfilingRingBuffer ring(/*capacity=*/1, PROF_SIZE);
+    const auto output = makeProfOutput(0);
+    EXPECT_ANY_THROW(ring.push(output.data(), PROF_SIZE / 2));
+}
+
+TEST(ProfilingRingBuffer, ReaderResyncsAfterCorruptedRecord) {
+    ProfilingRingBuffer ring(/*capacity=*/3, PROF_SIZE);
+    for (uint8_t inference = 0; inference < 3; ++inference) {
+        const auto output = makeProfOutput(inference);
+        ring.push(output.data(), output.size());
+    }
+    auto stream = ring.read();
+    const auto recordSize = sizeof(RingRecordHeader) + PROF_SIZE;
+    // Break the magic of the second record, the records around it are still delivered
+    stream[recordSize] ^= 0xFF;
+
+    // Split the stream right after the broken magic so the resync spans two calls
+    RingRecordReader reader(PROF_SIZE);
+    const size_t split = recordSize + sizeof(uint32_t);
+    auto records = reader.feed(stream.data(), split);
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].header.sequence, 0u);
+
+    records = reader.feed(stream.data() + split, stream.size() - split);
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].header.sequence, 2u);
+    EXPECT_EQ(records[0].payload, makeProfOutput(2));
+    EXPECT_EQ(reader.skippedBytes(), recordSize);
+    EXPECT_EQ(reader.pendingBytes(), 0u);
+}
+
+TEST(ProfilingRingBuffer, ReaderSkipsMismatchedRecords) {
+    ProfilingRingBuffer ring(/*capacity=*/1, PROF_SIZE);
+    const auto output = makeProfOutput(0);
+    ring.push(output.data(), output.size());
+
+    RingRecordReader reader(PROF_SIZE * 2);
+    const auto stream = ring.read();
+    EXPECT_TRUE(reader.feed(stream.data(), stream.size()).empty());
+    EXPECT_GT(reader.skippedBytes(), 0u);
+    EXPECT_LT(reader.pendingBytes(), sizeof(RingRecordHeader));
+}
+
+TEST(ProfilingStreamDecoder, CountsLostRecords) {
+    const auto metadata = buildMetadata();
+    const auto profilingMeta = flatbuffers::GetRoot<ProfilingFB::ProfilingMeta>(metadata.data());
+    ProfilingStreamDecoder decoder(profilingMeta);
+    EXPECT_EQ(decoder.getProfSize(), PROF_SIZE);
+
+    ProfilingRingBuffer ring(/*capacity=*/2, PROF_SIZE);
+    for (uint8_t inference = 0; inference < 2; ++inference) {
+        const auto output = makeProfOutput(inference);
+        ring.push(output.data(), output.size());
+    }
+    auto stream = ring.read();
+    auto infos = decoder.feed(stream.data(), stream.size());
+    ASSERT_EQ(infos.size(), 2u);
+    EXPECT_EQ(infos[0].sequence, 0u);
+    EXPECT_EQ(infos[1].sequence, 1u);
+    EXPECT_EQ(infos[1].lostRecords, 0u);
+    EXPECT_FALSE(infos[1].wrapped);
+    EXPECT_TRUE(infos[1].tasks.empty());
+
+    // Records 2 and 3 are overwritten before the stream is read again
+    for (uint8_t inference = 2; inference < 5; ++inference) {
+        const auto output = makeProfOutput(inference);
+        ring.push(output.data(), output.size());
+    }
+    stream = ring.read(/*fromSequence=*/2);
+    infos = decoder.feed(stream.data(), stream.size());
+    ASSERT_EQ(infos.size(), 2u);
+    EXPECT_EQ(infos[0].sequence, 3u);
+    EXPECT_EQ(infos[0].lostRecords, 1u);
+    EXPECT_TRUE(infos[0].wrapped);
+    EXPECT_EQ(infos[1].sequence, 4u);
+    EXPECT_EQ(infos[1].lostRecords, 0u);
+}
+
+TEST(ProfilingStreamDecoder, KeepsRecordsAfterFailure) {
+    const auto metadata = buildMetadata();
+    ProfilingStreamDecoder decoder(flatbuffers::GetRoot<ProfilingFB::ProfilingMeta>(metadata.data()));
+
+    ProfilingRingBuffer ring(/*capacity=*/3, PROF_SIZE);
+    for (uint8_t inference = 0; inference < 3; ++inference) {
+        const auto output = makeProfOutput(inference);
+        ring.push(output.data(), output.size());
+    }
+    const auto recordSize = sizeof(RingRecordHeader) + PROF_SIZE;
+    const auto stream = ring.read();
+
+    // Record 0 replayed after record 1 breaks the sequence, record 2 is kept for the next call
+    std::vector<uint8_t> replayed(stream.begin() + recordSize, stream.begin() + 2 * recordSize);
+    replayed.insert(replayed.end(), stream.begin(), stream.begin() + recordSize);
+    replayed.insert(replayed.end(), stream.begin() + 2 * recordSize, stream.end());
+
+    EXPECT_ANY_THROW(decoder.feed(replayed.data(), replayed.size()));
+    EXPECT_EQ(decoder.pendingRecords(), 2u);
+
+    const auto infos = decoder.feed(nullptr, 0);
+    ASSERT_EQ(infos.size(), 2u);
+    EXPECT_EQ(infos[0].sequence, 1u);
+    EXPECT_EQ(infos[1].sequence, 2u);
+    EXPECT_EQ(infos[1].lostRecords, 0u);
+    EXPECT_EQ(decoder.pendingRecords(), 0u);
+}
@@ -0,0 +1,79 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/profiling/metadata.hpp"
+#include "vpux/utils/profiling/parser/parser.hpp"
+
+#include "schema/profiling_generated.h"
+
+#include <gtest/gtest.h>
+
+using namespace vpux::profiling;
+
+namespace {
+
+constexpr uint32_t PROF_SIZE = 64;
+
+struct EngineCoverage {
+    ExecutorType type;
+    uint32_t totalTasks;
+    uint32_t profiledTasks;
+};
+
+// Metadata without tasks, only the coverage is filled the same way as the compiler does
+flatbuffers::DetachedBuffer buildMetadata(const std::vector<EngineCoverage>& coverage) {
+    flatbuffers::FlatBufferBuilder builder;
+
+    std::vector<flatbuffers::Offset<ProfilingFB::TaskCoverage>> coverageOffsets;
+    for (const auto& engineCoverage : coverage) {
+        coverageOffsets.push_back(ProfilingFB::CreateTaskCoverage(builder, static_cast<uint32_t>(engineCoverage.type),
+                                                                  engineCoverage.totalTasks,
+                                                                  engineCoverage.profiledTasks));
+    }
+    const auto coverageOffset = builder.CreateVector(coverageOffsets);
+    const auto sectionsOffset = builder.CreateVector(std::vector<flatbuffers::Offset<ProfilingFB::ProfilingSection>>{});
+    const auto profilingBufferOffset = ProfilingFB::CreateProfilingBuffer(builder, sectionsOffset, PROF_SIZE);
+    const auto platformOffset = ProfilingFB::CreatePlatform(builder, static_cast<int8_t>(TargetDevice_VPUX40XX));
+
+    const auto metadataOffset = ProfilingFB::CreateProfilingMeta(
+            builder, PROFILING_METADATA_VERSION_MAJOR, PROFILING_METADATA_VERSION_MINOR, platformOffset,
+            profilingBufferOffset, /*dmaTasks=*/0, /*dpuTasks=*/0, /*swTasks=*/0, /*m2iTasks=*/0, coverageOffset);
+    builder.Finish(metadataOffset);
+    return builder.Release();
+}
+
+RawData parse(const flatbuffers::DetachedBuffer& metadata) {
+    const std::vector<uint8_t> profOutput(PROF_SIZE, 0);
+    const auto profilingMeta = flatbuffers::GetRoot<ProfilingFB::ProfilingMeta>(metadata.data());
+    return getRawProfilingTasks(profilingMeta, profOutput.data(), profOutput.size());
+}
+
+}  // namespace
+
+TEST(ProfilingTaskCoverage, RoundTrip) {
+    const auto metadata = buildMetadata({{ExecutorType::DMA_HW, 10, 4}, {ExecutorType::DPU, 7, 7}});
+    const auto rawData = parse(metadata);
+
+    ASSERT_EQ(rawData.coverage.size(), 2u);
+    const auto& dmaCoverage = rawData.coverage.at(ExecutorType::DMA_HW);
+    EXPECT_EQ(dmaCoverage.totalTasks, 10u);
+    EXPECT_EQ(dmaCoverage.profiledTasks, 4u);
+    const auto& dpuCoverage = rawData.coverage.at(ExecutorType::DPU);
+    EXPECT_EQ(dpuCoverage.totalTasks, 7u);
+    EXPECT_EQ(dpuCoverage.profiledTasks, 7u);
+}
+
+TEST(ProfilingTaskCoverage, EmptyWithoutCoverage) {
+    const auto metadata = buildMetadata({});
+    const auto rawData = parse(metadata);
+
+    EXPECT_TRUE(rawData.coverage.empty());
+}
+
+TEST(ProfilingTaskCoverage, RejectMoreProfiledThanTotal) {
+    const auto metadata = buildMetadata({{ExecutorType::DPU, 3, 4}});
+
+    EXPECT_ANY_THROW(parse(metadata));
+}
@@ -210,6 +210,21 @@ mlir::LogicalResult exportELF(mlir::ModuleOp module, llvm::raw_ostream& output)
     return mlir::success();
 }
 
+//
+// export-ELF-shared-weights
+//
+
+mlir::LogicalResult exportELFSharedWeights(mlir::ModuleOp module, llvm::raw_ostream& output) {
+    auto arch = VPU::getArch(module.getOperation());
+    VPUX_THROW_UNLESS(arch == VPU::ArchKind::NPU40XX, "Shared weights are not supported for ARCH {0}",
+                      VPU::stringifyArchKind(arch));
+
+    const auto buf = ELF::exportSharedWeights(module);
+    output.write(reinterpret_cast<const char*>(buf.data()), buf.size());
+
+    return mlir::success();
+}
+
 //
 // export-LLVMIR
 //
@@ -276,6 +291,9 @@ int main(int argc, char* argv[]) {
 
         mlir::TranslateFromMLIRRegistration("export-ELF", "Translate ELF dialect to blob", exportELF,
                                             dialectRegistration);
+        mlir::TranslateFromMLIRRegistration("export-ELF-shared-weights",
+                                            "Translate constants of ELF dialect to shared weights blob",
+                                            exportELFSharedWeights, dialectRegistration);
         mlir::TranslateFromMLIRRegistration("export-LLVMIR", "Translate LLVMIR dialect to blob", exportLLVMIR,
                                             dialectRegistration);
 